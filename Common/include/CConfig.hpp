@@ -404,6 +404,8 @@ private:
   unsigned long InnerIter;          /*!< \brief Current inner iterations for multizone problems. */
   unsigned long TimeIter;           /*!< \brief Current time iterations for multizone problems. */
   long Unst_AdjointIter;            /*!< \brief Iteration number to begin the reverse time integration in the direct solver for the unsteady adjoint. */
+  unsigned short Unst_AdjointCheckpoints; /*!< \brief Number of primal states kept in memory by the unsteady adjoint. */
+  bool Unst_AdjointCheckpointCompression; /*!< \brief Compress the primal states kept in memory by the unsteady adjoint. */
   long Iter_Avg_Objective;          /*!< \brief Iteration the number of time steps to be averaged, counting from the back */
   su2double PhysicalTime;           /*!< \brief Physical time at the current iteration in the solver for unsteady problems. */
 
@@ -421,6 +423,9 @@ private:
   bool NewtonKrylov;           /*!< \brief Use a coupled Newton method to solve the flow equations. */
   array<unsigned short,3> NK_IntParam{{20, 3, 2}}; /*!< \brief Integer parameters for NK method. */
   array<su2double,4> NK_DblParam{{-2.0, 0.1, -3.0, 1e-4}}; /*!< \brief Floating-point parameters for NK method. */
+  bool NK_FrozenCoeff;         /*!< \brief Freeze limiters and dissipation coefficients in the NK finite difference products. */
+  bool FrozenCoeff = false;    /*!< \brief Limiters and dissipation coefficients are currently frozen. */
+  bool NK_EdgeProducts;        /*!< \brief NK products with the flux Jacobians of the vectorized edge numerics. */
 
   unsigned short nMGLevels;    /*!< \brief Number of multigrid levels (coarse levels). */
   unsigned short nCFL;         /*!< \brief Number of CFL, one for each multigrid level. */
@@ -452,6 +457,8 @@ private:
   string *TagFFDBox;                  /*!< \brief Tag of the FFD box. */
   unsigned short GeometryMode;        /*!< \brief Gemoetry mode (analysis or gradient computation). */
   unsigned short MGCycle;             /*!< \brief Kind of multigrid cycle. */
+  bool MG_Turb;                       /*!< \brief Multigrid (FAS) for the turbulence equations. */
+  bool MG_PartitionAgglomeration;     /*!< \brief Agglomerate coarse multigrid levels across partition interfaces. */
   unsigned short FinestMesh;          /*!< \brief Finest mesh for the full multigrid approach. */
   unsigned short nFFD_Fix_IDir,
   nFFD_Fix_JDir, nFFD_Fix_KDir;       /*!< \brief Number of planes fixed in the FFD. */
@@ -466,6 +473,9 @@ private:
   su2double *LocationStations;        /*!< \brief Airfoil sections in wing slicing subroutine. */
 
   ENUM_MULTIZONE Kind_MZSolver;    /*!< \brief Kind of multizone solver.  */
+  bool Concurrent_Zones;           /*!< \brief Compute each zone on its own subset of the ranks. */
+  unsigned short nZone_Cost;       /*!< \brief Number of values of ZONE_COST. */
+  su2double *Zone_Cost;            /*!< \brief Relative cost of each zone. */
   INC_DENSITYMODEL Kind_DensityModel; /*!< \brief Kind of the density model for incompressible flows. */
   CHT_COUPLING Kind_CHT_Coupling;  /*!< \brief Kind of coupling method used at CHT interfaces. */
   VISCOSITYMODEL Kind_ViscosityModel; /*!< \brief Kind of the Viscosity Model*/
@@ -560,6 +570,7 @@ private:
   Kind_ActDisk, Kind_Engine_Inflow,
   *Kind_Data_Riemann,
   *Kind_Data_Giles;                /*!< \brief Kind of inlet boundary treatment. */
+  WALL_DISTANCE_METHOD Kind_WallDistance;  /*!< \brief Method to compute the wall distance. */
   INLET_TYPE Kind_Inlet;
   INLET_TYPE *Kind_Inc_Inlet;
   INC_OUTLET_TYPE *Kind_Inc_Outlet;
@@ -578,6 +589,9 @@ private:
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
+  unsigned short Linear_Solver_AMG_Levels;       /*!< \brief Maximum number of levels of the AMG preconditioner. */
+  unsigned short Linear_Solver_AMG_Sweeps;       /*!< \brief Pre and post smoothing sweeps of the AMG preconditioner. */
+  su2double Linear_Solver_AMG_Strength;          /*!< \brief Strength of connection threshold for AMG aggregation. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Adjoint;  /*!< \brief Relaxation coefficient for variable updates of adjoint solvers. */
@@ -717,6 +731,7 @@ private:
   su2double *nBlades;                 /*!< \brief number of blades for turbomachinery computation. */
   unsigned short Geo_Description;     /*!< \brief Description of the geometry. */
   unsigned short Mesh_FileFormat;     /*!< \brief Mesh input format. */
+  unsigned short Mesh_Out_FileFormat; /*!< \brief Mesh output format. */
   unsigned short Tab_FileFormat;      /*!< \brief Format of the output files. */
   unsigned short output_precision;    /*!< \brief <ofstream>.precision(value) for SU2_DOT and HISTORY output */
   unsigned short ActDisk_Jump;        /*!< \brief Format of the output files. */
@@ -724,6 +739,7 @@ private:
   unsigned short nCFL_AdaptParam;     /*!< \brief Number of CFL parameters provided in config. */
   bool CFL_Adapt;        /*!< \brief Use adaptive CFL number. */
   bool HB_Precondition;  /*!< \brief Flag to turn on harmonic balance source term preconditioning */
+  unsigned short nHB_InstanceGroups; /*!< \brief Number of groups of ranks among which the harmonic balance instances are split. */
   su2double RefArea,     /*!< \brief Reference area for coefficient computation. */
   RefElemLength,         /*!< \brief Reference element length for computing the slope limiting epsilon. */
   RefSharpEdges,         /*!< \brief Reference coefficient for detecting sharp edges. */
@@ -962,6 +978,8 @@ private:
   bool RadialBasisFunction_PolynomialOption; /*!< \brief Option of whether to include polynomial terms in Radial Basis Function Interpolation or not. */
   su2double RadialBasisFunction_Parameter;   /*!< \brief Radial basis function parameter (radius). */
   su2double RadialBasisFunction_PruneTol;    /*!< \brief Tolerance to prune the RBF interpolation matrix. */
+  bool RadialBasisFunction_Sparse;           /*!< \brief Use local sparse RBF systems instead of the dense matrix. */
+  su2double RadialBasisFunction_PatchFactor; /*!< \brief Radius of the sparse RBF donor patches relative to the RBF radius. */
   bool Prestretch;                           /*!< \brief Read a reference geometry for optimization purposes. */
   string Prestretch_FEMFileName;             /*!< \brief File name for reference geometry. */
   string FEA_FileName;              /*!< \brief File name for element-based properties. */
@@ -1007,6 +1025,7 @@ private:
 
   su2double *FreeStreamTurboNormal;     /*!< \brief Direction to initialize the flow in turbomachinery computation */
   su2double Restart_Bandwidth_Agg;      /*!< \brief The aggregate of the bandwidth for writing binary restarts (to be averaged later). */
+  su2double Mesh_Read_Bandwidth;        /*!< \brief The aggregate bandwidth for reading the mesh. */
   su2double Max_Vel2;                   /*!< \brief The maximum velocity^2 in the domain for the incompressible preconditioner. */
   bool topology_optimization;           /*!< \brief If the structural solver should consider a variable density field to penalize element stiffness. */
   string top_optim_output_file;         /*!< \brief File to where the derivatives w.r.t. element densities will be written to. */
@@ -1091,6 +1110,9 @@ private:
   unsigned long VolumeWrtFreq;        /*!< \brief Writing frequency for solution files. */
   unsigned short* VolumeOutputFiles;  /*!< \brief File formats to output */
   unsigned short nVolumeOutputFiles;  /*!< \brief Number of File formats to output */
+  unsigned short AsyncRestartBuffers;  /*!< \brief Number of binary restarts that can be written asynchronously. */
+  RESTART_COMPRESSION Restart_Compression; /*!< \brief Compression of the binary restart files. */
+  su2double Restart_Compression_Tol;  /*!< \brief Relative error bound of the lossy compression of restart files. */
 
   bool Multizone_Mesh;            /*!< \brief Determines if the mesh contains multiple zones. */
   bool SinglezoneDriver;          /*!< \brief Determines if the single-zone driver is used. (TEMPORARY) */
@@ -1117,6 +1139,7 @@ private:
   string caseName;                 /*!< \brief Name of the current case */
 
   unsigned long edgeColorGroupSize; /*!< \brief Size of the edge groups colored for OpenMP parallelization of edge loops. */
+  bool overlapHaloComms;            /*!< \brief Overlap the halo exchange with the interior edges of FVM solvers. */
 
   INLET_SPANWISE_INTERP Kind_InletInterpolationFunction; /*!brief type of spanwise interpolation function to use for the inlet face. */
   INLET_INTERP_TYPE Kind_Inlet_InterpolationType;    /*!brief type of spanwise interpolation data to use for the inlet face. */
@@ -2627,6 +2650,18 @@ public:
    */
   unsigned short GetMGCycle(void) const { return MGCycle; }
 
+  /*!
+   * \brief Get whether the turbulence equations are also solved with the multigrid cycle.
+   * \return <code>TRUE</code> if the turbulence solver uses the FAS multigrid of the mean flow.
+   */
+  bool GetMG_Turb(void) const { return MG_Turb; }
+
+  /*!
+   * \brief Get whether the coarse multigrid control volumes can contain points of neighbor partitions.
+   * \return <code>TRUE</code> if the agglomeration crosses the partition interfaces.
+   */
+  bool GetMG_PartitionAgglomeration(void) const { return MG_PartitionAgglomeration; }
+
   /*!
    * \brief Get the king of evaluation in the geometrical module.
    * \return 0 or 1 depending of we are dealing with a V or W cycle.
@@ -2943,6 +2978,16 @@ public:
    */
   long GetUnst_AdjointIter(void) const { return Unst_AdjointIter; }
 
+  /*!
+   * \brief Get the number of primal states kept in memory by the unsteady adjoint.
+   */
+  unsigned short GetUnst_AdjointCheckpoints(void) const { return Unst_AdjointCheckpoints; }
+
+  /*!
+   * \brief Get whether the primal states kept in memory by the unsteady adjoint are compressed.
+   */
+  bool GetUnst_AdjointCheckpointCompression(void) const { return Unst_AdjointCheckpointCompression; }
+
   /*!
    * \brief Number of iterations to average (reverse time integration).
    * \return Starting direct iteration number for the unsteady adjoint.
@@ -3599,6 +3644,22 @@ public:
    */
   ENUM_MULTIZONE GetKind_MZSolver(void) const { return Kind_MZSolver; }
 
+  /*!
+   * \brief Whether each zone is computed by its own subset of the ranks.
+   */
+  bool GetConcurrent_Zones(void) const { return Concurrent_Zones; }
+
+  /*!
+   * \brief Number of zone costs specified (0 if equal costs).
+   */
+  unsigned short GetnZone_Cost(void) const { return nZone_Cost; }
+
+  /*!
+   * \brief Relative cost of a zone, used to distribute the ranks among concurrent zones.
+   * \param[in] val_iZone - Index of the zone.
+   */
+  su2double GetZone_Cost(unsigned short val_iZone) const { return Zone_Cost[val_iZone]; }
+
   /*!
    * \brief Governing equations of the flow (it can be different from the run time equation).
    * \param[in] val_zone - Zone where the soler is applied.
@@ -3956,6 +4017,24 @@ public:
    */
   unsigned short GetLinear_Solver_ILU_n(void) const { return Linear_Solver_ILU_n; }
 
+  /*!
+   * \brief Get the maximum number of levels of the AMG preconditioner.
+   * \return Number of levels, including the finest.
+   */
+  unsigned short GetLinear_Solver_AMG_Levels(void) const { return Linear_Solver_AMG_Levels; }
+
+  /*!
+   * \brief Get the number of pre and post smoothing sweeps of the AMG preconditioner.
+   * \return Number of sweeps.
+   */
+  unsigned short GetLinear_Solver_AMG_Sweeps(void) const { return Linear_Solver_AMG_Sweeps; }
+
+  /*!
+   * \brief Get the strength of connection threshold used to form the AMG aggregates.
+   * \return Threshold.
+   */
+  su2double GetLinear_Solver_AMG_Strength(void) const { return Linear_Solver_AMG_Strength; }
+
   /*!
    * \brief Get restart frequency of the linear solver for the implicit formulation.
    * \return Restart frequency of the linear solver for the implicit formulation.
@@ -4004,6 +4083,30 @@ public:
    */
   array<su2double,4> GetNewtonKrylovDblParam(void) const { return NK_DblParam; }
 
+  /*!
+   * \brief Get whether the limiters and artificial dissipation coefficients are frozen in the NK products.
+   * \note The products remain finite differences of the residual, only these coefficients are not perturbed.
+   */
+  bool GetNewtonKrylovFrozenCoeff(void) const { return NK_FrozenCoeff; }
+
+  /*!
+   * \brief Get whether the NK products apply the flux Jacobians of the vectorized edge numerics to the
+   *        Krylov directions, instead of finite differencing the residual.
+   */
+  bool GetNewtonKrylovEdgeProducts(void) const { return NK_EdgeProducts; }
+
+  /*!
+   * \brief Get whether the flow solvers should keep the current limiters and artificial dissipation
+   *        coefficients (sensors and spectral radii) instead of recomputing them in the preprocessing.
+   */
+  bool GetFrozenCoeff(void) const { return FrozenCoeff; }
+
+  /*!
+   * \brief Set whether the limiters and artificial dissipation coefficients are frozen.
+   * \param[in] frozen - <code>TRUE</code> to keep the current values.
+   */
+  void SetFrozenCoeff(bool frozen) { FrozenCoeff = frozen; }
+
   /*!
    * \brief Get the relaxation coefficient of the linear solver for the implicit formulation.
    * \return relaxation coefficient of the linear solver for the implicit formulation.
@@ -4170,6 +4273,12 @@ public:
    */
   unsigned short GetKind_Trans_Model(void) const { return Kind_Trans_Model; }
 
+  /*!
+   * \brief Get the method used to compute the wall distance.
+   * \return Kind of wall distance computation.
+   */
+  WALL_DISTANCE_METHOD GetKind_WallDistance(void) const { return Kind_WallDistance; }
+
   /*!
    * \brief Get the kind of the subgrid scale model.
    * \return Kind of the subgrid scale model.
@@ -5178,6 +5287,12 @@ public:
    */
   unsigned short GetMesh_FileFormat(void) const { return Mesh_FileFormat; }
 
+  /*!
+   * \brief Get the format of the output grid (when converting or deforming).
+   * \return Format of the output grid.
+   */
+  unsigned short GetMesh_Out_FileFormat(void) const { return Mesh_Out_FileFormat; }
+
   /*!
    * \brief Get the format of the output solution.
    * \return Format of the output solution.
@@ -5683,6 +5798,12 @@ public:
    */
   bool GetHB_Precondition(void) const { return HB_Precondition; }
 
+  /*!
+   * \brief Get the number of groups of ranks among which the harmonic balance instances are split.
+   * \return Number of instance groups (1 if all the ranks compute all the instances).
+   */
+  unsigned short GetnHB_InstanceGroups(void) const { return nHB_InstanceGroups; }
+
   /*!
    * \brief Get if we should update the motion origin.
    * \param[in] val_marker - Value of the marker in which we are interested.
@@ -8726,6 +8847,16 @@ public:
    */
   su2double GetRadialBasisFunctionPruneTol(void) const { return RadialBasisFunction_PruneTol; }
 
+  /*!
+   * \brief Get option of whether to use local sparse systems for RBF interpolation (compact kernels).
+   */
+  bool GetRadialBasisFunctionSparse(void) const { return RadialBasisFunction_Sparse; }
+
+  /*!
+   * \brief Get the radius of the donor patches (relative to the RBF radius) used in sparse RBF interpolation.
+   */
+  su2double GetRadialBasisFunctionPatchFactor(void) const { return RadialBasisFunction_PatchFactor; }
+
   /*!
    * \brief Get the number of donor points to use in Nearest Neighbor interpolation.
    */
@@ -8811,6 +8942,18 @@ public:
    */
   su2double GetRestart_Bandwidth_Agg(void) const { return Restart_Bandwidth_Agg; }
 
+  /*!
+   * \brief Set the aggregate bandwidth for reading the mesh (0 if not measured by the reader).
+   * \param[in] val_bandwidth - Bandwidth in MB/s.
+   */
+  void SetMesh_Read_Bandwidth(su2double val_bandwidth) { Mesh_Read_Bandwidth = val_bandwidth; }
+
+  /*!
+   * \brief Get the aggregate bandwidth for reading the mesh.
+   * \return Bandwidth in MB/s.
+   */
+  su2double GetMesh_Read_Bandwidth(void) const { return Mesh_Read_Bandwidth; }
+
   /*!
    * \brief Get the Kind of Hybrid RANS/LES.
    * \return Value of Hybrid RANS/LES method.
@@ -9227,6 +9370,23 @@ public:
    */
   unsigned short GetnVolumeOutputFiles() const { return nVolumeOutputFiles; }
 
+  /*!
+   * \brief Get the number of binary restart files that can be written asynchronously (staging buffers).
+   * \note Only the writing of binary restart files is asynchronous, sorting and other formats are not.
+   * \return 0 if the files are written synchronously.
+   */
+  unsigned short GetAsync_Restart_Buffers() const { return AsyncRestartBuffers; }
+
+  /*!
+   * \brief Get the compression of the binary restart files.
+   */
+  RESTART_COMPRESSION GetRestart_Compression() const { return Restart_Compression; }
+
+  /*!
+   * \brief Get the relative error bound of the fields that are compressed with loss.
+   */
+  su2double GetRestart_Compression_Tol() const { return Restart_Compression_Tol; }
+
   /*!
    * \brief Get the desired factorization frequency for PaStiX
    * \return Number of calls to 'Build' that trigger re-factorization.
@@ -9269,6 +9429,11 @@ public:
    */
   unsigned long GetEdgeColoringGroupSize(void) const { return edgeColorGroupSize; }
 
+  /*!
+   * \brief Get whether the halo exchange of reconstruction gradients and limiters overlaps with interior edge loops.
+   */
+  bool GetOverlapHaloComms(void) const { return overlapHaloComms; }
+
   /*!
    * \brief Get the ParMETIS load balancing tolerance.
    */
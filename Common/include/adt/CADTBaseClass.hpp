@@ -29,13 +29,23 @@
 
 #include <vector>
 #include <array>
+#include <utility>
+#include <algorithm>
 
 #include "../basic_types/datatype_structure.hpp"
 #include "./CADTNodeClass.hpp"
 #include "../parallelization/omp_structure.hpp"
+#include "../parallelization/mpi_structure.hpp"
 
 using namespace std;
 
+/*!
+ * \brief Sets of points (nDim contiguous coordinates per point) at which an ADT will be searched.
+ * \note Used to build "pruned" global trees, which only contain the data of the ranks that
+ *       may hold the nearest entity to any of these points (see DeterminePrunedCommPattern).
+ */
+using ADTSearchPoints = vector<pair<const su2double*, unsigned long> >;
+
 /*!
  * \class CADTBaseClass
  * \brief  Base class for storing an ADT in an arbitrary number of dimensions.
@@ -81,6 +91,85 @@ protected:
                 unsigned long   nPoints,
                 const su2double *coor);
 
+#ifdef HAVE_MPI
+  /*!
+   * \brief Function, which determines the communication pattern of a pruned global tree.
+   *        The bounding boxes of the local points of all ranks are made available on all
+   *        ranks. The distance from a search point to the nearest entity is bounded by the
+   *        maximum distance to any of the boxes, therefore only the ranks whose box is closer
+   *        (minimum distance) than that bound can contain the nearest entity.
+   * \param[in]  nDim      Number of spatial dimensions.
+   * \param[in]  nLocal    Number of local points (that define the entities of this rank).
+   * \param[in]  coor      Coordinates of the local points.
+   * \param[in]  searchPts Points at which the tree will be searched on this rank.
+   * \param[out] recvRanks Ranks whose data is needed by this rank (ascending, may include this rank).
+   * \param[out] sendRanks Ranks that need the data of this rank (ascending, may include this rank).
+   */
+  static void DeterminePrunedCommPattern(unsigned short         nDim,
+                                         unsigned long          nLocal,
+                                         const su2double        *coor,
+                                         const ADTSearchPoints  &searchPts,
+                                         vector<int>            &recvRanks,
+                                         vector<int>            &sendRanks);
+
+  /*!
+   * \brief Sparse version of Allgatherv, the local data is sent to the ranks in sendRanks
+   *        and the data from the ranks in recvRanks is concatenated in the order of recvRanks.
+   * \param[in]  sendBuf    Local data.
+   * \param[in]  nSend      Size of the local data.
+   * \param[in]  datatype   MPI type of the data.
+   * \param[in]  sendRanks  Ranks to which the local data is sent.
+   * \param[in]  recvRanks  Ranks from which data is received.
+   * \param[out] recvBuf    Received data.
+   * \param[out] recvDispls Position in recvBuf of the data of each rank in recvRanks (size + 1).
+   */
+  template<class T>
+  static void SparseAllgatherv(const T                *sendBuf,
+                               unsigned long          nSend,
+                               SU2_MPI::Datatype      datatype,
+                               const vector<int>      &sendRanks,
+                               const vector<int>      &recvRanks,
+                               vector<T>              &recvBuf,
+                               vector<unsigned long>  &recvDispls) {
+    const int rank = SU2_MPI::GetRank();
+    const auto nRecv = recvRanks.size();
+
+    /*--- Exchange the sizes. ---*/
+    vector<unsigned long> recvSizes(nRecv, 0);
+    vector<SU2_MPI::Request> requests(sendRanks.size() + nRecv);
+    int nRequests = 0;
+
+    for (const auto dest : sendRanks) {
+      if (dest == rank) continue;
+      SU2_MPI::Isend(&nSend, 1, MPI_UNSIGNED_LONG, dest, 0, SU2_MPI::GetComm(), &requests[nRequests++]);
+    }
+    for (auto i = 0ul; i < nRecv; ++i) {
+      if (recvRanks[i] == rank) recvSizes[i] = nSend;
+      else SU2_MPI::Irecv(&recvSizes[i], 1, MPI_UNSIGNED_LONG, recvRanks[i], 0, SU2_MPI::GetComm(), &requests[nRequests++]);
+    }
+    SU2_MPI::Waitall(nRequests, requests.data(), MPI_STATUSES_IGNORE);
+
+    recvDispls.resize(nRecv+1);
+    recvDispls[0] = 0;
+    for (auto i = 0ul; i < nRecv; ++i) recvDispls[i+1] = recvDispls[i] + recvSizes[i];
+    recvBuf.resize(recvDispls.back());
+
+    /*--- Exchange the data, the local data is copied. ---*/
+    nRequests = 0;
+    for (const auto dest : sendRanks) {
+      if (dest == rank || nSend == 0) continue;
+      SU2_MPI::Isend(sendBuf, nSend, datatype, dest, 1, SU2_MPI::GetComm(), &requests[nRequests++]);
+    }
+    for (auto i = 0ul; i < nRecv; ++i) {
+      if (recvRanks[i] == rank) copy(sendBuf, sendBuf+nSend, recvBuf.begin()+recvDispls[i]);
+      else if (recvSizes[i] > 0)
+        SU2_MPI::Irecv(recvBuf.data()+recvDispls[i], recvSizes[i], datatype, recvRanks[i], 1,
+                       SU2_MPI::GetComm(), &requests[nRequests++]);
+    }
+    SU2_MPI::Waitall(nRequests, requests.data(), MPI_STATUSES_IGNORE);
+  }
+#endif
+
 public:
 
   /*!
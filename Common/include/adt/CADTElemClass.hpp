@@ -87,6 +87,27 @@ public:
                 vector<unsigned long>  &val_elemID,
                 const bool             globalTree);
 
+  /*!
+   * \brief Constructor of a pruned global tree, which only contains the elements of the ranks that
+   *        may hold the nearest element to any of the search points of this rank. The nearest element
+   *        searches for those points give the same result as with a global tree, without replicating
+   *        all the elements on all ranks.
+   * \param[in] val_nDim     Number of spatial dimensions of the problem.
+   * \param[in] val_coor     Coordinates of the local points to be stored in the ADT.
+   * \param[in] val_connElem Local connectivity of the elements to be stored in the ADT.
+   * \param[in] val_VTKElem  Type of the elements using the VTK convention.
+   * \param[in] val_markerID Markers of the local elements.
+   * \param[in] val_elemID   Local element IDs of the elements.
+   * \param[in] searchPoints Points of this rank for which the nearest element will be searched.
+   */
+  CADTElemClass(unsigned short         val_nDim,
+                vector<su2double>      &val_coor,
+                vector<unsigned long>  &val_connElem,
+                vector<unsigned short> &val_VTKElem,
+                vector<unsigned short> &val_markerID,
+                vector<unsigned long>  &val_elemID,
+                const ADTSearchPoints  &searchPoints);
+
   /*!
    * \brief Function, which determines the element that contains the given coordinate.
    * \note This simply forwards the call to the implementation function selecting the right
@@ -133,6 +154,12 @@ public:
   }
 
 private:
+  /*!
+   * \brief Function, which builds the ADT of the bounding boxes of the elements
+   *        once the element data (of the local or global tree) is available.
+   */
+  void BuildElemADT();
+
   /*!
    * \brief Implementation of DetermineContainingElement.
    * \note Working variables (first two) passed explicitly for thread safety.
@@ -57,6 +57,21 @@ public:
                       const unsigned long *pointID,
                       const bool     globalTree);
 
+  /*!
+   * \brief Constructor of a pruned global tree, which only contains the points of the ranks that
+   *        may hold the nearest point to any of the search points of this rank (see CADTElemClass).
+   * \param[in] nDim         Number of spatial dimensions of the problem.
+   * \param[in] nPoints      Number of local points to be stored in the ADT.
+   * \param[in] coor         Coordinates of the local points.
+   * \param[in] pointID      Local point IDs of the local points.
+   * \param[in] searchPoints Points of this rank for which the nearest point will be searched.
+   */
+  CADTPointsOnlyClass(unsigned short        nDim,
+                      unsigned long         nPoints,
+                      const su2double       *coor,
+                      const unsigned long   *pointID,
+                      const ADTSearchPoints &searchPoints);
+
   /*!
    * \brief Function, which determines the nearest node in the ADT for the given coordinate.
    * \note This simply forwards the call to the implementation function selecting the right
@@ -75,6 +90,40 @@ public:
                               coor, dist, pointID, rankID);
   }
 
+  /*!
+   * \brief Function, which determines the k nearest nodes in the ADT for the given coordinate.
+   * \note Ties in distance are broken with the point ID, i.e. the order of the output
+   *       does not depend on the order of the points in the tree.
+   * \param[in]  coor    Coordinate for which the nearest nodes in the ADT must be determined.
+   * \param[in]  nNodes  Number of nodes to find, fewer are returned if the ADT is smaller.
+   * \param[out] dist2   Distance squared to the nearest nodes, sorted in increasing order.
+   * \param[out] pointID Local point IDs of the nearest nodes.
+   * \param[out] rankID  Ranks on which the nearest nodes are stored.
+   */
+  inline void DetermineNearestNodes(const su2double       *coor,
+                                    unsigned long         nNodes,
+                                    vector<su2double>     &dist2,
+                                    vector<unsigned long> &pointID,
+                                    vector<int>           &rankID) {
+    const auto iThread = omp_get_thread_num();
+    DetermineNearestNodes_impl(FrontLeaves[iThread], FrontLeavesNew[iThread],
+                               coor, nNodes, dist2, pointID, rankID);
+  }
+
+  /*!
+   * \brief Function, which determines the nodes of the ADT that are within a given radius of a coordinate.
+   * \param[in]  coor    Coordinate around which the nodes must be determined.
+   * \param[in]  radius  Radius of the search.
+   * \param[out] pointID Local point IDs of the nodes within the radius, sorted in increasing order.
+   */
+  inline void DetermineNodesInRadius(const su2double       *coor,
+                                     su2double             radius,
+                                     vector<unsigned long> &pointID) {
+    const auto iThread = omp_get_thread_num();
+    DetermineNodesInRadius_impl(FrontLeaves[iThread], FrontLeavesNew[iThread],
+                                coor, radius, pointID);
+  }
+
   /*!
    * \brief Default constructor of the class, disabled.
    */
@@ -91,4 +140,26 @@ private:
                                  su2double       &dist,
                                  unsigned long   &pointID,
                                  int             &rankID) const;
+
+  /*!
+   * \brief Implementation of DetermineNearestNodes.
+   * \note Working variables (first two) passed explicitly for thread safety.
+   */
+  void DetermineNearestNodes_impl(vector<unsigned long>& frontLeaves,
+                                  vector<unsigned long>& frontLeavesNew,
+                                  const su2double       *coor,
+                                  unsigned long         nNodes,
+                                  vector<su2double>     &dist2,
+                                  vector<unsigned long> &pointID,
+                                  vector<int>           &rankID) const;
+
+  /*!
+   * \brief Implementation of DetermineNodesInRadius.
+   * \note Working variables (first two) passed explicitly for thread safety.
+   */
+  void DetermineNodesInRadius_impl(vector<unsigned long>& frontLeaves,
+                                   vector<unsigned long>& frontLeavesNew,
+                                   const su2double       *coor,
+                                   su2double             radius,
+                                   vector<unsigned long> &pointID) const;
 };
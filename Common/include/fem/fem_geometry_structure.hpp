@@ -1217,9 +1217,12 @@ protected:
   /*!
    * \brief Compute an ADT including the coordinates of all viscous markers
    * \param[in] config - Definition of the particular problem.
+   * \param[in] searchPoints - Not used, the wall distance of the DG solver is also needed at the
+   *                           integration points, therefore a global tree is always built.
    * \return pointer to the ADT
    */
-  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig *config) const override;
+  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig *config,
+                                                       const ADTSearchPoints* searchPoints) const override;
 
   /*!
    * \brief Set wall distances a specific value
@@ -65,6 +65,8 @@ extern "C" {
 
 using namespace std;
 
+class CPoissonWallDistance;
+
 /*!
  * \class CGeometry
  * \brief Parent class for defining the geometry of the problem (complete geometry,
@@ -185,8 +187,14 @@ protected:
   unsigned long edgeColorGroupSize{1};   /*!< \brief Size of the edge groups within each color. */
   unsigned long elemColorGroupSize{1};   /*!< \brief Size of the element groups within each color. */
 
+  CCompressedSparsePatternUL edgeColoringSplit; /*!< \brief Edge coloring with interior and partition boundary edges apart. */
+  unsigned long edgeColoringSplitGroupSize{0};  /*!< \brief Group size used to split the edge coloring. */
+  unsigned long nEdgeColorInterior{0};          /*!< \brief Number of colors of the split coloring with only interior edges. */
+
   ColMajorMatrix<uint8_t> CoarseGridColor_;  /*!< \brief Coarse grid levels, colorized. */
 
+  unique_ptr<CPoissonWallDistance> poissonWallDistance; /*!< \brief PDE-based wall distance solver, kept for warm starts. */
+
 public:
   /*--- Main geometric elements of the grid. ---*/
 
@@ -915,6 +923,12 @@ public:
    */
   inline virtual void SetRestricted_GridVelocity(CGeometry *fine_mesh, const CConfig *config) {}
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] fine_mesh - Geometry of the fine mesh.
+   */
+  inline virtual void SetRestricted_WallDistance(const CGeometry *fine_mesh) {}
+
   /*!
    * \brief Check if a boundary is straight(2D) / plane(3D) for EULER_WALL and SYMMETRY_PLANE
    *        only and store the information in bound_is_straight. For all other boundary types
@@ -1623,6 +1637,18 @@ public:
    */
   void SetNaturalEdgeColoring();
 
+  /*!
+   * \brief Get the edge coloring with the interior edges (both points in the domain) and the
+   *        partition boundary edges (one halo point) in separate colors.
+   * \note The groups of each color are kept together, a group with a halo point is a boundary group.
+   *       The colors of interior groups come first, they can be computed while halo data is exchanged.
+   *       This method builds the split coloring if that has not been done yet (for this group size).
+   * \param[in] groupSize - Size of the groups of each color that are computed by one thread.
+   * \param[out] nColorInterior - Number of (leading) colors with only interior edges.
+   * \return Reference to the split coloring.
+   */
+  const CCompressedSparsePatternUL& GetEdgeColoringSplit(unsigned long groupSize, unsigned long& nColorInterior);
+
   /*!
    * \brief Get the group size used in edge coloring.
    * \return Group size.
@@ -1651,9 +1677,13 @@ public:
   /*!
    * \brief Compute an ADT including the coordinates of all viscous markers
    * \param[in] config - Definition of the particular problem.
+   * \param[in] searchPoints - If not null, only the walls that may be nearest to these points are gathered.
    * \return pointer to the ADT
    */
-  virtual std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig *config) const { return nullptr; }
+  virtual std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig *config,
+                                                               const ADTSearchPoints* searchPoints = nullptr) const {
+    return nullptr;
+  }
 
   /*!
    * \brief Reduce the wall distance based on an previously constructed ADT.
@@ -1678,6 +1708,14 @@ public:
    */
   static void ComputeWallDistance(const CConfig * const *config_container, CGeometry ****geometry_container);
 
+  /*!
+   * \brief Compute the wall distance with a Poisson equation (see CPoissonWallDistance).
+   * \note The solver is created on the first call, its solution is the initial guess for the next calls.
+   * \param[in] config - Definition of the particular problem.
+   * \return False if this zone has no viscous walls, in that case the wall distance is not set.
+   */
+  bool ComputePoissonWallDistance(const CConfig *config);
+
   /*!
    * \brief Set the amount of nonconvex elements in the mesh.
    * \param[in] nonconvex_elems - amount of nonconvex elements in the mesh
@@ -36,6 +36,31 @@
  * \author F. Palacios
  */
 class CMultiGridGeometry final : public CGeometry {
+private:
+  /*!
+   * \brief Determine if the halo copy of a point on another rank is complete, i.e. if that rank has all the
+   *        finest grid elements around the point (and therefore its volume and all its edges).
+   * \param[in] geometry - Geometry of all the multigrid levels.
+   * \param[in] iMesh - Level of the point.
+   * \param[in] iPoint - Point (owned by this rank).
+   * \param[in] iRank - The other rank.
+   * \param[in] owner - Owner rank of each point of the finest grid.
+   * \return <code>TRUE</code> if the halo copy is complete.
+   */
+  static bool CompleteOnRank(CGeometry **geometry, unsigned short iMesh, unsigned long iPoint,
+                             int iRank, const vector<int>& owner);
+
+  /*!
+   * \brief Agree with the neighbor ranks on the fine grid points that can be agglomerated across the partition
+   *        interfaces. A rank offers the interface points whose halo copy is complete on a lower neighbor rank.
+   * \param[in] geometry - Geometry of all the multigrid levels.
+   * \param[in] iMesh - Level being agglomerated.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] claimable - Halo points that this rank may add to its coarse control volumes.
+   * \param[out] reserved - Domain points offered to a neighbor rank.
+   */
+  void SetPartitionClaims(CGeometry **geometry, unsigned short iMesh, const CConfig *config,
+                          vector<bool>& claimable, vector<bool>& reserved) const;
 
 public:
   /*--- This is to suppress Woverloaded-virtual, omitting it has no negative impact. ---*/
@@ -151,6 +176,13 @@ public:
    */
   void SetRestricted_GridVelocity(CGeometry *fine_mesh, const CConfig *config) override;
 
+  /*!
+   * \brief Set the wall distance at each node in the coarse mesh level based
+   *        on a restriction (volume average) from a finer mesh.
+   * \param[in] fine_mesh - Geometry container for the finer mesh level.
+   */
+  void SetRestricted_WallDistance(const CGeometry *fine_mesh) override;
+
   /*!
    * \brief Find and store the closest neighbor to a vertex.
    * \param[in] config - Definition of the particular problem.
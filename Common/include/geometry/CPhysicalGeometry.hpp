@@ -48,6 +48,8 @@ class CPhysicalGeometry final : public CGeometry {
 
   vector<vector<unsigned long> > Neighbors;
   unordered_map<unsigned long, unsigned long> Color_List;
+  unordered_map<unsigned long, vector<unsigned long> > Halo_Color_List; /*!< \brief Colors of the neighbors of each local point (two halo layers). */
+  bool twoHaloLayers{false};                       /*!< \brief Whether the partitions have two layers of halo points. */
   vector<string> Marker_Tags;
   unsigned long nLocal_Point{0},
   nLocal_PointDomain{0},
@@ -162,6 +164,29 @@ public:
    */
   void DistributeColoring(const CConfig *config, CGeometry *geometry);
 
+  /*!
+   * \brief Distributes the colors of the neighbors of each point, these are the ranks that receive the elements
+   *        around the point when the partitions have two layers of halo points.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Definition of the geometry container holding the initial linear partitions of the grid + coloring.
+   */
+  void DistributeHaloColoring(const CConfig *config, CGeometry *geometry);
+
+  /*!
+   * \brief Get the ranks that receive the elements around a point, its color, or with two layers of halo points,
+   *        the colors of all its neighbors.
+   * \param[in] iPoint - Global index of the point.
+   * \return Pointers to the first rank and past the last rank.
+   */
+  inline pair<const unsigned long*, const unsigned long*> GetHalo_Colors(unsigned long iPoint) {
+    if (!twoHaloLayers) {
+      const auto& color = Color_List[iPoint];
+      return make_pair(&color, &color+1);
+    }
+    const auto& colors = Halo_Color_List[iPoint];
+    return make_pair(colors.data(), colors.data()+colors.size());
+  }
+
   /*!
    * \brief Distribute the grid points, including ghost points, across all ranks based on a ParMETIS coloring.
    * \param[in] config - Definition of the particular problem.
@@ -753,9 +778,11 @@ public:
   /*!
    * \brief Compute an ADT including the coordinates of all viscous markers
    * \param[in] config - Definition of the particular problem.
+   * \param[in] searchPoints - If not null, only the walls that may be nearest to these points are gathered.
    * \return pointer to the ADT
    */
-  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig *config) const override;
+  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig *config,
+                                                       const ADTSearchPoints* searchPoints) const override;
 
   /*!
    * \brief Reduce the wall distance based on an previously constructed ADT.
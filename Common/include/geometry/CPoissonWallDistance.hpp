@@ -0,0 +1,98 @@
+/*!
+ * \file CPoissonWallDistance.hpp
+ * \brief Header of the class that approximates the wall distance with a Poisson equation.
+ *        The subroutines and functions are in the <i>CPoissonWallDistance.cpp</i> file.
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+#include "../linear_algebra/CSysMatrix.hpp"
+#include "../linear_algebra/CSysVector.hpp"
+#include "../linear_algebra/CSysSolve.hpp"
+
+class CGeometry;
+class CConfig;
+
+/*!
+ * \class CPoissonWallDistance
+ * \brief Approximate wall distance from the solution of lap(phi) = -1 with phi = 0 on the viscous walls
+ *        (and zero normal gradient elsewhere), d = sqrt(|grad(phi)|^2 + 2 phi) - |grad(phi)|.
+ * \note The equation is discretized with the edge loops of the dual grid and solved with the mesh
+ *       deformation linear solver options. The solution is kept between calls and used as the initial
+ *       guess, when the mesh moves this is close to the new solution and only a few iterations are needed.
+ *       Only the walls of the zone are considered, the closest wall element is not tracked.
+ * \author P. Gomes
+ */
+class CPoissonWallDistance {
+private:
+  enum : size_t {MAXNDIM = 3};
+
+  const unsigned short nDim;         /*!< \brief Number of dimensions. */
+  const unsigned long nPoint;        /*!< \brief Number of points. */
+  const unsigned long nPointDomain;  /*!< \brief Number of points in the domain. */
+
+  unsigned long nWallPointGlobal = 0;  /*!< \brief Number of wall points in all ranks. */
+  std::vector<unsigned long> wallPoints; /*!< \brief Local points (including halos) on viscous walls. */
+
+#ifndef CODI_FORWARD_TYPE
+  CSysMatrix<su2mixedfloat> Jacobian; /*!< \brief Discrete Laplace operator. */
+  CSysSolve<su2mixedfloat>  System;   /*!< \brief Linear solver. */
+#else
+  CSysMatrix<su2double> Jacobian;
+  CSysSolve<su2double>  System;
+#endif
+  CSysVector<su2double> Phi;     /*!< \brief Solution of the Poisson equation, kept for warm starts. */
+  CSysVector<su2double> Rhs;     /*!< \brief Right hand side (the volumes). */
+  CSysVector<su2double> Dist;    /*!< \brief Wall distance, to communicate halo values. */
+
+  /*!
+   * \brief Assemble the Laplace operator and the right hand side for the current coordinates.
+   * \param[in] geometry - Geometry of the zone.
+   */
+  void SetLaplacian(CGeometry *geometry);
+
+public:
+  /*!
+   * \brief Constructor of the class, allocates the system and finds the wall points.
+   * \param[in] geometry - Geometry of the zone.
+   * \param[in] config - Definition of the zone.
+   */
+  CPoissonWallDistance(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Whether the zone has viscous walls (otherwise the problem is not well posed).
+   */
+  inline bool HasWalls() const { return nWallPointGlobal > 0; }
+
+  /*!
+   * \brief Solve the Poisson equation and set the wall distance of all the points of the geometry.
+   * \param[in] geometry - Geometry of the zone, must be the one used to construct the object.
+   * \param[in] config - Definition of the zone.
+   * \return Number of linear solver iterations.
+   */
+  unsigned long Compute(CGeometry *geometry, const CConfig *config);
+
+};
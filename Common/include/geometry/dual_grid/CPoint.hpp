@@ -448,6 +448,7 @@ public:
    */
   inline su2double& GetWall_Distance(unsigned long iPoint) { return Wall_Distance(iPoint); }
   inline const su2double& GetWall_Distance(unsigned long iPoint) const { return Wall_Distance(iPoint); }
+  inline const su2activevector& GetWall_Distance() const { return Wall_Distance; }
 
   /*!
    * \brief Set the value of the distance to the nearest wall.
@@ -462,6 +463,7 @@ public:
    * \return Value of the distance to the nearest wall.
    */
   inline su2double GetRoughnessHeight(unsigned long iPoint) const { return RoughnessHeight(iPoint); }
+  inline const su2activevector& GetRoughnessHeight() const { return RoughnessHeight; }
 
   /*!
    * \brief Set the value of the distance to a sharp edge.
@@ -513,6 +515,7 @@ public:
    */
   inline su2double& GetVolume(unsigned long iPoint) { return Volume(iPoint); }
   inline const su2double& GetVolume(unsigned long iPoint) const { return Volume(iPoint); }
+  inline const su2activevector& GetVolume() const { return Volume; }
 
   /*!
    * \brief Set the volume of the control volume.
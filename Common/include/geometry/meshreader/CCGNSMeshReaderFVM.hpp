@@ -31,12 +31,17 @@
 #ifdef HAVE_CGNS
 #include "cgnslib.h"
 #endif
+#ifdef HAVE_PCGNS
+#include "pcgnslib.h"
+#endif
 
 #include "CMeshReaderFVM.hpp"
 
 /*!
  * \class CCGNSMeshReaderFVM
  * \brief Reads a CGNS zone into linear partitions for the finite volume solver (FVM).
+ * \note When built with parallel CGNS (HAVE_PCGNS) the coordinates and the single-type
+ * volume sections are read with collective HDF5/MPI-IO calls (cgp_* API).
  * \author: T. Economon
  */
 class CCGNSMeshReaderFVM: public CMeshReaderFVM {
@@ -56,6 +61,7 @@ private:
   vector<unsigned long> elemOffset;    /*!< \brief Global ID offset for each interior section (i.e., the total number of global elements that came before it). */
   vector<vector<cgsize_t> > connElems; /*!< \brief Vector containing the local element connectivity found within each CGNS section. First index is the section, second contains the connectivity in format [globalID VTK n1 n2 n3 n4 n5 n6 n7 n8] for each element. */
   vector<vector<char> > sectionNames;  /*!< \brief Vector for storing the names of each boundary section (marker). */
+  unsigned long bytesRead = 0;         /*!< \brief Amount of grid data read by this rank (to compute the bandwidth). */
 
   /*!
    * \brief Open the CGNS file and checks for errors.
@@ -0,0 +1,93 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.hpp
+ * \brief Header file for the class CSU2BinaryMeshReaderFVM.
+ *        The implementations are in the <i>CSU2BinaryMeshReaderFVM.cpp</i> file.
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CMeshReaderFVM.hpp"
+
+/*!
+ * \class CSU2BinaryMeshReaderFVM
+ * \brief Reads a native SU2 binary grid into linear partitions for the finite volume solver (FVM).
+ * \note The layout of the file is described in option_structure.hpp (BINARY_MESH_HEADER).
+ * Each rank reads only its chunk of the points and of each type of element (using MPI I/O
+ * when available), the elements are then sent to the ranks that own their points.
+ * Only the master node reads the markers.
+ * \author P. Gomes
+ */
+class CSU2BinaryMeshReaderFVM: public CMeshReaderFVM {
+
+private:
+
+  string meshFilename; /*!< \brief Name of the SU2 binary mesh file being read. */
+
+#ifdef HAVE_MPI
+  MPI_File fileHandle; /*!< \brief File handle for reading. */
+#else
+  FILE* fileHandle = nullptr; /*!< \brief File handle for reading. */
+#endif
+
+  unsigned long header[BINARY_MESH_HEADER_SIZE] = {0}; /*!< \brief Header of the file, see BINARY_MESH_HEADER. */
+
+  /*!
+   * \brief Collectively read a chunk of data (of 8-byte words) from the file.
+   * \param[in] offsetInBytes - Position of the chunk in the file.
+   * \param[in] nWords - Number of words to read by this rank.
+   * \param[out] data - Where the data is stored.
+   */
+  void ReadBinaryDataAll(unsigned long offsetInBytes, unsigned long nWords, void* data);
+
+  /*!
+   * \brief Reads and checks the header of the file.
+   */
+  void ReadMetadata();
+
+  /*!
+   * \brief Reads the grid points into linear partitions across all ranks.
+   */
+  void ReadPointCoordinates();
+
+  /*!
+   * \brief Reads the volume elements in linear partitions and sends them to the ranks that need them.
+   */
+  void ReadVolumeElementConnectivity();
+
+  /*!
+   * \brief Reads the surface (boundary) elements on the master node.
+   */
+  void ReadSurfaceElementConnectivity();
+
+public:
+
+  /*!
+   * \brief Constructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  CSU2BinaryMeshReaderFVM(CConfig        *val_config,
+                          unsigned short val_iZone,
+                          unsigned short val_nZone);
+
+};
@@ -30,23 +30,14 @@
 
 /*!
  * \brief Nearest Neighbor(s) interpolation.
- * \note The closest k neighbors are used for IDW interpolation, the computational
- * cost of setting up the interpolation is O(N^2 log(k)), this can be improved
- * by using a kd-tree.
+ * \note The closest k neighbors are used for IDW interpolation, they are found with an ADT
+ * of the donor points. Each rank only receives the donors of the ranks whose bounding boxes
+ * are close to its target points.
  */
 class CNearestNeighbor final : public CInterpolator {
 private:
   su2double AvgDistance = 0.0, MaxDistance = 0.0;
 
-  /*! \brief Helper struct to (partially) sort neighbours according to distance while
-   *         keeping track of the origin of the point (i.e. index and processor). */
-  struct DonorInfo {
-    su2double dist;
-    unsigned pidx;
-    int proc;
-    DonorInfo(su2double d = 0.0, unsigned i = 0, int p = 0) : dist(d), pidx(i), proc(p) { }
-  };
-
 public:
   /*!
    * \brief Constructor of the class.
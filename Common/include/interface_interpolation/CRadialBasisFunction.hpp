@@ -38,6 +38,8 @@ class CRadialBasisFunction final : public CInterpolator {
 private:
   unsigned long MinDonors = 0, AvgDonors = 0, MaxDonors = 0;
   passivedouble Density = 0.0, AvgCorrection = 0.0, MaxCorrection = 0.0;
+  unsigned long MaxPatchSize = 0, MaxSolverIter = 0; /*!< \brief Statistics of the sparse mode. */
+  bool SparseMode = false;
 
 public:
   /*!
@@ -99,6 +101,44 @@ public:
   static int CheckPolynomialTerms(su2double max_diff_tol, vector<int>& keep_row, su2passivematrix &P);
 
 private:
+  /*!
+   * \brief Compute the interpolation coefficients of the target vertices of a marker using only the
+   * donors inside a patch around each target, i.e. local RBF interpolants. With compactly supported
+   * kernels the local RBF matrices are sparse, they are solved with preconditioned CG, and the cost
+   * grows linearly with the size of the interface instead of cubically.
+   * \note The polynomial term is included via the Schur complement of the local saddle-point system.
+   * \param[in] type - Type of radial basis function.
+   * \param[in] usePolynomial - Whether to use polynomial terms.
+   * \param[in] radius - Radius of the RBF.
+   * \param[in] patchRadius - Radius of the patch of donors for each target.
+   * \param[in] pruneTol - Relative tolerance to prune small coefficients.
+   * \param[in] donorCoord - Coordinates of all the donor points.
+   * \param[in] donorPoint - Global indices of the donor points.
+   * \param[in] donorProc - Ranks that own the donor points.
+   * \param[in] markTarget - Target marker.
+   * \param[in] nVertexTarget - Number of target vertices.
+   * \return Total number of donors (after pruning) of the target vertices.
+   */
+  unsigned long SetSparseTransferCoeff(RADIAL_BASIS type, bool usePolynomial, su2double radius,
+                                       su2double patchRadius, passivedouble pruneTol,
+                                       const su2activematrix& donorCoord, const vector<long>& donorPoint,
+                                       const vector<int>& donorProc, unsigned short markTarget,
+                                       unsigned long nVertexTarget);
+
+  /*!
+   * \brief Solve a small sparse SPD system, in CSR format (sorted columns), with conjugate gradients
+   * preconditioned by symmetric Gauss-Seidel (Jacobi would do nothing as the RBF matrices have unit diagonal).
+   * \param[in] rowPtr - Start of each row in colInd and values.
+   * \param[in] colInd - Column indices.
+   * \param[in] values - Non-zero values.
+   * \param[in] rhs - Right-hand-side of the system.
+   * \param[out] x - Solution.
+   * \return Number of iterations.
+   */
+  static unsigned long SolveSparseSPD(const vector<unsigned long>& rowPtr, const vector<unsigned long>& colInd,
+                                      const vector<passivedouble>& values, const passivedouble* rhs,
+                                      passivedouble* x);
+
   /*!
    * \brief Helper function, prunes (by setting to zero) small interpolation coefficients,
    * i.e. <= tolerance*max(abs(coeffs)). The vector is re-scaled such that sum(coeffs)==1.
@@ -0,0 +1,200 @@
+/*!
+ * \file CAlgebraicMultigrid.hpp
+ * \brief Aggregation-based algebraic multigrid for block-CSR (CSysMatrix) systems.
+ * \author SU2 Contributors
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../basic_types/datatype_structure.hpp"
+#include <vector>
+
+using namespace std;
+
+/*!
+ * \class CAlgebraicMultigrid
+ * \brief Unsmoothed-aggregation AMG hierarchy built on the block sparse pattern of a CSysMatrix.
+ * \note Like the other SU2 preconditioners this is an additive domain decomposition method,
+ *       the hierarchy is built for the rows owned by the rank and the coupling with halo points
+ *       is ignored. Aggregates are formed independently within thread partitions (which then
+ *       define the partitions of the coarse level) and the smoother is a hybrid block
+ *       Gauss-Seidel (Jacobi between partitions), thus the construction and the application
+ *       of the preconditioner are both thread-parallel. Forward sweeps are used for pre-smoothing
+ *       and backward sweeps for post-smoothing, which makes the V-cycle symmetric.
+ */
+template<class ScalarType>
+class CAlgebraicMultigrid {
+private:
+  enum : size_t { MAXNVAR = 8 };         /*!< \brief Maximum block size, same as CSysMatrix. */
+  enum { OMP_MIN_SIZE = 32 };            /*!< \brief Chunk size for finer grain operations. */
+  enum { OMP_MAX_SIZE = 512 };           /*!< \brief Chunk size for heavy loops (e.g. over rows). */
+  enum { MIN_POINTS_PER_PART = 64 };     /*!< \brief Coarsening stops when partitions have fewer points. */
+  enum { COARSEST_SWEEPS = 4 };          /*!< \brief Symmetric sweeps used to solve the coarsest level. */
+  static constexpr passivedouble MAX_COARSENING_RATIO = 0.8; /*!< \brief Coarsening stops above this ratio. */
+  static constexpr passivedouble MAX_CORRECTION = 2.0;       /*!< \brief Bounds for the scaling of coarse corrections. */
+  static constexpr passivedouble MIN_CORRECTION = 0.5;
+  static constexpr unsigned long UNASSIGNED = ~0ul;          /*!< \brief Marker for points not yet aggregated. */
+
+  /*!
+   * \brief A level of the hierarchy, a block-CSR matrix plus the data to transfer to/from the next level.
+   */
+  struct CLevel {
+    unsigned long nBlk = 0;                 /*!< \brief Number of block rows (columns >= nBlk are halos). */
+    const unsigned long *row_ptr = nullptr; /*!< \brief Pointers to the first element in each row. */
+    const unsigned long *col_ind = nullptr; /*!< \brief Column index of each non zero block. */
+    const unsigned long *dia_ptr = nullptr; /*!< \brief Pointers to the diagonal element in each row. */
+    const ScalarType *values = nullptr;     /*!< \brief Entries of the matrix. */
+
+    vector<unsigned long> rowPtr, colInd, diaPtr; /*!< \brief Storage for the pattern of coarse levels. */
+    vector<ScalarType> matrix;                    /*!< \brief Storage for the entries of coarse levels. */
+
+    vector<ScalarType> invDiag;             /*!< \brief Inverse of the diagonal blocks. */
+    vector<ScalarType> diagNorm;            /*!< \brief Squared norm of the diagonal blocks (strength of connection). */
+    vector<unsigned long> partitions;       /*!< \brief Row ranges of the thread partitions. */
+
+    vector<unsigned long> aggregate;        /*!< \brief Coarse point (aggregate) of each point. */
+    vector<unsigned long> aggPtr, aggIdx;   /*!< \brief Points of each aggregate, in CSR format. */
+
+    vector<ScalarType> sol, rhs, work;      /*!< \brief Level vectors (sol and rhs are not used on the finest). */
+  };
+
+  unsigned long nVar = 0;           /*!< \brief Size of the blocks. */
+  unsigned long nParts = 1;         /*!< \brief Number of thread partitions. */
+  unsigned long nCoarse = 0;        /*!< \brief Number of points of the level being created. */
+  unsigned short nSweeps = 1;       /*!< \brief Number of pre and post smoothing sweeps. */
+  ScalarType strength2 = 0.0;       /*!< \brief Strength of connection threshold (to the 4th power). */
+  vector<unsigned long> partCount;  /*!< \brief Aggregates per partition during coarsening. */
+  ScalarType dotNum, dotDen;        /*!< \brief Shared variables for thread reductions. */
+  vector<CLevel> levels;            /*!< \brief The hierarchy, level 0 maps to the input matrix. */
+
+  /*!
+   * \brief Squared Frobenius norm of a block.
+   */
+  inline ScalarType BlockNorm2(const ScalarType *block) const {
+    ScalarType norm = 0.0;
+    for (auto i = 0ul; i < nVar*nVar; ++i) norm += block[i]*block[i];
+    return norm;
+  }
+
+  /*!
+   * \brief Strength of connection test between points i and j of a level.
+   */
+  inline bool IsStrong(const CLevel& level, unsigned long index, unsigned long iPoint, unsigned long jPoint) const {
+    const auto aij2 = BlockNorm2(&level.values[index*nVar*nVar]);
+    return aij2*aij2 >= strength2 * level.diagNorm[iPoint] * level.diagNorm[jPoint];
+  }
+
+  /*!
+   * \brief Invert a small dense block using Gauss-Jordan elimination with partial pivoting.
+   * \param[in] block - The block.
+   * \param[out] inverse - Its inverse.
+   */
+  void InvertBlock(const ScalarType *block, ScalarType *inverse) const;
+
+  /*!
+   * \brief Compute the inverse and norm of the diagonal blocks of a level.
+   */
+  void ComputeDiagonal(CLevel& level);
+
+  /*!
+   * \brief Form aggregates on a level, independently in each thread partition.
+   * \return Number of aggregates (also stored in nCoarse).
+   */
+  unsigned long Aggregate(CLevel& fine);
+
+  /*!
+   * \brief Compute the Galerkin (P^T A P) coarse operator with piecewise constant prolongation.
+   */
+  void GalerkinProduct(const CLevel& fine, CLevel& coarse);
+
+  /*!
+   * \brief Perform block Gauss-Seidel sweeps (hybrid Jacobi between thread partitions).
+   * \param[in] level - The level.
+   * \param[in] rhs - Right hand side.
+   * \param[in,out] sol - Solution.
+   * \param[in] forward - Direction of the sweeps.
+   * \param[in] sweeps - Number of sweeps.
+   */
+  void Smooth(CLevel& level, const ScalarType *rhs, ScalarType *sol, bool forward, unsigned short sweeps) const;
+
+  /*!
+   * \brief Compute the scaling of a coarse correction that minimizes the energy of the error.
+   * \note The piecewise constant prolongation has low energy, the coarse corrections are thus
+   *       too small and need to be scaled (typically by 1.5 to 2) for V-cycles to be effective.
+   *       This makes the preconditioner slightly nonlinear, which is fine for flexible methods.
+   * \param[in] coarse - The coarse level, with sol and rhs computed.
+   * \return The scaling factor.
+   */
+  ScalarType CorrectionScale(CLevel& coarse);
+
+  /*!
+   * \brief Apply the V-cycle recursively, with zero initial guess.
+   * \param[in] iLevel - Level index.
+   * \param[in] rhs - Right hand side.
+   * \param[out] sol - Solution.
+   */
+  void Cycle(unsigned long iLevel, const ScalarType *rhs, ScalarType *sol);
+
+public:
+  /*!
+   * \brief Set the pointers to the finest level matrix (the data must persist).
+   * \param[in] nVar - DOF per point.
+   * \param[in] nPointDomain - Number of internal points.
+   * \param[in] rowptr - Array, where column index data starts for each matrix row.
+   * \param[in] colidx - Non zeros column indices.
+   * \param[in] diaptr - Location of the diagonal block in each row.
+   * \param[in] values - Matrix coefficients.
+   */
+  void SetMatrix(unsigned long nVar,
+                 unsigned long nPointDomain,
+                 const unsigned long *rowptr,
+                 const unsigned long *colidx,
+                 const unsigned long *diaptr,
+                 const ScalarType *values);
+
+  /*!
+   * \brief Build the hierarchy, call from within or outside parallel regions.
+   * \param[in] strength - Strength of connection threshold for aggregation.
+   * \param[in] maxLevels - Maximum number of levels (including the finest).
+   * \param[in] sweeps - Number of pre and post smoothing sweeps.
+   */
+  void Build(passivedouble strength, unsigned short maxLevels, unsigned short sweeps);
+
+  /*!
+   * \brief Apply one V-cycle to the owned part of the rhs vector.
+   * \param[in] rhs - Right hand side (nPointDomain*nVar entries).
+   * \param[out] sol - Approximate solution.
+   */
+  void Solve(const ScalarType *rhs, ScalarType *sol) { Cycle(0, rhs, sol); }
+
+  /*!
+   * \brief Get the number of levels of the hierarchy.
+   */
+  inline unsigned long GetNumLevels() const { return levels.size(); }
+
+  /*!
+   * \brief Get the number of points of a level.
+   */
+  inline unsigned long GetNumPoints(unsigned long iLevel) const { return levels[iLevel].nBlk; }
+};
@@ -272,6 +272,57 @@ public:
 };
 
 
+/*!
+ * \class CAMGPreconditioner
+ * \brief Specialization of preconditioner that uses the algebraic multigrid hierarchy of CSysMatrix.
+ */
+template<class ScalarType>
+class CAMGPreconditioner final : public CPreconditioner<ScalarType> {
+private:
+  CSysMatrix<ScalarType>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry;                   /*!< \brief Pointer to geometry associated with the matrix. */
+  const CConfig *config;                 /*!< \brief Pointer to problem configuration. */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] matrix_ref - Matrix reference that will be used to define the preconditioner.
+   * \param[in] geometry_ref - Geometry associated with the problem.
+   * \param[in] config_ref - Config of the problem.
+   */
+  inline CAMGPreconditioner(CSysMatrix<ScalarType> & matrix_ref,
+                            CGeometry *geometry_ref, const CConfig *config_ref) :
+    sparse_matrix(matrix_ref)
+  {
+    if((geometry_ref == nullptr) || (config_ref == nullptr))
+      SU2_MPI::Error("Preconditioner needs to be built with valid references.", CURRENT_FUNCTION);
+    geometry = geometry_ref;
+    config = config_ref;
+  }
+
+  /*!
+   * \note This class cannot be default constructed as that would leave us with invalid Pointers.
+   */
+  CAMGPreconditioner() = delete;
+
+  /*!
+   * \brief Operator that defines the preconditioner operation.
+   * \param[in] u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    sparse_matrix.ComputeAMGPreconditioner(u, v, geometry, config);
+  }
+
+  /*!
+   * \note Request the associated matrix to build the preconditioner.
+   */
+  inline void Build() override {
+    sparse_matrix.BuildAMGPreconditioner(config);
+  }
+};
+
+
 /*!
  * \class CPastixPreconditioner
  * \brief Specialization of preconditioner that uses PaStiX to factorize a CSysMatrix.
@@ -346,6 +397,9 @@ CPreconditioner<ScalarType>* CPreconditioner<ScalarType>::Create(ENUM_LINEAR_SOL
     case ILU:
       prec = new CILUPreconditioner<ScalarType>(jacobian, geometry, config);
       break;
+    case AMG:
+      prec = new CAMGPreconditioner<ScalarType>(jacobian, geometry, config);
+      break;
     case PASTIX_ILU: case PASTIX_LU_P: case PASTIX_LDLT_P:
       prec = new CPastixPreconditioner<ScalarType>(jacobian, geometry, config, kind);
       break;
@@ -31,6 +31,7 @@
 #include "../../include/CConfig.hpp"
 #include "CSysVector.hpp"
 #include "CPastixWrapper.hpp"
+#include "CAlgebraicMultigrid.hpp"
 
 #include <cstdlib>
 #include <vector>
@@ -168,6 +169,8 @@ private:
   mutable CPastixWrapper<ScalarType> pastix_wrapper;
 #endif
 
+  mutable CAlgebraicMultigrid<ScalarType> amg_hierarchy; /*!< \brief Hierarchy of the AMG preconditioner. */
+
   /*!
    * \brief Auxilary object to wrap the edge map pointer used in fast block updates, i.e. without linear searches.
    */
@@ -710,6 +713,39 @@ public:
     AddBlock2Diag(block_i, val_block, -1.0);
   }
 
+  /*!
+   * \brief SIMD version of AddBlock2Diag, does the update for multiple (unique) points.
+   * \note Nothing is updated if the mask is 0.
+   */
+  template<class MatTypeSIMD, size_t N, class I, class F = ScalarType>
+  FORCEINLINE void AddBlock2Diag(simd::Array<I,N> iPoint, const MatTypeSIMD& block, simd::Array<F,N> mask = 1) {
+
+    static_assert(MatTypeSIMD::StaticSize, "This method requires static size blocks.");
+    static_assert(MatTypeSIMD::IsRowMajor, "Block storage is not compatible with matrix.");
+    constexpr size_t blkSz = MatTypeSIMD::StaticSize;
+    assert(blkSz == nVar*nEqn);
+
+    /*--- "Transpose" the block, scale, and possibly convert types. ---*/
+    ScalarType blk[N][blkSz];
+
+    for (size_t i=0; i<blkSz; ++i) {
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (size_t k=0; k<N; ++k) {
+        blk[k][i] = PassiveAssign(mask[k] * block.data()[i][k]);
+      }
+    }
+
+    /*--- Update one by one skipping if mask is 0. ---*/
+    for (size_t k=0; k<N; ++k) {
+      if (mask[k]==0) continue;
+
+      auto bii = &matrix[dia_ptr[iPoint[k]]*blkSz];
+
+      SU2_OMP_SIMD
+      for (size_t i=0; i<blkSz; ++i) bii[i] += blk[k][i];
+    }
+  }
+
   /*!
    * \brief Adds the specified value to the diagonal of the (i, i) subblock
    *        of the matrix-by-blocks structure.
@@ -857,6 +893,22 @@ public:
   void ComputeLineletPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                     CGeometry *geometry, const CConfig *config) const;
 
+  /*!
+   * \brief Build the algebraic multigrid preconditioner.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildAMGPreconditioner(const CConfig *config);
+
+  /*!
+   * \brief Apply one V-cycle of the algebraic multigrid preconditioner.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                CGeometry *geometry, const CConfig *config) const;
+
   /*!
    * \brief Compute the linear residual.
    * \param[in] sol - Solution (x).
@@ -94,6 +94,13 @@ private:
   mutable std::vector<VectorType> W;  /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   mutable std::vector<VectorType> Z;  /*!< \brief Large matrix used by FGMRES, preconditioned W. */
 
+  mutable std::vector<VectorType> PV; /*!< \brief Work vectors of the pipelined CG and BCGSTAB. */
+
+  enum : int {MAX_PIPELINED_DOTS = 5}; /*!< \brief Maximum number of fused dot products in the pipelined methods. */
+  mutable ScalarType redSend[MAX_PIPELINED_DOTS] = {}; /*!< \brief Partial dot products of this rank (shared by threads). */
+  mutable ScalarType redRecv[MAX_PIPELINED_DOTS] = {}; /*!< \brief Result of the non-blocking reduction. */
+  mutable typename SelectMPIWrapper<ScalarType>::W::Request redRequest; /*!< \brief Request of the pending reduction. */
+
   VectorType  LinSysSol_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType  LinSysRes_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType* LinSysSol_ptr;        /*!< \brief Pointer to appropriate LinSysSol (set to original or temporary in call to Solve). */
@@ -101,6 +108,7 @@ private:
 
   LinearToleranceType tol_type = LinearToleranceType::ABSOLUTE; /*!< \brief How the linear solvers interpret the tolerance. */
   bool xIsZero = false;           /*!< \brief If true assume the initial solution is always 0. */
+  bool lowSyncOrtho = false;      /*!< \brief Use CGS2 instead of MGS for the orthogonalization in FGMRES. */
   bool recomputeRes = false;      /*!< \brief Recompute the residual after inner iterations, if monitoring. */
   unsigned long monitorFreq = 10; /*!< \brief Monitoring frequency. */
 
@@ -172,6 +180,45 @@ private:
    */
   void ModGramSchmidt(int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType> & w) const;
 
+  /*!
+   * \brief Low-synchronization alternative to ModGramSchmidt, classical Gram-Schmidt with one
+   * reorthogonalization (CGS2), each pass requires a single global reduction (see CSysVector::multiDot).
+   * \param[in] i - index indicating which vector in w is being orthogonalized
+   * \param[in,out] Hsbg - the upper Hessenberg begin updated
+   * \param[in,out] w - the (i+1)th vector of w is orthogonalized against the
+   *                    previous vectors in w
+   *
+   * \pre the vectors w[0:i] are orthonormal
+   * \post the vectors w[0:i+1] are orthonormal
+   *
+   * The squared norm of w[i+1] is reduced together with the projections, after the second pass
+   * the norm is obtained from Pythagoras, and only recomputed if there is severe cancellation.
+   */
+  void ClassicalGramSchmidt2(int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType> & w) const;
+
+  /*!
+   * \brief Start the (non-blocking) reduction of n dot products across threads and ranks.
+   * \note Must be called by all threads, the partial results come from CSysVector::localDot.
+   * Work that does not depend on the result can be done before calling NonBlockingReductionEnd.
+   * \param[in] partial - Partial dot products of the calling thread.
+   * \param[in] n - Number of dot products (at most MAX_PIPELINED_DOTS).
+   */
+  void NonBlockingReductionBegin(const ScalarType* partial, int n) const;
+
+  /*!
+   * \brief Wait for the reduction started by NonBlockingReductionBegin.
+   * \param[out] result - The n reduced dot products (the same on all threads).
+   * \param[in] n - Number of dot products.
+   */
+  void NonBlockingReductionEnd(ScalarType* result, int n) const;
+
+  /*!
+   * \brief Allocate (if needed) the work vectors of the pipelined methods.
+   * \param[in] b - Vector with the same layout as the work vectors.
+   * \param[in] n - Number of vectors.
+   */
+  void AllocatePipelinedVectors(const VectorType& b, size_t n) const;
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -309,6 +356,16 @@ public:
                              const PrecondType & precond, ScalarType tol, unsigned long m,
                              ScalarType & residual, bool monitoring, const CConfig *config) const;
 
+  /*!
+   * \brief Pipelined Conjugate Gradient method (Ghysels and Vanroose, 2014), mathematically
+   * equivalent to CG_LinSolver, the single (non-blocking) reduction of each iteration is
+   * overlapped with the preconditioner and the matrix-vector product.
+   * \note The parameters are the same as CG_LinSolver.
+   */
+  unsigned long PCG_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                              const PrecondType & precond, ScalarType tol, unsigned long m,
+                              ScalarType & residual, bool monitoring, const CConfig *config) const;
+
   /*!
    * \brief Flexible Generalized Minimal Residual method
    * \param[in] b - the right hand size vector
@@ -348,6 +405,16 @@ public:
                                   const PrecondType & precond, ScalarType tol, unsigned long m,
                                   ScalarType & residual, bool monitoring, const CConfig *config) const;
 
+  /*!
+   * \brief Pipelined BCGSTAB (Cools and Vanroose, 2017), mathematically equivalent to BCGSTAB_LinSolver,
+   * the two (non-blocking) reductions of each iteration are overlapped with the preconditioner
+   * and the matrix-vector product, at the cost of more work vectors and AXPY operations.
+   * \note The parameters are the same as BCGSTAB_LinSolver.
+   */
+  unsigned long PBCGSTAB_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                                   const PrecondType & precond, ScalarType tol, unsigned long m,
+                                   ScalarType & residual, bool monitoring, const CConfig *config) const;
+
   /*!
    * \brief Generic smoother (modified Richardson iteration with preconditioner)
    * \param[in] b - the right hand size vector
@@ -409,6 +476,12 @@ public:
    */
   inline void SetxIsZero(bool isZero) {xIsZero = isZero;}
 
+  /*!
+   * \brief Use low-synchronization orthogonalization (CGS2) in FGMRES, or the default MGS.
+   * \note Solve and Solve_b set this from the kind of linear solver (LOW_SYNC_FGMRES).
+   */
+  inline void SetLowSyncOrthogonalization(bool lowSync) {lowSyncOrtho = lowSync;}
+
   /*!
    * \brief Set whether to recompute residuals at the end (while monitoring only).
    */
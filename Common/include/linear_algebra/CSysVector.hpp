@@ -28,6 +28,9 @@
 
 #pragma once
 
+#include <vector>
+#include <algorithm>
+
 #include "../parallelization/mpi_structure.hpp"
 #include "../parallelization/omp_structure.hpp"
 #include "../parallelization/vectorization.hpp"
@@ -288,6 +291,26 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
    */
   inline void SetValZero(void) { *this = ScalarType(0); }
 
+  /*!
+   * \brief Partial dot product between "this" and an expression, over the elements of the calling thread.
+   * \note The result still needs to be reduced across threads and ranks, this is used
+   * to fuse and overlap reductions (e.g. in the pipelined methods of CSysSolve).
+   * \param[in] expr - Expression.
+   * \return Partial result of the dot product.
+   */
+  template <class T>
+  ScalarType localDot(const VecExpr::CVecExpr<T, ScalarType>& expr) const {
+    ScalarType sum = 0.0;
+
+    CSYSVEC_PARFOR
+    for (auto i = 0ul; i < nElmDomain; ++i) {
+      sum += vec_val[i] * expr.derived()[i];
+    }
+    END_CSYSVEC_PARFOR
+
+    return sum;
+  }
+
   /*!
    * \brief Dot product between "this" and an expression.
    * \param[in] expr - Expression.
@@ -304,13 +327,7 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
     SU2_OMP_BARRIER
 
     /*--- Local dot product for each thread. ---*/
-    ScalarType sum = 0.0;
-
-    CSYSVEC_PARFOR
-    for (auto i = 0ul; i < nElmDomain; ++i) {
-      sum += vec_val[i] * expr.derived()[i];
-    }
-    END_CSYSVEC_PARFOR
+    ScalarType sum = localDot(expr);
 
     /*--- Update shared variable with "our" partial sum. ---*/
     atomicAdd(sum, dotRes);
@@ -337,6 +354,65 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
    */
   inline ScalarType squaredNorm() const { return dot(*this); }
 
+  /*!
+   * \brief Dot products between "this" and the first n vectors of a container, with a single reduction.
+   * \note Used to reduce the number of global synchronizations in Krylov methods.
+   * The work is split as in the other methods, each chunk of "this" is multiplied by all
+   * vectors while in cache. "this" may be one of the vectors (to fuse its squared norm).
+   * \param[in] vecs - Container of CSysVector (indexable).
+   * \param[in] n - Number of vectors used from the container.
+   * \param[out] res - The n results, this array should be private to each thread.
+   */
+  template <class Container>
+  void multiDot(const Container& vecs, unsigned long n, ScalarType* res) const {
+    static std::vector<ScalarType> dotRes;
+    /*--- All threads get the same "view" of the vectors and shared variable. ---*/
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER
+    dotRes.assign(n, 0.0);
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    /*--- Local dot products for each thread, chunks are distributed
+     *    in the same way as the elements in CSYSVEC_PARFOR loops. ---*/
+    for (auto k = 0ul; k < n; ++k) res[k] = 0.0;
+
+    const auto nChunk = roundUpDiv(nElmDomain, omp_chunk_size);
+
+    SU2_OMP_FOR_(schedule(static,1) SU2_NOWAIT)
+    for (auto iChunk = 0ul; iChunk < nChunk; ++iChunk) {
+      const auto begin = iChunk * omp_chunk_size;
+      const auto end = std::min(begin + omp_chunk_size, nElmDomain);
+      for (auto k = 0ul; k < n; ++k) {
+        const ScalarType* other = vecs[k].vec_val;
+        ScalarType sum = 0.0;
+        for (auto i = begin; i < end; ++i) sum += vec_val[i] * other[i];
+        res[k] += sum;
+      }
+    }
+    END_SU2_OMP_FOR
+
+    /*--- Update shared variables with "our" partial sums. ---*/
+    SU2_OMP_CRITICAL
+    for (auto k = 0ul; k < n; ++k) dotRes[k] += res[k];
+    END_SU2_OMP_CRITICAL
+
+#ifdef HAVE_MPI
+    /*--- Reduce across all mpi ranks, only master thread communicates, once for all products. ---*/
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      for (auto k = 0ul; k < n; ++k) res[k] = dotRes[k];
+      const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+      SelectMPIWrapper<ScalarType>::W::Allreduce(res, dotRes.data(), n, mpi_type, MPI_SUM, SU2_MPI::GetComm());
+    }
+    END_SU2_OMP_MASTER
+#endif
+    /*--- Make view of result consistent across threads. ---*/
+    SU2_OMP_BARRIER
+
+    for (auto k = 0ul; k < n; ++k) res[k] = dotRes[k];
+  }
+
   /*!
    * \brief L2 norm of the vector.
    * \return L2 norm.
@@ -424,6 +500,26 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
     }
   }
 
+  /*!
+   * \brief Vectorized version of AddBlock, updates multiple iPoint's.
+   * \note See SIMD overload of SetBlock, the iPoint's must be unique.
+   */
+  template <size_t N, class T, class VecTypeSIMD, class F = ScalarType>
+  FORCEINLINE void AddBlock(simd::Array<T, N> iPoint, const VecTypeSIMD& vector, simd::Array<F, N> mask = 1) {
+    /*--- "Transpose" and scale input vector. ---*/
+    constexpr size_t nVar = VecTypeSIMD::StaticSize;
+    assert(nVar == this->nVar);
+    ScalarType vec[N][nVar];
+    UnpackBlock(vector, mask, vec);
+
+    /*--- Update one by one skipping if mask is 0. ---*/
+    for (size_t k = 0; k < N; ++k) {
+      if (mask[k] == 0) continue;
+      SU2_OMP_SIMD
+      for (size_t i = 0; i < nVar; ++i) vec_val[iPoint[k] * nVar + i] += vec[k][i];
+    }
+  }
+
   /*!
    * \brief Vectorized version of UpdateBlocks, updates multiple i/jPoint's.
    * \note See SIMD overload of SetBlock.
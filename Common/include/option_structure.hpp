@@ -863,6 +863,18 @@ static const MapType<std::string, ENUM_TRANS_MODEL> Trans_Model_Map = {
   MakePair("BC", BC)
 };
 
+/*!
+ * \brief Methods to compute the distance to the nearest viscous wall.
+ */
+enum class WALL_DISTANCE_METHOD {
+  EXACT,    /*!< \brief Exact distance to the wall elements, found with an ADT search. */
+  POISSON,  /*!< \brief Approximate distance from a Poisson equation solved on the dual grid. */
+};
+static const MapType<std::string, WALL_DISTANCE_METHOD> Wall_Distance_Map = {
+  MakePair("EXACT", WALL_DISTANCE_METHOD::EXACT)
+  MakePair("POISSON", WALL_DISTANCE_METHOD::POISSON)
+};
+
 /*!
  * \brief Types of subgrid scale models
  */
@@ -1578,14 +1590,45 @@ enum ENUM_INPUT {
   SU2       = 1,  /*!< \brief SU2 input format. */
   CGNS_GRID = 2,  /*!< \brief CGNS input format for the computational grid. */
   RECTANGLE = 3,  /*!< \brief 2D rectangular mesh with N x M points of size Lx x Ly. */
-  BOX       = 4   /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  BOX       = 4,  /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  SU2_BINARY = 5  /*!< \brief SU2 native binary mesh format (one zone per file). */
 };
 static const MapType<std::string, ENUM_INPUT> Input_Map = {
   MakePair("SU2", SU2)
   MakePair("CGNS", CGNS_GRID)
   MakePair("RECTANGLE", RECTANGLE)
   MakePair("BOX", BOX)
-};
+  MakePair("SU2_BINARY", SU2_BINARY)
+};
+
+/*!
+ * \brief Layout of the header of SU2_BINARY mesh files, an array of BINARY_MESH_HEADER_SIZE
+ * unsigned longs. The point coordinates (nPoint x nDim doubles), the connectivity of each
+ * type of volume element (nElem x nNodes unsigned longs, types in the order of
+ * BINARY_MESH_ELEM_TYPES), and the markers are stored at the byte offsets given in the header.
+ * Each marker is stored as: length of the name, name, number of elements, and for each
+ * element its VTK type followed by 4 nodes (padded with zeros).
+ */
+enum BINARY_MESH_HEADER {
+  BINARY_MESH_MAGIC         = 0,   /*!< \brief Magic number to identify the file type. */
+  BINARY_MESH_VERSION       = 1,   /*!< \brief Version of the format. */
+  BINARY_MESH_NDIM          = 2,   /*!< \brief Number of dimensions. */
+  BINARY_MESH_NPOINT        = 3,   /*!< \brief Global number of points. */
+  BINARY_MESH_NELEM         = 4,   /*!< \brief Global number of volume elements. */
+  BINARY_MESH_NMARKER       = 5,   /*!< \brief Number of markers. */
+  BINARY_MESH_POINT_OFFSET  = 6,   /*!< \brief Offset to the point coordinates. */
+  BINARY_MESH_MARKER_OFFSET = 7,   /*!< \brief Offset to the first marker. */
+  BINARY_MESH_ELEM_COUNT    = 8,   /*!< \brief First of the global element counts of each type. */
+  BINARY_MESH_ELEM_OFFSET   = 14,  /*!< \brief First of the offsets to the connectivity of each type. */
+  BINARY_MESH_HEADER_SIZE   = 20   /*!< \brief Size of the header. */
+};
+const unsigned long SU2_BINARY_MESH_MAGIC = 535533;   /*!< \brief First entry of SU2_BINARY mesh files. */
+const unsigned long SU2_BINARY_MESH_VERSION = 1;      /*!< \brief Current version of the SU2_BINARY format. */
+const unsigned short BINARY_MESH_N_ELEM_TYPES = 6;    /*!< \brief Number of types of volume elements. */
+const GEO_TYPE BINARY_MESH_ELEM_TYPES[] = {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID};
+const unsigned short BINARY_MESH_ELEM_NODES[] = {N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL, N_POINTS_TETRAHEDRON,
+                                                 N_POINTS_HEXAHEDRON, N_POINTS_PRISM, N_POINTS_PYRAMID};
+const unsigned short BINARY_MESH_MARKER_CONN_SIZE = 5; /*!< \brief Entries per surface element [vtkType n0 n1 n2 n3]. */
 
 /*!
  * \brief Type of solution output file formats
@@ -1609,7 +1652,8 @@ enum ENUM_OUTPUT {
   STL_BINARY              = 16, /*!< \brief STL binary format for surface solution output. Not implemented yet. */
   PARAVIEW_XML            = 17, /*!< \brief Paraview XML with binary data format */
   SURFACE_PARAVIEW_XML    = 18, /*!< \brief Surface Paraview XML with binary data format */
-  PARAVIEW_MULTIBLOCK     = 19  /*!< \brief Paraview XML Multiblock */
+  PARAVIEW_MULTIBLOCK     = 19, /*!< \brief Paraview XML Multiblock */
+  MESH_BINARY             = 20  /*!< \brief SU2 native binary mesh format. */
 };
 static const MapType<std::string, ENUM_OUTPUT> Output_Map = {
   MakePair("TECPLOT_ASCII", TECPLOT)
@@ -1677,6 +1721,20 @@ static const MapType<std::string, ENUM_TAB_OUTPUT> TabOutput_Map = {
   MakePair("TECPLOT", TAB_TECPLOT)
 };
 
+/*!
+ * \brief Compression of binary restart files
+ */
+enum class RESTART_COMPRESSION {
+  NONE,      /*!< \brief Uncompressed values. */
+  LOSSLESS,  /*!< \brief Lossless compression of all the fields. */
+  LOSSY,     /*!< \brief Lossless for the fields that are read back (restart, sensitivities), error-bounded lossy for the other fields. */
+};
+static const MapType<std::string, RESTART_COMPRESSION> RestartCompression_Map = {
+  MakePair("NONE", RESTART_COMPRESSION::NONE)
+  MakePair("LOSSLESS", RESTART_COMPRESSION::LOSSLESS)
+  MakePair("LOSSY", RESTART_COMPRESSION::LOSSY)
+};
+
 /*!
  * \brief Type of volume sensitivity file formats (inout to SU2_DOT)
  */
@@ -1837,6 +1895,9 @@ enum ENUM_LINEAR_SOLVER {
   FGMRES,               /*!< \brief Flexible Generalized Minimal Residual method. */
   BCGSTAB,              /*!< \brief BCGSTAB - Biconjugate Gradient Stabilized Method (main solver). */
   RESTARTED_FGMRES,     /*!< \brief Flexible Generalized Minimal Residual method with restart. */
+  LOW_SYNC_FGMRES,      /*!< \brief FGMRES with low-synchronization (CGS2) orthogonalization. */
+  PIPELINED_CG,         /*!< \brief Pipelined CG, reductions overlapped with the preconditioner and product. */
+  PIPELINED_BCGSTAB,    /*!< \brief Pipelined BCGSTAB, reductions overlapped with the preconditioner and product. */
   SMOOTHER,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU,            /*!< \brief PaStiX LU (complete) factorization. */
@@ -1846,6 +1907,9 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("BCGSTAB", BCGSTAB)
   MakePair("FGMRES", FGMRES)
   MakePair("RESTARTED_FGMRES", RESTARTED_FGMRES)
+  MakePair("LOW_SYNC_FGMRES", LOW_SYNC_FGMRES)
+  MakePair("PIPELINED_CG", PIPELINED_CG)
+  MakePair("PIPELINED_BCGSTAB", PIPELINED_BCGSTAB)
   MakePair("SMOOTHER", SMOOTHER)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
@@ -1905,6 +1969,7 @@ enum ENUM_LINEAR_SOLVER_PREC {
   LU_SGS,         /*!< \brief LU SGS preconditioner. */
   LINELET,        /*!< \brief Line implicit preconditioner. */
   ILU,            /*!< \brief ILU(k) preconditioner. */
+  AMG,            /*!< \brief Aggregation-based algebraic multigrid preconditioner. */
   PASTIX_ILU=10,  /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P,  /*!< \brief PaStiX LDLT as preconditioner. */
@@ -1914,6 +1979,7 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Ma
   MakePair("LU_SGS", LU_SGS)
   MakePair("LINELET", LINELET)
   MakePair("ILU", ILU)
+  MakePair("AMG", AMG)
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
@@ -0,0 +1,179 @@
+/*!
+ * \file CMonitorReduction.hpp
+ * \brief Aggregation of the small reductions of monitored quantities (residuals, forces, etc.).
+ *        The implementations are in the <i>CMonitorReduction.cpp</i> file.
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../parallelization/mpi_structure.hpp"
+
+#include <functional>
+#include <map>
+#include <vector>
+
+/*!
+ * \class CMonitorReduction
+ * \brief Collects the quantities that are reduced over all ranks for monitoring purposes into one
+ *        buffer, which is then reduced with a single collective.
+ * \note The quantities are registered in-place, i.e. the local values are read when they are added
+ *       and the global values are written to the same locations when the reduction completes, the
+ *       locations must remain valid until then. Sums, minima, maxima, and maxima with a location (the
+ *       value is accompanied by a payload, e.g. global point index and coordinates, taken from the rank
+ *       with the largest value, ties are broken by the smallest first payload entry) are supported.
+ *       All ranks must register the same quantities in the same order.
+ *       Reductions are performed immediately (Reduce) unless a batch is open (Begin/End), in that case
+ *       they are deferred to the end of the batch together with the finalization functions that use the
+ *       results, and the batch can be completed asynchronously (End(false) ... Complete()). Code that
+ *       needs the results right away (e.g. divergence checks) uses ReduceNow.
+ *       Sums of AD-active values are reduced separately with the AD-aware wrapper (in AD builds only).
+ *       The class is not thread-safe, it should be used by the master thread.
+ * \author P. Gomes
+ */
+class CMonitorReduction {
+private:
+  enum class OP : int {SUM = 0, MIN = 1, MAX = 2, MAXLOC = 3};
+
+  /*!
+   * \brief Location of the results of a registered quantity.
+   */
+  struct CTarget {
+    passivedouble* values;    /*!< \brief Where the results are written. */
+    passivedouble* payload;   /*!< \brief Where the payload of MAXLOC entries is written. */
+    size_t n;                 /*!< \brief Number of values. */
+    size_t payloadSize;       /*!< \brief Payload per value. */
+    size_t offset;            /*!< \brief Position of the first value in the buffer. */
+  };
+
+  std::vector<passivedouble> sendBuf, recvBuf;  /*!< \brief Encoded records of passive quantities. */
+  std::vector<CTarget> targets;                 /*!< \brief Results of the passive quantities. */
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  std::vector<su2double> activeSend, activeRecv;  /*!< \brief Sums of AD-active quantities. */
+  std::vector<std::pair<su2double*, size_t> > activeTargets;  /*!< \brief Results of the active sums. */
+#endif
+
+  std::vector<std::function<void()> > finalizers;  /*!< \brief Deferred finalization functions. */
+
+  bool batchOpen = false;   /*!< \brief Whether Reduce calls are deferred. */
+  bool inFlight = false;    /*!< \brief Whether a reduction has been started but not completed. */
+
+#ifdef HAVE_MPI
+  MPI_Request request;                          /*!< \brief Request of the non-blocking collective. */
+  std::map<size_t, MPI_Datatype> recordTypes;   /*!< \brief All the records as a single element, by buffer size. */
+  MPI_Op recordOp = MPI_OP_NULL;                /*!< \brief Operation that reduces the records. */
+#endif
+
+  /*!
+   * \brief Append a record of passive values to the buffer.
+   */
+  void AddRecord(OP op, passivedouble* values, passivedouble* payload, size_t n, size_t payloadSize);
+
+  /*!
+   * \brief Start the reduction of the registered quantities.
+   */
+  void Start();
+
+  CMonitorReduction() = default;
+
+public:
+  /*!
+   * \brief Get the (unique) instance of the class.
+   */
+  static CMonitorReduction& GetInstance();
+
+  /*!
+   * \brief Reduce the combination of the encoded records in "in" into "inout" (exposed for MPI).
+   */
+  static void CombineRecords(const passivedouble* in, passivedouble* inout);
+
+  /*!
+   * \brief Register values for a sum reduction.
+   */
+  inline void Sum(passivedouble* values, size_t n) { AddRecord(OP::SUM, values, nullptr, n, 0); }
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  /*!
+   * \brief Register AD-active values for a sum reduction.
+   */
+  void Sum(su2double* values, size_t n);
+#endif
+
+  /*!
+   * \brief Register values for a min reduction.
+   */
+  inline void Min(passivedouble* values, size_t n) { AddRecord(OP::MIN, values, nullptr, n, 0); }
+
+  /*!
+   * \brief Register values for a max reduction.
+   */
+  inline void Max(passivedouble* values, size_t n) { AddRecord(OP::MAX, values, nullptr, n, 0); }
+
+  /*!
+   * \brief Register values for a max reduction that also returns the payload of the maxima.
+   * \param[in,out] values - Values.
+   * \param[in,out] payload - Payload, payloadSize entries per value (e.g. point index and coordinates).
+   * \param[in] n - Number of values.
+   * \param[in] payloadSize - Size of the payload of each value.
+   */
+  inline void MaxLoc(passivedouble* values, passivedouble* payload, size_t n, size_t payloadSize) {
+    AddRecord(OP::MAXLOC, values, payload, n, payloadSize);
+  }
+
+  /*!
+   * \brief Reduce the registered quantities and then call the finalization function.
+   * \note If a batch is open both are deferred to the end of the batch.
+   * \param[in] finalize - Function that uses the reduced values.
+   */
+  void Reduce(std::function<void()> finalize = nullptr);
+
+  /*!
+   * \brief Reduce the registered quantities (including those of an open batch) immediately.
+   */
+  void ReduceNow();
+
+  /*!
+   * \brief Open a batch, subsequent reductions are deferred.
+   */
+  void Begin();
+
+  /*!
+   * \brief Close the batch and reduce the quantities registered in it.
+   * \param[in] wait - If false the reduction is only started, and it must be completed by Complete.
+   */
+  void End(bool wait = true);
+
+  /*!
+   * \brief Wait for the reduction, write the results, and call the finalization functions.
+   */
+  void Complete();
+
+  /*!
+   * \brief Complete any pending reduction and free the cached MPI types and operation.
+   * \note Must be called before MPI is finalized.
+   */
+  void Clear();
+
+};
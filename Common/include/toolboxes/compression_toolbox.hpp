@@ -0,0 +1,201 @@
+/*!
+ * \file compression_toolbox.hpp
+ * \brief Lightweight compression of floating point data (e.g. solution checkpoints).
+ *        The implementations are in the <i>compression_toolbox.cpp</i> file.
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../code_config.hpp"
+
+namespace CompressionToolbox {
+
+/*!
+ * \brief Lossless compression of an array of doubles.
+ * \note Each value is predicted by the value "stride" positions before (e.g. the same field of the
+ *       previous point in point-major data), the bits of the prediction residual (XOR) are split
+ *       into byte planes, most significant first, and runs of zero bytes are encoded by their length.
+ *       Smooth data has residuals with many leading zero bytes, which makes the first planes compress well.
+ * \param[in] data - Values to compress.
+ * \param[in] n - Number of values.
+ * \param[in] stride - Distance between a value and its predictor (>= 1).
+ * \param[out] buffer - Compressed data (the number of values and the stride are not stored).
+ */
+void CompressLossless(const passivedouble* data, size_t n, size_t stride, std::vector<uint8_t>& buffer);
+
+/*!
+ * \brief Inverse of CompressLossless.
+ * \param[in] buffer - Compressed data.
+ * \param[in] size - Size of the compressed data in bytes.
+ * \param[in] n - Number of values.
+ * \param[in] stride - Stride used for compression.
+ * \param[out] data - Decompressed values.
+ * \return False if the buffer is not consistent with n.
+ */
+bool DecompressLossless(const uint8_t* buffer, size_t size, size_t n, size_t stride, passivedouble* data);
+
+/*!
+ * \brief Error-bounded lossy compression of an array of doubles.
+ * \note The mantissas are truncated to the number of bits that guarantees |x - x'| <= tolerance * |x|,
+ *       which zeroes the last byte planes, and the result is compressed with CompressLossless (use
+ *       DecompressLossless to decompress). Zeros, subnormals, infinities, and NaNs are not modified.
+ * \param[in] data - Values to compress.
+ * \param[in] n - Number of values.
+ * \param[in] stride - Distance between a value and its predictor (>= 1).
+ * \param[in] tolerance - Relative error bound, 0 is lossless.
+ * \param[out] buffer - Compressed data.
+ */
+void CompressLossy(const passivedouble* data, size_t n, size_t stride, passivedouble tolerance,
+                   std::vector<uint8_t>& buffer);
+
+/*!
+ * \brief Compress a block of point-major data field by field (stride 1 within each field).
+ * \param[in] data - Values of the block, nPoint x nField.
+ * \param[in] nPoint - Number of points.
+ * \param[in] nField - Number of fields.
+ * \param[in] tolerance - Relative error bound of each field (see CompressLossy), 0 is lossless.
+ * \param[in,out] buffer - The compressed fields are appended to it.
+ * \param[out] sizes - Compressed size of each field.
+ */
+void CompressBlock(const passivedouble* data, size_t nPoint, size_t nField, const passivedouble* tolerance,
+                   std::vector<uint8_t>& buffer, uint64_t* sizes);
+
+/*!
+ * \brief Inverse of CompressBlock.
+ * \param[in] buffer - Compressed fields of the block.
+ * \param[in] sizes - Compressed size of each field.
+ * \param[in] nPoint - Number of points.
+ * \param[in] nField - Number of fields.
+ * \param[out] data - Values of the block, nPoint x nField.
+ * \return False if the buffer is not consistent with the sizes.
+ */
+bool DecompressBlock(const uint8_t* buffer, const uint64_t* sizes, size_t nPoint, size_t nField, passivedouble* data);
+
+/*!
+ * \brief First int of compressed restart files, the uncompressed ones use 535532 (hex for "SU2").
+ */
+constexpr int COMPRESSED_RESTART_MAGIC = 535533;
+
+/*!
+ * \brief Maximum number of points of the blocks of compressed restart files.
+ */
+constexpr uint64_t RESTART_BLOCK_SIZE = 8192;
+
+/*!
+ * \class CRestartBlockTable
+ * \brief Offset table of a compressed restart file.
+ * \note Compressed restart files have the header {COMPRESSED_RESTART_MAGIC, nField, nPointGlobal, nBlock,
+ *       compression}, the names of the fields (as uncompressed files), this table, and the data section.
+ *       The points are split in blocks (in order of global index) and each block is compressed with
+ *       CompressBlock. The table has one entry per block: first point, number of points, offset of the
+ *       block in the data section, and the compressed size of each field. Readers only read and decompress
+ *       the blocks that contain their points.
+ */
+class CRestartBlockTable {
+private:
+  size_t nField;                  /*!< \brief Number of fields. */
+  std::vector<uint64_t> entries;  /*!< \brief Entries of all the blocks. */
+
+public:
+  /*!
+   * \brief Construct an empty table.
+   * \param[in] nFld - Number of fields.
+   */
+  explicit CRestartBlockTable(size_t nFld = 0) : nField(nFld) {}
+
+  /*!
+   * \brief Size of the entries in number of uint64_t.
+   */
+  inline size_t GetEntrySize() const { return 3 + nField; }
+
+  /*!
+   * \brief Number of blocks.
+   */
+  inline size_t GetnBlock() const { return entries.size() / GetEntrySize(); }
+
+  /*!
+   * \brief Resize the table (e.g. before reading it from file).
+   */
+  inline void Resize(size_t nBlock) { entries.resize(nBlock * GetEntrySize()); }
+
+  /*!
+   * \brief Raw entries, to read or write the table.
+   */
+  inline uint64_t* GetData() { return entries.data(); }
+  inline const uint64_t* GetData() const { return entries.data(); }
+
+  inline uint64_t GetFirstPoint(size_t iBlock) const { return entries[iBlock*GetEntrySize()]; }
+  inline uint64_t GetnPoint(size_t iBlock) const { return entries[iBlock*GetEntrySize()+1]; }
+  inline uint64_t GetOffset(size_t iBlock) const { return entries[iBlock*GetEntrySize()+2]; }
+  inline const uint64_t* GetFieldSizes(size_t iBlock) const { return &entries[iBlock*GetEntrySize()+3]; }
+
+  /*!
+   * \brief Compressed size of a block (all fields).
+   */
+  uint64_t GetSize(size_t iBlock) const;
+
+  /*!
+   * \brief Append a block.
+   */
+  void AddBlock(uint64_t firstPoint, uint64_t nPoint, uint64_t offset, const uint64_t* sizes);
+
+  /*!
+   * \brief Shift the offsets of all the blocks (e.g. by the offset of the data of a rank).
+   */
+  void ShiftOffsets(uint64_t shift);
+
+  /*!
+   * \brief Check that the blocks are contiguous and cover all the points.
+   */
+  bool Check(uint64_t nPointGlobal) const;
+
+  /*!
+   * \brief Find the blocks that contain some points.
+   * \param[in] points - Global indices of the points, sorted.
+   * \param[in] nPoint - Number of points.
+   * \param[out] blocks - Indices of the blocks (sorted).
+   * \return False if some point is not in the table.
+   */
+  bool FindBlocks(const unsigned long* points, size_t nPoint, std::vector<size_t>& blocks) const;
+};
+
+/*!
+ * \brief Read the data of a compressed restart file at some points, the header was read already.
+ * \note Only the blocks that contain the points are read (collectively with MPI) and decompressed.
+ *       Errors in the file are fatal (SU2_MPI::Error).
+ * \param[in] filename - Name of the restart file (with extension).
+ * \param[in] header - First ints of the file {COMPRESSED_RESTART_MAGIC, nField, nPointGlobal, nBlock, compression}.
+ * \param[in] points - Global indices of the points, sorted.
+ * \param[in] nPoint - Number of points.
+ * \param[out] data - Values of the points, nPoint x nField.
+ */
+void ReadRestartBlocks(const std::string& filename, const int* header, const unsigned long* points, size_t nPoint,
+                       passivedouble* data);
+
+}
@@ -663,6 +663,11 @@ unsigned short CConfig::GetnZone(string val_mesh_filename, unsigned short val_fo
       nZone = 1;
       break;
     }
+    case SU2_BINARY: {
+      /*--- One file per zone. ---*/
+      nZone = 1;
+      break;
+    }
   }
 
   return (unsigned short) nZone;
@@ -773,6 +778,22 @@ unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_for
       nDim = 3;
       break;
     }
+    case SU2_BINARY: {
+
+      /*--- The dimension is the third entry of the header. ---*/
+      unsigned long header[BINARY_MESH_HEADER_SIZE] = {0};
+      ifstream mesh_file(val_mesh_filename, ios::in | ios::binary);
+      if (mesh_file.fail()) {
+        SU2_MPI::Error(string("The SU2 binary mesh file named ") + val_mesh_filename + string(" was not found."), CURRENT_FUNCTION);
+      }
+      mesh_file.read(reinterpret_cast<char*>(header), sizeof(header));
+
+      if (!mesh_file || (header[BINARY_MESH_MAGIC] != SU2_BINARY_MESH_MAGIC)) {
+        SU2_MPI::Error(val_mesh_filename + string(" is not an SU2 binary mesh file."), CURRENT_FUNCTION);
+      }
+      nDim = header[BINARY_MESH_NDIM];
+      break;
+    }
   }
 
   /*--- After reading the mesh, assert that the dimension is equal to 2 or 3. ---*/
@@ -963,6 +984,10 @@ void CConfig::SetPointersNull(void) {
 
   Omega_HB = nullptr;
 
+  /* Relative cost of the zones */
+
+  Zone_Cost = nullptr;
+
   /*--- Initialize some default arrays to NULL. ---*/
 
   Riemann_FlowDir       = nullptr;
@@ -1021,6 +1046,7 @@ void CConfig::SetPointersNull(void) {
   nSpanMaxAllZones = 1;
 
   Restart_Bandwidth_Agg = 0.0;
+  Mesh_Read_Bandwidth = 0.0;
 
   Mesh_Box_Size = nullptr;
 
@@ -1068,6 +1094,10 @@ void CConfig::SetConfig_Options() {
   addBoolOption("MULTIZONE", Multizone_Problem, NO);
   /*!\brief PHYSICAL_PROBLEM \n DESCRIPTION: Physical governing equations \n Options: see \link Solver_Map \endlink \n DEFAULT: NO_SOLVER \ingroup Config*/
   addEnumOption("MULTIZONE_SOLVER", Kind_MZSolver, Multizone_Map, ENUM_MULTIZONE::MZ_BLOCK_GAUSS_SEIDEL);
+  /*!\brief CONCURRENT_ZONES \n DESCRIPTION: Compute each zone on its own subset of the ranks (block Jacobi coupling) \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("CONCURRENT_ZONES", Concurrent_Zones, false);
+  /*!\brief ZONE_COST \n DESCRIPTION: Relative cost of each zone, the ranks are distributed proportionally (concurrent zones) \ingroup Config*/
+  addDoubleListOption("ZONE_COST", nZone_Cost, Zone_Cost);
 #ifdef CODI_REVERSE_TYPE
   const bool discAdjDefault = true;
 #else
@@ -1079,6 +1109,8 @@ void CConfig::SetConfig_Options() {
   addEnumOption("KIND_TURB_MODEL", Kind_Turb_Model, Turb_Model_Map, NO_TURB_MODEL);
   /*!\brief KIND_TRANS_MODEL \n DESCRIPTION: Specify transition model OPTIONS: see \link Trans_Model_Map \endlink \n DEFAULT: NO_TRANS_MODEL \ingroup Config*/
   addEnumOption("KIND_TRANS_MODEL", Kind_Trans_Model, Trans_Model_Map, NO_TRANS_MODEL);
+  /*!\brief KIND_WALL_DISTANCE \n DESCRIPTION: Method to compute the wall distance OPTIONS: see \link Wall_Distance_Map \endlink \n DEFAULT: EXACT \ingroup Config*/
+  addEnumOption("KIND_WALL_DISTANCE", Kind_WallDistance, Wall_Distance_Map, WALL_DISTANCE_METHOD::EXACT);
 
   /*!\brief KIND_SGS_MODEL \n DESCRIPTION: Specify subgrid scale model OPTIONS: see \link SGS_Model_Map \endlink \n DEFAULT: NO_SGS_MODEL \ingroup Config*/
   addEnumOption("KIND_SGS_MODEL", Kind_SGS_Model, SGS_Model_Map, NO_SGS_MODEL);
@@ -1598,6 +1630,10 @@ void CConfig::SetConfig_Options() {
   addUShortArrayOption("NEWTON_KRYLOV_IPARAM", NK_IntParam.size(), NK_IntParam.data());
   /* DESCRIPTION: Double parameters {startup residual drop, precond tolerance, full tolerance residual drop, findiff step}. */
   addDoubleArrayOption("NEWTON_KRYLOV_DPARAM", NK_DblParam.size(), NK_DblParam.data());
+  /* DESCRIPTION: Keep the limiters and dissipation coefficients of the current solution in the finite difference products. */
+  addBoolOption("NEWTON_KRYLOV_FROZEN_COEFF", NK_FrozenCoeff, false);
+  /* DESCRIPTION: Compute the NK products edge by edge with the flux Jacobians of the vectorized numerics. */
+  addBoolOption("NEWTON_KRYLOV_EDGE_PRODUCTS", NK_EdgeProducts, false);
 
   /* DESCRIPTION: Number of samples for quasi-Newton methods. */
   addUnsignedShortOption("QUASI_NEWTON_NUM_SAMPLES", nQuasiNewtonSamples, 0);
@@ -1645,8 +1681,14 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("HB_PERIOD", HarmonicBalance_Period, -1.0);
   /* DESCRIPTION:  Turn on/off harmonic balance preconditioning */
   addBoolOption("HB_PRECONDITION", HB_Precondition, false);
+  /* DESCRIPTION: Number of groups of ranks that compute the harmonic balance instances concurrently */
+  addUnsignedShortOption("HB_INSTANCE_GROUPS", nHB_InstanceGroups, 1);
   /* DESCRIPTION: Starting direct solver iteration for the unsteady adjoint */
   addLongOption("UNST_ADJOINT_ITER", Unst_AdjointIter, 0);
+  /* DESCRIPTION: Number of primal states kept in memory by the unsteady adjoint (0 to always read from file) */
+  addUnsignedShortOption("UNST_ADJOINT_CHECKPOINTS", Unst_AdjointCheckpoints, 0);
+  /* DESCRIPTION: Lossless compression of the primal states kept in memory by the unsteady adjoint */
+  addBoolOption("UNST_ADJOINT_CHECKPOINT_COMPRESSION", Unst_AdjointCheckpointCompression, false);
   /* DESCRIPTION: Number of iterations to average the objective */
   addLongOption("ITER_AVERAGE_OBJ", Iter_Avg_Objective , 0);
   /* DESCRIPTION: Time discretization */
@@ -1685,6 +1727,12 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("LINEAR_SOLVER_ITER", Linear_Solver_Iter, 10);
   /* DESCRIPTION: Fill in level for the ILU preconditioner */
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
+  /* DESCRIPTION: Maximum number of levels (including the finest) of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_LEVELS", Linear_Solver_AMG_Levels, 10);
+  /* DESCRIPTION: Number of pre and post smoothing (block Gauss-Seidel) sweeps of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_SWEEPS", Linear_Solver_AMG_Sweeps, 1);
+  /* DESCRIPTION: Strength of connection threshold used by the AMG preconditioner to form aggregates */
+  addDoubleOption("LINEAR_SOLVER_AMG_STRENGTH", Linear_Solver_AMG_Strength, 0.08);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
   /* DESCRIPTION: Relaxation factor for iterative linear smoothers (SMOOTHER_ILU/JACOBI/LU-SGS/LINELET) */
@@ -1767,6 +1815,10 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("MG_DAMP_RESTRICTION", Damp_Res_Restric, 0.75);
   /*!\brief MG_DAMP_PROLONGATION\n DESCRIPTION: Damping factor for the correction prolongation. DEFAULT 0.75 \ingroup Config*/
   addDoubleOption("MG_DAMP_PROLONGATION", Damp_Correc_Prolong, 0.75);
+  /*!\brief MG_TURBULENCE\n DESCRIPTION: Use the multigrid cycle also for the turbulence equations. DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_TURBULENCE", MG_Turb, false);
+  /*!\brief MG_PARTITION_AGGLOMERATION\n DESCRIPTION: Agglomerate the coarse levels across the partition interfaces (uses two layers of halo points). DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_PARTITION_AGGLOMERATION", MG_PartitionAgglomeration, false);
 
   /*!\par CONFIG_CATEGORY: Spatial Discretization \ingroup Config*/
   /*--- Options related to the spatial discretization ---*/
@@ -1942,6 +1994,8 @@ void CConfig::SetConfig_Options() {
   addStringOption("MESH_FILENAME", Mesh_FileName, string("mesh.su2"));
   /*!\brief MESH_OUT_FILENAME \n DESCRIPTION: Mesh output file name. Used when converting, scaling, or deforming a mesh. \n DEFAULT: mesh_out.su2 \ingroup Config*/
   addStringOption("MESH_OUT_FILENAME", Mesh_Out_FileName, string("mesh_out.su2"));
+  /*!\brief MESH_OUT_FORMAT \n DESCRIPTION: Mesh output file format, SU2 or SU2_BINARY (the extension is set accordingly). Used when converting, scaling, or deforming a mesh. \n DEFAULT: SU2 \ingroup Config*/
+  addEnumOption("MESH_OUT_FORMAT", Mesh_Out_FileFormat, Input_Map, SU2);
 
   /* DESCRIPTION: List of the number of grid points in the RECTANGLE or BOX grid in the x,y,z directions. (default: (33,33,33) ). */
   addShortListOption("MESH_BOX_SIZE", nMesh_Box_Size, Mesh_Box_Size);
@@ -2428,6 +2482,12 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Tolerance to prune small coefficients from the RBF interpolation matrix. */
   addDoubleOption("RADIAL_BASIS_FUNCTION_PRUNE_TOLERANCE", RadialBasisFunction_PruneTol, 1e-6);
 
+  /* DESCRIPTION: Use local sparse systems (compact kernels only) instead of inverting the dense RBF matrix. */
+  addBoolOption("RADIAL_BASIS_FUNCTION_SPARSE", RadialBasisFunction_Sparse, false);
+
+  /* DESCRIPTION: Radius of the donor patch of each target point in sparse RBF mode, as a multiple of the RBF radius. */
+  addDoubleOption("RADIAL_BASIS_FUNCTION_PATCH_FACTOR", RadialBasisFunction_PatchFactor, 3.0);
+
    /*!\par INLETINTERPOLATION \n
    * DESCRIPTION: Type of spanwise interpolation to use for the inlet face. \n OPTIONS: see \link Inlet_SpanwiseInterpolation_Map \endlink
    * Sets Kind_InletInterpolation \ingroup Config
@@ -2742,6 +2802,12 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("OUTPUT_WRT_FREQ", VolumeWrtFreq, 250);
   /* DESCRIPTION: Volume solution files */
   addEnumListOption("OUTPUT_FILES", nVolumeOutputFiles, VolumeOutputFiles, Output_Map);
+  /* DESCRIPTION: Number of binary restart files that are written asynchronously (other formats are always synchronous), 0 writes them synchronously */
+  addUnsignedShortOption("ASYNC_RESTART_BUFFERS", AsyncRestartBuffers, 0);
+  /* DESCRIPTION: Compression of binary restart files (NONE, LOSSLESS, LOSSY) */
+  addEnumOption("RESTART_COMPRESSION", Restart_Compression, RestartCompression_Map, RESTART_COMPRESSION::NONE);
+  /* DESCRIPTION: Relative error bound of the fields that are compressed with loss (RESTART_COMPRESSION= LOSSY) */
+  addDoubleOption("RESTART_COMPRESSION_TOL", Restart_Compression_Tol, 1e-6);
 
   /* DESCRIPTION: Using Uncertainty Quantification with SST Turbulence Model */
   addBoolOption("USING_UQ", using_uq, false);
@@ -2769,6 +2835,9 @@ void CConfig::SetConfig_Options() {
 
   /* DESCRIPTION: Size of the edge groups colored for thread parallel edge loops (0 forces the reducer strategy). */
   addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", edgeColorGroupSize, 512);
+
+  /* DESCRIPTION: Overlap the halo exchange of reconstruction gradients and limiters with the interior edges of FVM solvers. */
+  addBoolOption("OVERLAP_HALO_COMMS", overlapHaloComms, false);
   
   /*--- options that are used for libROM ---*/
   /*!\par CONFIG_CATEGORY:libROM options \ingroup Config*/
@@ -3263,6 +3332,10 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     }
   }
 
+  if (Mesh_Out_FileFormat != SU2 && Mesh_Out_FileFormat != SU2_BINARY) {
+    SU2_MPI::Error("MESH_OUT_FORMAT must be SU2 or SU2_BINARY.", CURRENT_FUNCTION);
+  }
+
   if (Kind_Solver == NAVIER_STOKES && Kind_Turb_Model != NONE){
     SU2_MPI::Error("KIND_TURB_MODEL must be NONE if SOLVER= NAVIER_STOKES", CURRENT_FUNCTION);
   }
@@ -3512,6 +3585,10 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if ((ContinuousAdjoint && !MG_AdjointFlow) ||
       (TimeMarching == TIME_MARCHING::TIME_STEPPING)) { nMGLevels = 0; }
 
+  /*--- The turbulence multigrid is only implemented for the direct (and discrete adjoint) solvers. ---*/
+
+  if (ContinuousAdjoint || (Kind_Turb_Model == NONE)) MG_Turb = false;
+
   if (Kind_Solver == EULER ||
       Kind_Solver == NAVIER_STOKES ||
       Kind_Solver == RANS ||
@@ -4694,6 +4771,16 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     Streamwise_Periodic_Temperature = false;
   }
 
+  /*--- The Poisson wall distance does not track the closest wall element, nor is it differentiated. ---*/
+  if (Kind_WallDistance == WALL_DISTANCE_METHOD::POISSON) {
+    if (nRough_Wall > 0)
+      SU2_MPI::Error("KIND_WALL_DISTANCE= POISSON is not compatible with WALL_ROUGHNESS.", CURRENT_FUNCTION);
+    if (DiscreteAdjoint)
+      SU2_MPI::Error("KIND_WALL_DISTANCE= POISSON is not available for the discrete adjoint.", CURRENT_FUNCTION);
+    if (nMarker_PerBound > 0)
+      SU2_MPI::Error("KIND_WALL_DISTANCE= POISSON is not compatible with periodic boundaries.", CURRENT_FUNCTION);
+  }
+
   /*--- Check that if the wall roughness array are compatible and set deafult values if needed. ---*/
    if ((nMarker_HeatFlux > 0) || (nMarker_Isothermal > 0) || (nMarker_HeatTransfer) || (nMarker_CHTInterface > 0)) {
 
@@ -6450,10 +6537,14 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
             SU2_MPI::Error("Implicit time scheme is not working with NEMO. Use EULER_EXPLICIT.", CURRENT_FUNCTION);
           switch (Kind_Linear_Solver) {
             case BCGSTAB:
+            case PIPELINED_BCGSTAB:
             case FGMRES:
             case RESTARTED_FGMRES:
+            case LOW_SYNC_FGMRES:
               if (Kind_Linear_Solver == BCGSTAB)
                 cout << "BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == PIPELINED_BCGSTAB)
+                cout << "Pipelined BCGSTAB is used for solving the linear system." << endl;
               else
                 cout << "FGMRES is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
@@ -6461,6 +6552,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG:     cout << "Using an algebraic multigrid preconditioning."<< endl; break;
               }
               break;
             case SMOOTHER:
@@ -6469,6 +6561,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
                 case LINELET: cout << "A Linelet"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
+                case AMG:     cout << "An algebraic multigrid"; break;
               }
               cout << " method is used for smoothing the linear system." << endl;
               break;
@@ -6496,17 +6589,17 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
         case STRUCT_TIME_INT::NEWMARK_IMPLICIT:
           if (Dynamic_Analysis) cout << "Newmark implicit method for the structural time integration." << endl;
           switch (Kind_Linear_Solver) {
-            case BCGSTAB:
+            case BCGSTAB: case PIPELINED_BCGSTAB:
               cout << "BCGSTAB is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
-            case FGMRES: case RESTARTED_FGMRES:
+            case FGMRES: case RESTARTED_FGMRES: case LOW_SYNC_FGMRES:
               cout << "FGMRES is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
-            case CONJUGATE_GRADIENT:
+            case CONJUGATE_GRADIENT: case PIPELINED_CG:
               cout << "A Conjugate Gradient method is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
@@ -7485,6 +7578,8 @@ CConfig::~CConfig(void) {
 
   delete [] Omega_HB;
 
+  delete [] Zone_Cost;
+
   /*--- Marker pointers ---*/
 
   delete[] Marker_CfgFile_GeoEval;
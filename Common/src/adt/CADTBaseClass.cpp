@@ -30,6 +30,7 @@
 #include "../../include/adt/CADTComparePointClass.hpp"
 
 #include <algorithm>
+#include <limits>
 
 void CADTBaseClass::BuildADT(unsigned short  nDim,
                              unsigned long   nPoints,
@@ -211,3 +212,102 @@ void CADTBaseClass::BuildADT(unsigned short  nDim,
     for(unsigned long i=0; i<nPointIDs[nLeavesToDivide]; ++i) pointIDs[i]  = pointIDsNew[i];
   }
 }
+
+#ifdef HAVE_MPI
+void CADTBaseClass::DeterminePrunedCommPattern(unsigned short         nDim,
+                                               unsigned long          nLocal,
+                                               const su2double        *coor,
+                                               const ADTSearchPoints  &searchPts,
+                                               vector<int>            &recvRanks,
+                                               vector<int>            &sendRanks) {
+
+  const int size = SU2_MPI::GetSize();
+  const unsigned short nDimBox = 2*nDim;
+
+  /*--- Determine the bounding box of the local points, an empty box is
+        marked by minimum coordinates larger than the maximum ones. ---*/
+  vector<passivedouble> localBox(nDimBox);
+  for(unsigned short k=0; k<nDim; ++k) {
+    localBox[k]      =  numeric_limits<passivedouble>::max();
+    localBox[nDim+k] = -numeric_limits<passivedouble>::max();
+  }
+  for(unsigned long i=0; i<nLocal; ++i) {
+    for(unsigned short k=0; k<nDim; ++k) {
+      const passivedouble x = SU2_TYPE::GetValue(coor[i*nDim+k]);
+      localBox[k]      = min(localBox[k], x);
+      localBox[nDim+k] = max(localBox[nDim+k], x);
+    }
+  }
+
+  /*--- Make the boxes available on all ranks, the boxes are passive data
+        as they are only used to determine the communication pattern. ---*/
+  vector<passivedouble> boxes(nDimBox*size);
+  SelectMPIWrapper<passivedouble>::W::Allgather(localBox.data(), nDimBox, MPI_DOUBLE, boxes.data(),
+                                                nDimBox, MPI_DOUBLE, SU2_MPI::GetComm());
+
+  vector<int> candidates;
+  for(int iRank=0; iRank<size; ++iRank)
+    if(boxes[nDimBox*iRank] <= boxes[nDimBox*iRank+nDim]) candidates.push_back(iRank);
+
+  /*--- For each search point determine the upper bound of the distance to the nearest
+        entity, i.e. the smallest maximum distance to a box, and flag the ranks with
+        a box within that distance. ---*/
+  vector<char> needed(size, 0);
+
+  SU2_OMP_PARALLEL
+  {
+    vector<char> neededLocal(size, 0);
+    vector<passivedouble> minDist2(candidates.size());
+
+    for(const auto& pts : searchPts) {
+
+      SU2_OMP_FOR_DYN(256)
+      for(unsigned long iPoint=0; iPoint<pts.second; ++iPoint) {
+
+        const su2double *xP = pts.first + iPoint*nDim;
+        passivedouble bound = numeric_limits<passivedouble>::max();
+
+        for(unsigned long i=0; i<candidates.size(); ++i) {
+          const passivedouble *BBMin = boxes.data() + nDimBox*candidates[i];
+          const passivedouble *BBMax = BBMin + nDim;
+
+          passivedouble dMin = 0.0, dMax = 0.0;
+          for(unsigned short k=0; k<nDim; ++k) {
+            const passivedouble x = SU2_TYPE::GetValue(xP[k]);
+            const passivedouble dOut = max(max(BBMin[k]-x, x-BBMax[k]), 0.0);
+            const passivedouble dFar = max(fabs(x-BBMin[k]), fabs(x-BBMax[k]));
+            dMin += dOut*dOut;
+            dMax += dFar*dFar;
+          }
+          minDist2[i] = dMin;
+          bound = min(bound, dMax);
+        }
+
+        /* Small tolerance to be safe against round off. */
+        bound = bound*(1.0+1.e-8) + 1.e-30;
+        for(unsigned long i=0; i<candidates.size(); ++i)
+          if(minDist2[i] <= bound) neededLocal[candidates[i]] = 1;
+      }
+      END_SU2_OMP_FOR
+    }
+
+    SU2_OMP_CRITICAL
+    for(int iRank=0; iRank<size; ++iRank) needed[iRank] |= neededLocal[iRank];
+    END_SU2_OMP_CRITICAL
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- Tell the other ranks which data is needed from them. ---*/
+  vector<int> sendFlags(size), recvFlags(size);
+  for(int iRank=0; iRank<size; ++iRank) recvFlags[iRank] = needed[iRank];
+
+  SU2_MPI::Alltoall(recvFlags.data(), 1, MPI_INT, sendFlags.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  recvRanks.clear();
+  sendRanks.clear();
+  for(int iRank=0; iRank<size; ++iRank) {
+    if(recvFlags[iRank]) recvRanks.push_back(iRank);
+    if(sendFlags[iRank]) sendRanks.push_back(iRank);
+  }
+}
+#endif
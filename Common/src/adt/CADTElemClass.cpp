@@ -181,6 +181,82 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
 
 #endif
 
+  /*--- Build the tree of the elements. ---*/
+  BuildElemADT();
+}
+
+CADTElemClass::CADTElemClass(unsigned short         val_nDim,
+                             vector<su2double>      &val_coor,
+                             vector<unsigned long>  &val_connElem,
+                             vector<unsigned short> &val_VTKElem,
+                             vector<unsigned short> &val_markerID,
+                             vector<unsigned long>  &val_elemID,
+                             const ADTSearchPoints  &searchPoints) {
+
+  /* Copy the dimension of the problem into nDim. */
+  nDim = val_nDim;
+
+  /* Allocate some thread-safe working variables if required. */
+#ifdef HAVE_OMP
+  BBoxTargets.resize(omp_get_max_threads());
+  FrontLeaves.resize(omp_get_max_threads());
+  FrontLeavesNew.resize(omp_get_max_threads());
+#endif
+
+#ifdef HAVE_MPI
+
+  /*--- Determine which ranks may have the nearest elements to the search
+        points of this rank, and which ranks need the elements of this rank. ---*/
+  vector<int> recvRanks, sendRanks;
+  DeterminePrunedCommPattern(nDim, val_coor.size()/nDim, val_coor.data(), searchPoints,
+                             recvRanks, sendRanks);
+
+  /*--- Gather the data of those ranks only. ---*/
+  vector<unsigned long> coorDispls, elemDispls, connDispls;
+
+  SparseAllgatherv(val_coor.data(), val_coor.size(), MPI_DOUBLE, sendRanks, recvRanks,
+                   coorPoints, coorDispls);
+  SparseAllgatherv(val_VTKElem.data(), val_VTKElem.size(), MPI_UNSIGNED_SHORT, sendRanks, recvRanks,
+                   elemVTK_Type, elemDispls);
+  SparseAllgatherv(val_markerID.data(), val_markerID.size(), MPI_UNSIGNED_SHORT, sendRanks, recvRanks,
+                   localMarkers, elemDispls);
+  SparseAllgatherv(val_elemID.data(), val_elemID.size(), MPI_UNSIGNED_LONG, sendRanks, recvRanks,
+                   localElemIDs, elemDispls);
+  SparseAllgatherv(val_connElem.data(), val_connElem.size(), MPI_UNSIGNED_LONG, sendRanks, recvRanks,
+                   elemConns, connDispls);
+
+  /*--- Correct the connectivities with the offset of the points of each
+        rank and store the ranks where the elements come from. ---*/
+  ranksOfElems.resize(elemVTK_Type.size());
+
+  for(unsigned long i=0; i<recvRanks.size(); ++i) {
+    const unsigned long offsetRank = coorDispls[i]/nDim;
+    for(unsigned long j=connDispls[i]; j<connDispls[i+1]; ++j)
+      elemConns[j] += offsetRank;
+
+    for(unsigned long j=elemDispls[i]; j<elemDispls[i+1]; ++j)
+      ranksOfElems[j] = recvRanks[i];
+  }
+
+#else
+
+  /*--- Sequential mode, the local tree is the global tree. ---*/
+  coorPoints   = val_coor;
+  elemConns    = val_connElem;
+  elemVTK_Type = val_VTKElem;
+  localMarkers = val_markerID;
+  localElemIDs = val_elemID;
+
+  ranksOfElems.assign(elemVTK_Type.size(), MASTER_NODE);
+
+#endif
+
+  /*--- Build the tree of the elements. ---*/
+  BuildElemADT();
+}
+
+void CADTElemClass::BuildElemADT() {
+
     /*--- Determine the values of the vector nDOFsPerElem, which contains the
         number of DOFs per element in cumulative storage format. ---*/
   const unsigned long nElem = elemVTK_Type.size();
@@ -114,6 +114,51 @@ CADTPointsOnlyClass::CADTPointsOnlyClass(unsigned short nDim,
   for (auto& vec : FrontLeavesNew) vec.reserve(200);
 }
 
+CADTPointsOnlyClass::CADTPointsOnlyClass(unsigned short        nDim,
+                                         unsigned long         nPoints,
+                                         const su2double       *coor,
+                                         const unsigned long   *pointID,
+                                         const ADTSearchPoints &searchPoints) {
+
+  /* Allocate some thread-safe working variables if required. */
+#ifdef HAVE_OMP
+  FrontLeaves.resize(omp_get_max_threads());
+  FrontLeavesNew.resize(omp_get_max_threads());
+#endif
+
+#ifdef HAVE_MPI
+
+  /*--- Determine which ranks may have the nearest points to the search
+        points of this rank, and gather the points of those ranks only. ---*/
+  vector<int> recvRanks, sendRanks;
+  DeterminePrunedCommPattern(nDim, nPoints, coor, searchPoints, recvRanks, sendRanks);
+
+  vector<unsigned long> coorDispls, pointDispls;
+
+  SparseAllgatherv(coor, nDim*nPoints, MPI_DOUBLE, sendRanks, recvRanks, coorPoints, coorDispls);
+  SparseAllgatherv(pointID, nPoints, MPI_UNSIGNED_LONG, sendRanks, recvRanks, localPointIDs, pointDispls);
+
+  ranksOfPoints.resize(localPointIDs.size());
+  for(unsigned long i=0; i<recvRanks.size(); ++i)
+    for(unsigned long j=pointDispls[i]; j<pointDispls[i+1]; ++j)
+      ranksOfPoints[j] = recvRanks[i];
+
+#else
+
+  /*--- Sequential mode, the local tree is the global tree. ---*/
+  coorPoints.assign(coor, coor + nDim*nPoints);
+  localPointIDs.assign(pointID, pointID + nPoints);
+  ranksOfPoints.assign(nPoints, MASTER_NODE);
+
+#endif
+
+  /*--- Build the tree. ---*/
+  BuildADT(nDim, localPointIDs.size(), coorPoints.data());
+
+  for (auto& vec : FrontLeaves) vec.reserve(200);
+  for (auto& vec : FrontLeavesNew) vec.reserve(200);
+}
+
 void CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& frontLeaves,
                                                     vector<unsigned long>& frontLeavesNew,
                                                     const su2double *coor,
@@ -253,3 +298,173 @@ void CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& front
   dist = sqrt(dist);
 
 }
+
+void CADTPointsOnlyClass::DetermineNearestNodes_impl(vector<unsigned long>& frontLeaves,
+                                                     vector<unsigned long>& frontLeavesNew,
+                                                     const su2double       *coor,
+                                                     unsigned long         nNodes,
+                                                     vector<su2double>     &dist2,
+                                                     vector<unsigned long> &pointID,
+                                                     vector<int>           &rankID) const {
+
+  /*--- During the search pointID stores the indices of the nodes in the tree,
+        and dist2 the corresponding distances squared, both are kept sorted. ---*/
+  dist2.clear();
+  pointID.clear();
+  rankID.clear();
+  if (isEmpty || (nNodes == 0)) return;
+
+  const bool wasActive = AD::BeginPassive();
+
+  auto distanceSquared = [&](unsigned long kk) {
+    const su2double *coorTarget = coorPoints.data() + nDimADT*kk;
+    su2double dist = 0.0;
+    for(unsigned short l=0; l<nDimADT; ++l) {
+      const su2double ds = coor[l] - coorTarget[l];
+      dist += ds*ds;
+    }
+    return dist;
+  };
+
+  /*--- Lexicographic comparison of (distance, point ID) to break ties. ---*/
+  auto closer = [&](su2double distA, unsigned long kkA, su2double distB, unsigned long kkB) {
+    return (distA != distB)? (distA < distB) : (localPointIDs[kkA] < localPointIDs[kkB]);
+  };
+
+  /*--- Insert a node in the sorted list if it is closer than the farthest one. ---*/
+  auto insertNode = [&](unsigned long kk) {
+    const su2double dist = distanceSquared(kk);
+    if (dist2.size() == nNodes) {
+      if (!closer(dist, kk, dist2.back(), pointID.back())) return;
+      dist2.pop_back();
+      pointID.pop_back();
+    }
+    auto pos = dist2.size();
+    while ((pos > 0) && closer(dist, kk, dist2[pos-1], pointID[pos-1])) --pos;
+    dist2.insert(dist2.begin()+pos, dist);
+    pointID.insert(pointID.begin()+pos, kk);
+  };
+
+  /*--- Traverse the tree, a leaf is visited if the list is not full yet or if
+        its possible minimum distance squared does not exceed that of the
+        farthest node in the list (equality is needed for the tie-breaks). ---*/
+
+  frontLeaves.clear();
+  frontLeaves.push_back(0);
+
+  for(;;) {
+
+    frontLeavesNew.clear();
+
+    for(unsigned long i=0; i<frontLeaves.size(); ++i) {
+
+      const unsigned long ll = frontLeaves[i];
+      for(unsigned short mm=0; mm<2; ++mm) {
+
+        const unsigned long kk = leaves[ll].children[mm];
+        if( leaves[ll].childrenAreTerminal[mm] ) {
+
+          /* A tree with a single point stores it in both children. */
+          if((mm == 1) && leaves[ll].childrenAreTerminal[0] && (kk == leaves[ll].children[0])) continue;
+          insertNode(kk);
+        }
+        else {
+
+          su2double posDist = 0.0;
+          for(unsigned short l=0; l<nDimADT; ++l) {
+            su2double ds = 0.0;
+            if(     coor[l] < leaves[kk].xMin[l]) ds = coor[l] - leaves[kk].xMin[l];
+            else if(coor[l] > leaves[kk].xMax[l]) ds = coor[l] - leaves[kk].xMax[l];
+
+            posDist += ds*ds;
+          }
+
+          if((dist2.size() < nNodes) || (posDist <= dist2.back()))
+            frontLeavesNew.push_back(kk);
+        }
+      }
+    }
+
+    frontLeaves.swap(frontLeavesNew);
+    if(frontLeaves.empty()) break;
+  }
+
+  AD::EndPassive(wasActive);
+
+  /*--- Recompute the distances to get the correct dependency if we use AD,
+        and convert the tree indices to point IDs and ranks. ---*/
+  rankID.resize(pointID.size());
+  for(unsigned long i=0; i<pointID.size(); ++i) {
+    const auto kk = pointID[i];
+    dist2[i]   = distanceSquared(kk);
+    pointID[i] = localPointIDs[kk];
+    rankID[i]  = ranksOfPoints[kk];
+  }
+}
+
+void CADTPointsOnlyClass::DetermineNodesInRadius_impl(vector<unsigned long>& frontLeaves,
+                                                      vector<unsigned long>& frontLeavesNew,
+                                                      const su2double       *coor,
+                                                      su2double             radius,
+                                                      vector<unsigned long> &pointID) const {
+  pointID.clear();
+  if (isEmpty) return;
+
+  const bool wasActive = AD::BeginPassive();
+
+  const su2double radius2 = radius*radius;
+
+  /*--- Traverse the tree, a leaf is visited if its possible
+        minimum distance squared is within the radius. ---*/
+
+  frontLeaves.clear();
+  frontLeaves.push_back(0);
+
+  for(;;) {
+
+    frontLeavesNew.clear();
+
+    for(unsigned long i=0; i<frontLeaves.size(); ++i) {
+
+      const unsigned long ll = frontLeaves[i];
+      for(unsigned short mm=0; mm<2; ++mm) {
+
+        const unsigned long kk = leaves[ll].children[mm];
+        if( leaves[ll].childrenAreTerminal[mm] ) {
+
+          /* A tree with a single point stores it in both children. */
+          if((mm == 1) && leaves[ll].childrenAreTerminal[0] && (kk == leaves[ll].children[0])) continue;
+
+          const su2double *coorTarget = coorPoints.data() + nDimADT*kk;
+          su2double dist = 0.0;
+          for(unsigned short l=0; l<nDimADT; ++l) {
+            const su2double ds = coor[l] - coorTarget[l];
+            dist += ds*ds;
+          }
+          if(dist <= radius2) pointID.push_back(localPointIDs[kk]);
+        }
+        else {
+
+          su2double posDist = 0.0;
+          for(unsigned short l=0; l<nDimADT; ++l) {
+            su2double ds = 0.0;
+            if(     coor[l] < leaves[kk].xMin[l]) ds = coor[l] - leaves[kk].xMin[l];
+            else if(coor[l] > leaves[kk].xMax[l]) ds = coor[l] - leaves[kk].xMax[l];
+
+            posDist += ds*ds;
+          }
+
+          if(posDist <= radius2) frontLeavesNew.push_back(kk);
+        }
+      }
+    }
+
+    frontLeaves.swap(frontLeavesNew);
+    if(frontLeaves.empty()) break;
+  }
+
+  AD::EndPassive(wasActive);
+
+  /*--- Make the output independent of the order of the points in the tree. ---*/
+  sort(pointID.begin(), pointID.end());
+}
@@ -28,7 +28,8 @@
 #include "../../include/fem/fem_geometry_structure.hpp"
 #include "../../include/adt/CADTElemClass.hpp"
 
-std::unique_ptr<CADTElemClass> CMeshFEM_DG::ComputeViscousWallADT(const CConfig *config) const {
+std::unique_ptr<CADTElemClass> CMeshFEM_DG::ComputeViscousWallADT(const CConfig *config,
+                                                                  const ADTSearchPoints* searchPoints) const {
 
   /*--------------------------------------------------------------------------*/
   /*--- Step 1: Create the coordinates and connectivity of the linear      ---*/
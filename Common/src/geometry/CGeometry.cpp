@@ -26,6 +26,7 @@
  */
 
 #include "../../include/geometry/CGeometry.hpp"
+#include "../../include/geometry/CPoissonWallDistance.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/parallelization/omp_structure.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
@@ -3737,6 +3738,59 @@ void CGeometry::SetNaturalEdgeColoring()
   edgeColoring = createNaturalColoring(nEdge);
   /*--- In parallel, set the group size to nEdge to protect client code. ---*/
   if (omp_get_max_threads() > 1) edgeColorGroupSize = nEdge;
+  /*--- The split coloring is derived from this one. ---*/
+  edgeColoringSplit = CCompressedSparsePatternUL();
+}
+
+const CCompressedSparsePatternUL& CGeometry::GetEdgeColoringSplit(unsigned long groupSize, unsigned long& nColorInterior)
+{
+  /*--- Check for dry run mode with dummy geometry. ---*/
+  nColorInterior = 0;
+  if (nEdge==0) return edgeColoringSplit;
+
+  const auto& coloring = GetEdgeColoring();
+  groupSize = max<unsigned long>(groupSize, 1);
+
+  if (edgeColoringSplit.empty() || (groupSize != edgeColoringSplitGroupSize)) {
+
+    /*--- Interior and boundary colors, built separately and then concatenated. ---*/
+    vector<unsigned long> interiorPtr(1,0), interiorIdx, boundaryPtr(1,0), boundaryIdx;
+    interiorIdx.reserve(nEdge);
+
+    for (auto iColor = 0ul; iColor < coloring.getOuterSize(); ++iColor) {
+      const auto colorSize = coloring.getNumNonZeros(iColor);
+      const auto indices = coloring.innerIdx(iColor);
+
+      /*--- Only the last group of a color can be incomplete, and it is also the last group in
+       *    the interior or boundary part of the color, so all the other groups stay aligned. ---*/
+      for (auto iGroup = 0ul; iGroup < colorSize; iGroup += groupSize) {
+        const auto groupEnd = min(iGroup+groupSize, colorSize);
+
+        bool interior = true;
+        for (auto k = iGroup; k < groupEnd && interior; ++k) {
+          interior = nodes->GetDomain(edges->GetNode(indices[k],0)) &&
+                     nodes->GetDomain(edges->GetNode(indices[k],1));
+        }
+        auto& part = interior? interiorIdx : boundaryIdx;
+        part.insert(part.end(), indices+iGroup, indices+groupEnd);
+      }
+
+      if (interiorIdx.size() > interiorPtr.back()) interiorPtr.push_back(interiorIdx.size());
+      if (boundaryIdx.size() > boundaryPtr.back()) boundaryPtr.push_back(boundaryIdx.size());
+    }
+
+    nEdgeColorInterior = interiorPtr.size()-1;
+
+    for (auto iColor = 1ul; iColor < boundaryPtr.size(); ++iColor)
+      interiorPtr.push_back(interiorIdx.size() + boundaryPtr[iColor]);
+    interiorIdx.insert(interiorIdx.end(), boundaryIdx.begin(), boundaryIdx.end());
+
+    edgeColoringSplit = CCompressedSparsePatternUL(interiorPtr, interiorIdx);
+    edgeColoringSplitGroupSize = groupSize;
+  }
+
+  nColorInterior = nEdgeColorInterior;
+  return edgeColoringSplit;
 }
 
 const CCompressedSparsePatternUL& CGeometry::GetElementColoring(su2double* efficiency)
@@ -3818,11 +3872,25 @@ void CGeometry::ColorMGLevels(unsigned short nMGLevels, const CGeometry* const*
   }
 }
 
+bool CGeometry::ComputePoissonWallDistance(const CConfig *config) {
+
+  /*--- Nothing to solve on dummy geometries. ---*/
+  if (nodes == nullptr) return false;
+
+  if (!poissonWallDistance) poissonWallDistance.reset(new CPoissonWallDistance(this, config));
+
+  if (!poissonWallDistance->HasWalls()) return false;
+
+  poissonWallDistance->Compute(this, config);
+  return true;
+}
+
 void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeometry ****geometry_container){
 
   int nZone = config_container[ZONE_0]->GetnZone();
   bool allEmpty = true;
   vector<bool> wallDistanceNeeded(nZone, false);
+  vector<bool> poissonZone(nZone, false);
 
   for (int iInst = 0; iInst < config_container[ZONE_0]->GetnTimeInstances(); iInst++){
     for (int iZone = 0; iZone < nZone; iZone++){
@@ -3839,17 +3907,50 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
         wallDistanceNeeded[iZone] = true;
       }
 
+      /*--- FVM zones may approximate the distance to their own walls with a Poisson equation,
+       * zones without walls fall back to the search of the walls in the other zones. ---*/
+      CGeometry *geometry = geometry_container[iZone][iInst][MESH_0];
+      if (wallDistanceNeeded[iZone] && kindSolver != FEM_LES && kindSolver != FEM_RANS &&
+          config_container[iZone]->GetKind_WallDistance() == WALL_DISTANCE_METHOD::POISSON &&
+          geometry->ComputePoissonWallDistance(config_container[iZone])) {
+        poissonZone[iZone] = true;
+        wallDistanceNeeded[iZone] = false;
+      }
+
       /*--- Set the wall distances in all zones to the numerical limit.
      * This is necessary, because before a computed distance is set, it will be checked
      * whether the new distance is smaller than the currently stored one. ---*/
-      CGeometry *geometry = geometry_container[iZone][iInst][MESH_0];
       if (wallDistanceNeeded[iZone])
         geometry->SetWallDistance(numeric_limits<su2double>::max());
     }
 
+    /*--- Nothing else to do if all the zones that need the distance used the Poisson equation. ---*/
+    if (find(wallDistanceNeeded.begin(), wallDistanceNeeded.end(), true) == wallDistanceNeeded.end() &&
+        find(poissonZone.begin(), poissonZone.end(), true) != poissonZone.end()) continue;
+
+    /*--- Points where the wall distance is needed, each rank then only gathers the walls that may be
+     * nearest to its points instead of all the walls. The FEM solvers also need the distance at
+     * other locations (integration points), in that case all walls are gathered. ---*/
+    ADTSearchPoints searchPoints;
+    bool pruneWalls = false;
+    for (int jZone = 0; jZone < nZone; jZone++){
+      if (!wallDistanceNeeded[jZone]) continue;
+      const CGeometry *geometry = geometry_container[jZone][iInst][MESH_0];
+      const auto kindSolver = config_container[jZone]->GetKind_Solver();
+      if (kindSolver == FEM_LES || kindSolver == FEM_RANS) {
+        pruneWalls = false;
+        break;
+      }
+      /*--- Zones computed by other ranks (concurrent zones) have no points here. ---*/
+      if (geometry->nodes == nullptr) continue;
+      searchPoints.emplace_back(geometry->nodes->GetCoord().data(), geometry->GetnPoint());
+      pruneWalls = true;
+    }
+
     /*--- Loop over all zones and compute the ADT based on the viscous walls in that zone ---*/
     for (int iZone = 0; iZone < nZone; iZone++){
-      unique_ptr<CADTElemClass> WallADT = geometry_container[iZone][iInst][MESH_0]->ComputeViscousWallADT(config_container[iZone]);
+      unique_ptr<CADTElemClass> WallADT = geometry_container[iZone][iInst][MESH_0]->ComputeViscousWallADT(
+                                            config_container[iZone], pruneWalls? &searchPoints : nullptr);
       if (WallADT && !WallADT->IsEmpty()){
         allEmpty = false;
         /*--- Inner loop over all zones to update the wall distances.
@@ -3864,6 +3965,7 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
     /*--- If there are no viscous walls in the entire domain, set distances to zero ---*/
     if (allEmpty){
       for (int iZone = 0; iZone < nZone; iZone++){
+        if (poissonZone[iZone]) continue;
         CGeometry *geometry = geometry_container[iZone][iInst][MESH_0];
         geometry->SetWallDistance(0.0);
       }
@@ -3892,4 +3994,16 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
       }
     }
   }
+
+  /*--- The multigrid of the turbulence equations also needs the distance on the coarse levels. ---*/
+
+  for (int iInst = 0; iInst < config_container[ZONE_0]->GetnTimeInstances(); iInst++){
+    for (int iZone = 0; iZone < nZone; iZone++){
+      const CConfig* config = config_container[iZone];
+      if (!config->GetMG_Turb() || geometry_container[iZone][iInst][MESH_0]->nodes == nullptr) continue;
+
+      for (unsigned short iMesh = 1; iMesh <= config->GetnMGLevels(); iMesh++)
+        geometry_container[iZone][iInst][iMesh]->SetRestricted_WallDistance(geometry_container[iZone][iInst][iMesh-1]);
+    }
+  }
 }
@@ -30,6 +30,46 @@
 #include "../../include/toolboxes/printing_toolbox.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 
+namespace {
+
+/*--- Exchange one value per vertex with the neighbor rank of a send/receive marker pair. The values sent
+ by this rank are received by the neighbor in the order of its opposite marker (the receive marker if
+ sent from the send marker, and vice versa). ---*/
+
+void SendRecvVertexValues(const CConfig *config, unsigned short MarkerS, const vector<unsigned long>& bufSend,
+                          vector<unsigned long>& bufRecv) {
+
+  const int neighbor = config->GetMarker_All_SendRecv(MarkerS)-1;
+  SU2_MPI::Status status;
+
+  SU2_MPI::Sendrecv(bufSend.data(), bufSend.size(), MPI_UNSIGNED_LONG, neighbor, 0,
+                    bufRecv.data(), bufRecv.size(), MPI_UNSIGNED_LONG, neighbor, 0, SU2_MPI::GetComm(), &status);
+}
+
+/*--- Markers of a point, with agglomeration across partitions the send/receive markers count as one, since
+ with two layers of halo points it is common for points to be sent to several ranks. ---*/
+
+unsigned short GetPointMarkers(const CGeometry *fine_grid, const CConfig *config, unsigned long iPoint,
+                               unsigned short *markers) {
+
+  const bool partitionAgglomeration = config->GetMG_PartitionAgglomeration();
+  bool sendRecv = false;
+  unsigned short counter = 0;
+
+  for (auto jMarker = 0u; jMarker < fine_grid->GetnMarker(); jMarker++) {
+    if (fine_grid->nodes->GetVertex(iPoint, jMarker) == -1) continue;
+    if (partitionAgglomeration && (config->GetMarker_All_KindBC(jMarker) == SEND_RECEIVE)) {
+      if (sendRecv) continue;
+      sendRecv = true;
+    }
+    markers[counter] = jMarker;
+    counter++;
+  }
+  return counter;
+}
+
+}
+
 CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_container, unsigned short iMesh) : CGeometry() {
 
   /*--- CGeometry & CConfig pointers to the fine grid level for clarity. We may
@@ -46,7 +86,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
                 *Parent_Remote = nullptr,         *Children_Remote = nullptr,    *Parent_Local = nullptr,            *Children_Local = nullptr;
   short marker_seed;
   bool agglomerate_seed = true;
-  unsigned short nChildren, iNode, counter, iMarker, jMarker, priority, MarkerS, MarkerR, *nChildren_MPI;
+  unsigned short nChildren, iNode, counter, iMarker, priority, MarkerS, MarkerR, *nChildren_MPI;
   vector<unsigned long> Suitable_Indirect_Neighbors, Aux_Parent;
   vector<unsigned long>::iterator it;
 
@@ -96,6 +136,28 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   Index_CoarseCV = 0;
 
+  /*--- Agglomeration across the partition interfaces. The points offered to lower neighbor ranks are
+   reserved (they are only agglomerated here if the neighbor does not use them), and the halo points
+   offered by higher neighbor ranks can join the control volumes of this rank. ---*/
+
+  const bool partitionAgglomeration = config->GetMG_PartitionAgglomeration() && (size > SINGLE_NODE);
+  const auto reservedParent = numeric_limits<unsigned long>::max();
+  vector<bool> claimable, reserved, claimed;
+
+  if (partitionAgglomeration) {
+    SetPartitionClaims(geometry, iMesh, config, claimable, reserved);
+    for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint++)
+      if (reserved[iPoint]) fine_grid->nodes->SetParent_CV(iPoint, reservedParent);
+  }
+
+  /*--- A claimable halo can only be added as a direct neighbor of a seed of this rank, which keeps the new
+   control volume connected and ensures that it has a vertex on the send marker to the neighbor. ---*/
+
+  auto ClaimHalo = [&](unsigned long jPoint) {
+    return partitionAgglomeration && claimable[jPoint] && !fine_grid->nodes->GetAgglomerate(jPoint) &&
+           GeometricalCheck(jPoint, fine_grid, config);
+  };
+
   /*--- The first step is the boundary agglomeration. ---*/
 
   for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker++) {
@@ -124,11 +186,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
         /*--- For a particular point in the fine grid we save all the markers
          that are in that point ---*/
 
-        for (jMarker = 0; jMarker < fine_grid->GetnMarker(); jMarker ++)
-          if (fine_grid->nodes->GetVertex(iPoint, jMarker) != -1) {
-            copy_marker[counter] = jMarker;
-            counter++;
-          }
+        counter = GetPointMarkers(fine_grid, config, iPoint, copy_marker);
 
         /*--- To aglomerate a vertex it must have only one physical bc!!
          This can be improved. If there is only a marker, it is a good
@@ -159,7 +217,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
             /*--- The new point can be agglomerated ---*/
 
-            if (SetBoundAgglomeration(CVPoint, marker_seed, fine_grid, config)) {
+            if (SetBoundAgglomeration(CVPoint, marker_seed, fine_grid, config) || ClaimHalo(CVPoint)) {
 
               /*--- We set the value of the parent ---*/
 
@@ -289,9 +347,9 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
         /*--- Determine if the CVPoint can be agglomerated ---*/
 
-        if ((fine_grid->nodes->GetAgglomerate(CVPoint) == false) &&
-            (fine_grid->nodes->GetDomain(CVPoint)) &&
-            (GeometricalCheck(CVPoint, fine_grid, config))) {
+        if (((fine_grid->nodes->GetAgglomerate(CVPoint) == false) &&
+             (fine_grid->nodes->GetDomain(CVPoint)) &&
+             (GeometricalCheck(CVPoint, fine_grid, config))) || ClaimHalo(CVPoint)) {
 
           /*--- We set the value of the parent ---*/
 
@@ -379,6 +437,62 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
     }
   }
 
+  /*--- Tell the neighbor ranks which of their points were added to control volumes of this rank.
+   The reserved points that were not are added to the control volume of one of their neighbors. ---*/
+
+  if (partitionAgglomeration) {
+
+    claimed.resize(fine_grid->GetnPoint(), false);
+
+    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+
+      if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+          (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+
+        MarkerS = iMarker;  MarkerR = iMarker+1;
+
+        vector<unsigned long> Buffer_Send_Claimed(fine_grid->nVertex[MarkerR]);
+        vector<unsigned long> Buffer_Receive_Claimed(fine_grid->nVertex[MarkerS]);
+
+        for (iVertex = 0; iVertex < fine_grid->nVertex[MarkerR]; iVertex++) {
+          iPoint = fine_grid->vertex[MarkerR][iVertex]->GetNode();
+          claimed[iPoint] = claimable[iPoint] && fine_grid->nodes->GetAgglomerate(iPoint);
+          Buffer_Send_Claimed[iVertex] = claimed[iPoint];
+        }
+
+        SendRecvVertexValues(config, MarkerS, Buffer_Send_Claimed, Buffer_Receive_Claimed);
+
+        for (iVertex = 0; iVertex < fine_grid->nVertex[MarkerS]; iVertex++) {
+          iPoint = fine_grid->vertex[MarkerS][iVertex]->GetNode();
+          if (Buffer_Receive_Claimed[iVertex]) claimed[iPoint] = true;
+        }
+      }
+    }
+
+    for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint++) {
+      if (!reserved[iPoint] || claimed[iPoint]) continue;
+
+      iParent = Index_CoarseCV;
+      for (auto jPoint : fine_grid->nodes->GetPoints(iPoint)) {
+        if (fine_grid->nodes->GetDomain(jPoint) && !reserved[jPoint]) {
+          iParent = fine_grid->nodes->GetParent_CV(jPoint);
+          break;
+        }
+      }
+      if (iParent == Index_CoarseCV) {
+        nodes->SetnChildren_CV(Index_CoarseCV, 0);
+        Index_CoarseCV++;
+      }
+
+      nChildren = nodes->GetnChildren_CV(iParent);
+      fine_grid->nodes->SetParent_CV(iPoint, iParent);
+      if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint))
+        nodes->SetAgglomerate_Indirect(iParent, true);
+      nodes->SetChildren_CV(iParent, nChildren, iPoint);
+      nodes->SetnChildren_CV(iParent, nChildren+1);
+    }
+  }
+
   nPointDomain = Index_CoarseCV;
 
   /*--- Check that there are no hanging nodes ---*/
@@ -411,7 +525,9 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   for (iCoarsePoint = 0; iCoarsePoint < nPointDomain; iCoarsePoint ++) {
 
-    if (nodes->GetnPoint(iCoarsePoint) == 1) {
+    /*--- Points added to the control volumes of neighbor ranks do not have a parent yet. ---*/
+
+    if ((nodes->GetnPoint(iCoarsePoint) == 1) && (nodes->GetPoint(iCoarsePoint, 0) < nPointDomain)) {
 
       /*--- Find the neighbor of the isolated point. This neighbor is the right control volume ---*/
 
@@ -477,7 +593,12 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   /*--- Dealing with MPI parallelization, the objective is that the received nodes must be agglomerated
    in the same way as the donor nodes. Send the node agglomeration information of the donor
-   (parent and children), Sending only occurs with MPI ---*/
+   (parent and children), Sending only occurs with MPI. The points that were added to control volumes
+   of the neighbor (claimed) are the exception, the parents of those are set by the rank that claimed them. ---*/
+
+  auto ClaimedVertex = [&](unsigned short val_marker, unsigned long val_vertex) {
+    return partitionAgglomeration && claimed[fine_grid->vertex[val_marker][val_vertex]->GetNode()];
+  };
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
 
@@ -529,11 +650,30 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
       delete [] Buffer_Send_Children;
       delete [] Buffer_Send_Parent;
 
+      /*--- Parents of the claimed halos, received by the rank that owns the points. ---*/
+
+      vector<unsigned long> Buffer_Send_Claimed, Buffer_Receive_Claimed;
+
+      if (partitionAgglomeration) {
+        Buffer_Send_Claimed.resize(nVertexR);
+        Buffer_Receive_Claimed.resize(nVertexS);
+        for (iVertex = 0; iVertex < nVertexR; iVertex++) {
+          iPoint = fine_grid->vertex[MarkerR][iVertex]->GetNode();
+          Buffer_Send_Claimed[iVertex] = fine_grid->nodes->GetParent_CV(iPoint);
+        }
+        SendRecvVertexValues(config, MarkerS, Buffer_Send_Claimed, Buffer_Receive_Claimed);
+      }
+
       /*--- Create a list of the parent nodes without repeated parents ---*/
 
       Aux_Parent.clear();
       for (iVertex = 0; iVertex < nVertexR; iVertex++)
-        Aux_Parent.push_back (Buffer_Receive_Parent[iVertex]);
+        if (!ClaimedVertex(MarkerR, iVertex))
+          Aux_Parent.push_back (Buffer_Receive_Parent[iVertex]);
+
+      for (iVertex = 0; iVertex < nVertexS; iVertex++)
+        if (ClaimedVertex(MarkerS, iVertex))
+          Aux_Parent.push_back (Buffer_Receive_Claimed[iVertex]);
 
       sort(Aux_Parent.begin(), Aux_Parent.end());
       it = unique(Aux_Parent.begin(), Aux_Parent.end());
@@ -550,6 +690,8 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
       for (iVertex = 0; iVertex < nVertexR; iVertex++) {
 
+        if (ClaimedVertex(MarkerR, iVertex)) continue;
+
         Parent_Remote[iVertex] = Buffer_Receive_Parent[iVertex];
 
         /*--- We use the same sorting as in the donor domain ---*/
@@ -575,6 +717,8 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
       /*--- Create the final structure ---*/
       for (iVertex = 0; iVertex < nVertexR; iVertex++) {
 
+        if (ClaimedVertex(MarkerR, iVertex)) continue;
+
         /*--- Be careful, it is possible that a node change the agglomeration configuration, the priority
          is always, when receive the information ---*/
 
@@ -586,6 +730,24 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
       }
 
+      /*--- Points of this rank claimed by the neighbor, they are children of its (halo) control volumes. ---*/
+
+      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
+
+        if (!ClaimedVertex(MarkerS, iVertex)) continue;
+
+        iPoint = fine_grid->vertex[MarkerS][iVertex]->GetNode();
+        iParent = Index_CoarseCV - Aux_Parent.size() +
+                  (lower_bound(Aux_Parent.begin(), Aux_Parent.end(), Buffer_Receive_Claimed[iVertex]) - Aux_Parent.begin());
+
+        fine_grid->nodes->SetParent_CV(iPoint, iParent);
+        nodes->SetChildren_CV(iParent, nChildren_MPI[iParent], iPoint);
+        nChildren_MPI[iParent]++;
+        nodes->SetnChildren_CV(iParent, nChildren_MPI[iParent]);
+        nodes->SetDomain(iParent, false);
+
+      }
+
       /*--- Deallocate auxiliar structures ---*/
 
       delete[] nChildren_MPI;
@@ -659,10 +821,108 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
 }
 
+bool CMultiGridGeometry::CompleteOnRank(CGeometry **geometry, unsigned short iMesh, unsigned long iPoint,
+                                        int iRank, const vector<int>& owner) {
+
+  const auto nodes = geometry[iMesh]->nodes;
+
+  if (iMesh == MESH_0) {
+
+    /*--- With two layers of halo points, the other rank has the elements that contain at least
+     one neighbor of its points. The neighbors of the nodes are all known on this rank. ---*/
+
+    auto NextToRank = [&](unsigned long jPoint) {
+      if (owner[jPoint] == iRank) return true;
+      for (auto kPoint : nodes->GetPoints(jPoint))
+        if (owner[kPoint] == iRank) return true;
+      return false;
+    };
+
+    for (auto iElem = 0u; iElem < nodes->GetnElem(iPoint); iElem++) {
+      const auto elem = geometry[MESH_0]->elem[nodes->GetElem(iPoint, iElem)];
+      bool found = false;
+      for (auto iNode = 0u; (iNode < elem->GetnNodes()) && !found; iNode++)
+        found = NextToRank(elem->GetNode(iNode));
+      if (!found) return false;
+    }
+    return nodes->GetnElem(iPoint) > 0;
+  }
+
+  /*--- On the coarse levels all the children must be owned by this rank and be complete. ---*/
+
+  for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iPoint); iChildren++) {
+    const auto iFinePoint = nodes->GetChildren_CV(iPoint, iChildren);
+    if (!geometry[iMesh-1]->nodes->GetDomain(iFinePoint) ||
+        !CompleteOnRank(geometry, iMesh-1, iFinePoint, iRank, owner)) return false;
+  }
+  return nodes->GetnChildren_CV(iPoint) > 0;
+
+}
+
+void CMultiGridGeometry::SetPartitionClaims(CGeometry **geometry, unsigned short iMesh, const CConfig *config,
+                                            vector<bool>& claimable, vector<bool>& reserved) const {
+
+  CGeometry *fine_grid = geometry[iMesh-1];
+  const auto nMarker_All = config->GetnMarker_All();
+
+  claimable.assign(fine_grid->GetnPoint(), false);
+  reserved.assign(fine_grid->GetnPoint(), false);
+
+  /*--- Owner of the points of the finest grid, from the receive markers. ---*/
+
+  vector<int> owner(geometry[MESH_0]->GetnPoint(), rank);
+
+  for (auto iMarker = 0u; iMarker < nMarker_All; iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) < 0)) {
+      const int iRank = abs(config->GetMarker_All_SendRecv(iMarker))-1;
+      for (auto iVertex = 0ul; iVertex < geometry[MESH_0]->nVertex[iMarker]; iVertex++)
+        owner[geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode()] = iRank;
+    }
+  }
+
+  /*--- Points are offered to the lower rank of each pair. They must not have other boundary conditions,
+   which also excludes points that are halos on more than one rank, and their halo copy must be complete
+   for the neighbor to compute the residual of the new control volume. ---*/
+
+  for (auto iMarker = 0u; iMarker < nMarker_All; iMarker++) {
+
+    if ((config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) ||
+        (config->GetMarker_All_SendRecv(iMarker) <= 0)) continue;
+
+    const auto MarkerS = iMarker, MarkerR = iMarker+1;
+    const int neighbor = config->GetMarker_All_SendRecv(MarkerS)-1;
+
+    vector<unsigned long> Buffer_Send_Offered(fine_grid->nVertex[MarkerS], 0);
+    vector<unsigned long> Buffer_Receive_Offered(fine_grid->nVertex[MarkerR], 0);
+
+    for (auto iVertex = 0ul; (neighbor < rank) && (iVertex < fine_grid->nVertex[MarkerS]); iVertex++) {
+      const auto iPoint = fine_grid->vertex[MarkerS][iVertex]->GetNode();
+
+      unsigned short nMarkerPoint = 0;
+      for (auto jMarker = 0u; jMarker < nMarker_All; jMarker++)
+        nMarkerPoint += (fine_grid->nodes->GetVertex(iPoint, jMarker) != -1);
+
+      if (fine_grid->nodes->GetDomain(iPoint) && (nMarkerPoint == 1) &&
+          CompleteOnRank(geometry, iMesh-1, iPoint, neighbor, owner)) {
+        Buffer_Send_Offered[iVertex] = 1;
+        reserved[iPoint] = true;
+      }
+    }
+
+    SendRecvVertexValues(config, MarkerS, Buffer_Send_Offered, Buffer_Receive_Offered);
+
+    for (auto iVertex = 0ul; iVertex < fine_grid->nVertex[MarkerR]; iVertex++)
+      if (Buffer_Receive_Offered[iVertex])
+        claimable[fine_grid->vertex[MarkerR][iVertex]->GetNode()] = true;
+  }
+
+}
+
 bool CMultiGridGeometry::SetBoundAgglomeration(unsigned long CVPoint, short marker_seed, CGeometry *fine_grid, CConfig *config) {
 
   bool agglomerate_CV = false;
-  unsigned short counter, jMarker;
+  unsigned short counter;
 
   unsigned short nMarker_Max = config->GetnMarker_Max();
 
@@ -681,12 +941,7 @@ bool CMultiGridGeometry::SetBoundAgglomeration(unsigned long CVPoint, short mark
 
       /*--- Identify the markers of the vertex that we want to agglomerate ---*/
 
-      counter = 0;
-      for (jMarker = 0; jMarker < fine_grid->GetnMarker(); jMarker ++)
-        if (fine_grid->nodes->GetVertex(CVPoint, jMarker) != -1) {
-          copy_marker[counter] = jMarker;
-          counter++;
-        }
+      counter = GetPointMarkers(fine_grid, config, CVPoint, copy_marker);
 
       /*--- The basic condition is that the aglomerated vertex must have the same physical marker,
        but eventually a send-receive condition ---*/
@@ -936,11 +1191,24 @@ void CMultiGridGeometry::SetPoint_Connectivity(CGeometry *fine_grid) {
 
 void CMultiGridGeometry::SetVertex(CGeometry *fine_grid, CConfig *config) {
   unsigned long  iVertex, iFinePoint, iCoarsePoint;
-  unsigned short iMarker, iMarker_Tag, iChildren;
+  unsigned short iMarker, jMarker, iMarker_Tag, iChildren;
 
   nMarker = fine_grid->GetnMarker();
   unsigned short nMarker_Max = config->GetnMarker_Max();
 
+  /*--- With agglomeration across partitions a control volume may have children on both markers of a
+   send/receive pair, it is a vertex of the send marker if it is owned by this rank and of the receive
+   marker otherwise. ---*/
+
+  const bool partitionAgglomeration = config->GetMG_PartitionAgglomeration();
+
+  auto CoarseMarker = [&](unsigned long val_point, unsigned short val_marker) {
+    if (!partitionAgglomeration || (config->GetMarker_All_KindBC(val_marker) != SEND_RECEIVE)) return val_marker;
+    const bool send = (config->GetMarker_All_SendRecv(val_marker) > 0);
+    if (send == nodes->GetDomain(val_point)) return val_marker;
+    return static_cast<unsigned short>(send? val_marker+1 : val_marker-1);
+  };
+
   /*--- If any children node belong to the boundary then the entire control
    volume will belong to the boundary ---*/
   for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++)
@@ -968,10 +1236,12 @@ void CMultiGridGeometry::SetVertex(CGeometry *fine_grid, CConfig *config) {
       for (iChildren = 0; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren ++) {
         iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
         for (iMarker = 0; iMarker < nMarker; iMarker ++) {
-          if ((fine_grid->nodes->GetVertex(iFinePoint, iMarker) != -1) && (nodes->GetVertex(iCoarsePoint, iMarker) == -1)) {
-            iVertex = nVertex[iMarker];
-            nodes->SetVertex(iCoarsePoint, iVertex, iMarker);
-            nVertex[iMarker]++;
+          if (fine_grid->nodes->GetVertex(iFinePoint, iMarker) == -1) continue;
+          jMarker = CoarseMarker(iCoarsePoint, iMarker);
+          if (nodes->GetVertex(iCoarsePoint, jMarker) == -1) {
+            iVertex = nVertex[jMarker];
+            nodes->SetVertex(iCoarsePoint, iVertex, jMarker);
+            nVertex[jMarker]++;
           }
         }
       }
@@ -995,16 +1265,18 @@ void CMultiGridGeometry::SetVertex(CGeometry *fine_grid, CConfig *config) {
       for (iChildren = 0; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren ++) {
         iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
         for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker ++) {
-          if ((fine_grid->nodes->GetVertex(iFinePoint, iMarker) != -1) && (nodes->GetVertex(iCoarsePoint, iMarker) == -1)) {
-            iVertex = nVertex[iMarker];
-            vertex[iMarker][iVertex] = new CVertex(iCoarsePoint, nDim);
-            nodes->SetVertex(iCoarsePoint, iVertex, iMarker);
+          if (fine_grid->nodes->GetVertex(iFinePoint, iMarker) == -1) continue;
+          jMarker = CoarseMarker(iCoarsePoint, iMarker);
+          if (nodes->GetVertex(iCoarsePoint, jMarker) == -1) {
+            iVertex = nVertex[jMarker];
+            vertex[jMarker][iVertex] = new CVertex(iCoarsePoint, nDim);
+            nodes->SetVertex(iCoarsePoint, iVertex, jMarker);
 
             /*--- Set the transformation to apply ---*/
             unsigned long ChildVertex = fine_grid->nodes->GetVertex(iFinePoint, iMarker);
             unsigned short RotationKind = fine_grid->vertex[iMarker][ChildVertex]->GetRotation_Type();
-            vertex[iMarker][iVertex]->SetRotation_Type(RotationKind);
-            nVertex[iMarker]++;
+            vertex[jMarker][iVertex]->SetRotation_Type(RotationKind);
+            nVertex[jMarker]++;
           }
         }
       }
@@ -1309,6 +1581,24 @@ void CMultiGridGeometry::SetRestricted_GridVelocity(CGeometry *fine_mesh, const
   END_SU2_OMP_FOR
 }
 
+void CMultiGridGeometry::SetRestricted_WallDistance(const CGeometry *fine_mesh) {
+
+  /*--- Volume average of the children, the coarse CVs at walls only contain wall points. ---*/
+  SU2_OMP_FOR_STAT(roundUpDiv(nPoint,omp_get_max_threads()))
+  for (unsigned long Point_Coarse = 0; Point_Coarse < nPoint; Point_Coarse++) {
+    su2double Area_Parent = nodes->GetVolume(Point_Coarse);
+    su2double Distance = 0.0;
+
+    for (unsigned short iChild = 0; iChild < nodes->GetnChildren_CV(Point_Coarse); iChild++) {
+      unsigned long Point_Fine = nodes->GetChildren_CV(Point_Coarse, iChild);
+      su2double Area_Child     = fine_mesh->nodes->GetVolume(Point_Fine);
+      Distance += fine_mesh->nodes->GetWall_Distance(Point_Fine)*Area_Child/Area_Parent;
+    }
+    nodes->SetWall_Distance(Point_Coarse, Distance);
+  }
+  END_SU2_OMP_FOR
+}
+
 
 void CMultiGridGeometry::FindNormal_Neighbor(CConfig *config) {
 
@@ -31,7 +31,9 @@
 #include "../../include/toolboxes/CLinearPartitioner.hpp"
 #include "../../include/toolboxes/C1DInterpolation.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/toolboxes/compression_toolbox.hpp"
 #include "../../include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
+#include "../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CCGNSMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CRectangularMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CBoxMeshReaderFVM.hpp"
@@ -97,7 +99,7 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
   else {
 
     switch (val_format) {
-      case SU2: case CGNS_GRID: case RECTANGLE: case BOX:
+      case SU2: case CGNS_GRID: case RECTANGLE: case BOX: case SU2_BINARY:
         Read_Mesh_FVM(config, val_mesh_filename, val_iZone, val_nZone);
         break;
       default:
@@ -204,6 +206,13 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
 
   DistributeColoring(config, geometry);
 
+  /*--- Agglomerating the coarse multigrid levels across the partitions requires a second layer of
+   halo points, such that a rank has all the edges of the halo points it agglomerates. ---*/
+
+  twoHaloLayers = config->GetMG_PartitionAgglomeration() && (config->GetnMGLevels() > 0) && (size > SINGLE_NODE);
+
+  if (twoHaloLayers) DistributeHaloColoring(config, geometry);
+
   /*--- Redistribute the points to all ranks based on the coloring. ---*/
 
   if ((rank == MASTER_NODE) && (size != SINGLE_NODE))
@@ -273,6 +282,7 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
 
   decltype(Neighbors)().swap(Neighbors);
   decltype(Color_List)().swap(Color_List);
+  decltype(Halo_Color_List)().swap(Halo_Color_List);
 
   delete [] Local_Points;
   delete [] Local_Colors;
@@ -748,6 +758,101 @@ void CPhysicalGeometry::DistributeColoring(const CConfig *config,
 
 }
 
+void CPhysicalGeometry::DistributeHaloColoring(const CConfig *config,
+                                               CGeometry *geometry) {
+
+  /*--- With two layers of halo points, the elements around a point are sent to the
+   colors of all the neighbors of the point. Those colors are known on the rank that
+   owns the point in the linear partitioning, which sends them to the ranks that have
+   the point in their repeated elements, i.e. to the owners of the neighbors. ---*/
+
+  unsigned long iPoint, iProcessor;
+  int iProc, iSend, iRecv;
+
+  CLinearPartitioner pointPartitioner(geometry->GetGlobal_nPoint(),0);
+
+  /*--- Colors of the neighbors (self-inclusive) of each owned point. ---*/
+
+  vector<vector<unsigned long> > Neighbor_Colors(geometry->GetnPoint());
+
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    for (auto jPoint : Neighbors[iPoint])
+      Neighbor_Colors[iPoint].push_back(Color_List[jPoint]);
+
+    sort(Neighbor_Colors[iPoint].begin(), Neighbor_Colors[iPoint].end());
+    auto it = unique(Neighbor_Colors[iPoint].begin(), Neighbor_Colors[iPoint].end());
+    Neighbor_Colors[iPoint].resize(it - Neighbor_Colors[iPoint].begin());
+  }
+
+  /*--- Count the (point, color) pairs that must be sent to each rank. ---*/
+
+  vector<int> nColor_Send(size+1, 0), nColor_Recv(size+1, 0), nColor_Flag(size, -1);
+
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    for (auto jPoint : Neighbors[iPoint]) {
+      iProcessor = pointPartitioner.GetRankContainingIndex(jPoint);
+      if (nColor_Flag[iProcessor] != (int)iPoint) {
+        nColor_Flag[iProcessor] = (int)iPoint;
+        nColor_Send[iProcessor+1] += Neighbor_Colors[iPoint].size();
+      }
+    }
+  }
+
+  SU2_MPI::Alltoall(&(nColor_Send[1]), 1, MPI_INT,
+                    &(nColor_Recv[1]), 1, MPI_INT, SU2_MPI::GetComm());
+
+  int nSends = 0, nRecvs = 0;
+  for (iProc = 0; iProc < size; iProc++) {
+    if ((iProc != rank) && (nColor_Send[iProc+1] > 0)) nSends++;
+    if ((iProc != rank) && (nColor_Recv[iProc+1] > 0)) nRecvs++;
+
+    nColor_Send[iProc+1] += nColor_Send[iProc];
+    nColor_Recv[iProc+1] += nColor_Recv[iProc];
+  }
+
+  /*--- Load the global ID and color of each pair. ---*/
+
+  vector<unsigned long> colorSend(2*nColor_Send[size]), colorRecv(2*nColor_Recv[size]);
+  vector<int> index(nColor_Send.begin(), nColor_Send.end()-1);
+  nColor_Flag.assign(size, -1);
+
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    for (auto jPoint : Neighbors[iPoint]) {
+      iProcessor = pointPartitioner.GetRankContainingIndex(jPoint);
+      if (nColor_Flag[iProcessor] != (int)iPoint) {
+        nColor_Flag[iProcessor] = (int)iPoint;
+        for (auto color : Neighbor_Colors[iPoint]) {
+          colorSend[2*index[iProcessor]]   = geometry->nodes->GetGlobalIndex(iPoint);
+          colorSend[2*index[iProcessor]+1] = color;
+          index[iProcessor]++;
+        }
+      }
+    }
+  }
+
+  /*--- Communicate, and copy my own rank's data into the recv buffer directly. ---*/
+
+  vector<SU2_MPI::Request> colorSendReq(nSends), colorRecvReq(nRecvs);
+
+  InitiateCommsAll(colorSend.data(), nColor_Send.data(), colorSendReq.data(),
+                   colorRecv.data(), nColor_Recv.data(), colorRecvReq.data(),
+                   2, COMM_TYPE_UNSIGNED_LONG);
+
+  iRecv = nColor_Recv[rank];
+  for (iSend = nColor_Send[rank]; iSend < nColor_Send[rank+1]; iSend++, iRecv++) {
+    colorRecv[2*iRecv]   = colorSend[2*iSend];
+    colorRecv[2*iRecv+1] = colorSend[2*iSend+1];
+  }
+
+  CompleteCommsAll(nSends, colorSendReq.data(), nRecvs, colorRecvReq.data());
+
+  /*--- Each point is received once from its owner, with its colors sorted. ---*/
+
+  for (iRecv = 0; iRecv < nColor_Recv[size]; iRecv++)
+    Halo_Color_List[colorRecv[2*iRecv]].push_back(colorRecv[2*iRecv+1]);
+
+}
+
 void CPhysicalGeometry::DistributeVolumeConnectivity(const CConfig *config,
                                                      CGeometry *geometry,
                                                      unsigned short Elem_Type) {
@@ -820,16 +925,19 @@ void CPhysicalGeometry::DistributeVolumeConnectivity(const CConfig *config,
 
         Global_Index = geometry->elem[iElem]->GetNode(iNode);
 
-        /*--- We have the color stored in a map for all local points. ---*/
+        /*--- We have the color(s) stored in a map for all local points. ---*/
 
-        iProcessor = Color_List[Global_Index];
+        const auto colors = GetHalo_Colors(Global_Index);
+        for (auto iColor = colors.first; iColor != colors.second; ++iColor) {
+          iProcessor = *iColor;
 
-        /*--- If we have not visited this element yet, increment our
-         number of elements that must be sent to a particular proc. ---*/
+          /*--- If we have not visited this element yet, increment our
+           number of elements that must be sent to a particular proc. ---*/
 
-        if ((nElem_Flag[iProcessor] != (int)iElem)) {
-          nElem_Flag[iProcessor] = (int)iElem;
-          nElem_Send[iProcessor+1]++;
+          if ((nElem_Flag[iProcessor] != (int)iElem)) {
+            nElem_Flag[iProcessor] = (int)iElem;
+            nElem_Send[iProcessor+1]++;
+          }
         }
 
       }
@@ -894,34 +1002,37 @@ void CPhysicalGeometry::DistributeVolumeConnectivity(const CConfig *config,
 
         Global_Index = geometry->elem[iElem]->GetNode(iNode);
 
-        /*--- We have the color stored in a map for all local points. ---*/
+        /*--- We have the color(s) stored in a map for all local points. ---*/
 
-        iProcessor = Color_List[Global_Index];
+        const auto colors = GetHalo_Colors(Global_Index);
+        for (auto iColor = colors.first; iColor != colors.second; ++iColor) {
+          iProcessor = *iColor;
 
-        /*--- Load connectivity and IDs into the buffer for sending ---*/
+          /*--- Load connectivity and IDs into the buffer for sending ---*/
 
-        if (nElem_Flag[iProcessor] != (int)iElem) {
+          if (nElem_Flag[iProcessor] != (int)iElem) {
 
-          nElem_Flag[iProcessor] = (int)iElem;
-          unsigned long nn = index[iProcessor];
-          unsigned long mm = idIndex[iProcessor];
+            nElem_Flag[iProcessor] = (int)iElem;
+            unsigned long nn = index[iProcessor];
+            unsigned long mm = idIndex[iProcessor];
 
-          /*--- Load the connectivity values. Note that elements are already
-          stored directly based on their global index for the nodes.---*/
+            /*--- Load the connectivity values. Note that elements are already
+            stored directly based on their global index for the nodes.---*/
 
-          for (jNode = 0; jNode < NODES_PER_ELEMENT; jNode++) {
-            connSend[nn] = geometry->elem[iElem]->GetNode(jNode); nn++;
-          }
+            for (jNode = 0; jNode < NODES_PER_ELEMENT; jNode++) {
+              connSend[nn] = geometry->elem[iElem]->GetNode(jNode); nn++;
+            }
 
-          /*--- Global ID for this element. ---*/
+            /*--- Global ID for this element. ---*/
 
-          idSend[mm] = Local2GlobalElem[iElem];
+            idSend[mm] = Local2GlobalElem[iElem];
 
-          /*--- Increment the index by the message length ---*/
+            /*--- Increment the index by the message length ---*/
 
-          index[iProcessor] += NODES_PER_ELEMENT;
-          idIndex[iProcessor]++;
+            index[iProcessor] += NODES_PER_ELEMENT;
+            idIndex[iProcessor]++;
 
+          }
         }
       }
     }
@@ -1119,16 +1230,19 @@ void CPhysicalGeometry::DistributePoints(const CConfig *config, CGeometry *geome
 
       jPoint = Neighbors[iPoint][iNeighbor];
 
-      /*--- We have the color stored in a map for all local points. ---*/
+      /*--- We have the color(s) stored in a map for all local points. ---*/
 
-      iProcessor = Color_List[jPoint];
+      const auto colors = GetHalo_Colors(jPoint);
+      for (auto iColor = colors.first; iColor != colors.second; ++iColor) {
+        iProcessor = *iColor;
 
-      /*--- If we have not visited this node yet, increment our
-       number of points that must be sent to a particular proc. ---*/
+        /*--- If we have not visited this node yet, increment our
+         number of points that must be sent to a particular proc. ---*/
 
-      if (nPoint_Flag[iProcessor] != (int)iPoint) {
-        nPoint_Flag[iProcessor] = (int)iPoint;
-        nPoint_Send[iProcessor+1]++;
+        if (nPoint_Flag[iProcessor] != (int)iPoint) {
+          nPoint_Flag[iProcessor] = (int)iPoint;
+          nPoint_Send[iProcessor+1]++;
+        }
       }
     }
   }
@@ -1193,33 +1307,36 @@ void CPhysicalGeometry::DistributePoints(const CConfig *config, CGeometry *geome
 
       jPoint = Neighbors[iPoint][iNeighbor];
 
-      /*--- We have the color stored in a map for all local points. ---*/
+      /*--- We have the color(s) stored in a map for all local points. ---*/
 
-      iProcessor = Color_List[jPoint];
+      const auto colors = GetHalo_Colors(jPoint);
+      for (auto iColor = colors.first; iColor != colors.second; ++iColor) {
+        iProcessor = *iColor;
 
-      /*--- If we have not visited this node yet, increment our
-       counters and load up the colors, ids, and coords. ---*/
+        /*--- If we have not visited this node yet, increment our
+         counters and load up the colors, ids, and coords. ---*/
 
-      if (nPoint_Flag[iProcessor] != (int)iPoint) {
+        if (nPoint_Flag[iProcessor] != (int)iPoint) {
 
-        nPoint_Flag[iProcessor] = (int)iPoint;
-        unsigned long nn = index[iProcessor];
+          nPoint_Flag[iProcessor] = (int)iPoint;
+          unsigned long nn = index[iProcessor];
 
-        /*--- Load the global ID, color, and coordinate values. ---*/
+          /*--- Load the global ID, color, and coordinate values. ---*/
 
-        idSend[nn]    = geometry->nodes->GetGlobalIndex(iPoint);
-        colorSend[nn] = geometry->nodes->GetColor(iPoint);
+          idSend[nn]    = geometry->nodes->GetGlobalIndex(iPoint);
+          colorSend[nn] = geometry->nodes->GetColor(iPoint);
 
-        nn = coordIndex[iProcessor];
-        for (iDim  = 0; iDim < nDim; iDim++) {
-          coordSend[nn] = geometry->nodes->GetCoord(iPoint, iDim); nn++;
-        }
+          nn = coordIndex[iProcessor];
+          for (iDim  = 0; iDim < nDim; iDim++) {
+            coordSend[nn] = geometry->nodes->GetCoord(iPoint, iDim); nn++;
+          }
 
-        /*--- Increment the index by the message length ---*/
+          /*--- Increment the index by the message length ---*/
 
-        coordIndex[iProcessor] += nDim;
-        index[iProcessor]++;
+          coordIndex[iProcessor] += nDim;
+          index[iProcessor]++;
 
+        }
       }
     }
   }
@@ -3207,38 +3324,80 @@ void CPhysicalGeometry::SetSendReceive(const CConfig *config) {
    to find the points with different colors. Create the send/received lists
    from this information. ---*/
 
-  for (iElem = 0; iElem < nElem; iElem++) {
-    for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
+  if (!twoHaloLayers) {
+    for (iElem = 0; iElem < nElem; iElem++) {
+      for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
 
-      iPoint  = elem[iElem]->GetNode(iNode);
-      iDomain = nodes->GetColor(iPoint);
+        iPoint  = elem[iElem]->GetNode(iNode);
+        iDomain = nodes->GetColor(iPoint);
 
-      if (iDomain == (unsigned long) rank) {
-        for (jNode = 0; jNode < elem[iElem]->GetnNodes(); jNode++) {
+        if (iDomain == (unsigned long) rank) {
+          for (jNode = 0; jNode < elem[iElem]->GetnNodes(); jNode++) {
 
-          jPoint  = elem[iElem]->GetNode(jNode);
-          jDomain = nodes->GetColor(jPoint);
+            jPoint  = elem[iElem]->GetNode(jNode);
+            jDomain = nodes->GetColor(jPoint);
 
-          /*--- If one of the neighbors is a different color and connected
-           by an edge, then we add them to the list. ---*/
+            /*--- If one of the neighbors is a different color and connected
+             by an edge, then we add them to the list. ---*/
 
-          if (iDomain != jDomain) {
+            if (iDomain != jDomain) {
 
-            /*--- We send from iDomain to jDomain the value of iPoint,
-             we save the global value becuase we need to sort the lists. ---*/
+              /*--- We send from iDomain to jDomain the value of iPoint,
+               we save the global value becuase we need to sort the lists. ---*/
 
-            SendDomainLocal[jDomain].push_back(Local_to_Global_Point[iPoint]);
+              SendDomainLocal[jDomain].push_back(Local_to_Global_Point[iPoint]);
 
-            /*--- We send from jDomain to iDomain the value of jPoint,
-             we save the global value becuase we need to sort the lists. ---*/
+              /*--- We send from jDomain to iDomain the value of jPoint,
+               we save the global value becuase we need to sort the lists. ---*/
 
-            ReceivedDomainLocal[jDomain].push_back(Local_to_Global_Point[jPoint]);
+              ReceivedDomainLocal[jDomain].push_back(Local_to_Global_Point[jPoint]);
 
+            }
           }
         }
       }
     }
   }
+  else {
+
+    /*--- With two layers of halo points all the halo points are received, and
+     the points are sent to the colors of the neighbors of their neighbors. ---*/
+
+    vector<vector<unsigned long> > Neighbor_Colors(nPoint);
+
+    for (iElem = 0; iElem < nElem; iElem++) {
+      for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
+        iPoint = elem[iElem]->GetNode(iNode);
+        for (jNode = 0; jNode < elem[iElem]->GetnNodes(); jNode++)
+          Neighbor_Colors[iPoint].push_back(nodes->GetColor(elem[iElem]->GetNode(jNode)));
+      }
+    }
+
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      sort(Neighbor_Colors[iPoint].begin(), Neighbor_Colors[iPoint].end());
+      it = unique(Neighbor_Colors[iPoint].begin(), Neighbor_Colors[iPoint].end());
+      Neighbor_Colors[iPoint].resize(it - Neighbor_Colors[iPoint].begin());
+
+      iDomain = nodes->GetColor(iPoint);
+      if (iDomain != (unsigned long) rank)
+        ReceivedDomainLocal[iDomain].push_back(Local_to_Global_Point[iPoint]);
+    }
+
+    for (iElem = 0; iElem < nElem; iElem++) {
+      for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
+
+        iPoint = elem[iElem]->GetNode(iNode);
+        if (nodes->GetColor(iPoint) != (unsigned long) rank) continue;
+
+        for (jNode = 0; jNode < elem[iElem]->GetnNodes(); jNode++) {
+          jPoint = elem[iElem]->GetNode(jNode);
+          for (auto jDomain : Neighbor_Colors[jPoint])
+            if (jDomain != (unsigned long) rank)
+              SendDomainLocal[jDomain].push_back(Local_to_Global_Point[iPoint]);
+        }
+      }
+    }
+  }
 
   /*--- Sort the points that must be sent and delete repeated points, note
    that the sorting should be done with the global index (not the local). ---*/
@@ -3698,6 +3857,9 @@ void CPhysicalGeometry::Read_Mesh_FVM(CConfig        *config,
     case BOX:
       MeshFVM = new CBoxMeshReaderFVM(config, val_iZone, val_nZone);
       break;
+    case SU2_BINARY:
+      MeshFVM = new CSU2BinaryMeshReaderFVM(config, val_iZone, val_nZone);
+      break;
     default:
       SU2_MPI::Error("Unrecognized mesh format specified!", CURRENT_FUNCTION);
       break;
@@ -8663,6 +8825,19 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     passivedouble Restart_Meta_Passive[8] = {0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0};
     su2double Restart_Meta[8] = {0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0};
 
+    /*--- Compressed files are read block by block, only at the local points,
+     they do not have metadata after the data section. ---*/
+
+    auto readCompressed = [&]() {
+      vector<unsigned long> points;
+      points.reserve(GetnPointDomain());
+      for (unsigned long iPoint = 0; iPoint < GetGlobal_nPointDomain(); iPoint++) {
+        if (GetGlobal_to_Local_Point(iPoint) > -1) points.push_back(iPoint);
+      }
+      Restart_Data = new passivedouble[nFields*points.size()];
+      CompressionToolbox::ReadRestartBlocks(filename, Restart_Vars, points.data(), points.size(), Restart_Data);
+    };
+
 #ifndef HAVE_MPI
 
     /*--- Serial binary input. ---*/
@@ -8685,9 +8860,12 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     }
 
     /*--- Check that this is an SU2 binary file. SU2 binary files
-     have the hex representation of "SU2" as the first int in the file. ---*/
+     have the hex representation of "SU2" as the first int in the file
+     (plus one if the file is compressed). ---*/
+
+    const bool compressed = (Restart_Vars[0] == CompressionToolbox::COMPRESSED_RESTART_MAGIC);
 
-    if (Restart_Vars[0] != 535532) {
+    if (Restart_Vars[0] != 535532 && !compressed) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -8712,34 +8890,40 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
       config->fields.push_back(str_buf);
     }
 
-    /*--- For now, create a temp 1D buffer to read the data from file. ---*/
+    if (compressed) {
+      readCompressed();
+    }
+    else {
 
-    Restart_Data = new passivedouble[nFields*GetnPointDomain()];
+      /*--- For now, create a temp 1D buffer to read the data from file. ---*/
 
-    /*--- Read in the data for the restart at all local points. ---*/
+      Restart_Data = new passivedouble[nFields*GetnPointDomain()];
 
-    ret = fread(Restart_Data, sizeof(passivedouble), nFields*GetnPointDomain(), fhw);
-    if (ret != (unsigned long)nFields*GetnPointDomain()) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
-    }
+      /*--- Read in the data for the restart at all local points. ---*/
+
+      ret = fread(Restart_Data, sizeof(passivedouble), nFields*GetnPointDomain(), fhw);
+      if (ret != (unsigned long)nFields*GetnPointDomain()) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
 
-    /*--- Compute (negative) displacements and grab the metadata. ---*/
+      /*--- Compute (negative) displacements and grab the metadata. ---*/
 
-    ret = sizeof(int) + 8*sizeof(passivedouble);
-    fseek(fhw,-ret, SEEK_END);
+      ret = sizeof(int) + 8*sizeof(passivedouble);
+      fseek(fhw,-ret, SEEK_END);
 
-    /*--- Read the external iteration. ---*/
+      /*--- Read the external iteration. ---*/
 
-    ret = fread(&Restart_Iter, sizeof(int), 1, fhw);
-    if (ret != 1) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
-    }
+      ret = fread(&Restart_Iter, sizeof(int), 1, fhw);
+      if (ret != 1) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
 
-    /*--- Read the metadata. ---*/
+      /*--- Read the metadata. ---*/
 
-    ret = fread(Restart_Meta_Passive, sizeof(passivedouble), 8, fhw);
-    if (ret != 8) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      ret = fread(Restart_Meta_Passive, sizeof(passivedouble), 8, fhw);
+      if (ret != 8) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
     }
 
     /*--- Close the file. ---*/
@@ -8781,9 +8965,12 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
 
     /*--- Check that this is an SU2 binary file. SU2 binary files
-     have the hex representation of "SU2" as the first int in the file. ---*/
+     have the hex representation of "SU2" as the first int in the file
+     (plus one if the file is compressed). ---*/
+
+    const bool compressed = (Restart_Vars[0] == CompressionToolbox::COMPRESSED_RESTART_MAGIC);
 
-    if (Restart_Vars[0] != 535532) {
+    if (Restart_Vars[0] != 535532 && !compressed) {
 
       SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
@@ -8829,69 +9016,78 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
 
     delete [] mpi_str_buf;
 
-    /*--- We're writing only su2doubles in the data portion of the file. ---*/
+    if (compressed) {
+      readCompressed();
+    }
+    else {
 
-    etype = MPI_DOUBLE;
+      /*--- We're writing only su2doubles in the data portion of the file. ---*/
 
-    /*--- We need to ignore the 4 ints describing the nVar_Restart and nPoints,
-     along with the string names of the variables. ---*/
+      etype = MPI_DOUBLE;
 
-    disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
+      /*--- We need to ignore the 4 ints describing the nVar_Restart and nPoints,
+       along with the string names of the variables. ---*/
 
-    /*--- Define a derived datatype for this rank's set of non-contiguous data
-     that will be placed in the restart. Here, we are collecting each one of the
-     points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
+      disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
 
-    int *blocklen = new int[GetnPointDomain()];
-    MPI_Aint *displace = new MPI_Aint[GetnPointDomain()];
+      /*--- Define a derived datatype for this rank's set of non-contiguous data
+       that will be placed in the restart. Here, we are collecting each one of the
+       points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
 
-    counter = 0;
-    for (iPoint_Global = 0; iPoint_Global < GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      if (GetGlobal_to_Local_Point(iPoint_Global) > -1) {
-        blocklen[counter] = nFields;
-        displace[counter] = iPoint_Global*nFields*sizeof(passivedouble);
-        counter++;
+      int *blocklen = new int[GetnPointDomain()];
+      MPI_Aint *displace = new MPI_Aint[GetnPointDomain()];
+
+      counter = 0;
+      for (iPoint_Global = 0; iPoint_Global < GetGlobal_nPointDomain(); iPoint_Global++ ) {
+        if (GetGlobal_to_Local_Point(iPoint_Global) > -1) {
+          blocklen[counter] = nFields;
+          displace[counter] = iPoint_Global*nFields*sizeof(passivedouble);
+          counter++;
+        }
       }
-    }
-    MPI_Type_create_hindexed(GetnPointDomain(), blocklen, displace, MPI_DOUBLE, &filetype);
-    MPI_Type_commit(&filetype);
+      MPI_Type_create_hindexed(GetnPointDomain(), blocklen, displace, MPI_DOUBLE, &filetype);
+      MPI_Type_commit(&filetype);
 
-    /*--- Set the view for the MPI file write, i.e., describe the location in
-     the file that this rank "sees" for writing its piece of the restart file. ---*/
+      /*--- Set the view for the MPI file write, i.e., describe the location in
+       the file that this rank "sees" for writing its piece of the restart file. ---*/
 
-    MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
+      MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
 
-    /*--- For now, create a temp 1D buffer to read the data from file. ---*/
+      /*--- For now, create a temp 1D buffer to read the data from file. ---*/
 
-    Restart_Data = new passivedouble[nFields*GetnPointDomain()];
+      Restart_Data = new passivedouble[nFields*GetnPointDomain()];
 
-    /*--- Collective call for all ranks to read from their view simultaneously. ---*/
+      /*--- Collective call for all ranks to read from their view simultaneously. ---*/
 
-    MPI_File_read_all(fhw, Restart_Data, nFields*GetnPointDomain(), MPI_DOUBLE, &status);
+      MPI_File_read_all(fhw, Restart_Data, nFields*GetnPointDomain(), MPI_DOUBLE, &status);
 
-    /*--- Free the derived datatype. ---*/
+      /*--- Free the derived datatype. ---*/
 
-    MPI_Type_free(&filetype);
+      MPI_Type_free(&filetype);
 
-    /*--- Reset the file view before writing the metadata. ---*/
+      delete [] blocklen;
+      delete [] displace;
 
-    MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE, (char*)"native", MPI_INFO_NULL);
+      /*--- Reset the file view before writing the metadata. ---*/
 
-    /*--- Access the metadata. ---*/
+      MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE, (char*)"native", MPI_INFO_NULL);
 
-    if (rank == MASTER_NODE) {
+      /*--- Access the metadata. ---*/
 
-      /*--- External iteration. ---*/
-      disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
-              nFields*Restart_Vars[2]*sizeof(passivedouble));
-      MPI_File_read_at(fhw, disp, &Restart_Iter, 1, MPI_INT, MPI_STATUS_IGNORE);
+      if (rank == MASTER_NODE) {
 
-      /*--- Additional doubles for AoA, AoS, etc. ---*/
+        /*--- External iteration. ---*/
+        disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
+                nFields*Restart_Vars[2]*sizeof(passivedouble));
+        MPI_File_read_at(fhw, disp, &Restart_Iter, 1, MPI_INT, MPI_STATUS_IGNORE);
 
-      disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
-              nFields*Restart_Vars[2]*sizeof(passivedouble) + 1*sizeof(int));
-      MPI_File_read_at(fhw, disp, Restart_Meta_Passive, 8, MPI_DOUBLE, MPI_STATUS_IGNORE);
+        /*--- Additional doubles for AoA, AoS, etc. ---*/
 
+        disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
+                nFields*Restart_Vars[2]*sizeof(passivedouble) + 1*sizeof(int));
+        MPI_File_read_at(fhw, disp, Restart_Meta_Passive, 8, MPI_DOUBLE, MPI_STATUS_IGNORE);
+
+      }
     }
 
     /*--- Communicate metadata. ---*/
@@ -8910,9 +9106,6 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
 
     MPI_File_close(&fhw);
 
-    delete [] blocklen;
-    delete [] displace;
-
 #endif
 
     std::vector<string>::iterator itx = std::find(config->fields.begin(), config->fields.end(), "Sensitivity_x");
@@ -10750,7 +10943,8 @@ void CPhysicalGeometry::Compute_Nacelle(CConfig *config, bool original_surface,
 
 }
 
-std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CConfig *config) const{
+std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CConfig *config,
+                                                                       const ADTSearchPoints* searchPoints) const{
 
   /*--------------------------------------------------------------------------*/
   /*--- Step 1: Create the coordinates and connectivity of the linear      ---*/
@@ -10829,10 +11023,20 @@ std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CC
   /*---         surface elements. A nearest point search does not give     ---*/
   /*---         accurate results, especially not for the integration       ---*/
   /*---         points of the elements close to a wall boundary.           ---*/
+  /*---         If the search points are known, only the surface elements  ---*/
+  /*---         of the ranks that may contain the nearest element to those ---*/
+  /*---         points are gathered, instead of all elements.              ---*/
   /*--------------------------------------------------------------------------*/
 
-  std::unique_ptr<CADTElemClass> WallADT(new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem,
-                                                           markerIDs, elemIDs, true));
+  std::unique_ptr<CADTElemClass> WallADT;
+  if (searchPoints) {
+    WallADT.reset(new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem,
+                                    markerIDs, elemIDs, *searchPoints));
+  }
+  else {
+    WallADT.reset(new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem,
+                                    markerIDs, elemIDs, true));
+  }
 
   return WallADT;
 
@@ -0,0 +1,195 @@
+/*!
+ * \file CPoissonWallDistance.cpp
+ * \brief Implementation of the class that approximates the wall distance with a Poisson equation.
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/geometry/CPoissonWallDistance.hpp"
+#include "../../include/geometry/CGeometry.hpp"
+#include "../../include/toolboxes/geometry_toolbox.hpp"
+
+CPoissonWallDistance::CPoissonWallDistance(CGeometry *geometry, const CConfig *config) :
+  nDim(geometry->GetnDim()),
+  nPoint(geometry->GetnPoint()),
+  nPointDomain(geometry->GetnPointDomain()),
+  System(true) {
+
+  /*--- Find the points on viscous walls, a point may be on more than one marker. ---*/
+
+  vector<bool> isWall(nPoint, false);
+
+  for (auto iMarker = 0u; iMarker < geometry->GetnMarker(); ++iMarker) {
+    if (!config->GetViscous_Wall(iMarker)) continue;
+    for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); ++iVertex)
+      isWall[geometry->vertex[iMarker][iVertex]->GetNode()] = true;
+  }
+
+  unsigned long nWallPointDomain = 0;
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    if (!isWall[iPoint]) continue;
+    wallPoints.push_back(iPoint);
+    if (geometry->nodes->GetDomain(iPoint)) ++nWallPointDomain;
+  }
+
+  SU2_MPI::Allreduce(&nWallPointDomain, &nWallPointGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  if (!HasWalls()) return;
+
+  Phi.Initialize(nPoint, nPointDomain, 1, 0.0);
+  Rhs.Initialize(nPoint, nPointDomain, 1, 0.0);
+  Dist.Initialize(nPoint, nPointDomain, 1, 0.0);
+
+  /*--- Edge-based sparse pattern, the transposed pointers are needed by SetDiagonalAsColumnSum. ---*/
+
+  Jacobian.Initialize(nPoint, nPointDomain, 1, 1, true, geometry, config, true);
+}
+
+void CPoissonWallDistance::SetLaplacian(CGeometry *geometry) {
+
+  const auto nodes = geometry->nodes;
+  const auto edges = geometry->edges;
+
+  Jacobian.SetValZero();
+
+  /*--- Two-point flux approximation of the diffusive flux, the off-diagonal coefficients are
+   * -(n . d_ij) / |d_ij|^2 and the diagonal is the sum of the neighbor coefficients. ---*/
+
+  SU2_OMP_FOR_STAT(256)
+  for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge) {
+
+    const auto iPoint = edges->GetNode(iEdge,0);
+    const auto jPoint = edges->GetNode(iEdge,1);
+    const auto normal = edges->GetNormal(iEdge);
+
+    su2double dist2 = 0.0, proj = 0.0;
+    for (auto iDim = 0u; iDim < nDim; ++iDim) {
+      const su2double d_ij = nodes->GetCoord(jPoint,iDim) - nodes->GetCoord(iPoint,iDim);
+      dist2 += d_ij * d_ij;
+      proj += d_ij * normal[iDim];
+    }
+
+    const su2double block_i[1][1] = {{proj / dist2}};
+    const su2double block_j[1][1] = {{-proj / dist2}};
+    Jacobian.SetBlocks(iEdge, block_i, block_j);
+  }
+  END_SU2_OMP_FOR
+
+  Jacobian.SetDiagonalAsColumnSum();
+
+  SU2_OMP_FOR_STAT(256)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    Rhs(iPoint,0) = nodes->GetVolume(iPoint);
+  END_SU2_OMP_FOR
+
+  /*--- Homogeneous Dirichlet condition on the walls, the solution is also set to zero
+   * to be consistent with the halo rows, which are not solved. ---*/
+
+  SU2_OMP_MASTER {
+    for (const auto iPoint : wallPoints) {
+      Phi(iPoint,0) = 0.0;
+      if (iPoint < nPointDomain) Jacobian.EnforceSolutionAtDOF(iPoint, 0, su2double(0.0), Rhs);
+    }
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+unsigned long CPoissonWallDistance::Compute(CGeometry *geometry, const CConfig *config) {
+
+  if (!HasWalls()) return 0;
+
+  const auto nodes = geometry->nodes;
+  const auto edges = geometry->edges;
+
+  unsigned long nIter = 0;
+
+  SU2_OMP_PARALLEL
+  {
+  SetLaplacian(geometry);
+
+  /*--- The previous solution is the initial guess. ---*/
+
+  const auto iter = System.Solve(Jacobian, Rhs, Phi, geometry, config);
+
+  SU2_OMP_MASTER {
+    nIter = iter;
+  }
+  END_SU2_OMP_MASTER
+
+  CSysMatrixComms::Initiate(Phi, geometry, config);
+  CSysMatrixComms::Complete(Phi, geometry, config);
+
+  /*--- Green-Gauss gradient of phi and the distance from the solution of the 1D problem.
+   * Boundary vertex normals point into the domain. ---*/
+
+  SU2_OMP_FOR_DYN(256)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+
+    const su2double phi_i = Phi(iPoint,0);
+    const su2double halfOnVol = 0.5 / nodes->GetVolume(iPoint);
+
+    su2double grad[MAXNDIM] = {0.0};
+
+    for (auto iNeigh = 0u; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh) {
+      const auto iEdge = nodes->GetEdge(iPoint,iNeigh);
+      const auto jPoint = nodes->GetPoint(iPoint,iNeigh);
+      const auto normal = edges->GetNormal(iEdge);
+
+      const su2double weight = ((iPoint < jPoint)? 1.0 : -1.0) * halfOnVol;
+      const su2double flux = weight * (phi_i + Phi(jPoint,0));
+
+      for (auto iDim = 0u; iDim < nDim; ++iDim) grad[iDim] += flux * normal[iDim];
+    }
+
+    if (nodes->GetBoundary(iPoint)) {
+      for (auto iMarker = 0u; iMarker < geometry->GetnMarker(); ++iMarker) {
+        const auto iVertex = nodes->GetVertex(iPoint, iMarker);
+        if (iVertex < 0 || config->GetMarker_All_KindBC(iMarker) == INTERNAL_BOUNDARY ||
+            config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) continue;
+
+        const auto normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        for (auto iDim = 0u; iDim < nDim; ++iDim) grad[iDim] -= 2 * halfOnVol * phi_i * normal[iDim];
+      }
+    }
+
+    Dist(iPoint,0) = 0.0;
+    if (phi_i > 0.0) {
+      const su2double gradNorm = GeometryToolbox::Norm(nDim, grad);
+      Dist(iPoint,0) = sqrt(gradNorm*gradNorm + 2*phi_i) - gradNorm;
+    }
+  }
+  END_SU2_OMP_FOR
+
+  CSysMatrixComms::Initiate(Dist, geometry, config);
+  CSysMatrixComms::Complete(Dist, geometry, config);
+
+  SU2_OMP_FOR_STAT(1024)
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    nodes->SetWall_Distance(iPoint, Dist(iPoint,0));
+  END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+  return nIter;
+}
@@ -41,6 +41,7 @@ CCGNSMeshReaderFVM::CCGNSMeshReaderFVM(CConfig        *val_config,
 
   /*--- The CGNS reader currently assumes a single database. ---*/
   cgnsBase = 1;
+  const su2double startTime = SU2_MPI::Wtime();
   OpenCGNSFile(config->GetMesh_FileName());
 
   /*--- Read the basic information about the database and zone(s). ---*/
@@ -68,7 +69,26 @@ CCGNSMeshReaderFVM::CCGNSMeshReaderFVM(CConfig        *val_config,
   }
 
   /*--- We have extracted all CGNS data. Close the CGNS file. ---*/
+#ifdef HAVE_PCGNS
+  if (cgp_close(cgnsFileID)) cgp_error_exit();
+#else
   if (cg_close(cgnsFileID)) cg_error_exit();
+#endif
+
+  /*--- Aggregate read bandwidth, bytes over all ranks divided by the slowest rank. ---*/
+  su2double readTime = SU2_MPI::Wtime() - startTime, maxReadTime = 0.0;
+  unsigned long totalBytesRead = 0;
+  SU2_MPI::Allreduce(&readTime, &maxReadTime, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&bytesRead, &totalBytesRead, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  if (maxReadTime > 0.0) {
+    const su2double bandwidth = totalBytesRead/1.0e6/maxReadTime;
+    config->SetMesh_Read_Bandwidth(bandwidth);
+    if (rank == MASTER_NODE) {
+      cout << "Read " << totalBytesRead/1.0e6 << " MB of grid data in " << maxReadTime;
+      cout << " s (" << bandwidth << " MB/s)." << endl;
+    }
+  }
 
   /*--- Put our CGNS data into the class data for the mesh reader. ---*/
   ReformatCGNSVolumeConnectivity();
@@ -101,8 +121,17 @@ void CCGNSMeshReaderFVM::OpenCGNSFile(string val_filename) {
    is the specific index number for this file and will be
    repeatedly used in the function calls. ---*/
 
+#ifdef HAVE_PCGNS
+  /*--- With parallel CGNS (HDF5 with MPI I/O) the file is opened collectively
+   and the bulk data (coordinates and volume sections) is read collectively. ---*/
+  if (cgp_mpi_comm(SU2_MPI::GetComm())) cgp_error_exit();
+  if (cgp_pio_mode(CGP_COLLECTIVE)) cgp_error_exit();
+  if (cgp_open(val_filename.c_str(), CG_MODE_READ, &cgnsFileID))
+    cgp_error_exit();
+#else
   if (cg_open(val_filename.c_str(), CG_MODE_READ, &cgnsFileID))
     cg_error_exit();
+#endif
   if (rank == MASTER_NODE) {
     cout << "Reading the CGNS file: ";
     cout << val_filename.c_str() << "." << endl;
@@ -282,9 +311,32 @@ void CCGNSMeshReaderFVM::ReadCGNSPointCoordinates() {
      Ask for datatype RealDouble and let CGNS library do the translation
      when RealSingle is found. ---*/
 
+#ifdef HAVE_PCGNS
+    /*--- The collective read does not convert types, all ranks must take part
+     even if they do not own points (in which case they pass no buffer). ---*/
+
+    vector<float> coordSingle(datatype == RealSingle ? numberOfLocalPoints : 0);
+    void* coordData = nullptr;
+    if (numberOfLocalPoints > 0) {
+      if (datatype == RealSingle) coordData = coordSingle.data();
+      else coordData = localPointCoordinates[indC].data();
+    }
+
+    if (cgp_coord_read_data(cgnsFileID, cgnsBase, cgnsZone, k+1,
+                            &range_min, &range_max, coordData))
+      cgp_error_exit();
+
+    for (unsigned long iPoint = 0; iPoint < coordSingle.size(); iPoint++)
+      localPointCoordinates[indC][iPoint] = coordSingle[iPoint];
+
+    bytesRead += numberOfLocalPoints * (datatype == RealSingle ? sizeof(float) : sizeof(double));
+#else
     if (cg_coord_read(cgnsFileID, cgnsBase, cgnsZone, coordname, RealDouble,
                       &range_min, &range_max, localPointCoordinates[indC].data()))
       cg_error_exit();
+
+    bytesRead += numberOfLocalPoints * sizeof(double);
+#endif
   }
 
 }
@@ -470,22 +522,40 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
    partial read function in the CGNS API. Only call the CGNS API
    if we have a non-zero number of elements on this rank. ---*/
 
+  const bool isPoly = (elemType == MIXED || elemType == NFACE_n || elemType == NGON_n);
+
+#ifdef HAVE_PCGNS
+  /*--- Sections of a single element type are read collectively, all
+   ranks must take part even if they do not read any elements. ---*/
+  if (!isPoly) {
+    cgsize_t firstE = elementPartitioner.GetFirstIndexOnRank(rank);
+    cgsize_t lastE = elementPartitioner.GetLastIndexOnRank(rank);
+    if (cgp_elements_read_data(cgnsFileID, cgnsBase, cgnsZone, val_section+1, firstE, lastE,
+                               (nElems[val_section] > 0)? connElemCGNS.data() : nullptr))
+      cgp_error_exit();
+  }
+#endif
+
   if (nElems[val_section] > 0) {
-    if (elemType == MIXED || elemType == NFACE_n || elemType == NGON_n) {
+    if (isPoly) {
       if (cg_poly_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
                                         (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
                                         (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank),
                                         connElemCGNS.data(),
                                         connOffsetCGNS.data(), NULL) != CG_OK)
       cg_error_exit();
-    } else {
+    }
+#ifndef HAVE_PCGNS
+    else {
       if (cg_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
                                    (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
                                    (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank),
                                    connElemCGNS.data(), NULL) != CG_OK)
       cg_error_exit();
     }
+#endif
   }
+  bytesRead += (connElemCGNS.size() + connOffsetCGNS.size()) * sizeof(cgsize_t);
 
   /*--- Print some information to the console. ---*/
 
@@ -889,6 +959,7 @@ void CCGNSMeshReaderFVM::ReadCGNSSurfaceSection(int val_section) {
                            connElemTemp.data(), NULL))
         cg_error_exit();
     }
+    bytesRead += connElemTemp.size() * sizeof(cgsize_t);
 
     /*--- Allocate the memory for the data structure used to carry
      the connectivity for this section. ---*/
@@ -0,0 +1,311 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.cpp
+ * \brief Reads a native SU2 binary grid into linear partitions for the
+ *        finite volume solver (FVM).
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+
+static_assert(sizeof(unsigned long) == 8 && sizeof(passivedouble) == 8,
+              "The SU2 binary mesh format assumes 8 byte integers and floating point numbers.");
+
+CSU2BinaryMeshReaderFVM::CSU2BinaryMeshReaderFVM(CConfig        *val_config,
+                                                 unsigned short val_iZone,
+                                                 unsigned short val_nZone)
+: CMeshReaderFVM(val_config, val_iZone, val_nZone) {
+
+  /* Single surface actuator disks are split by the ASCII reader, binary
+   meshes are expected to have been split before the conversion. */
+  const bool actuator_disk = (((config->GetnMarker_ActDiskInlet() != 0) ||
+                               (config->GetnMarker_ActDiskOutlet() != 0)) &&
+                              ((config->GetKind_SU2() == SU2_COMPONENT::SU2_CFD) ||
+                               ((config->GetKind_SU2() == SU2_COMPONENT::SU2_DEF) &&
+                                (config->GetActDisk_SU2_DEF()))) &&
+                              !config->GetActDisk_DoubleSurface());
+  if (actuator_disk) {
+    SU2_MPI::Error(string("SU2 binary meshes cannot split actuator disk surfaces.\n") +
+                   string("Convert the mesh with ACTDISK_SU2_DEF= YES and use ACTDISK_DOUBLE_SURFACE= YES."),
+                   CURRENT_FUNCTION);
+  }
+
+  if ((val_nZone > 1) && config->GetMultizone_Mesh()) {
+    SU2_MPI::Error("SU2 binary mesh files contain a single zone, use one file per zone.", CURRENT_FUNCTION);
+  }
+
+  meshFilename = config->GetMesh_FileName();
+
+  /*--- All ranks open the file. ---*/
+
+#ifdef HAVE_MPI
+  if (MPI_File_open(SU2_MPI::GetComm(), meshFilename.c_str(), MPI_MODE_RDONLY,
+                    MPI_INFO_NULL, &fileHandle) != MPI_SUCCESS)
+#else
+  fileHandle = fopen(meshFilename.c_str(), "rb");
+  if (!fileHandle)
+#endif
+    SU2_MPI::Error(string("Error opening SU2 binary grid ") + meshFilename +
+                   string(".\n Check that the file exists."), CURRENT_FUNCTION);
+
+  /* Read the header, the points and the interior elements, each rank only
+   reads and stores its linear partition of the points (and the elements
+   that use those points). The master stores all surface connectivity. */
+  ReadMetadata();
+  ReadPointCoordinates();
+  ReadVolumeElementConnectivity();
+
+#ifdef HAVE_MPI
+  MPI_File_close(&fileHandle);
+#else
+  fclose(fileHandle);
+#endif
+
+  ReadSurfaceElementConnectivity();
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadBinaryDataAll(unsigned long offsetInBytes, unsigned long nWords, void* data) {
+
+#ifdef HAVE_MPI
+
+  /*--- Read in units of 8 bytes, to allow chunks larger than 2GB. ---*/
+
+  MPI_Datatype wordType;
+  MPI_Type_contiguous(sizeof(unsigned long), MPI_BYTE, &wordType);
+  MPI_Type_commit(&wordType);
+
+  int ierr = MPI_File_read_at_all(fileHandle, MPI_Offset(offsetInBytes), data, int(nWords),
+                                  wordType, MPI_STATUS_IGNORE);
+  MPI_Type_free(&wordType);
+
+  if (ierr != MPI_SUCCESS)
+#else
+  if ((nWords > 0) && (fseek(fileHandle, offsetInBytes, SEEK_SET) ||
+                       (fread(data, sizeof(unsigned long), nWords, fileHandle) != nWords)))
+#endif
+    SU2_MPI::Error(string("Error reading SU2 binary grid ") + meshFilename, CURRENT_FUNCTION);
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadMetadata() {
+
+  ReadBinaryDataAll(0, BINARY_MESH_HEADER_SIZE, header);
+
+  if (header[BINARY_MESH_MAGIC] != SU2_BINARY_MESH_MAGIC) {
+    SU2_MPI::Error(meshFilename + string(" is not an SU2 binary mesh file."), CURRENT_FUNCTION);
+  }
+  if (header[BINARY_MESH_VERSION] > SU2_BINARY_MESH_VERSION) {
+    SU2_MPI::Error(meshFilename + string(" was written by a more recent version of SU2."), CURRENT_FUNCTION);
+  }
+
+  dimension = header[BINARY_MESH_NDIM];
+  numberOfGlobalPoints = header[BINARY_MESH_NPOINT];
+  numberOfGlobalElements = header[BINARY_MESH_NELEM];
+  numberOfMarkers = header[BINARY_MESH_NMARKER];
+
+  if ((dimension != 2) && (dimension != 3)) {
+    SU2_MPI::Error(string("Invalid number of dimensions in ") + meshFilename, CURRENT_FUNCTION);
+  }
+
+  unsigned long nElemCheck = 0;
+  for (unsigned short iType = 0; iType < BINARY_MESH_N_ELEM_TYPES; iType++)
+    nElemCheck += header[BINARY_MESH_ELEM_COUNT+iType];
+
+  if (nElemCheck != numberOfGlobalElements) {
+    SU2_MPI::Error(string("Inconsistent number of elements in ") + meshFilename, CURRENT_FUNCTION);
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadPointCoordinates() {
+
+  /* The points of each rank are contiguous in the file (point-major). */
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+  const auto firstPoint = pointPartitioner.GetCumulativeSizeBeforeRank(rank);
+
+  vector<passivedouble> coords(numberOfLocalPoints*dimension);
+
+  ReadBinaryDataAll(header[BINARY_MESH_POINT_OFFSET] + firstPoint*dimension*sizeof(passivedouble),
+                    coords.size(), coords.data());
+
+  /* Transpose into our data structure for the point coordinates. */
+  localPointCoordinates.resize(dimension);
+  for (unsigned short iDim = 0; iDim < dimension; iDim++) {
+    localPointCoordinates[iDim].resize(numberOfLocalPoints);
+    for (unsigned long iPoint = 0; iPoint < numberOfLocalPoints; iPoint++)
+      localPointCoordinates[iDim][iPoint] = coords[iPoint*dimension + iDim];
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadVolumeElementConnectivity() {
+
+  /*--- Each rank reads a linear partition of the elements of each type, and then
+   sends them to the ranks that own at least one of their points, as with the
+   ASCII format there will be element redundancy at the partition boundaries.
+   Types are processed in order to keep the elements sorted by global index. ---*/
+
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+
+  numberOfLocalElements = 0;
+  unsigned long firstGlobalIndex = 0;
+
+  vector<int> nElemSend(size), nElemRecv(size);
+  vector<int> sendCounts(size), sendDispls(size), recvCounts(size), recvDispls(size);
+  vector<int> elemRanks;
+  elemRanks.reserve(N_POINTS_HEXAHEDRON);
+
+  for (unsigned short iType = 0; iType < BINARY_MESH_N_ELEM_TYPES; iType++) {
+
+    const auto nNodes = BINARY_MESH_ELEM_NODES[iType];
+    const auto nElemType = header[BINARY_MESH_ELEM_COUNT+iType];
+
+    CLinearPartitioner elemPartitioner(nElemType,0);
+    const auto nElem = elemPartitioner.GetSizeOnRank(rank);
+    const auto firstElem = elemPartitioner.GetCumulativeSizeBeforeRank(rank);
+
+    vector<unsigned long> connElem(nElem*nNodes);
+
+    ReadBinaryDataAll(header[BINARY_MESH_ELEM_OFFSET+iType] + firstElem*nNodes*sizeof(unsigned long),
+                      connElem.size(), connElem.data());
+
+    /*--- Find the (unique) ranks that need each element. ---*/
+
+    auto findRanks = [&](unsigned long iElem) {
+      elemRanks.clear();
+      for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+        const auto iPoint = connElem[iElem*nNodes + iNode];
+        if (iPoint >= numberOfGlobalPoints) {
+          SU2_MPI::Error(string("Invalid point index in ") + meshFilename, CURRENT_FUNCTION);
+        }
+        const int iRank = pointPartitioner.GetRankContainingIndex(iPoint);
+        if (find(elemRanks.begin(), elemRanks.end(), iRank) == elemRanks.end())
+          elemRanks.push_back(iRank);
+      }
+    };
+
+    /*--- Count the elements that are sent to each rank and communicate the counts. ---*/
+
+    fill(nElemSend.begin(), nElemSend.end(), 0);
+    for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+      findRanks(iElem);
+      for (auto iRank : elemRanks) nElemSend[iRank]++;
+    }
+
+    SU2_MPI::Alltoall(nElemSend.data(), 1, MPI_INT, nElemRecv.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+    int nSend = 0, nRecv = 0;
+    for (int iRank = 0; iRank < size; iRank++) {
+      sendCounts[iRank] = SU2_CONN_SIZE*nElemSend[iRank];
+      recvCounts[iRank] = SU2_CONN_SIZE*nElemRecv[iRank];
+      sendDispls[iRank] = nSend;
+      recvDispls[iRank] = nRecv;
+      nSend += sendCounts[iRank];
+      nRecv += recvCounts[iRank];
+    }
+
+    /*--- Load the send buffer in the standard format
+     [globalID vtkType n0 n1 n2 n3 n4 n5 n6 n7]. ---*/
+
+    vector<unsigned long> connSend(nSend, 0), connRecv(nRecv, 0);
+    vector<int> index(sendDispls);
+
+    for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+      findRanks(iElem);
+      for (auto iRank : elemRanks) {
+        auto conn = &connSend[index[iRank]];
+        conn[0] = firstGlobalIndex + firstElem + iElem;
+        conn[1] = BINARY_MESH_ELEM_TYPES[iType];
+        for (unsigned short iNode = 0; iNode < nNodes; iNode++)
+          conn[SU2_CONN_SKIP + iNode] = connElem[iElem*nNodes + iNode];
+        index[iRank] += SU2_CONN_SIZE;
+      }
+    }
+    vector<unsigned long>().swap(connElem);
+
+    SU2_MPI::Alltoallv(connSend.data(), sendCounts.data(), sendDispls.data(), MPI_UNSIGNED_LONG,
+                       connRecv.data(), recvCounts.data(), recvDispls.data(), MPI_UNSIGNED_LONG,
+                       SU2_MPI::GetComm());
+
+    localVolumeElementConnectivity.insert(localVolumeElementConnectivity.end(), connRecv.begin(), connRecv.end());
+    numberOfLocalElements += nRecv / SU2_CONN_SIZE;
+    firstGlobalIndex += nElemType;
+
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadSurfaceElementConnectivity() {
+
+  surfaceElementConnectivity.resize(numberOfMarkers);
+  markerNames.resize(numberOfMarkers);
+
+  /*--- Only the master node reads and stores the markers. ---*/
+
+  if (rank != MASTER_NODE) return;
+
+  ifstream mesh_file(meshFilename, ios::in | ios::binary);
+  mesh_file.seekg(header[BINARY_MESH_MARKER_OFFSET]);
+
+  auto readWords = [&](unsigned long nWords, unsigned long* data) {
+    mesh_file.read(reinterpret_cast<char*>(data), nWords*sizeof(unsigned long));
+  };
+
+  for (unsigned long iMarker = 0; iMarker < numberOfMarkers; iMarker++) {
+
+    unsigned long nameLength = 0, nElemBound = 0;
+
+    readWords(1, &nameLength);
+    markerNames[iMarker].resize(nameLength);
+    mesh_file.read(&markerNames[iMarker][0], nameLength);
+
+    readWords(1, &nElemBound);
+    vector<unsigned long> connElem(nElemBound*BINARY_MESH_MARKER_CONN_SIZE);
+    readWords(connElem.size(), connElem.data());
+
+    if (!mesh_file) {
+      SU2_MPI::Error(string("Error reading the markers of SU2 binary grid ") + meshFilename, CURRENT_FUNCTION);
+    }
+
+    /*--- Store in the standard format [0 vtkType n0 n1 n2 n3 0 0 0 0]. ---*/
+
+    auto& connMarker = surfaceElementConnectivity[iMarker];
+    connMarker.resize(nElemBound*SU2_CONN_SIZE, 0);
+
+    for (unsigned long iElem = 0; iElem < nElemBound; iElem++) {
+      const auto conn = &connElem[iElem*BINARY_MESH_MARKER_CONN_SIZE];
+      if ((dimension == 3) && (conn[0] == LINE)) {
+        SU2_MPI::Error(string("Line boundary conditions are not possible for 3D calculations.") +
+                       string("Please check the SU2 binary mesh file."), CURRENT_FUNCTION);
+      }
+      connMarker[iElem*SU2_CONN_SIZE + 1] = conn[0];
+      for (unsigned short iNode = 0; iNode < BINARY_MESH_MARKER_CONN_SIZE-1; iNode++)
+        connMarker[iElem*SU2_CONN_SIZE + SU2_CONN_SKIP + iNode] = conn[1 + iNode];
+    }
+  }
+
+}
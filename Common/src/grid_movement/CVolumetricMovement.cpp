@@ -409,10 +409,13 @@ void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry *geometry, CConfi
     }
   }
 
-  /*--- Build the ADT of the boundary nodes. ---*/
+  /*--- Build the ADT of the boundary nodes, only the nodes that may be the nearest
+   to the points of this rank are gathered from other ranks. ---*/
+
+  const ADTSearchPoints searchPoints{{geometry->nodes->GetCoord().data(), geometry->GetnPoint()}};
 
   CADTPointsOnlyClass WallADT(nDim, nVertex_SolidWall, Coord_bound.data(),
-                              PointIDs.data(), true);
+                              PointIDs.data(), searchPoints);
 
   /*--- Loop over all interior mesh nodes and compute the distances to each
    of the no-slip boundary nodes. Store the minimum distance to the wall
@@ -29,6 +29,7 @@
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
 
 CNearestNeighbor::CNearestNeighbor(CGeometry ****geometry_container, const CConfig* const* config,
                                    unsigned int iZone, unsigned int jZone) :
@@ -53,11 +54,15 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
   const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface()/2;
   const auto nDim = donor_geometry->GetnDim();
 
-  Buffer_Receive_nVertex_Donor = new unsigned long [nProcessor];
-
   targetVertices.resize(config[targetZone]->GetnMarker_All());
 
-  vector<vector<DonorInfo> > DonorInfoVec(omp_get_max_threads());
+  /*--- Working arrays for the tree searches of each thread. ---*/
+  struct SearchWork {
+    vector<su2double> dist2;
+    vector<unsigned long> pointID;
+    vector<int> rankID;
+  };
+  vector<SearchWork> workVec(omp_get_max_threads());
 
   /*--- Cycle over nMarkersInt interface to determine communication pattern. ---*/
 
@@ -79,100 +84,202 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
     if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
     if (markTarget != -1) nVertexTarget = target_geometry->GetnVertex(markTarget);
 
-    /*--- Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor. ---*/
-    Determine_ArraySize(markDonor, markTarget, nVertexDonor, nDim);
     if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
 
-    const auto nPossibleDonor = accumulate(Buffer_Receive_nVertex_Donor,
-                                Buffer_Receive_nVertex_Donor+nProcessor, 0ul);
+    /*--- Local (owned) donor points. ---*/
+    vector<su2double> localCoord;
+    vector<unsigned long> localGlobalIdx;
+    for (auto iVertex = 0ul; iVertex < nVertexDonor; iVertex++) {
+      const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+      if (!donor_geometry->nodes->GetDomain(iPoint)) continue;
+      localGlobalIdx.push_back(donor_geometry->nodes->GetGlobalIndex(iPoint));
+      for (auto iDim = 0u; iDim < nDim; iDim++)
+        localCoord.push_back(donor_geometry->nodes->GetCoord(iPoint, iDim));
+    }
+    unsigned long nLocalDonor = localGlobalIdx.size();
+
+    /*--- Bounding boxes of the local donor and target points, the donor
+     *    boxes of all ranks are used to decide which donors are needed. ---*/
+    vector<passivedouble> donorBox(2*nDim), targetBox(2*nDim);
+    auto initBox = [nDim](vector<passivedouble>& box) {
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        box[iDim] = numeric_limits<passivedouble>::max();
+        box[nDim+iDim] = numeric_limits<passivedouble>::lowest();
+      }
+    };
+    auto addToBox = [nDim](const su2double* coord, vector<passivedouble>& box) {
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        box[iDim] = min(box[iDim], SU2_TYPE::GetValue(coord[iDim]));
+        box[nDim+iDim] = max(box[nDim+iDim], SU2_TYPE::GetValue(coord[iDim]));
+      }
+    };
+    initBox(donorBox);
+    initBox(targetBox);
+    for (auto iDonor = 0ul; iDonor < nLocalDonor; iDonor++) addToBox(&localCoord[iDonor*nDim], donorBox);
+
+    unsigned long nLocalTarget = 0;
+    for (auto iVertex = 0ul; iVertex < nVertexTarget; iVertex++) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+      addToBox(target_geometry->nodes->GetCoord(iPoint), targetBox);
+      ++nLocalTarget;
+    }
+
+    vector<unsigned long> allNumDonor(nProcessor);
+    vector<passivedouble> allDonorBox(nProcessor*2*nDim);
+    SU2_MPI::Allgather(&nLocalDonor, 1, MPI_UNSIGNED_LONG, allNumDonor.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+    SU2_MPI::Allgather(donorBox.data(), 2*nDim, MPI_DOUBLE, allDonorBox.data(), 2*nDim, MPI_DOUBLE, SU2_MPI::GetComm());
+
+    /*--- Squared distance between the local target box and the donor box of a rank. ---*/
+    auto boxDistance2 = [&](int iProcessor) {
+      const auto box = &allDonorBox[iProcessor*2*nDim];
+      passivedouble dist2 = 0.0;
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        const passivedouble gap = max(0.0, max(box[iDim] - targetBox[nDim+iDim], targetBox[iDim] - box[nDim+iDim]));
+        dist2 += gap*gap;
+      }
+      return dist2;
+    };
+
+    /*--- Donors received so far, their ranks are looked up by global index. ---*/
+    vector<su2double> donorCoord;
+    vector<unsigned long> donorGlobalIdx;
+    vector<pair<unsigned long,int> > donorRank;
+    vector<int> haveDonors(nProcessor, 0);
+
+    /*--- The search is done in two rounds. First the donors of the ranks whose boxes
+     *    overlap the local target box are fetched. The distance to the farthest of the
+     *    k nearest donors of any target (searchRadius) then bounds the region where
+     *    closer donors may exist, the donors of the ranks whose boxes are within that
+     *    distance are fetched and the search is repeated if new donors were received.
+     *    The result is exact, and in general only neighboring ranks exchange donors. ---*/
+    passivedouble searchRadius2 = 0.0;
+    su2double markerAvgDist = 0.0, markerMaxDist = 0.0;
+    unsigned long markerNumTarget = 0;
+
+    for (int iRound = 0; iRound < 2; ++iRound) {
+
+      vector<int> request(nProcessor, 0), requested(nProcessor, 0);
+      for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
+        request[iProcessor] = (nLocalTarget > 0) && !haveDonors[iProcessor] && (allNumDonor[iProcessor] > 0) &&
+                              (boxDistance2(iProcessor) <= searchRadius2);
+      }
+      SU2_MPI::Alltoall(request.data(), 1, MPI_INT, requested.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+      /*--- Exchange global indices and coordinates, all receivers get the same send buffer. ---*/
+      vector<int> sendCount(nProcessor), sendDispl(nProcessor, 0), recvCount(nProcessor), recvDispl(nProcessor);
+      int nRecv = 0;
+      for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
+        sendCount[iProcessor] = requested[iProcessor]? nLocalDonor : 0;
+        recvCount[iProcessor] = request[iProcessor]? allNumDonor[iProcessor] : 0;
+        recvDispl[iProcessor] = nRecv;
+        nRecv += recvCount[iProcessor];
+      }
+      const auto nPrev = donorGlobalIdx.size();
+      donorGlobalIdx.resize(nPrev + nRecv);
+      donorCoord.resize((nPrev + nRecv)*nDim);
+
+      SU2_MPI::Alltoallv(localGlobalIdx.data(), sendCount.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                         &donorGlobalIdx[nPrev], recvCount.data(), recvDispl.data(), MPI_UNSIGNED_LONG,
+                         SU2_MPI::GetComm());
+
+      for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
+        sendCount[iProcessor] *= nDim;
+        recvCount[iProcessor] *= nDim;
+        recvDispl[iProcessor] *= nDim;
+      }
+      SU2_MPI::Alltoallv(localCoord.data(), sendCount.data(), sendDispl.data(), MPI_DOUBLE,
+                         &donorCoord[nPrev*nDim], recvCount.data(), recvDispl.data(), MPI_DOUBLE,
+                         SU2_MPI::GetComm());
+
+      /*--- No new donors, the previous search is final. ---*/
+      if ((iRound > 0) && (nRecv == 0)) break;
+
+      for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
+        if (!request[iProcessor]) continue;
+        haveDonors[iProcessor] = 1;
+        for (auto iDonor = recvDispl[iProcessor]/nDim; iDonor < (recvDispl[iProcessor]+recvCount[iProcessor])/nDim; ++iDonor)
+          donorRank.emplace_back(donorGlobalIdx[nPrev+iDonor], iProcessor);
+      }
+      sort(donorRank.begin(), donorRank.end());
 
-    Buffer_Send_Coord.resize(MaxLocalVertex_Donor, nDim);
-    Buffer_Send_GlobalPoint.resize(MaxLocalVertex_Donor);
-    Buffer_Receive_Coord.resize(nProcessor * MaxLocalVertex_Donor, nDim);
-    Buffer_Receive_GlobalPoint.resize(nProcessor * MaxLocalVertex_Donor);
+      /*--- Tree of the donors received so far, the global indices are used as IDs. ---*/
+      CADTPointsOnlyClass donorADT(nDim, donorGlobalIdx.size(), donorCoord.data(), donorGlobalIdx.data(), false);
 
-    /*--- Collect coordinates and global point indices. ---*/
-    Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim);
+      const auto nDonorTree = min<unsigned long>(nDonor, donorGlobalIdx.size());
 
-    /*--- Find the closest donor points to each target. ---*/
-    SU2_OMP_PARALLEL
-    {
-    /*--- Working array for this thread. ---*/
-    auto& donorInfo = DonorInfoVec[omp_get_thread_num()];
-    donorInfo.resize(nPossibleDonor);
+      /*--- A target without enough donors makes the search radius infinite. ---*/
+      passivedouble maxDist2 = (nDonorTree < nDonor)? numeric_limits<passivedouble>::max() : 0.0;
+      markerAvgDist = markerMaxDist = 0.0;
+      markerNumTarget = 0;
 
-    su2double avgDist = 0.0, maxDist = 0.0;
-    unsigned long numTarget = 0;
+      SU2_OMP_PARALLEL
+      {
+      auto& work = workVec[omp_get_thread_num()];
+      passivedouble threadMaxDist2 = 0.0;
+      su2double avgDist = 0.0, maxDist = 0.0;
+      unsigned long numTarget = 0;
 
-    SU2_OMP_FOR_DYN(roundUpDiv(nVertexTarget,2*omp_get_max_threads()))
-    for (auto iVertexTarget = 0ul; iVertexTarget < nVertexTarget; iVertexTarget++) {
+      SU2_OMP_FOR_DYN(roundUpDiv(nVertexTarget,2*omp_get_max_threads()))
+      for (auto iVertexTarget = 0ul; iVertexTarget < nVertexTarget; iVertexTarget++) {
 
-      auto& target_vertex = targetVertices[markTarget][iVertexTarget];
-      const auto Point_Target = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
+        auto& target_vertex = targetVertices[markTarget][iVertexTarget];
+        const auto Point_Target = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
 
-      if (!target_geometry->nodes->GetDomain(Point_Target)) continue;
+        if (!target_geometry->nodes->GetDomain(Point_Target)) continue;
 
-      /*--- Coordinates of the target point. ---*/
-      const su2double* Coord_i = target_geometry->nodes->GetCoord(Point_Target);
+        /*--- Find the k closest donors (sorted by distance and global index). ---*/
+        donorADT.DetermineNearestNodes(target_geometry->nodes->GetCoord(Point_Target), nDonorTree,
+                                       work.dist2, work.pointID, work.rankID);
 
-      /*--- Compute all distances. ---*/
-      for (int iProcessor = 0, iDonor = 0; iProcessor < nProcessor; ++iProcessor) {
-        for (auto jVertex = 0ul; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++jVertex) {
+        if (nDonorTree == 0) continue;
+        threadMaxDist2 = max(threadMaxDist2, SU2_TYPE::GetValue(work.dist2.back()));
 
-          const auto idx = iProcessor*MaxLocalVertex_Donor + jVertex;
-          const auto pGlobalPoint = Buffer_Receive_GlobalPoint[idx];
-          const su2double* Coord_j = Buffer_Receive_Coord[idx];
-          const auto dist2 = GeometryToolbox::SquaredDistance(nDim, Coord_i, Coord_j);
+        /*--- Update stats. ---*/
+        numTarget += 1;
+        su2double d = sqrt(work.dist2[0]);
+        avgDist += d;
+        maxDist = max(maxDist, d);
 
-          donorInfo[iDonor++] = DonorInfo(dist2, pGlobalPoint, iProcessor);
+        /*--- Compute interpolation numerators and denominator. ---*/
+        su2double denom = 0.0;
+        for (auto iDonor = 0ul; iDonor < nDonorTree; ++iDonor) {
+          work.dist2[iDonor] = 1.0 / (work.dist2[iDonor] + eps);
+          denom += work.dist2[iDonor];
         }
-      }
 
-      /*--- Find k closest points. ---*/
-      partial_sort(donorInfo.begin(), donorInfo.begin()+nDonor, donorInfo.end(),
-        [](const DonorInfo& a, const DonorInfo& b) {
-          /*--- Global index is used as tie-breaker to make sorted order independent of initial. ---*/
-          return (a.dist != b.dist)? (a.dist < b.dist) : (a.pidx < b.pidx);
+        /*--- Set interpolation coefficients. ---*/
+        target_vertex.resize(nDonorTree);
+
+        for (auto iDonor = 0ul; iDonor < nDonorTree; ++iDonor) {
+          const auto globalIdx = work.pointID[iDonor];
+          const auto it = lower_bound(donorRank.begin(), donorRank.end(), make_pair(globalIdx, 0));
+          target_vertex.globalPoint[iDonor] = globalIdx;
+          target_vertex.processor[iDonor] = it->second;
+          target_vertex.coefficient[iDonor] = work.dist2[iDonor]/denom;
         }
-      );
-
-      /*--- Update stats. ---*/
-      numTarget += 1;
-      su2double d = sqrt(donorInfo[0].dist);
-      avgDist += d;
-      maxDist = max(maxDist, d);
-
-      /*--- Compute interpolation numerators and denominator. ---*/
-      su2double denom = 0.0;
-      for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
-        donorInfo[iDonor].dist = 1.0 / (donorInfo[iDonor].dist + eps);
-        denom += donorInfo[iDonor].dist;
       }
-
-      /*--- Set interpolation coefficients. ---*/
-      target_vertex.resize(nDonor);
-
-      for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
-        target_vertex.globalPoint[iDonor] = donorInfo[iDonor].pidx;
-        target_vertex.processor[iDonor] = donorInfo[iDonor].proc;
-        target_vertex.coefficient[iDonor] = donorInfo[iDonor].dist/denom;
+      END_SU2_OMP_FOR
+      SU2_OMP_CRITICAL
+      {
+        maxDist2 = max(maxDist2, threadMaxDist2);
+        markerNumTarget += numTarget;
+        markerAvgDist += avgDist;
+        markerMaxDist = max(markerMaxDist, maxDist);
       }
+      END_SU2_OMP_CRITICAL
+      }
+      END_SU2_OMP_PARALLEL
+
+      searchRadius2 = maxDist2;
     }
-    END_SU2_OMP_FOR
-    SU2_OMP_CRITICAL
-    {
-      totalTargetPoints += numTarget;
-      AvgDistance += avgDist;
-      MaxDistance = max(MaxDistance, maxDist);
-    }
-    END_SU2_OMP_CRITICAL
-    }
-    END_SU2_OMP_PARALLEL
 
+    /*--- Stats of the final search. ---*/
+    totalTargetPoints += markerNumTarget;
+    AvgDistance += markerAvgDist;
+    MaxDistance = max(MaxDistance, markerMaxDist);
   }
 
-  delete[] Buffer_Receive_nVertex_Donor;
-
   unsigned long tmp = totalTargetPoints;
   SU2_MPI::Allreduce(&tmp, &totalTargetPoints, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
   su2double tmp1 = AvgDistance, tmp2 = MaxDistance;
@@ -30,6 +30,7 @@
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/CSymmetricMatrix.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
 
 #if defined(HAVE_MKL)
 #include "mkl.h"
@@ -60,6 +61,10 @@ void CRadialBasisFunction::PrintStatistics() const {
   if (MaxCorrection < 1.1 || AvgCorrection < 1.02) cout << " (ok)\n";
   else if (MaxCorrection < 2.0 && AvgCorrection < 1.05) cout << " (warning)\n";
   else cout << " <<< WARNING >>>\n";
+  if (SparseMode) {
+    cout << "  Max donor patch size / CG iterations of the local RBF systems: "
+         << MaxPatchSize << " / " << MaxSolverIter << "\n";
+  }
   cout << "  Interpolation matrix is " << Density << "% dense." << endl;
   cout.unsetf(ios::floatfield);
 }
@@ -101,6 +106,13 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   const bool usePolynomial = config[donorZone]->GetRadialBasisFunctionPolynomialOption();
   const su2double paramRBF = config[donorZone]->GetRadialBasisFunctionParameter();
   const su2double pruneTol = config[donorZone]->GetRadialBasisFunctionPruneTol();
+  const bool sparse = config[donorZone]->GetRadialBasisFunctionSparse();
+  const su2double patchRadius = config[donorZone]->GetRadialBasisFunctionPatchFactor() * paramRBF;
+
+  if (sparse && (kindRBF != RADIAL_BASIS::WENDLAND_C2)) {
+    SU2_MPI::Error("Sparse RBF interpolation requires a compactly supported kernel (WENDLAND_C2).", CURRENT_FUNCTION);
+  }
+  SparseMode = sparse;
 
   const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface()/2;
   const int nDim = donor_geometry->GetnDim();
@@ -192,7 +204,7 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
     for (int i = 1; i < nProcessor; ++i)
       if (totalWork[i] < totalWork[iProcessor]) iProcessor = i;
 
-    totalWork[iProcessor] += pow(nGlobalVertexDonor,3); // based on matrix inversion.
+    totalWork[iProcessor] += sparse? nGlobalVertexDonor : pow(nGlobalVertexDonor,3); // based on matrix inversion.
 
     assignedProcessor[iMarkerInt] = iProcessor;
 
@@ -207,7 +219,7 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
   SU2_OMP_PARALLEL_(for schedule(dynamic,1))
   for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; ++iMarkerInt) {
-    if (rank == assignedProcessor[iMarkerInt]) {
+    if (!sparse && (rank == assignedProcessor[iMarkerInt])) {
       ComputeGeneratorMatrix(kindRBF, usePolynomial, paramRBF,
                              donorCoordinates[iMarkerInt], nPolynomialVec[iMarkerInt],
                              keepPolynomialRowVec[iMarkerInt], CinvTrucVec[iMarkerInt]);
@@ -220,6 +232,7 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   /*--- Initialize variables for interpolation statistics. ---*/
   unsigned long totalTargetPoints = 0, totalDonorPoints = 0, denseSize = 0;
   MinDonors = 1<<30; MaxDonors = 0; MaxCorrection = 0.0; AvgCorrection = 0.0;
+  MaxPatchSize = 0; MaxSolverIter = 0;
 
   for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++) {
 
@@ -244,6 +257,24 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
     const auto nGlobalVertexDonor = donorCoord.rows();
 
+    if (sparse) {
+      /*--- Each rank computes the coefficients of its own target vertices from the
+       *    gathered donor information, the generator matrix is not needed. ---*/
+      if (nVertexTarget) {
+        targetVertices[markTarget].resize(nVertexTarget);
+        totalDonorPoints += SetSparseTransferCoeff(kindRBF, usePolynomial, paramRBF, patchRadius,
+                                                   SU2_TYPE::GetValue(pruneTol), donorCoord, donorPoint,
+                                                   donorProc, markTarget, nVertexTarget);
+      }
+      totalTargetPoints += nVertexTarget;
+      denseSize += nVertexTarget*nGlobalVertexDonor;
+
+      donorCoord.resize(0,0);
+      vector<long>().swap(donorPoint);
+      vector<int>().swap(donorProc);
+      continue;
+    }
+
 #ifdef HAVE_MPI
     /*--- For simplicity, broadcast small information about the interpolation matrix. ---*/
     SU2_MPI::Bcast(&nPolynomial, 1, MPI_INT, iProcessor, SU2_MPI::GetComm());
@@ -408,6 +439,8 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   Reduce(MPI_SUM, denseSize);
   Reduce(MPI_MIN, MinDonors);
   Reduce(MPI_MAX, MaxDonors);
+  Reduce(MPI_MAX, MaxPatchSize);
+  Reduce(MPI_MAX, MaxSolverIter);
 #ifdef HAVE_MPI
   passivedouble tmp1 = AvgCorrection, tmp2 = MaxCorrection;
   MPI_Allreduce(&tmp1, &AvgCorrection, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
@@ -429,6 +462,235 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
 }
 
+unsigned long CRadialBasisFunction::SetSparseTransferCoeff(RADIAL_BASIS type, bool usePolynomial, su2double radius,
+                                                           su2double patchRadius, passivedouble pruneTol,
+                                                           const su2activematrix& donorCoord,
+                                                           const vector<long>& donorPoint,
+                                                           const vector<int>& donorProc,
+                                                           unsigned short markTarget,
+                                                           unsigned long nVertexTarget) {
+
+  const su2double interfaceCoordTol = 1e6 * numeric_limits<passivedouble>::epsilon();
+
+  const auto nDonor = donorCoord.rows();
+  const int nDim = donorCoord.cols();
+  const passivedouble radius2 = pow(SU2_TYPE::GetValue(radius), 2);
+
+  /*--- Local tree of the donor points, the IDs are the positions in donorCoord,
+   *    which are sorted by global index, i.e. the patches do not depend on the partitions. ---*/
+  vector<unsigned long> donorIdx(nDonor);
+  iota(donorIdx.begin(), donorIdx.end(), 0ul);
+  CADTPointsOnlyClass donorADT(nDim, nDonor, donorCoord.data(), donorIdx.data(), false);
+  vector<unsigned long>().swap(donorIdx);
+
+  unsigned long totalDonors = 0;
+
+  SU2_OMP_PARALLEL
+  {
+  /*--- Thread-local work variables and statistics. ---*/
+  vector<unsigned long> patch, rowPtr, colInd;
+  vector<passivedouble> values, phi, coeff, polyRes, polyCoeff;
+  vector<int> keepPolynomialRow;
+  su2passivematrix P, Z;
+
+  unsigned long minDonors = 1<<30, maxDonors = 0, sumDonors = 0, maxPatch = 0, maxIter = 0;
+  passivedouble sumCorr = 0.0, maxCorr = 0.0;
+
+  SU2_OMP_FOR_DYN(16)
+  for (auto iVertex = 0ul; iVertex < nVertexTarget; ++iVertex) {
+
+    const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+    const su2double* targetCoord = target_geometry->nodes->GetCoord(iPoint);
+    auto& targetVertex = targetVertices[markTarget][iVertex];
+
+    /*--- Donors in the patch around the target, without any the target keeps 0 donors
+     *    (reported by the sanity checks at the end of SetTransferCoeff). ---*/
+    donorADT.DetermineNodesInRadius(targetCoord, patchRadius, patch);
+    const auto nPatch = patch.size();
+    maxPatch = max(maxPatch, nPatch);
+    if (nPatch == 0) {
+      minDonors = 0;
+      continue;
+    }
+
+    /*--- Sparse RBF matrix of the patch, full rows are stored. ---*/
+    rowPtr.assign(1, 0);
+    colInd.clear();
+    values.clear();
+    for (auto i = 0ul; i < nPatch; ++i) {
+      for (auto j = 0ul; j < nPatch; ++j) {
+        const auto dist2 = SU2_TYPE::GetValue(GeometryToolbox::SquaredDistance(nDim, donorCoord[patch[i]],
+                                                                                donorCoord[patch[j]]));
+        if (dist2 >= radius2) continue;
+        colInd.push_back(j);
+        values.push_back(SU2_TYPE::GetValue(Get_RadialBasisValue(type, radius, sqrt(dist2))));
+      }
+      rowPtr.push_back(colInd.size());
+    }
+
+    /*--- RBF part of the coefficients, M^-1 * phi, phi being the RBF values at the target. ---*/
+    phi.resize(nPatch);
+    coeff.resize(nPatch);
+    for (auto i = 0ul; i < nPatch; ++i) {
+      const auto dist = GeometryToolbox::Distance(nDim, targetCoord, donorCoord[patch[i]]);
+      phi[i] = SU2_TYPE::GetValue(Get_RadialBasisValue(type, radius, dist));
+    }
+    auto nIter = SolveSparseSPD(rowPtr, colInd, values, phi.data(), coeff.data());
+
+    /*--- Polynomial part, only if the patch has enough points to define it. ---*/
+    if (usePolynomial && (nPatch > static_cast<unsigned long>(nDim+1))) {
+
+      P.resize(1+nDim, nPatch);
+      for (auto i = 0ul; i < nPatch; ++i) {
+        P(0,i) = 1.0;
+        for (int iDim = 0; iDim < nDim; ++iDim)
+          P(1+iDim,i) = SU2_TYPE::GetValue(donorCoord(patch[i],iDim));
+      }
+      const int nPoly = 1 + CheckPolynomialTerms(interfaceCoordTol, keepPolynomialRow, P);
+
+      /*--- Z = M^-1 * P^T, stored by rows. ---*/
+      Z.resize(nPoly, nPatch);
+      for (int k = 0; k < nPoly; ++k)
+        nIter = max(nIter, SolveSparseSPD(rowPtr, colInd, values, P[k], Z[k]));
+
+      /*--- Schur complement of the saddle-point system, (P * Z^T)^-1. ---*/
+      CSymmetricMatrix Mp(nPoly);
+      for (int k = 0; k < nPoly; ++k)
+        for (int l = k; l < nPoly; ++l) {
+          Mp(k,l) = 0.0;
+          for (auto i = 0ul; i < nPatch; ++i) Mp(k,l) += P(k,i) * Z(l,i);
+        }
+      Mp.Invert(false);
+
+      /*--- Correct the coefficients with the polynomial values at the target that
+       *    are not reproduced by the RBF part, coeff += Z^T * Mp * (p_t - P * coeff). ---*/
+      polyRes.resize(nPoly);
+      polyCoeff.resize(nPoly);
+      polyRes[0] = 1.0;
+      for (int iDim = 0, k = 1; iDim < nDim; ++iDim) {
+        if (!keepPolynomialRow[iDim]) continue;
+        polyRes[k++] = SU2_TYPE::GetValue(targetCoord[iDim]);
+      }
+      for (int k = 0; k < nPoly; ++k)
+        for (auto i = 0ul; i < nPatch; ++i) polyRes[k] -= P(k,i) * coeff[i];
+
+      Mp.MatVecMult(polyRes.begin(), polyCoeff.begin());
+
+      for (int k = 0; k < nPoly; ++k)
+        for (auto i = 0ul; i < nPatch; ++i) coeff[i] += Z(k,i) * polyCoeff[k];
+    }
+    maxIter = max(maxIter, nIter);
+
+    /*--- Prune small coefficients. ---*/
+    auto info = PruneSmallCoefficients(pruneTol, nPatch, coeff.begin());
+    auto nnz = info.first;
+    sumDonors += nnz;
+    minDonors = min(minDonors, nnz);
+    maxDonors = max(maxDonors, nnz);
+    auto corr = fabs(info.second-1.0);
+    sumCorr += corr;
+    maxCorr = max(maxCorr, corr);
+
+    /*--- Allocate and set donor information for this target point. ---*/
+    targetVertex.resize(nnz);
+
+    for (unsigned long i = 0, iSet = 0; i < nPatch; ++i) {
+      if (fabs(coeff[i]) > 0.0) {
+        const auto iDonor = patch[i];
+        targetVertex.processor[iSet] = donorProc[iDonor];
+        targetVertex.globalPoint[iSet] = donorPoint[iDonor];
+        targetVertex.coefficient[iSet] = coeff[i];
+        ++iSet;
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+  SU2_OMP_CRITICAL
+  {
+    totalDonors += sumDonors;
+    MinDonors = min(MinDonors, minDonors);
+    MaxDonors = max(MaxDonors, maxDonors);
+    AvgCorrection += sumCorr;
+    MaxCorrection = max(MaxCorrection, maxCorr);
+    MaxPatchSize = max(MaxPatchSize, maxPatch);
+    MaxSolverIter = max(MaxSolverIter, maxIter);
+  }
+  END_SU2_OMP_CRITICAL
+  }
+  END_SU2_OMP_PARALLEL
+
+  return totalDonors;
+}
+
+unsigned long CRadialBasisFunction::SolveSparseSPD(const vector<unsigned long>& rowPtr,
+                                                   const vector<unsigned long>& colInd,
+                                                   const vector<passivedouble>& values,
+                                                   const passivedouble* rhs, passivedouble* x) {
+  const auto n = rowPtr.size()-1;
+  const passivedouble relTol = 1e-12;
+  const auto maxIter = 2*n+10;
+
+  vector<passivedouble> r(rhs, rhs+n), z(n), p(n), q(n);
+
+  auto dot = [n](const passivedouble* a, const passivedouble* b) {
+    passivedouble sum = 0.0;
+    for (auto i = 0ul; i < n; ++i) sum += a[i]*b[i];
+    return sum;
+  };
+
+  /*--- Symmetric Gauss-Seidel preconditioner, (D+L) D^-1 (D+U) z = r. ---*/
+  auto precond = [&](const vector<passivedouble>& v, vector<passivedouble>& w) {
+    for (auto i = 0ul; i < n; ++i) {
+      passivedouble sum = v[i], diag = 1.0;
+      for (auto k = rowPtr[i]; k < rowPtr[i+1]; ++k) {
+        if (colInd[k] < i) sum -= values[k] * w[colInd[k]];
+        else if (colInd[k] == i) diag = values[k];
+      }
+      w[i] = sum / diag;
+    }
+    for (auto i = n; i-- > 0;) {
+      passivedouble sum = 0.0, diag = 1.0;
+      for (auto k = rowPtr[i]; k < rowPtr[i+1]; ++k) {
+        if (colInd[k] > i) sum += values[k] * w[colInd[k]];
+        else if (colInd[k] == i) diag = values[k];
+      }
+      w[i] -= sum / diag;
+    }
+  };
+
+  for (auto i = 0ul; i < n; ++i) x[i] = 0.0;
+
+  const passivedouble norm0 = sqrt(dot(r.data(), r.data()));
+  if (norm0 == 0.0) return 0;
+
+  precond(r, z);
+  p = z;
+  passivedouble rz = dot(r.data(), z.data());
+
+  unsigned long iter = 0;
+  while (iter < maxIter) {
+    ++iter;
+
+    for (auto i = 0ul; i < n; ++i) {
+      q[i] = 0.0;
+      for (auto k = rowPtr[i]; k < rowPtr[i+1]; ++k) q[i] += values[k] * p[colInd[k]];
+    }
+    const passivedouble alpha = rz / dot(p.data(), q.data());
+    for (auto i = 0ul; i < n; ++i) {
+      x[i] += alpha * p[i];
+      r[i] -= alpha * q[i];
+    }
+    if (sqrt(dot(r.data(), r.data())) < relTol * norm0) break;
+
+    precond(r, z);
+    const passivedouble rzNew = dot(r.data(), z.data());
+    const passivedouble beta = rzNew / rz;
+    rz = rzNew;
+    for (auto i = 0ul; i < n; ++i) p[i] = z[i] + beta * p[i];
+  }
+  return iter;
+}
+
 void CRadialBasisFunction::ComputeGeneratorMatrix(RADIAL_BASIS type, bool usePolynomial,
                            su2double radius, const su2activematrix& coords, int& nPolynomial,
                            vector<int>& keepPolynomialRow, su2passivematrix& C_inv_trunc) {
@@ -0,0 +1,561 @@
+/*!
+ * \file CAlgebraicMultigrid.cpp
+ * \brief Implementation of the aggregation-based algebraic multigrid.
+ * \author SU2 Contributors
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CAlgebraicMultigrid.hpp"
+#include "../../include/parallelization/omp_structure.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+
+#include <algorithm>
+
+template<class ScalarType>
+constexpr passivedouble CAlgebraicMultigrid<ScalarType>::MAX_COARSENING_RATIO;
+
+template<class ScalarType>
+constexpr passivedouble CAlgebraicMultigrid<ScalarType>::MAX_CORRECTION;
+
+template<class ScalarType>
+constexpr passivedouble CAlgebraicMultigrid<ScalarType>::MIN_CORRECTION;
+
+template<class ScalarType>
+constexpr unsigned long CAlgebraicMultigrid<ScalarType>::UNASSIGNED;
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SetMatrix(unsigned long nvar, unsigned long nPointDomain,
+                                                const unsigned long *rowptr, const unsigned long *colidx,
+                                                const unsigned long *diaptr, const ScalarType *values) {
+  SU2_OMP_MASTER
+  {
+    if (nvar > MAXNVAR)
+      SU2_MPI::Error("nVar larger than expected, increase MAXNVAR.", CURRENT_FUNCTION);
+
+    nVar = nvar;
+    if (levels.empty()) levels.resize(1);
+
+    auto& finest = levels[0];
+    finest.nBlk = nPointDomain;
+    finest.row_ptr = rowptr;
+    finest.col_ind = colidx;
+    finest.dia_ptr = diaptr;
+    finest.values = values;
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::InvertBlock(const ScalarType *block, ScalarType *inverse) const {
+
+  ScalarType aug[MAXNVAR*MAXNVAR];
+
+#define A(I,J) aug[(I)*nVar+(J)]
+#define M(I,J) inverse[(I)*nVar+(J)]
+
+  for (auto i = 0ul; i < nVar; ++i) {
+    for (auto j = 0ul; j < nVar; ++j) {
+      A(i,j) = block[i*nVar+j];
+      M(i,j) = ScalarType(i==j);
+    }
+  }
+
+  for (auto j = 0ul; j < nVar; ++j) {
+
+    /*--- Find the pivot in the current column and swap rows. ---*/
+    auto jj = j;
+    for (auto i = j+1; i < nVar; ++i)
+      if (fabs(A(i,j)) > fabs(A(jj,j))) jj = i;
+
+    if (jj != j) {
+      for (auto k = 0ul; k < nVar; ++k) {
+        std::swap(A(j,k), A(jj,k));
+        std::swap(M(j,k), M(jj,k));
+      }
+    }
+
+    /*--- Normalize the pivot row and eliminate the column from the other rows. ---*/
+    const ScalarType pivot = 1 / A(j,j);
+    for (auto k = 0ul; k < nVar; ++k) {
+      A(j,k) *= pivot;
+      M(j,k) *= pivot;
+    }
+
+    for (auto i = 0ul; i < nVar; ++i) {
+      if (i == j) continue;
+      const ScalarType factor = A(i,j);
+      for (auto k = 0ul; k < nVar; ++k) {
+        A(i,k) -= factor * A(j,k);
+        M(i,k) -= factor * M(j,k);
+      }
+    }
+  }
+#undef A
+#undef M
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::ComputeDiagonal(CLevel& level) {
+
+  SU2_OMP_MASTER
+  {
+    level.invDiag.resize(level.nBlk*nVar*nVar);
+    level.diagNorm.resize(level.nBlk);
+    level.work.resize(level.nBlk*nVar);
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  SU2_OMP_FOR_DYN(OMP_MAX_SIZE)
+  for (auto iPoint = 0ul; iPoint < level.nBlk; ++iPoint) {
+    const auto block = &level.values[level.dia_ptr[iPoint]*nVar*nVar];
+    InvertBlock(block, &level.invDiag[iPoint*nVar*nVar]);
+    level.diagNorm[iPoint] = BlockNorm2(block);
+  }
+  END_SU2_OMP_FOR
+}
+
+template<class ScalarType>
+unsigned long CAlgebraicMultigrid<ScalarType>::Aggregate(CLevel& fine) {
+
+  SU2_OMP_MASTER
+  {
+    fine.aggregate.assign(fine.nBlk, UNASSIGNED);
+    fine.aggPtr.clear();
+    partCount.assign(nParts+1, 0);
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  /*--- Each partition is aggregated independently, only connections to points of
+   *    the same partition are considered, the aggregate indices are local for now. ---*/
+
+  SU2_OMP_FOR_STAT(1)
+  for (auto iPart = 0ul; iPart < nParts; ++iPart) {
+    const auto begin = fine.partitions[iPart];
+    const auto end = fine.partitions[iPart+1];
+    auto& agg = fine.aggregate;
+    unsigned long count = 0;
+
+    auto inPart = [&](unsigned long jPoint) { return (jPoint >= begin) && (jPoint < end); };
+
+    /*--- Phase 1, points whose strong neighbors are all free form a new aggregate with them. ---*/
+
+    for (auto iPoint = begin; iPoint < end; ++iPoint) {
+      if (agg[iPoint] != UNASSIGNED) continue;
+
+      bool isFree = true, isolated = true;
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint+1] && isFree; ++k) {
+        const auto jPoint = fine.col_ind[k];
+        if (jPoint == iPoint || !inPart(jPoint) || !IsStrong(fine, k, iPoint, jPoint)) continue;
+        isolated = false;
+        isFree = (agg[jPoint] == UNASSIGNED);
+      }
+      if (!isFree || isolated) continue;
+
+      agg[iPoint] = count;
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint+1]; ++k) {
+        const auto jPoint = fine.col_ind[k];
+        if (inPart(jPoint) && IsStrong(fine, k, iPoint, jPoint)) agg[jPoint] = count;
+      }
+      ++count;
+    }
+
+    /*--- Phase 2, remaining points join the aggregate of their strongest neighbor,
+     *    the assignments are deferred to only extend the aggregates of phase 1. ---*/
+
+    vector<pair<unsigned long, unsigned long> > joins;
+
+    for (auto iPoint = begin; iPoint < end; ++iPoint) {
+      if (agg[iPoint] != UNASSIGNED) continue;
+
+      ScalarType maxNorm = 0.0;
+      auto target = UNASSIGNED;
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint+1]; ++k) {
+        const auto jPoint = fine.col_ind[k];
+        if (jPoint == iPoint || !inPart(jPoint) || agg[jPoint] == UNASSIGNED) continue;
+        if (!IsStrong(fine, k, iPoint, jPoint)) continue;
+        const auto norm = BlockNorm2(&fine.values[k*nVar*nVar]);
+        if (norm > maxNorm) {
+          maxNorm = norm;
+          target = agg[jPoint];
+        }
+      }
+      if (target != UNASSIGNED) joins.emplace_back(iPoint, target);
+    }
+    for (const auto& join : joins) agg[join.first] = join.second;
+
+    /*--- Phase 3, what is left forms aggregates with the free strong neighbors (or alone). ---*/
+
+    for (auto iPoint = begin; iPoint < end; ++iPoint) {
+      if (agg[iPoint] != UNASSIGNED) continue;
+
+      agg[iPoint] = count;
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint+1]; ++k) {
+        const auto jPoint = fine.col_ind[k];
+        if (inPart(jPoint) && agg[jPoint] == UNASSIGNED && IsStrong(fine, k, iPoint, jPoint))
+          agg[jPoint] = count;
+      }
+      ++count;
+    }
+    partCount[iPart+1] = count;
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_MASTER
+  {
+    for (auto iPart = 0ul; iPart < nParts; ++iPart) partCount[iPart+1] += partCount[iPart];
+    nCoarse = partCount[nParts];
+    fine.aggPtr.assign(nCoarse+1, 0);
+    fine.aggIdx.resize(fine.nBlk);
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  /*--- Make the indices global and count the points in each aggregate, the
+   *    aggregates of a partition are only accessed by the thread handling it. ---*/
+
+  SU2_OMP_FOR_STAT(1)
+  for (auto iPart = 0ul; iPart < nParts; ++iPart) {
+    for (auto iPoint = fine.partitions[iPart]; iPoint < fine.partitions[iPart+1]; ++iPoint) {
+      fine.aggregate[iPoint] += partCount[iPart];
+      ++fine.aggPtr[fine.aggregate[iPoint]+1];
+    }
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_MASTER
+  for (auto iAgg = 0ul; iAgg < nCoarse; ++iAgg) fine.aggPtr[iAgg+1] += fine.aggPtr[iAgg];
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  SU2_OMP_FOR_STAT(1)
+  for (auto iPart = 0ul; iPart < nParts; ++iPart) {
+    vector<unsigned long> cursor(fine.aggPtr.begin()+partCount[iPart], fine.aggPtr.begin()+partCount[iPart+1]);
+    for (auto iPoint = fine.partitions[iPart]; iPoint < fine.partitions[iPart+1]; ++iPoint) {
+      fine.aggIdx[cursor[fine.aggregate[iPoint]-partCount[iPart]]++] = iPoint;
+    }
+  }
+  END_SU2_OMP_FOR
+
+  return nCoarse;
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::GalerkinProduct(const CLevel& fine, CLevel& coarse) {
+
+  /*--- Gather the unique coarse columns of a coarse row. ---*/
+  auto coarseColumns = [&](unsigned long iAgg, vector<unsigned long>& cols) {
+    cols.clear();
+    for (auto m = fine.aggPtr[iAgg]; m < fine.aggPtr[iAgg+1]; ++m) {
+      const auto iPoint = fine.aggIdx[m];
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint+1]; ++k) {
+        const auto jPoint = fine.col_ind[k];
+        if (jPoint < fine.nBlk) cols.push_back(fine.aggregate[jPoint]);
+      }
+    }
+    sort(cols.begin(), cols.end());
+    cols.erase(unique(cols.begin(), cols.end()), cols.end());
+  };
+
+  SU2_OMP_MASTER
+  {
+    coarse.nBlk = nCoarse;
+    coarse.rowPtr.assign(nCoarse+1, 0);
+    coarse.diaPtr.resize(nCoarse);
+    coarse.partitions = partCount;
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  /*--- Symbolic product, count the non zeros of each row. ---*/
+
+  vector<unsigned long> cols; // thread-local working memory
+
+  SU2_OMP_FOR_DYN(OMP_MAX_SIZE)
+  for (auto iAgg = 0ul; iAgg < nCoarse; ++iAgg) {
+    coarseColumns(iAgg, cols);
+    coarse.rowPtr[iAgg+1] = cols.size();
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_MASTER
+  {
+    for (auto iAgg = 0ul; iAgg < nCoarse; ++iAgg) coarse.rowPtr[iAgg+1] += coarse.rowPtr[iAgg];
+    const auto nnz = coarse.rowPtr[nCoarse];
+    coarse.colInd.resize(nnz);
+    coarse.matrix.assign(nnz*nVar*nVar, ScalarType(0));
+
+    coarse.row_ptr = coarse.rowPtr.data();
+    coarse.col_ind = coarse.colInd.data();
+    coarse.dia_ptr = coarse.diaPtr.data();
+    coarse.values = coarse.matrix.data();
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  /*--- Numeric product, A_IJ is the sum of the A_ij with i in I and j in J. ---*/
+
+
+  SU2_OMP_FOR_DYN(OMP_MAX_SIZE)
+  for (auto iAgg = 0ul; iAgg < nCoarse; ++iAgg) {
+    coarseColumns(iAgg, cols);
+
+    const auto offset = coarse.rowPtr[iAgg];
+    copy(cols.begin(), cols.end(), &coarse.colInd[offset]);
+    coarse.diaPtr[iAgg] = offset + (lower_bound(cols.begin(), cols.end(), iAgg) - cols.begin());
+
+    for (auto m = fine.aggPtr[iAgg]; m < fine.aggPtr[iAgg+1]; ++m) {
+      const auto iPoint = fine.aggIdx[m];
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint+1]; ++k) {
+        const auto jPoint = fine.col_ind[k];
+        if (jPoint >= fine.nBlk) continue;
+        const auto pos = offset + (lower_bound(cols.begin(), cols.end(), fine.aggregate[jPoint]) - cols.begin());
+        const auto src = &fine.values[k*nVar*nVar];
+        auto dst = &coarse.matrix[pos*nVar*nVar];
+        SU2_OMP_SIMD
+        for (auto i = 0ul; i < nVar*nVar; ++i) dst[i] += src[i];
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Build(passivedouble strength, unsigned short maxLevels, unsigned short sweeps) {
+
+  SU2_OMP_MASTER
+  {
+    if (levels.empty())
+      SU2_MPI::Error("The matrix must be set before building the hierarchy.", CURRENT_FUNCTION);
+
+    nSweeps = max<unsigned short>(sweeps, 1);
+    strength2 = pow(strength, 4);
+    nParts = omp_get_num_threads();
+    levels.resize(1);
+    levels.reserve(max<unsigned short>(maxLevels, 1));
+
+    /*--- Partitions of the finest level balance the number of non zeros. ---*/
+    auto& finest = levels[0];
+    finest.partitions.assign(nParts+1, finest.nBlk);
+    const auto nnzPerPart = roundUpDiv(finest.row_ptr[finest.nBlk], nParts);
+    for (auto iPoint = 0ul, iPart = 0ul; iPoint < finest.nBlk && iPart < nParts; ++iPoint) {
+      if (finest.row_ptr[iPoint] >= iPart*nnzPerPart) finest.partitions[iPart++] = iPoint;
+    }
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  for (auto iLevel = 0ul; ; ++iLevel) {
+    auto& fine = levels[iLevel];
+
+    ComputeDiagonal(fine);
+
+    if (iLevel+1 >= maxLevels || fine.nBlk < MIN_POINTS_PER_PART*nParts) break;
+
+    Aggregate(fine);
+
+    /*--- Stop if aggregation stagnates, the last level then becomes the coarsest. ---*/
+    if (nCoarse == 0 || nCoarse > MAX_COARSENING_RATIO*fine.nBlk) break;
+
+    SU2_OMP_MASTER
+    {
+      levels.emplace_back();
+      levels.back().sol.resize(nCoarse*nVar);
+      levels.back().rhs.resize(nCoarse*nVar);
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    GalerkinProduct(levels[iLevel], levels[iLevel+1]);
+  }
+  SU2_OMP_BARRIER
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Smooth(CLevel& level, const ScalarType *rhs, ScalarType *sol,
+                                             bool forward, unsigned short sweeps) const {
+
+  const auto n = level.nBlk;
+  auto solOld = level.work.data();
+
+  for (auto iSweep = 0ul; iSweep < sweeps; ++iSweep) {
+
+    /*--- Couplings across partitions use the values from the previous sweep. ---*/
+    parallelCopy(n*nVar, sol, solOld);
+
+    SU2_OMP_FOR_STAT(1)
+    for (auto iPart = 0ul; iPart < nParts; ++iPart) {
+      const auto begin = level.partitions[iPart];
+      const auto end = level.partitions[iPart+1];
+
+      for (auto i = begin; i < end; ++i) {
+        const auto iPoint = forward? i : end-1-(i-begin);
+
+        ScalarType res[MAXNVAR];
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) res[iVar] = rhs[iPoint*nVar+iVar];
+
+        for (auto k = level.row_ptr[iPoint]; k < level.row_ptr[iPoint+1]; ++k) {
+          const auto jPoint = level.col_ind[k];
+          if (jPoint == iPoint || jPoint >= n) continue;
+          const auto x = (jPoint >= begin && jPoint < end)? &sol[jPoint*nVar] : &solOld[jPoint*nVar];
+          const auto blk = &level.values[k*nVar*nVar];
+          for (auto iVar = 0ul; iVar < nVar; ++iVar)
+            for (auto jVar = 0ul; jVar < nVar; ++jVar)
+              res[iVar] -= blk[iVar*nVar+jVar] * x[jVar];
+        }
+
+        const auto invD = &level.invDiag[iPoint*nVar*nVar];
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+          ScalarType val = 0.0;
+          for (auto jVar = 0ul; jVar < nVar; ++jVar) val += invD[iVar*nVar+jVar] * res[jVar];
+          sol[iPoint*nVar+iVar] = val;
+        }
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
+template<class ScalarType>
+ScalarType CAlgebraicMultigrid<ScalarType>::CorrectionScale(CLevel& coarse) {
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  {
+    dotNum = 0.0;
+    dotDen = 0.0;
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  /*--- Local (thread) contributions to (e, r) and (e, A e). ---*/
+  ScalarType num = 0.0, den = 0.0;
+
+  SU2_OMP_FOR_(schedule(static,OMP_MAX_SIZE) SU2_NOWAIT)
+  for (auto iPoint = 0ul; iPoint < coarse.nBlk; ++iPoint) {
+    const auto e = &coarse.sol[iPoint*nVar];
+
+    ScalarType prod[MAXNVAR] = {0.0};
+    for (auto k = coarse.row_ptr[iPoint]; k < coarse.row_ptr[iPoint+1]; ++k) {
+      const auto ej = &coarse.sol[coarse.col_ind[k]*nVar];
+      const auto blk = &coarse.values[k*nVar*nVar];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          prod[iVar] += blk[iVar*nVar+jVar] * ej[jVar];
+    }
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      num += e[iVar] * coarse.rhs[iPoint*nVar+iVar];
+      den += e[iVar] * prod[iVar];
+    }
+  }
+  END_SU2_OMP_FOR
+
+  atomicAdd(num, dotNum);
+  atomicAdd(den, dotDen);
+  SU2_OMP_BARRIER
+
+  /*--- Non-positive energy is only possible for indefinite matrices, do not scale then. ---*/
+  if (dotDen <= 0.0) return 1.0;
+  return max(ScalarType(MIN_CORRECTION), min(dotNum/dotDen, ScalarType(MAX_CORRECTION)));
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Cycle(unsigned long iLevel, const ScalarType *rhs, ScalarType *sol) {
+
+  auto& level = levels[iLevel];
+  const auto n = level.nBlk;
+
+  parallelSet(n*nVar, ScalarType(0), sol);
+
+  if (iLevel+1 == levels.size()) {
+    for (auto iSweep = 0ul; iSweep < COARSEST_SWEEPS; ++iSweep) {
+      Smooth(level, rhs, sol, true, 1);
+      Smooth(level, rhs, sol, false, 1);
+    }
+    return;
+  }
+  auto& coarse = levels[iLevel+1];
+
+  /*--- Pre-smoothing. ---*/
+  Smooth(level, rhs, sol, true, nSweeps);
+
+  /*--- Residual. ---*/
+  auto res = level.work.data();
+
+  SU2_OMP_FOR_DYN(OMP_MAX_SIZE)
+  for (auto iPoint = 0ul; iPoint < n; ++iPoint) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) res[iPoint*nVar+iVar] = rhs[iPoint*nVar+iVar];
+
+    for (auto k = level.row_ptr[iPoint]; k < level.row_ptr[iPoint+1]; ++k) {
+      const auto jPoint = level.col_ind[k];
+      if (jPoint >= n) continue;
+      const auto blk = &level.values[k*nVar*nVar];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          res[iPoint*nVar+iVar] -= blk[iVar*nVar+jVar] * sol[jPoint*nVar+jVar];
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Restriction, sum of the residuals of the points in each aggregate. ---*/
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto iAgg = 0ul; iAgg < coarse.nBlk; ++iAgg) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) coarse.rhs[iAgg*nVar+iVar] = 0.0;
+
+    for (auto m = level.aggPtr[iAgg]; m < level.aggPtr[iAgg+1]; ++m) {
+      const auto iPoint = level.aggIdx[m];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) coarse.rhs[iAgg*nVar+iVar] += res[iPoint*nVar+iVar];
+    }
+  }
+  END_SU2_OMP_FOR
+
+  Cycle(iLevel+1, coarse.rhs.data(), coarse.sol.data());
+
+  const auto scale = CorrectionScale(coarse);
+
+  /*--- Prolongation of the scaled coarse correction. ---*/
+
+  SU2_OMP_FOR_STAT(OMP_MAX_SIZE)
+  for (auto iPoint = 0ul; iPoint < n; ++iPoint) {
+    const auto iAgg = level.aggregate[iPoint];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) sol[iPoint*nVar+iVar] += scale * coarse.sol[iAgg*nVar+iVar];
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Post-smoothing. ---*/
+  Smooth(level, rhs, sol, false, nSweeps);
+}
+
+/*--- Explicit instantiations ---*/
+
+#ifdef CODI_FORWARD_TYPE
+template class CAlgebraicMultigrid<su2double>;
+#else
+template class CAlgebraicMultigrid<su2mixedfloat>;
+#ifdef USE_MIXED_PRECISION
+template class CAlgebraicMultigrid<passivedouble>;
+#endif
+#endif
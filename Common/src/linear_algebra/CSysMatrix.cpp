@@ -1381,6 +1381,28 @@ void CSysMatrix<ScalarType>::MatrixMatrixAddition(ScalarType alpha, const CSysMa
 
 }
 
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner(const CConfig *config) {
+
+  /*--- The hierarchy is rebuilt every time as the aggregates depend on the values. ---*/
+  amg_hierarchy.SetMatrix(nVar, nPointDomain, row_ptr, col_ind, dia_ptr, matrix);
+  amg_hierarchy.Build(SU2_TYPE::GetValue(config->GetLinear_Solver_AMG_Strength()),
+                      config->GetLinear_Solver_AMG_Levels(), config->GetLinear_Solver_AMG_Sweeps());
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                      CGeometry *geometry, const CConfig *config) const {
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  amg_hierarchy.Solve(&vec[0], &prod[0]);
+
+  /*--- MPI Parallelization ---*/
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+}
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::BuildPastixPreconditioner(CGeometry *geometry, const CConfig *config,
                                                        unsigned short kind_fact) {
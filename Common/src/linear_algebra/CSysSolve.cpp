@@ -166,6 +166,60 @@ void CSysSolve<ScalarType>::ModGramSchmidt(int i, su2matrix<ScalarType>& Hsbg,
 
 }
 
+template<class ScalarType>
+void CSysSolve<ScalarType>::ClassicalGramSchmidt2(int i, su2matrix<ScalarType>& Hsbg,
+                                                  vector<CSysVector<ScalarType> >& w) const {
+
+  /*--- Projections of w[i+1] onto w[0:i], the last entry is the squared norm of w[i+1].
+   Each thread has its own copy, the results of multiDot are the same for all threads. ---*/
+
+  const int n = i+1;
+  su2vector<ScalarType> proj(n+1);
+
+  /*--- First pass, the norm is only used to check for divergence. ---*/
+
+  w[i+1].multiDot(w, n+1, proj.data());
+
+  ScalarType nrm = proj[n];
+
+  /*--- The norm of w[i+1] < 0.0 or w[i+1] = NaN ---*/
+
+  if ((nrm <= 0.0) || (nrm != nrm)) {
+    /*--- nrm is the result of a dot product, communications are implicitly handled. ---*/
+    SU2_MPI::Error("FGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+  }
+
+  for (int k = 0; k < n; k++) {
+    Hsbg(k,i) = proj[k];
+    w[i+1] -= proj[k] * w[k];
+  }
+
+  /*--- Second pass (reorthogonalization), the squared norm of w[i+1] after this pass
+   is the squared norm before it minus the squared norm of the projections. ---*/
+
+  w[i+1].multiDot(w, n+1, proj.data());
+
+  nrm = proj[n];
+
+  for (int k = 0; k < n; k++) {
+    Hsbg(k,i) += proj[k];
+    w[i+1] -= proj[k] * w[k];
+    nrm -= pow(proj[k],2);
+  }
+
+  /*--- If the vector is almost in the span of the basis the norm needs to be recomputed. ---*/
+
+  if (nrm > 1e-6 * proj[n]) nrm = sqrt(nrm);
+  else nrm = w[i+1].norm();
+
+  Hsbg(i+1,i) = nrm;
+
+  /*--- Scale the resulting vector ---*/
+
+  w[i+1] /= nrm;
+
+}
+
 template<class ScalarType>
 void CSysSolve<ScalarType>::WriteHeader(string solver, ScalarType restol, ScalarType resinit) const {
 
@@ -196,6 +250,63 @@ void CSysSolve<ScalarType>::WriteWarning(ScalarType res_calc, ScalarType res_tru
   cout << "# true_res - calc_res = " << res_true - res_calc << endl;
 }
 
+template<class ScalarType>
+void CSysSolve<ScalarType>::NonBlockingReductionBegin(const ScalarType* partial, int n) const {
+
+  /*--- Accumulate the partial results of all threads, redSend is
+   *    zeroed in NonBlockingReductionEnd after the communication. ---*/
+
+  SU2_OMP_CRITICAL
+  for (int k = 0; k < n; ++k) redSend[k] += partial[k];
+  END_SU2_OMP_CRITICAL
+  SU2_OMP_BARRIER
+
+  /*--- Only the master thread communicates, the other threads carry on with their work. ---*/
+
+  SU2_OMP_MASTER {
+#ifdef HAVE_MPI
+    const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+    SelectMPIWrapper<ScalarType>::W::Iallreduce(redSend, redRecv, n, mpi_type, MPI_SUM,
+                                                SU2_MPI::GetComm(), &redRequest);
+#else
+    for (int k = 0; k < n; ++k) redRecv[k] = redSend[k];
+#endif
+  }
+  END_SU2_OMP_MASTER
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::NonBlockingReductionEnd(ScalarType* result, int n) const {
+
+  SU2_OMP_MASTER {
+#ifdef HAVE_MPI
+    typename SelectMPIWrapper<ScalarType>::W::Status status;
+    SelectMPIWrapper<ScalarType>::W::Wait(&redRequest, &status);
+#endif
+    for (int k = 0; k < n; ++k) redSend[k] = 0.0;
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  /*--- redRecv is only modified again after the barrier in the next NonBlockingReductionBegin. ---*/
+
+  for (int k = 0; k < n; ++k) result[k] = redRecv[k];
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::AllocatePipelinedVectors(const VectorType& b, size_t n) const {
+
+  if (PV.size() >= n) return;
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+    PV.resize(n);
+    for (auto& vec : PV) vec.Initialize(b.GetNBlk(), b.GetNBlkDomain(), b.GetNVar(), nullptr);
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                   const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
@@ -338,6 +449,152 @@ unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType> &
 
 }
 
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::PCG_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                   const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                   ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, const CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+  const bool full_comm = (config->GetComm_Level() == COMM_FULL);
+  ScalarType norm_r = 0.0, norm0 = 0.0;
+  unsigned long i = 0;
+
+  /*--- Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, the names follow the paper, "u" is the
+   *    preconditioned residual, "w = A u", "m = M w", "n = A m", and "z", "q", "s"
+   *    are the recurrences for "A M A p", "M A p", and "A p" respectively. ---*/
+
+  AllocatePipelinedVectors(b, 9);
+
+  auto& r_ = PV[0]; auto& u = PV[1]; auto& w = PV[2];
+  auto& m_ = PV[3]; auto& n_ = PV[4]; auto& z_ = PV[5];
+  auto& q = PV[6];  auto& s = PV[7];  auto& p_ = PV[8];
+
+  /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
+
+  if (!xIsZero) {
+    mat_vec(x, r_);
+    r_ = b - r_;
+  } else {
+    r_ = b;
+  }
+
+  if (full_comm) {
+
+    norm_r = r_.norm();
+    norm0  = b.norm();
+
+    /*--- Set the norm to the initial initial residual value ---*/
+
+    if (tol_type == LinearToleranceType::RELATIVE) norm0 = norm_r;
+
+    if ((norm_r < tol*norm0) || (norm_r < eps)) {
+      if (master && !mesh_deform) cout << "CSysSolve::PipelinedConjugateGradient(): system solved by initial guess." << endl;
+      return 0;
+    }
+
+    /*--- Output header information including initial residual ---*/
+
+    if (monitoring && master) {
+      WriteHeader("Pipelined CG", tol, norm_r);
+      WriteHistory(i, norm_r/norm0);
+    }
+
+  }
+
+  precond(r_, u);
+  mat_vec(u, w);
+
+  /*--- The recurrences start from 0 (beta is 0 in the first iteration). ---*/
+
+  z_ = ScalarType(0.0); q = ScalarType(0.0);
+  s = ScalarType(0.0);  p_ = ScalarType(0.0);
+
+  ScalarType alpha = 0.0, gamma_old = 0.0;
+
+  /*---  Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+
+    /*--- Start the reduction of gamma = (r,u), delta = (w,u), and (r,r) for monitoring. ---*/
+
+    ScalarType dots[3] = {r_.localDot(u), w.localDot(u), full_comm? r_.localDot(r_) : ScalarType(0.0)};
+    NonBlockingReductionBegin(dots, 3);
+
+    /*--- Overlap with the preconditioner and matrix-vector product. ---*/
+
+    precond(w, m_);
+    mat_vec(m_, n_);
+
+    NonBlockingReductionEnd(dots, 3);
+
+    const ScalarType gamma = dots[0], delta = dots[1];
+
+    /*--- The residual norm lags one iteration behind the other reductions, r is still consistent with x. ---*/
+
+    if (full_comm && i > 0) {
+      norm_r = sqrt(dots[2]);
+      if (norm_r < tol*norm0) break;
+      if (monitoring && master && (i % monitorFreq == 0))
+        WriteHistory(i, norm_r/norm0);
+    }
+
+    /*--- Step length and Gram-Schmidt coefficient. ---*/
+
+    ScalarType beta = 0.0;
+    if (i > 0) {
+      beta = gamma / gamma_old;
+      alpha = gamma / (delta - beta * gamma / alpha);
+    } else {
+      alpha = gamma / delta;
+    }
+    gamma_old = gamma;
+
+    /*--- Update the recurrences, the solution, and the residual. ---*/
+
+    z_ = n_ + beta * z_;
+    q = m_ + beta * q;
+    s = w + beta * s;
+    p_ = u + beta * p_;
+
+    x += alpha * p_;
+    r_ -= alpha * s;
+    u -= alpha * q;
+    w -= alpha * z_;
+
+  }
+
+  /*--- The loop ran to completion, update the residual norm. ---*/
+
+  if (full_comm && i == m) norm_r = r_.norm();
+
+  /*--- Recalculate final residual (this should be optional) ---*/
+
+  if (monitoring && full_comm) {
+
+    if (master) WriteFinalResidual("Pipelined CG", i, norm_r/norm0);
+
+    if (recomputeRes) {
+      mat_vec(x, r_);
+      r_ = b - r_;
+      ScalarType true_res = r_.norm();
+
+      if ((fabs(true_res - norm_r) > tol*10.0) && master) {
+        WriteWarning(norm_r, true_res, tol);
+      }
+    }
+  }
+
+  residual = norm_r/norm0;
+  return i;
+
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                       const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
@@ -451,9 +708,10 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
       mat_vec(W[i], W[i+1]);
     }
 
-    /*---  Modified Gram-Schmidt orthogonalization ---*/
+    /*---  Modified Gram-Schmidt orthogonalization, or its low-synchronization alternative ---*/
 
-    ModGramSchmidt(i, H, W);
+    if (lowSyncOrtho) ClassicalGramSchmidt2(i, H, W);
+    else ModGramSchmidt(i, H, W);
 
     /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
      new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
@@ -695,6 +953,180 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
   return i;
 }
 
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::PBCGSTAB_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                        const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                        ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, const CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+  const bool full_comm = (config->GetComm_Level() == COMM_FULL);
+  ScalarType norm_r = 0.0, norm0 = 0.0;
+  unsigned long i = 0;
+
+  /*--- Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet. The names follow the paper, the "h" suffix
+   *    denotes preconditioned vectors (right preconditioning), "w = A rh", "t = A wh",
+   *    "v = A zh", "s" and "z" are the recurrences for "A ph" and "A sh". "q" and "y"
+   *    are stored in "r" and "w" since they are only needed to update them. ---*/
+
+  AllocatePipelinedVectors(b, 12);
+
+  auto& r_ = PV[0]; auto& rh = PV[1]; auto& w = PV[2];  auto& wh = PV[3];
+  auto& t = PV[4];  auto& ph = PV[5]; auto& s = PV[6];  auto& sh = PV[7];
+  auto& z_ = PV[8]; auto& zh = PV[9]; auto& v_ = PV[10]; auto& r0 = PV[11];
+
+  /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
+
+  if (!xIsZero) {
+    mat_vec(x, r_);
+    r_ = b - r_;
+  } else {
+    r_ = b;
+  }
+
+  if (full_comm) {
+
+    norm_r = r_.norm();
+    norm0  = b.norm();
+
+    /*--- Set the norm to the initial initial residual value ---*/
+
+    if (tol_type == LinearToleranceType::RELATIVE) norm0 = norm_r;
+
+    if ((norm_r < tol*norm0) || (norm_r < eps)) {
+      if (master && !mesh_deform) cout << "CSysSolve::PipelinedBCGSTAB(): system solved by initial guess." << endl;
+      return 0;
+    }
+
+    /*--- Output header information including initial residual ---*/
+
+    if (monitoring && master) {
+      WriteHeader("Pipelined BCGSTAB", tol, norm_r);
+      WriteHistory(i, norm_r/norm0);
+    }
+
+  }
+
+  /*--- Initialization, the first step length also overlaps its reduction. ---*/
+
+  r0 = r_;
+  precond(r_, rh);
+  mat_vec(rh, w);
+
+  ScalarType dots[5] = {r0.localDot(r_), r0.localDot(w)};
+  NonBlockingReductionBegin(dots, 2);
+
+  precond(w, wh);
+  mat_vec(wh, t);
+
+  NonBlockingReductionEnd(dots, 2);
+
+  ScalarType rho = dots[0], alpha = rho / dots[1], beta = 0.0, omega = 1.0;
+
+  ph = ScalarType(0.0); s = ScalarType(0.0); sh = ScalarType(0.0);
+  z_ = ScalarType(0.0); zh = ScalarType(0.0); v_ = ScalarType(0.0);
+
+  /*--- Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+
+    /*--- Update the search direction and the auxiliary recurrences. ---*/
+
+    ph = rh + beta * (ph - omega*sh);
+    s = w + beta * (s - omega*z_);
+    sh = wh + beta * (sh - omega*zh);
+    z_ = t + beta * (z_ - omega*v_);
+
+    /*--- q = r - alpha*s, qh = rh - alpha*sh, y = w - alpha*z. ---*/
+
+    r_ -= alpha * s;
+    rh -= alpha * sh;
+    w -= alpha * z_;
+
+    /*--- Start the reduction of (q,y) and (y,y), overlap with the preconditioner and product. ---*/
+
+    dots[0] = r_.localDot(w);
+    dots[1] = w.localDot(w);
+    NonBlockingReductionBegin(dots, 2);
+
+    precond(z_, zh);
+    mat_vec(zh, v_);
+
+    NonBlockingReductionEnd(dots, 2);
+
+    /*--- Calculate step-length omega, avoid division by 0, "r" is consistent with the half step. ---*/
+
+    if (dots[1] == ScalarType(0)) {
+      x += alpha * ph;
+      break;
+    }
+    omega = dots[0] / dots[1];
+
+    /*--- Update solution and residuals. ---*/
+
+    x += alpha*ph + omega*rh;
+    r_ -= omega * w;
+    rh -= omega * (wh - alpha*zh);
+    w -= omega * (t - alpha*v_);
+
+    /*--- Start the reduction of the coefficients for the next iteration and of the
+     *    residual norm, overlap with the preconditioner and product. ---*/
+
+    dots[0] = r0.localDot(r_);
+    dots[1] = r0.localDot(w);
+    dots[2] = r0.localDot(s);
+    dots[3] = r0.localDot(z_);
+    dots[4] = full_comm? r_.localDot(r_) : ScalarType(0.0);
+    NonBlockingReductionBegin(dots, 5);
+
+    precond(w, wh);
+    mat_vec(wh, t);
+
+    NonBlockingReductionEnd(dots, 5);
+
+    /*--- Check if solution has converged, else output the relative residual if necessary ---*/
+
+    if (full_comm) {
+      norm_r = sqrt(dots[4]);
+      if (norm_r < tol*norm0) break;
+      if (monitoring && master && ((i+1) % monitorFreq == 0))
+        WriteHistory(i+1, norm_r/norm0);
+    }
+
+    /*--- Compute beta and the next step-length alpha. ---*/
+
+    beta = (alpha / omega) * (dots[0] / rho);
+    rho = dots[0];
+    alpha = rho / (dots[1] + beta * (dots[2] - omega * dots[3]));
+
+  }
+
+  /*--- Recalculate final residual (this should be optional) ---*/
+
+  if (monitoring && full_comm) {
+
+    if (master) WriteFinalResidual("Pipelined BCGSTAB", i, norm_r/norm0);
+
+    if (recomputeRes) {
+      mat_vec(x, r_);
+      r_ = b - r_;
+      ScalarType true_res = r_.norm();
+
+      if ((fabs(true_res - norm_r) > tol*10.0) && master) {
+        WriteWarning(norm_r, true_res, tol);
+      }
+    }
+  }
+
+  residual = norm_r/norm0;
+  return i;
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                         const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
@@ -891,11 +1323,18 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
   unsigned long IterLinSol = 0;
   ScalarType residual = 0.0;
 
+  /*--- The low-synchronization variant only changes the orthogonalization of FGMRES. ---*/
+
+  SU2_OMP_MASTER
+  lowSyncOrtho = (KindSolver == LOW_SYNC_FGMRES);
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
   switch (KindSolver) {
     case BCGSTAB:
       IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
-    case FGMRES:
+    case FGMRES: case LOW_SYNC_FGMRES:
       IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
     case RESTARTED_FGMRES:
@@ -904,6 +1343,12 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
     case CONJUGATE_GRADIENT:
       IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
+    case PIPELINED_CG:
+      IterLinSol = PCG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      break;
+    case PIPELINED_BCGSTAB:
+      IterLinSol = PBCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      break;
     case SMOOTHER:
       IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
@@ -948,6 +1393,9 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
       case LINELET:
         if (RequiresTranspose) Jacobian.BuildJacobiPreconditioner();
         break;
+      case AMG:
+        if (RequiresTranspose) Jacobian.BuildAMGPreconditioner(config);
+        break;
       case LU_SGS:
         /*--- Nothing to build. ---*/
         break;
@@ -1038,8 +1486,13 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
 
   HandleTemporariesIn(LinSysRes, LinSysSol);
 
+  SU2_OMP_MASTER
+  lowSyncOrtho = (KindSolver == LOW_SYNC_FGMRES);
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
   switch(KindSolver) {
-    case FGMRES:
+    case FGMRES: case LOW_SYNC_FGMRES:
       IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, Residual, ScreenOutput, config);
       break;
     case RESTARTED_FGMRES:
@@ -1051,6 +1504,12 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
     case CONJUGATE_GRADIENT:
       IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
       break;
+    case PIPELINED_CG:
+      IterLinSol = PCG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
+      break;
+    case PIPELINED_BCGSTAB:
+      IterLinSol = PBCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
+      break;
     case SMOOTHER:
       IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
       break;
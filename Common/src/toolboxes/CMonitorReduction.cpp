@@ -0,0 +1,221 @@
+/*!
+ * \file CMonitorReduction.cpp
+ * \brief Aggregation of the small reductions of monitored quantities (residuals, forces, etc.).
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CMonitorReduction.hpp"
+
+#include <algorithm>
+
+/*--- Records are encoded as [operation, number of values, payload size, values (with payloads)],
+ * the first entry of the buffer is its size. ---*/
+
+enum : size_t {RECORD_HEADER = 3};
+
+#ifdef HAVE_MPI
+namespace {
+void CombineRecordsMPI(void* in, void* inout, int* len, MPI_Datatype*) {
+  auto src = static_cast<const passivedouble*>(in);
+  auto dst = static_cast<passivedouble*>(inout);
+  const auto size = static_cast<size_t>(src[0]);
+
+  for (int i = 0; i < *len; ++i) {
+    CMonitorReduction::CombineRecords(src + i*size, dst + i*size);
+  }
+}
+}
+#endif
+
+CMonitorReduction& CMonitorReduction::GetInstance() {
+  static CMonitorReduction reduction;
+  return reduction;
+}
+
+void CMonitorReduction::CombineRecords(const passivedouble* in, passivedouble* inout) {
+
+  const auto size = static_cast<size_t>(in[0]);
+
+  for (size_t pos = 1; pos < size; ) {
+    const auto op = static_cast<OP>(static_cast<int>(in[pos]));
+    const auto n = static_cast<size_t>(in[pos+1]);
+    const auto payloadSize = static_cast<size_t>(in[pos+2]);
+    const auto stride = 1 + payloadSize;
+    pos += RECORD_HEADER;
+
+    for (size_t k = 0; k < n; ++k, pos += stride) {
+      switch (op) {
+        case OP::SUM: inout[pos] += in[pos]; break;
+        case OP::MIN: inout[pos] = std::min(inout[pos], in[pos]); break;
+        case OP::MAX: inout[pos] = std::max(inout[pos], in[pos]); break;
+        case OP::MAXLOC: {
+          const bool tie = (in[pos] == inout[pos]) && (payloadSize > 0) && (in[pos+1] < inout[pos+1]);
+          if (in[pos] > inout[pos] || tie) std::copy(in + pos, in + pos + stride, inout + pos);
+          break;
+        }
+      }
+    }
+  }
+}
+
+void CMonitorReduction::AddRecord(OP op, passivedouble* values, passivedouble* payload, size_t n, size_t payloadSize) {
+
+  if (inFlight) Complete();
+  if (n == 0) return;
+
+  if (sendBuf.empty()) sendBuf.push_back(1);
+
+  sendBuf.push_back(static_cast<int>(op));
+  sendBuf.push_back(n);
+  sendBuf.push_back(payloadSize);
+
+  targets.push_back({values, payload, n, payloadSize, sendBuf.size()});
+
+  for (size_t k = 0; k < n; ++k) {
+    sendBuf.push_back(values[k]);
+    for (size_t j = 0; j < payloadSize; ++j) sendBuf.push_back(payload[k*payloadSize + j]);
+  }
+  sendBuf[0] = sendBuf.size();
+}
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+void CMonitorReduction::Sum(su2double* values, size_t n) {
+
+  if (inFlight) Complete();
+  if (n == 0) return;
+
+  activeSend.insert(activeSend.end(), values, values + n);
+  activeTargets.emplace_back(values, n);
+}
+#endif
+
+void CMonitorReduction::Start() {
+
+  if (inFlight) Complete();
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  if (!activeSend.empty()) {
+    activeRecv.resize(activeSend.size());
+    SU2_MPI::Allreduce(activeSend.data(), activeRecv.data(), activeSend.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  }
+#endif
+
+  inFlight = true;
+  if (sendBuf.empty()) return;
+
+#ifdef HAVE_MPI
+  recvBuf.resize(sendBuf.size());
+
+  /*--- The same quantities are monitored every iteration, so only a few buffer sizes occur. ---*/
+
+  if (recordOp == MPI_OP_NULL) MPI_Op_create(&CombineRecordsMPI, 1, &recordOp);
+
+  auto it = recordTypes.find(sendBuf.size());
+  if (it == recordTypes.end()) {
+    MPI_Datatype recordType;
+    MPI_Type_contiguous(sendBuf.size(), MPI_DOUBLE, &recordType);
+    MPI_Type_commit(&recordType);
+    it = recordTypes.emplace(sendBuf.size(), recordType).first;
+  }
+  MPI_Iallreduce(sendBuf.data(), recvBuf.data(), 1, it->second, recordOp, SU2_MPI::GetComm(), &request);
+#else
+  recvBuf = sendBuf;
+#endif
+}
+
+void CMonitorReduction::Complete() {
+
+  if (inFlight) {
+    inFlight = false;
+
+    if (!sendBuf.empty()) {
+#ifdef HAVE_MPI
+      MPI_Wait(&request, MPI_STATUS_IGNORE);
+#endif
+      for (const auto& t : targets) {
+        const auto stride = 1 + t.payloadSize;
+        for (size_t k = 0; k < t.n; ++k) {
+          const auto pos = t.offset + k*stride;
+          t.values[k] = recvBuf[pos];
+          for (size_t j = 0; j < t.payloadSize; ++j) t.payload[k*t.payloadSize + j] = recvBuf[pos+1+j];
+        }
+      }
+    }
+    sendBuf.clear();
+    targets.clear();
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+    size_t offset = 0;
+    for (const auto& t : activeTargets) {
+      for (size_t k = 0; k < t.second; ++k) t.first[k] = activeRecv[offset + k];
+      offset += t.second;
+    }
+    activeSend.clear();
+    activeTargets.clear();
+#endif
+  }
+
+  /*--- The finalization functions may register new quantities. ---*/
+
+  auto functions = std::move(finalizers);
+  finalizers.clear();
+  for (auto& f : functions) f();
+}
+
+void CMonitorReduction::Reduce(std::function<void()> finalize) {
+
+  if (batchOpen) {
+    if (finalize) finalizers.push_back(std::move(finalize));
+    return;
+  }
+  ReduceNow();
+  if (finalize) finalize();
+}
+
+void CMonitorReduction::ReduceNow() {
+  Start();
+  Complete();
+}
+
+void CMonitorReduction::Begin() {
+  if (inFlight) Complete();
+  batchOpen = true;
+}
+
+void CMonitorReduction::End(bool wait) {
+  batchOpen = false;
+  Start();
+  if (wait) Complete();
+}
+
+void CMonitorReduction::Clear() {
+
+  Complete();
+
+#ifdef HAVE_MPI
+  for (auto& type : recordTypes) MPI_Type_free(&type.second);
+  recordTypes.clear();
+  if (recordOp != MPI_OP_NULL) MPI_Op_free(&recordOp);
+#endif
+}
@@ -0,0 +1,342 @@
+/*!
+ * \file compression_toolbox.cpp
+ * \brief Lightweight compression of floating point data (e.g. solution checkpoints).
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/compression_toolbox.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+#include "../../include/option_structure.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace CompressionToolbox {
+
+namespace {
+
+static_assert(sizeof(passivedouble) == sizeof(uint64_t), "Compression assumes 8 byte floating point numbers.");
+
+enum : size_t {NBYTES = sizeof(uint64_t)};
+
+inline uint64_t ToBits(passivedouble x) {
+  uint64_t bits;
+  memcpy(&bits, &x, NBYTES);
+  return bits;
+}
+
+inline passivedouble FromBits(uint64_t bits) {
+  passivedouble x;
+  memcpy(&x, &bits, NBYTES);
+  return x;
+}
+
+}
+
+void CompressLossless(const passivedouble* data, size_t n, size_t stride, std::vector<uint8_t>& buffer) {
+
+  buffer.clear();
+  buffer.reserve(n);
+
+  /*--- Zero runs are written as a 0 followed by the run length minus one (LEB128). ---*/
+
+  size_t zeroRun = 0;
+
+  auto flushZeros = [&]() {
+    if (zeroRun == 0) return;
+    buffer.push_back(0);
+    auto len = zeroRun - 1;
+    do {
+      uint8_t byte = len & 0x7f;
+      len >>= 7;
+      if (len) byte |= 0x80;
+      buffer.push_back(byte);
+    } while (len);
+    zeroRun = 0;
+  };
+
+  for (size_t iPlane = 0; iPlane < NBYTES; ++iPlane) {
+    const auto shift = 8 * (NBYTES - 1 - iPlane);
+
+    for (size_t k = 0; k < n; ++k) {
+      auto residual = ToBits(data[k]);
+      if (k >= stride) residual ^= ToBits(data[k-stride]);
+
+      const uint8_t byte = (residual >> shift) & 0xff;
+
+      if (byte == 0) {
+        ++zeroRun;
+      } else {
+        flushZeros();
+        buffer.push_back(byte);
+      }
+    }
+  }
+  flushZeros();
+}
+
+bool DecompressLossless(const uint8_t* buffer, size_t size, size_t n, size_t stride, passivedouble* data) {
+
+  std::vector<uint64_t> residual(n, 0);
+
+  size_t pos = 0, iByte = 0;
+  const size_t nByte = n * NBYTES;
+
+  while (iByte < nByte) {
+    if (pos >= size) return false;
+
+    const uint8_t byte = buffer[pos++];
+    size_t count = 1;
+
+    if (byte == 0) {
+      size_t len = 0;
+      for (unsigned shift = 0; ; shift += 7) {
+        if (pos >= size || shift >= 64) return false;
+        const uint8_t b = buffer[pos++];
+        len |= size_t(b & 0x7f) << shift;
+        if (!(b & 0x80)) break;
+      }
+      count = len + 1;
+    }
+    if (iByte + count > nByte) return false;
+
+    if (byte != 0) {
+      const auto iPlane = iByte / n;
+      residual[iByte % n] |= uint64_t(byte) << (8 * (NBYTES - 1 - iPlane));
+    }
+    iByte += count;
+  }
+  if (pos != size) return false;
+
+  for (size_t k = 0; k < n; ++k) {
+    auto bits = residual[k];
+    if (k >= stride) bits ^= ToBits(data[k-stride]);
+    data[k] = FromBits(bits);
+  }
+  return true;
+}
+
+void CompressLossy(const passivedouble* data, size_t n, size_t stride, passivedouble tolerance,
+                   std::vector<uint8_t>& buffer) {
+
+  /*--- Keeping k bits of the mantissa bounds the relative error by 2^-k. ---*/
+
+  const int nMantissa = 52;
+  int nKeep = nMantissa;
+  if (tolerance > 0) nKeep = std::min(nMantissa, std::max(0, int(std::ceil(-std::log2(tolerance)))));
+
+  if (nKeep == nMantissa) {
+    CompressLossless(data, n, stride, buffer);
+    return;
+  }
+
+  const uint64_t mask = ~((uint64_t(1) << (nMantissa - nKeep)) - 1);
+  const uint64_t expMask = uint64_t(0x7ff) << nMantissa;
+
+  std::vector<passivedouble> truncated(data, data+n);
+  for (auto& x : truncated) {
+    const auto bits = ToBits(x);
+    const auto exponent = bits & expMask;
+    if (exponent != 0 && exponent != expMask) x = FromBits(bits & mask);
+  }
+  CompressLossless(truncated.data(), n, stride, buffer);
+}
+
+void CompressBlock(const passivedouble* data, size_t nPoint, size_t nField, const passivedouble* tolerance,
+                   std::vector<uint8_t>& buffer, uint64_t* sizes) {
+
+  std::vector<passivedouble> field(nPoint);
+  std::vector<uint8_t> compressed;
+
+  for (size_t iField = 0; iField < nField; ++iField) {
+    for (size_t iPoint = 0; iPoint < nPoint; ++iPoint) field[iPoint] = data[iPoint*nField + iField];
+
+    CompressLossy(field.data(), nPoint, 1, tolerance[iField], compressed);
+
+    buffer.insert(buffer.end(), compressed.begin(), compressed.end());
+    sizes[iField] = compressed.size();
+  }
+}
+
+bool DecompressBlock(const uint8_t* buffer, const uint64_t* sizes, size_t nPoint, size_t nField, passivedouble* data) {
+
+  std::vector<passivedouble> field(nPoint);
+
+  for (size_t iField = 0; iField < nField; ++iField) {
+    if (!DecompressLossless(buffer, sizes[iField], nPoint, 1, field.data())) return false;
+
+    for (size_t iPoint = 0; iPoint < nPoint; ++iPoint) data[iPoint*nField + iField] = field[iPoint];
+    buffer += sizes[iField];
+  }
+  return true;
+}
+
+uint64_t CRestartBlockTable::GetSize(size_t iBlock) const {
+  uint64_t size = 0;
+  for (size_t iField = 0; iField < nField; ++iField) size += GetFieldSizes(iBlock)[iField];
+  return size;
+}
+
+void CRestartBlockTable::AddBlock(uint64_t firstPoint, uint64_t nPoint, uint64_t offset, const uint64_t* sizes) {
+  entries.push_back(firstPoint);
+  entries.push_back(nPoint);
+  entries.push_back(offset);
+  entries.insert(entries.end(), sizes, sizes+nField);
+}
+
+void CRestartBlockTable::ShiftOffsets(uint64_t shift) {
+  for (size_t iBlock = 0; iBlock < GetnBlock(); ++iBlock) entries[iBlock*GetEntrySize()+2] += shift;
+}
+
+bool CRestartBlockTable::Check(uint64_t nPointGlobal) const {
+
+  uint64_t nextPoint = 0, nextOffset = 0;
+
+  for (size_t iBlock = 0; iBlock < GetnBlock(); ++iBlock) {
+    if (GetFirstPoint(iBlock) != nextPoint || GetOffset(iBlock) != nextOffset || GetnPoint(iBlock) == 0)
+      return false;
+    nextPoint += GetnPoint(iBlock);
+    nextOffset += GetSize(iBlock);
+  }
+  return nextPoint == nPointGlobal;
+}
+
+bool CRestartBlockTable::FindBlocks(const unsigned long* points, size_t nPoint, std::vector<size_t>& blocks) const {
+
+  blocks.clear();
+  size_t iBlock = 0;
+
+  for (size_t k = 0; k < nPoint; ++k) {
+    while (iBlock < GetnBlock() && points[k] >= GetFirstPoint(iBlock) + GetnPoint(iBlock)) ++iBlock;
+
+    if (iBlock == GetnBlock() || points[k] < GetFirstPoint(iBlock)) return false;
+
+    if (blocks.empty() || blocks.back() != iBlock) blocks.push_back(iBlock);
+  }
+  return true;
+}
+
+void ReadRestartBlocks(const std::string& filename, const int* header, const unsigned long* points, size_t nPoint,
+                       passivedouble* data) {
+
+  const size_t nField = header[1];
+  const uint64_t nPointFile = header[2];
+
+  /*--- The block table follows the header and the names of the fields, then comes the data section. ---*/
+
+  CRestartBlockTable table(nField);
+  table.Resize(header[3]);
+  const size_t tableSize = table.GetnBlock()*table.GetEntrySize();
+
+  const size_t disp = 5*sizeof(int) + CGNS_STRING_SIZE*nField*sizeof(char);
+  const size_t dataDisp = disp + tableSize*sizeof(uint64_t);
+
+  std::vector<size_t> blocks;
+  std::vector<uint8_t> buffer;
+
+#ifdef HAVE_MPI
+
+  /*--- The master reads the table, then each rank reads the blocks of its points collectively. ---*/
+
+  MPI_File fhw;
+  int ierr = MPI_File_open(SU2_MPI::GetComm(), const_cast<char*>(filename.c_str()), MPI_MODE_RDONLY,
+                           MPI_INFO_NULL, &fhw);
+  if (ierr) SU2_MPI::Error(std::string("Unable to open SU2 restart file ") + filename, CURRENT_FUNCTION);
+
+  if (SU2_MPI::GetRank() == MASTER_NODE)
+    MPI_File_read_at(fhw, disp, table.GetData(), tableSize, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+  SU2_MPI::Bcast(table.GetData(), tableSize, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (!table.Check(nPointFile) || !table.FindBlocks(points, nPoint, blocks))
+    SU2_MPI::Error(std::string("The block table of ") + filename + std::string(" is corrupted."), CURRENT_FUNCTION);
+
+  std::vector<int> blocklen;
+  std::vector<MPI_Aint> displace;
+  for (auto iBlock : blocks) {
+    blocklen.push_back(table.GetSize(iBlock));
+    displace.push_back(table.GetOffset(iBlock));
+    buffer.resize(buffer.size() + blocklen.back());
+  }
+
+  MPI_Datatype filetype;
+  MPI_Type_create_hindexed(blocks.size(), blocklen.data(), displace.data(), MPI_BYTE, &filetype);
+  MPI_Type_commit(&filetype);
+
+  MPI_File_set_view(fhw, dataDisp, MPI_BYTE, filetype, (char*)"native", MPI_INFO_NULL);
+
+  MPI_File_read_all(fhw, buffer.data(), buffer.size(), MPI_BYTE, MPI_STATUS_IGNORE);
+
+  MPI_File_close(&fhw);
+  MPI_Type_free(&filetype);
+
+#else
+
+  /*--- Serial, the blocks are read one after the other. ---*/
+
+  FILE* fhw = fopen(filename.c_str(), "rb");
+  if (!fhw) SU2_MPI::Error(std::string("Unable to open SU2 restart file ") + filename, CURRENT_FUNCTION);
+
+  bool ok = (fseek(fhw, disp, SEEK_SET) == 0) &&
+            (fread(table.GetData(), sizeof(uint64_t), tableSize, fhw) == tableSize);
+
+  if (!ok || !table.Check(nPointFile) || !table.FindBlocks(points, nPoint, blocks))
+    SU2_MPI::Error(std::string("The block table of ") + filename + std::string(" is corrupted."), CURRENT_FUNCTION);
+
+  for (auto iBlock : blocks) {
+    const auto pos = buffer.size();
+    buffer.resize(pos + table.GetSize(iBlock));
+
+    ok = ok && (fseek(fhw, dataDisp + table.GetOffset(iBlock), SEEK_SET) == 0) &&
+         (fread(&buffer[pos], sizeof(uint8_t), table.GetSize(iBlock), fhw) == table.GetSize(iBlock));
+  }
+  fclose(fhw);
+
+  if (!ok) SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+
+#endif
+
+  /*--- Decompress the blocks and extract the points. ---*/
+
+  std::vector<passivedouble> blockData;
+  size_t pos = 0, iPoint = 0;
+
+  for (auto iBlock : blocks) {
+    const auto firstPoint = table.GetFirstPoint(iBlock);
+    const auto nPointBlock = table.GetnPoint(iBlock);
+    blockData.resize(nPointBlock*nField);
+
+    if (!DecompressBlock(&buffer[pos], table.GetFieldSizes(iBlock), nPointBlock, nField, blockData.data()))
+      SU2_MPI::Error(std::string("Corrupted block in restart file ") + filename, CURRENT_FUNCTION);
+
+    pos += table.GetSize(iBlock);
+
+    for (; iPoint < nPoint && points[iPoint] < firstPoint + nPointBlock; ++iPoint) {
+      const auto values = &blockData[(points[iPoint] - firstPoint)*nField];
+      std::copy(values, values + nField, &data[iPoint*nField]);
+    }
+  }
+}
+
+}
@@ -61,6 +61,10 @@ protected:
             UsedTimeOutput,                     /*!< \brief Elapsed time between Start and Stop point of the timer for tracking output phase.*/
             UsedTime;                           /*!< \brief Elapsed time between Start and Stop point of the timer.*/
   su2double BandwidthSum = 0.0;                 /*!< \brief Aggregate value of the bandwidth for writing restarts (to be average later).*/
+  su2double MeshBandwidth = 0.0;                /*!< \brief Aggregate value of the bandwidth for reading the mesh (if measured by the reader).*/
+  su2double AsyncWriteTime = 0.0;               /*!< \brief Time the asynchronous restart writes were in flight.*/
+  su2double AsyncWaitTime = 0.0;                /*!< \brief Time spent waiting for asynchronous restart writes.*/
+  map<string, pair<passivedouble, unsigned long> > HistoryGroupCost; /*!< \brief Time spent evaluating the expensive history groups, and number of evaluations.*/
   unsigned long IterCount,                      /*!< \brief Iteration count stored for performance benchmarking.*/
   OutputCount;                                  /*!< \brief Output count stored for performance benchmarking.*/
   unsigned long DOFsPerPoint;                   /*!< \brief Number of unknowns at each vertex, i.e., number of equations solved. */
@@ -98,6 +102,15 @@ protected:
   interpolator_container;                       /*!< \brief Definition of the interpolation method between non-matching discretizations of the interface. */
   CInterface ***interface_container;            /*!< \brief Definition of the interface of information and physics. */
   bool dry_run;                                 /*!< \brief Flag if SU2_CFD was started as dry-run via "SU2_CFD -d <config>.cfg" */
+  bool concurrentZones = false;                 /*!< \brief Flag if each zone is computed by its own subset of ranks. */
+  unsigned short ownZone = 0;                   /*!< \brief Zone computed by this rank (concurrent zones). */
+  vector<int> zoneRoot;                         /*!< \brief First (global) rank of each zone (concurrent zones). */
+  SU2_Comm globalComm;                          /*!< \brief Communicator of all the ranks. */
+  SU2_Comm zoneComm;                            /*!< \brief Communicator of the ranks of ownZone (concurrent zones) or of the instance group. */
+  bool instanceGroups = false;                  /*!< \brief Flag if the HB instances are split among groups of ranks. */
+  unsigned short firstInst = 0;                 /*!< \brief First instance computed by this rank (instance groups). */
+  unsigned short nInstGroup = 0;                /*!< \brief Number of instances computed by each group (instance groups). */
+  SU2_Comm instComm;                            /*!< \brief Communicator of the ranks with the same partition in all the groups (instance groups). */
 
 public:
 
@@ -134,6 +147,52 @@ protected:
    */
   void Input_Preprocessing(CConfig **&config, CConfig *&driver_config);
 
+  /*!
+   * \brief Assign a subset of the ranks to each zone (CONCURRENT_ZONES), proportional to the cost of the zone.
+   * \note The zones owned by other ranks are represented by dummy geometries (no points), their
+   *       solvers only take part in the interface transfers, which use the global communicator.
+   */
+  void Concurrent_Zones_Preprocessing();
+
+  /*!
+   * \brief Read the global number of points of a zone from the header of its mesh file.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_iZone - Index of the zone.
+   * \return Number of points, 0 if it cannot be determined without reading the mesh.
+   */
+  unsigned long GetZone_nPointGlobal(const CConfig* config, unsigned short val_iZone) const;
+
+  /*!
+   * \brief Whether this rank computes a zone (always true when the zones are not concurrent).
+   * \param[in] val_iZone - Index of the zone.
+   */
+  inline bool OwnsZone(unsigned short val_iZone) const { return !concurrentZones || (val_iZone == ownZone); }
+
+  /*!
+   * \brief Split the ranks into groups that compute different harmonic balance instances (HB_INSTANCE_GROUPS).
+   * \note The groups have the same number of ranks and therefore the same partitions, the instances
+   *       computed by other groups are represented by dummy geometries (no points).
+   */
+  void Instance_Groups_Preprocessing();
+
+  /*!
+   * \brief Whether this rank computes an instance (always true when the instances are not split).
+   * \param[in] val_iInst - Index of the instance.
+   */
+  inline bool OwnsInstance(unsigned short val_iInst) const {
+    return !instanceGroups || ((val_iInst >= firstInst) && (val_iInst < firstInst+nInstGroup));
+  }
+
+  /*!
+   * \brief Make the communicator of all the ranks the current one (when the zones are concurrent or the instances split).
+   */
+  void SetGlobalComm() const;
+
+  /*!
+   * \brief Make the communicator of the zone (or instance group) of this rank the current one.
+   */
+  void SetZoneComm() const;
+
   /*!
    * \brief Construction of the edge-based data structure and the multigrid structure.
    */
@@ -407,6 +466,21 @@ public:
    */
   passivedouble Get_LiftCoeff() const;
 
+  /*!
+   * \brief Request history output fields (or groups) of the first zone that must be evaluated at every
+   *        iteration, regardless of the screen and history file output frequencies.
+   * \param[in] fields - Names of the fields or groups, "ALL" requests all the groups.
+   */
+  void RequestHistoryOutput(const vector<string>& fields);
+
+  /*!
+   * \brief Get the value of a history output field of the first zone.
+   * \note Expensive fields are only up to date if they were requested (RequestHistoryOutput) or written.
+   * \param[in] field - Name of the field.
+   * \return Value of the field.
+   */
+  passivedouble GetHistoryOutputValue(const string& field) const;
+
   /*!
    * \brief Get the number of vertices (halo nodes included) from a specified marker.
    * \param[in] iMarker -  Marker identifier.
@@ -887,6 +961,24 @@ private:
   unsigned short nInstHB;
   su2double **D; /*!< \brief Harmonic Balance operator. */
 
+  vector<su2double> instanceData;       /*!< \brief Values of all the instances at the local points (instance groups). */
+  vector<unsigned long> instanceOffset; /*!< \brief Offset of each grid level in the values of one instance. */
+  unsigned long instanceSize = 0;       /*!< \brief Number of values of one instance. */
+
+  /*!
+   * \brief Gather values of all the instances at the local points from the groups that compute them.
+   * \param[in] blockSize - Number of values per instance.
+   * \param[in] pack - Functor (iInst, su2double*) that writes the values of an instance of this rank.
+   * \param[out] data - Values of all the instances, one block after the other.
+   */
+  template<class F>
+  void GatherInstances(unsigned long blockSize, const F& pack, vector<su2double>& data) const;
+
+  /*!
+   * \brief Check that the instance groups have the same partitions.
+   */
+  void CheckInstancePartitions() const;
+
 public:
 
   /*!
@@ -934,6 +1026,11 @@ public:
    */
   void Update() override;
 
+  /*!
+   * \brief Monitor the computation, all the instance groups stop with the first instance.
+   */
+  bool Monitor(unsigned long ExtIter) override;
+
   /*!
    * \brief Reset the convergence flag (set to false) of the solver for the Harmonic Balance.
    */
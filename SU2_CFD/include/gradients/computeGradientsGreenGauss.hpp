@@ -179,10 +179,11 @@ void computeGradientsGreenGauss(CSolver* solver,
     solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
   }
 
-  /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
+  /*--- Obtain the gradients at halo points from the MPI ranks that own them,
+   *    the solver may defer the completion to overlap it with other work. ---*/
 
   solver->InitiateComms(&geometry, &config, kindMpiComm);
-  solver->CompleteComms(&geometry, &config, kindMpiComm);
+  solver->CompleteOrDeferComms(&geometry, &config, kindMpiComm);
 
 }
 } // end namespace
@@ -309,10 +309,11 @@ void computeGradientsLeastSquares(CSolver* solver,
 
   if (solver != nullptr)
   {
-    /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
+    /*--- Obtain the gradients at halo points from the MPI ranks that own them,
+     *    the solver may defer the completion to overlap it with other work. ---*/
 
     solver->InitiateComms(&geometry, &config, kindMpiComm);
-    solver->CompleteComms(&geometry, &config, kindMpiComm);
+    solver->CompleteOrDeferComms(&geometry, &config, kindMpiComm);
   }
 
 }
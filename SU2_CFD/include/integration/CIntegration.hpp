@@ -76,6 +76,18 @@ protected:
   void Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                         unsigned short iRKStep, unsigned short RunTime_EqSystem);
 
+  /*!
+   * \brief Restrict the eddy viscosity from fine grid to a coarse grid.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   * \param[in] sol_fine - Pointer to the solution on the fine grid.
+   * \param[out] sol_coarse - Pointer to the solution on the coarse grid.
+   * \param[in] geo_fine - Geometrical definition of the fine grid.
+   * \param[in] geo_coarse - Geometrical definition of the coarse grid.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetRestricted_EddyVisc(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
+                              CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config);
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -71,13 +71,14 @@ private:
 
   /*!
    * \brief Compute the forcing term.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
    * \param[in] sol_fine - Pointer to the solution on the fine grid.
    * \param[in] sol_coarse - Pointer to the solution on the coarse grid.
    * \param[in] geo_fine - Geometrical definition of the fine grid.
    * \param[in] geo_coarse - Geometrical definition of the coarse grid.
    * \param[in] config - Definition of the particular problem.
    */
-  void SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
+  void SetForcing_Term(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
                        CGeometry *geo_coarse, CConfig *config, unsigned short iMesh);
 
   /*!
@@ -89,11 +90,14 @@ private:
 
   /*!
    * \brief Set the value of the corrected fine grid solution.
+   * \note For the turbulence equations the correction is limited to keep the variables positive.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
    * \param[out] sol_fine - Pointer to the solution on the fine grid.
    * \param[in] geo_fine - Geometrical definition of the fine grid.
    * \param[in] config - Definition of the particular problem.
    */
-  void SetProlongated_Correction(CSolver *sol_fine, CGeometry *geo_fine, CConfig *config, unsigned short iMesh);
+  void SetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine, CGeometry *geo_fine,
+                                 CConfig *config, unsigned short iMesh);
 
   /*!
    * \brief Compute the gradient in coarse grid using the fine grid information.
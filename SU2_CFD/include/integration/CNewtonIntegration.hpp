@@ -47,6 +47,12 @@
  * \class CNewtonIntegration
  * \brief Class for time integration using a Newton-Krylov method, based
  * on matrix-free products with the true Jacobian via finite differences.
+ * \note With NEWTON_KRYLOV_FROZEN_COEFF the products are still finite differences
+ * of full residual evaluations, but of the residual with the limiters and dissipation
+ * coefficients of the current solution held fixed (not an exact linearization).
+ * With NEWTON_KRYLOV_EDGE_PRODUCTS the flux Jacobians of the vectorized edge numerics
+ * are applied to the Krylov directions instead, edge by edge, and the boundary conditions
+ * enter via the diagonal blocks of the Jacobian assembled for the preconditioner.
  */
 class CNewtonIntegration final : public CIntegration {
 public:
@@ -67,6 +73,8 @@ private:
   bool setup = false;
   Scalar finDiffStepND = 0.0;
   Scalar finDiffStep = 0.0; /*!< \brief Based on RMS(solution), used in matrix-free products. */
+  bool frozenCoeff = false; /*!< \brief Keep limiters and dissipation coefficients in the finite difference products. */
+  bool edgeProducts = false; /*!< \brief Products with the flux Jacobians of the edge numerics. */
   unsigned long omp_chunk_size; /*!< \brief Chunk size used in light point loops. */
 
   /*--- Number of iterations and tolerance for the linear preconditioner,
@@ -119,6 +127,34 @@ private:
     END_CNEWTON_PARFOR
   }
 
+  /*--- For edge products, 0 for the rows without off-diagonal entries in the Jacobian (strong BCs), 1 otherwise. ---*/
+  CSysVector<Scalar> edgeRowMask;
+
+  /*--- The edge products of the solver use su2double, if it is not the Scalar type these temporaries are used. ---*/
+  CSysVector<su2double> edgeProdIn, edgeProdOut;
+
+  template<class T, su2enable_if<std::is_same<T,su2double>::value> = 0>
+  inline bool EdgeFluxProduct_impl(const CSysVector<T>& u, CSysVector<T>& v) {
+    return solvers[FLOW_SOL]->EdgeFluxProduct(geometry, config, u, v);
+  }
+
+  template<class T, su2enable_if<!std::is_same<T,su2double>::value> = 0>
+  inline bool EdgeFluxProduct_impl(const CSysVector<T>& u, CSysVector<T>& v) {
+    CNEWTON_PARFOR
+    for (auto i = 0ul; i < u.GetLocSize(); ++i) edgeProdIn[i] = u[i];
+    END_CNEWTON_PARFOR
+    SU2_OMP_BARRIER
+
+    if (!solvers[FLOW_SOL]->EdgeFluxProduct(geometry, config, edgeProdIn, edgeProdOut)) return false;
+    SU2_OMP_BARRIER
+
+    CNEWTON_PARFOR
+    for (auto i = 0ul; i < v.GetLocSize(); ++i) v[i] = SU2_TYPE::GetValue(edgeProdOut[i]);
+    END_CNEWTON_PARFOR
+    SU2_OMP_BARRIER
+    return true;
+  }
+
   /*--- Preconditioner objects for each active solver. ---*/
   CPreconditioner<MixedScalar>* preconditioner = nullptr;
 
@@ -179,6 +215,16 @@ private:
    */
   void ComputeFinDiffStep();
 
+  /*!
+   * \brief Find the rows of the Jacobian that do not couple to neighbors, for the edge products.
+   */
+  void SetEdgeRowMask();
+
+  /*!
+   * \brief Product with the edge flux Jacobians and the diagonal blocks of the assembled Jacobian.
+   */
+  void EdgeProduct(const CSysVector<Scalar>& u, CSysVector<Scalar>& v);
+
 public:
   /*!
    * \brief Constructor.
@@ -229,12 +229,12 @@ void computeLimiters_impl(CSolver* solver,
     }
   }
 
-  /*--- Obtain the limiters at halo points from the MPI ranks that own them.
-   *    If no solver was provided we do not communicate. ---*/
+  /*--- Obtain the limiters at halo points from the MPI ranks that own them (the solver may
+   *    defer the completion). If no solver was provided we do not communicate. ---*/
   if (solver != nullptr)
   {
     solver->InitiateComms(&geometry, &config, kindMpiComm);
-    solver->CompleteComms(&geometry, &config, kindMpiComm);
+    solver->CompleteOrDeferComms(&geometry, &config, kindMpiComm);
   }
 
   AD::EndPassive(wasActive);
@@ -29,8 +29,13 @@
 
 #include "CNumericsSIMD.hpp"
 #include "flow/convection/roe.hpp"
+#include "flow/convection/ausm_slau.hpp"
+#include "flow/convection/hllc.hpp"
+#include "flow/convection/fds.hpp"
 #include "flow/convection/centered.hpp"
 #include "flow/diffusion/viscous_fluxes.hpp"
+#include "turbulent/sa.hpp"
+#include "turbulent/sst.hpp"
 
 namespace {
 
@@ -44,6 +49,24 @@ CNumericsSIMD* createUpwindIdealNumerics(const CConfig& config, int iMesh, const
     case ROE:
       obj = new CRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
       break;
+    case AUSM:
+      obj = new CAUSMScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case AUSMPLUSUP:
+      obj = new CAUSMPlusUpScheme<ViscousDecorator,false>(config, iMesh, turbVars);
+      break;
+    case AUSMPLUSUP2:
+      obj = new CAUSMPlusUpScheme<ViscousDecorator,true>(config, iMesh, turbVars);
+      break;
+    case SLAU:
+      obj = new CSLAUScheme<ViscousDecorator,false>(config, iMesh, turbVars);
+      break;
+    case SLAU2:
+      obj = new CSLAUScheme<ViscousDecorator,true>(config, iMesh, turbVars);
+      break;
+    case HLLC:
+      obj = new CHLLCScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
   }
   return obj;
 }
@@ -81,12 +104,49 @@ CNumericsSIMD* createCenteredNumerics(const CConfig& config, int iMesh, const CV
   return obj;
 }
 
+/*!
+ * \brief Factory implementation for incompressible flow.
+ */
+template<class ViscousDecorator>
+CNumericsSIMD* createIncompressibleNumerics(const CConfig& config, int iMesh, const CVariable* turbVars) {
+  CNumericsSIMD* obj = nullptr;
+  switch (config.GetKind_ConvNumScheme_Flow()) {
+    case SPACE_UPWIND:
+      if (config.GetKind_Upwind_Flow() == FDS)
+        obj = new CFDSIncScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+
+    case SPACE_CENTERED:
+      switch ((iMesh==MESH_0)? config.GetKind_Centered_Flow() : LAX) {
+        case LAX:
+          obj = new CLaxIncScheme<ViscousDecorator>(config, iMesh, turbVars);
+          break;
+        case JST:
+          obj = new CJSTIncScheme<ViscousDecorator>(config, iMesh, turbVars);
+          break;
+        default:
+          break;
+      }
+      break;
+  }
+  return obj;
+}
+
 /*!
  * \brief Generic factory implementation.
  */
 template<int nDim>
 CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable* turbVars) {
   CNumericsSIMD* obj = nullptr;
+
+  if (config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE) {
+    if (config.GetViscous())
+      obj = createIncompressibleNumerics<CIncompressibleViscousFlux<nDim> >(config, iMesh, turbVars);
+    else
+      obj = createIncompressibleNumerics<CNoViscousFlux<nDim> >(config, iMesh, turbVars);
+    return obj;
+  }
+
   const bool ideal_gas = (config.GetKind_FluidModel() == STANDARD_AIR) ||
                          (config.GetKind_FluidModel() == IDEAL_GAS);
 
@@ -122,6 +182,42 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
   return obj;
 }
 
+/*!
+ * \brief Turbulence factory implementation.
+ */
+template<int nDim, class FlowPrimitives, class FlowVariable>
+CNumericsSIMD* createTurbModelNumerics(const CConfig& config, int iMesh, const CVariable* flowVars,
+                                  const su2double* constants, const su2double* freeStream) {
+  CNumericsSIMD* obj = nullptr;
+  switch (config.GetKind_Turb_Model()) {
+    case SA: case SA_E: case SA_COMP: case SA_E_COMP:
+      obj = new CTurbSAScheme<nDim,FlowPrimitives,FlowVariable,false>(config, iMesh, flowVars);
+      break;
+    case SA_NEG:
+      obj = new CTurbSAScheme<nDim,FlowPrimitives,FlowVariable,true>(config, iMesh, flowVars);
+      break;
+    case SST: case SST_SUST:
+      obj = new CTurbSSTScheme<nDim,FlowPrimitives,FlowVariable>(config, iMesh, flowVars, constants, freeStream);
+      break;
+  }
+  return obj;
+}
+
+/*!
+ * \brief Generic turbulence factory implementation.
+ */
+template<int nDim>
+CNumericsSIMD* createTurbNumerics(const CConfig& config, int iMesh, const CVariable* flowVars,
+                                  const su2double* constants, const su2double* freeStream) {
+  /*--- Only the primitives up to the eddy viscosity are needed. ---*/
+  if (config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE)
+    return createTurbModelNumerics<nDim, CIncompressiblePrimitives<nDim,nDim+6>, CIncEulerVariable>(
+             config, iMesh, flowVars, constants, freeStream);
+
+  return createTurbModelNumerics<nDim, CCompressiblePrimitives<nDim,nDim+7>, CEulerVariable>(
+           config, iMesh, flowVars, constants, freeStream);
+}
+
 } // namespace
 
 /*!
@@ -138,3 +234,14 @@ CNumericsSIMD* CNumericsSIMD::CreateNumerics(const CConfig& config, int nDim, in
 
   return nullptr;
 }
+
+/*!
+ * \brief Same as CreateNumerics, for the turbulence models.
+ */
+CNumericsSIMD* CNumericsSIMD::CreateTurbNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* flowVars,
+                                                 const su2double* constants, const su2double* freeStream) {
+  if (nDim == 2) return createTurbNumerics<2>(config, iMesh, flowVars, constants, freeStream);
+  if (nDim == 3) return createTurbNumerics<3>(config, iMesh, flowVars, constants, freeStream);
+
+  return nullptr;
+}
@@ -34,8 +34,10 @@
  * \brief Ways to update vectors and system matrices.
  * COLORING is the typical i/j update, whereas for REDUCTION
  * the fluxes are stored and the matrix diagonal is not modified.
+ * PRODUCT does not store the Jacobians, the off-diagonal blocks are
+ * applied to a direction and the result is added to the vector.
  */
-enum class UpdateType {COLORING, REDUCTION};
+enum class UpdateType {COLORING, REDUCTION, PRODUCT};
 
 /*!
  * \brief Define Double and Int SIMD types.
@@ -73,6 +75,7 @@ public:
    * \param[in] updateMask - SIMD array of 1's and 0's, the latter prevent the update.
    * \param[in,out] vector - Target for the fluxes.
    * \param[in,out] matrix - Target for the flux Jacobians.
+   * \param[in] direction - Vector multiplied by the flux Jacobians (only for UpdateType::PRODUCT).
    * \note The update mask is used to handle "remainder" edges (nEdge mod simdSize).
    */
   virtual void ComputeFlux(Int iEdge,
@@ -82,7 +85,27 @@ public:
                            UpdateType updateType,
                            Double updateMask,
                            CSysVector<su2double>& vector,
-                           SparseMatrixType& matrix) const = 0;
+                           SparseMatrixType& matrix,
+                           const CSysVector<su2double>* direction = nullptr) const = 0;
+
+  /*!
+   * \brief Interface for point source computation, only implemented by the numerics of
+   * models that have volume sources (e.g. turbulence).
+   * \param[in] iPoint - The points for source computation.
+   * \param[in] config - Problem definitions.
+   * \param[in] geometry - Problem geometry.
+   * \param[in] solution - Solution variables.
+   * \param[in] updateMask - SIMD array of 1's and 0's, the latter prevent the update.
+   * \param[in,out] vector - Target for the sources (they are subtracted).
+   * \param[in,out] matrix - Target for the source Jacobians (subtracted from the diagonal).
+   */
+  virtual void ComputeSource(Int iPoint,
+                             const CConfig& config,
+                             const CGeometry& geometry,
+                             const CVariable& solution,
+                             Double updateMask,
+                             CSysVector<su2double>& vector,
+                             SparseMatrixType& matrix) const {}
 
   /*! \brief Destructor of the class. */
   virtual ~CNumericsSIMD(void) = default;
@@ -96,4 +119,16 @@ public:
    */
   static CNumericsSIMD* CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars = nullptr);
 
+  /*!
+   * \brief Factory method for turbulence models (convection, diffusion, and sources).
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] iMesh - Grid index.
+   * \param[in] flowVars - Flow variables.
+   * \param[in] constants - Closure constants of the model (may be null).
+   * \param[in] freeStream - Free-stream values of the turbulence variables.
+   */
+  static CNumericsSIMD* CreateTurbNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* flowVars,
+                                           const su2double* constants, const su2double* freeStream);
+
 };
@@ -0,0 +1,576 @@
+/*!
+ * \file ausm_slau.hpp
+ * \brief AUSM-family of convective schemes.
+ * \author P. Gomes, F. Palacios, T. Economon
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CAUSMBase
+ * \brief Base class for AUSM-type schemes, i.e. schemes that can be written as
+ * F = mdot * psi_upwind + N * p, with psi = (1, u, H), derived classes implement
+ * the face mass flux (per unit area) "mdot" and pressure "p" in a const
+ * "massAndPressureFluxes" method. This method must be a function of, at most,
+ * the velocities, pressures, densities, and enthalpies at nodes i/j, so that
+ * accurate Jacobians can be obtained by finite differences.
+ * \note See CRoeBase for the role of Base. Branches of the scalar implementations
+ * (CUpwAUSMPLUS_SLAU_Base_Flow and derived) are replaced by masks.
+ */
+template<class Derived, class Base>
+class CAUSMBase : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double gamma;
+  const bool finestGrid;
+  const bool muscl;
+  const bool accurateJacobian;
+  const ENUM_LIMITER typeLimiter;
+  const ENUM_ROELOWDISS typeDissip;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   * \param[in] lowDissipation - Whether the derived scheme supports low dissipation.
+   */
+  template<class... Ts>
+  CAUSMBase(const CConfig& config, bool lowDissipation, unsigned iMesh, Ts&... args) :
+    Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    accurateJacobian(config.GetUse_Accurate_Jacobians()),
+    typeLimiter(static_cast<ENUM_LIMITER>(config.GetKind_SlopeLimit_Flow())),
+    typeDissip(lowDissipation? static_cast<ENUM_ROELOWDISS>(config.GetKind_RoeLowDiss()) : NO_ROELOWDISS) {
+    if (finestGrid && config.GetDynamic_Grid() && (SU2_MPI::GetRank() == MASTER_NODE))
+      cout << "WARNING: Grid velocities are NOT yet considered in AUSM-type schemes." << endl;
+  }
+
+  /*!
+   * \brief Approximate (Roe) Jacobians of the flux.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void approximateJacobian(const CPair<PrimVarType>& V,
+                                       const VectorDbl<nDim>& normal,
+                                       const VectorDbl<nDim>& unitNormal,
+                                       Double area,
+                                       MatrixDbl<nVar>& jac_i,
+                                       MatrixDbl<nVar>& jac_j) const {
+    auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+
+    auto pMat = pMatrix(gamma, roeAvg.density, roeAvg.velocity,
+                        roeAvg.projVel, roeAvg.speedSound, unitNormal);
+    auto pMatInv = pMatrixInv(gamma, roeAvg.density, roeAvg.velocity,
+                              roeAvg.projVel, roeAvg.speedSound, unitNormal);
+
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = abs(roeAvg.projVel);
+    }
+    lambda(nDim) = abs(roeAvg.projVel + roeAvg.speedSound);
+    lambda(nDim+1) = abs(roeAvg.projVel - roeAvg.speedSound);
+
+    /*--- Scale = 0.5 because the flux is ~ 0.5*(fc_i+fc_j)*Normal. ---*/
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure() / V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure() / V.j.density();
+    jac_i = inviscidProjJac(gamma, V.i.velocity(), energy_i, normal, 0.5);
+    jac_j = inviscidProjJac(gamma, V.j.velocity(), energy_j, normal, 0.5);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double projModJacTensor = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+        }
+        jac_i(iVar,jVar) += 0.5 * area * projModJacTensor;
+        jac_j(iVar,jVar) -= 0.5 * area * projModJacTensor;
+      }
+    }
+  }
+
+  /*!
+   * \brief Derivatives of (u, p, rho, H) w.r.t. the conservative variables (ideal gas).
+   */
+  template<class PrimVarType>
+  FORCEINLINE MatrixDbl<nDim+3,nVar> primitivesJacobian(const PrimVarType& V) const {
+    MatrixDbl<nDim+3,nVar> dVdU;
+    for (size_t iVar = 0; iVar < nDim+3; ++iVar)
+      for (size_t jVar = 0; jVar < nVar; ++jVar)
+        dVdU(iVar,jVar) = 0.0;
+
+    const Double oneOnRho = 1 / V.density();
+    const Double sqVel = squaredNorm<nDim>(V.velocity());
+
+    /*--- Density. ---*/
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      dVdU(iDim,0) = -V.velocity(iDim) * oneOnRho;
+    }
+    dVdU(nDim,0) = 0.5*(gamma-1)*sqVel;
+    dVdU(nDim+1,0) = 1.0;
+    dVdU(nDim+2,0) = (0.5*(gamma-2)*sqVel - gamma*V.pressure()/((gamma-1)*V.density())) * oneOnRho;
+
+    /*--- Momentum. ---*/
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      dVdU(iDim,iDim+1) = oneOnRho;
+      dVdU(nDim,iDim+1) = -(gamma-1)*V.velocity(iDim);
+      dVdU(nDim+2,iDim+1) = dVdU(nDim,iDim+1) * oneOnRho;
+    }
+
+    /*--- Energy. ---*/
+    dVdU(nDim,nDim+1) = gamma-1;
+    dVdU(nDim+2,nDim+1) = gamma * oneOnRho;
+
+    return dVdU;
+  }
+
+  /*!
+   * \brief Accurate Jacobians of the flux, the derivatives of mdot and p w.r.t. the
+   * primitives are obtained by finite differences, the rest is analytical.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void accurateJacobians(const CPair<PrimVarType>& V,
+                                     const VectorDbl<nDim>& normal,
+                                     const VectorDbl<nDim>& unitNormal,
+                                     Double area,
+                                     Double dissipation,
+                                     Double mdot,
+                                     Double pressure,
+                                     Double upwind,
+                                     MatrixDbl<nVar>& jac_i,
+                                     MatrixDbl<nVar>& jac_j) const {
+    const auto derived = static_cast<const Derived*>(this);
+    const passivedouble finDiffStep = 1e-4;
+
+    /*--- Differentiate w.r.t. the primitives (u, p, rho, H), which
+     *    conveniently are contiguous in the primitive vector. ---*/
+
+    VectorDbl<nDim+3> dmdot_dVi, dmdot_dVj, dpres_dVi, dpres_dVj;
+    auto Vp = V;
+
+    for (size_t iVar = 0; iVar < nDim+3; ++iVar) {
+      Double mdot_p, pressure_p;
+
+      /*--- Perturb side i. ---*/
+      const Double eps_i = finDiffStep * max(1.0, abs(V.i.all(iVar+1)));
+      Vp.i.all(iVar+1) += eps_i;
+      derived->massAndPressureFluxes(Vp, unitNormal, dissipation, mdot_p, pressure_p);
+      dmdot_dVi(iVar) = (mdot_p - mdot) / eps_i;
+      dpres_dVi(iVar) = (pressure_p - pressure) / eps_i;
+      Vp.i.all(iVar+1) = V.i.all(iVar+1);
+
+      /*--- Perturb side j. ---*/
+      const Double eps_j = finDiffStep * max(1.0, abs(V.j.all(iVar+1)));
+      Vp.j.all(iVar+1) += eps_j;
+      derived->massAndPressureFluxes(Vp, unitNormal, dissipation, mdot_p, pressure_p);
+      dmdot_dVj(iVar) = (mdot_p - mdot) / eps_j;
+      dpres_dVj(iVar) = (pressure_p - pressure) / eps_j;
+      Vp.j.all(iVar+1) = V.j.all(iVar+1);
+    }
+
+    /*--- Chain rule to obtain the derivatives w.r.t. the conservatives. ---*/
+
+    const auto dVdU_i = primitivesJacobian(V.i);
+    const auto dVdU_j = primitivesJacobian(V.j);
+
+    VectorDbl<nVar> dmdot_dUi, dmdot_dUj, dpres_dUi, dpres_dUj;
+    for (size_t jVar = 0; jVar < nVar; ++jVar) {
+      dmdot_dUi(jVar) = 0.0;  dpres_dUi(jVar) = 0.0;
+      dmdot_dUj(jVar) = 0.0;  dpres_dUj(jVar) = 0.0;
+      for (size_t iVar = 0; iVar < nDim+3; ++iVar) {
+        dmdot_dUi(jVar) += dmdot_dVi(iVar) * dVdU_i(iVar,jVar);
+        dpres_dUi(jVar) += dpres_dVi(iVar) * dVdU_i(iVar,jVar);
+        dmdot_dUj(jVar) += dmdot_dVj(iVar) * dVdU_j(iVar,jVar);
+        dpres_dUj(jVar) += dpres_dVj(iVar) * dVdU_j(iVar,jVar);
+      }
+    }
+
+    /*--- Upwind convected quantities, psi = (1, u, H). ---*/
+
+    VectorDbl<nVar> psiHat;
+    psiHat(0) = area;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      psiHat(iDim+1) = area * (upwind*V.i.velocity(iDim) + (1-upwind)*V.j.velocity(iDim));
+    }
+    psiHat(nDim+1) = area * (upwind*V.i.enthalpy() + (1-upwind)*V.j.enthalpy());
+
+    /*--- Contributions from the mass flux and pressure derivatives. ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iVar,jVar) = psiHat(iVar) * dmdot_dUi(jVar);
+        jac_j(iVar,jVar) = psiHat(iVar) * dmdot_dUj(jVar);
+      }
+    }
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iDim+1,jVar) += normal(iDim) * dpres_dUi(jVar);
+        jac_j(iDim+1,jVar) += normal(iDim) * dpres_dUj(jVar);
+      }
+    }
+
+    /*--- Contributions from the derivatives of psi, only on the upwind side. ---*/
+
+    auto psiJacobian = [&](const PrimVarType& Vk, const MatrixDbl<nDim+3,nVar>& dVdU,
+                           Double mdotHat, MatrixDbl<nVar>& jac) {
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        jac(iDim+1,0) -= mdotHat * Vk.velocity(iDim);
+        jac(iDim+1,iDim+1) += mdotHat;
+        jac(nDim+1,iDim+1) -= mdotHat * (gamma-1) * Vk.velocity(iDim);
+      }
+      jac(nDim+1,0) += mdotHat * dVdU(nDim+2,0) * Vk.density();
+      jac(nDim+1,nDim+1) += mdotHat * gamma;
+    };
+    psiJacobian(V.i, dVdU_i, upwind * area * mdot / V.i.density(), jac_i);
+    psiJacobian(V.j, dVdU_j, (1-upwind) * area * mdot / V.j.density(), jac_j);
+  }
+
+public:
+  /*!
+   * \brief Implementation of the base AUSM flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix,
+                   const CSysVector<su2double>* direction) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Mass and pressure fluxes defined by the derived class (static polymorphism). ---*/
+
+    const Double dissipation = roeDissipation(iPoint, jPoint, typeDissip, solution);
+
+    Double mdot, pressure;
+    const auto derived = static_cast<const Derived*>(this);
+    derived->massAndPressureFluxes(V, unitNormal, dissipation, mdot, pressure);
+
+    /*--- Upwind the convected quantities, psi = (1, u, H). ---*/
+
+    const Double upwind = (mdot > 0.0);
+
+    VectorDbl<nVar> flux;
+    flux(0) = area * mdot;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = area * (mdot * (upwind*V.i.velocity(iDim) + (1-upwind)*V.j.velocity(iDim)) +
+                             unitNormal(iDim) * pressure);
+    }
+    flux(nDim+1) = area * mdot * (upwind*V.i.enthalpy() + (1-upwind)*V.j.enthalpy());
+
+    /*--- Jacobians, either approximate (Roe) or accurate. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      if (accurateJacobian)
+        accurateJacobians(V, normal, unitNormal, area, dissipation, mdot, pressure, upwind, jac_i, jac_j);
+      else
+        approximateJacobian(V, normal, unitNormal, area, jac_i, jac_j);
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix, direction);
+  }
+};
+
+/*!
+ * \class CAUSMScheme
+ * \brief Original AUSM scheme of Liou and Steffen.
+ */
+template<class Decorator>
+class CAUSMScheme : public CAUSMBase<CAUSMScheme<Decorator>,Decorator> {
+private:
+  using Base = CAUSMBase<CAUSMScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+
+public:
+  /*!
+   * \brief Constructor, forward to base.
+   */
+  template<class... Ts>
+  CAUSMScheme(const CConfig& config, Ts&... args) : Base(config, false, args...) {}
+
+  /*!
+   * \brief Mass and pressure fluxes.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure() / V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure() / V.j.density();
+    const Double soundSpeed_i = sqrt(abs(gamma*(gamma-1)*(energy_i - 0.5*squaredNorm<nDim>(V.i.velocity()))));
+    const Double soundSpeed_j = sqrt(abs(gamma*(gamma-1)*(energy_j - 0.5*squaredNorm<nDim>(V.j.velocity()))));
+
+    const Double mL = projVel_i / soundSpeed_i;
+    const Double mR = projVel_j / soundSpeed_j;
+
+    /*--- Split Mach numbers and pressures, subsonic or supersonic. ---*/
+
+    const Double subL = (abs(mL) <= 1.0);
+    const Double subR = (abs(mR) <= 1.0);
+
+    const Double mLP = subL * 0.25*pow(mL+1, 2) + (1-subL) * 0.5*(mL+abs(mL));
+    const Double mRM =-subR * 0.25*pow(mR-1, 2) + (1-subR) * 0.5*(mR-abs(mR));
+
+    const Double pLP = subL * 0.25*pow(mL+1, 2)*(2-mL) + (1-subL) * (mL > 0.0);
+    const Double pRM = subR * 0.25*pow(mR-1, 2)*(2+mR) + (1-subR) * (mR < 0.0);
+
+    const Double mF = mLP + mRM;
+    mdot = max(mF, 0.0) * V.i.density() * soundSpeed_i + min(mF, 0.0) * V.j.density() * soundSpeed_j;
+    pressure = pLP * V.i.pressure() + pRM * V.j.pressure();
+  }
+};
+
+/*!
+ * \class CAUSMPlusUpScheme
+ * \brief AUSM+-up (Liou, 2006), and AUSM+-up2 (Kitamura and Shima, 2013) if "UP2" is true.
+ */
+template<class Decorator, bool UP2>
+class CAUSMPlusUpScheme : public CAUSMBase<CAUSMPlusUpScheme<Decorator,UP2>,Decorator> {
+private:
+  using Base = CAUSMBase<CAUSMPlusUpScheme<Decorator,UP2>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const su2double Minf;
+  const su2double Kp = 0.25;
+  const su2double Ku = 0.75;
+  const su2double sigma = 1.0;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CAUSMPlusUpScheme(const CConfig& config, Ts&... args) : Base(config, false, args...),
+    Minf(config.GetMach()) {
+    if (Minf < EPS)
+      SU2_MPI::Error("AUSM+Up requires a reference Mach number (\"MACH_NUMBER\") greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief Mass and pressure fluxes.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    /*--- Compute interface speed of sound (aF). ---*/
+
+    const Double astarL = sqrt(2*(gamma-1)/(gamma+1)*V.i.enthalpy());
+    const Double astarR = sqrt(2*(gamma-1)/(gamma+1)*V.j.enthalpy());
+
+    const Double ahatL = astarL*astarL / max(astarL, projVel_i);
+    const Double ahatR = astarR*astarR / max(astarR,-projVel_j);
+
+    const Double aF = min(ahatL, ahatR);
+
+    /*--- Left and right pressures and Mach numbers. ---*/
+
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    const Double MFsq = 0.5*(mL*mL + mR*mR);
+    const Double Mrefsq = min(1.0, max(MFsq, Minf*Minf));
+
+    const Double fa = 2*sqrt(Mrefsq) - Mrefsq;
+
+    const Double alpha = 3.0/16.0*(-4 + 5*fa*fa);
+    const passivedouble beta = 1.0/8.0;
+
+    const Double subL = (abs(mL) <= 1.0);
+    const Double subR = (abs(mR) <= 1.0);
+
+    Double p1 = 0.25*pow(mL+1, 2);
+    Double p2 = pow(mL*mL-1, 2);
+    const Double mLP = subL * (p1 + beta*p2) + (1-subL) * 0.5*(mL+abs(mL));
+    const Double betaLP = subL * (p1*(2-mL) + alpha*mL*p2) + (1-subL) * (mL > 0.0);
+
+    p1 = 0.25*pow(mR-1, 2);
+    p2 = pow(mR*mR-1, 2);
+    const Double mRM = subR * (-p1 - beta*p2) + (1-subR) * 0.5*(mR-abs(mR));
+    const Double betaRM = subR * (p1*(2+mR) - alpha*mR*p2) + (1-subR) * (mR < 0.0);
+
+    /*--- Mass flux with pressure diffusion term. ---*/
+
+    const Double rhoF = 0.5*(V.i.density() + V.j.density());
+    const Double Mp = -(Kp/fa) * max(1-sigma*MFsq, 0.0) * (V.j.pressure()-V.i.pressure()) / (rhoF*aF*aF);
+
+    const Double mF = mLP + mRM + Mp;
+    mdot = aF * (max(mF, 0.0) * V.i.density() + min(mF, 0.0) * V.j.density());
+
+    /*--- Pressure flux, with velocity diffusion term or modified (UP2). ---*/
+
+    if (!UP2) {
+      const Double Pu = -Ku*fa*betaLP*betaRM*2*rhoF*aF*(projVel_j-projVel_i);
+      pressure = betaLP*V.i.pressure() + betaRM*V.j.pressure() + Pu;
+    }
+    else {
+      const Double sqVel = 0.5*(squaredNorm<nDim>(V.i.velocity()) + squaredNorm<nDim>(V.j.velocity()));
+      pressure = 0.5*(V.j.pressure() + V.i.pressure()) +
+                 0.5*(betaLP-betaRM)*(V.i.pressure() - V.j.pressure()) +
+                 sqrt(sqVel)*(betaLP+betaRM-1)*rhoF*aF;
+    }
+  }
+};
+
+/*!
+ * \class CSLAUScheme
+ * \brief Simple Low-dissipation AUSM (Shima and Kitamura, 2011), and SLAU2 if "SLAU2" is true.
+ */
+template<class Decorator, bool SLAU2>
+class CSLAUScheme : public CAUSMBase<CSLAUScheme<Decorator,SLAU2>,Decorator> {
+private:
+  using Base = CAUSMBase<CSLAUScheme<Decorator,SLAU2>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+
+public:
+  /*!
+   * \brief Constructor, forward to base (SLAU supports low dissipation).
+   */
+  template<class... Ts>
+  CSLAUScheme(const CConfig& config, Ts&... args) : Base(config, true, args...) {}
+
+  /*!
+   * \brief Mass and pressure fluxes.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double dissipation,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    const Double sqVel_i = squaredNorm<nDim>(V.i.velocity());
+    const Double sqVel_j = squaredNorm<nDim>(V.j.velocity());
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure() / V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure() / V.j.density();
+    const Double soundSpeed_i = sqrt(abs(gamma*(gamma-1)*(energy_i - 0.5*sqVel_i)));
+    const Double soundSpeed_j = sqrt(abs(gamma*(gamma-1)*(energy_j - 0.5*sqVel_j)));
+
+    /*--- Interface speed of sound (aF), and left/right Mach number. ---*/
+
+    const Double aF = 0.5 * (soundSpeed_i + soundSpeed_j);
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    /*--- Smooth function of the local Mach number. ---*/
+
+    const Double velMag = sqrt(0.5*(sqVel_i + sqVel_j));
+    const Double machTilde = min(1.0, velMag / aF);
+    const Double chi = pow(1-machTilde, 2);
+    const Double f_rho = -max(min(mL, 0.0), -1.0) * min(max(mR, 0.0), 1.0);
+
+    /*--- Mean normal velocity with density weighting. ---*/
+
+    const Double VnMag = (V.i.density()*abs(projVel_i) + V.j.density()*abs(projVel_j)) /
+                         (V.i.density() + V.j.density());
+    const Double VnMagL = (1-f_rho)*VnMag + f_rho*abs(projVel_i);
+    const Double VnMagR = (1-f_rho)*VnMag + f_rho*abs(projVel_j);
+
+    /*--- Mass flux function. ---*/
+
+    mdot = 0.5 * (V.i.density()*(projVel_i+VnMagL) + V.j.density()*(projVel_j-VnMagR) -
+                  (chi/aF)*(V.j.pressure()-V.i.pressure()));
+
+    /*--- Pressure function. ---*/
+
+    const Double subL = (abs(mL) < 1.0);
+    const Double subR = (abs(mR) < 1.0);
+    const Double betaL = subL * 0.25*(2-mL)*pow(mL+1, 2) + (1-subL) * (mL >= 0.0);
+    const Double betaR = subR * 0.25*(2+mR)*pow(mR-1, 2) + (1-subR) * (mR < 0.0);
+
+    pressure = 0.5*(V.i.pressure()+V.j.pressure()) + 0.5*(betaL-betaR)*(V.i.pressure()-V.j.pressure());
+
+    if (!SLAU2) pressure += dissipation*(1-chi)*(betaL+betaR-1)*0.5*(V.i.pressure()+V.j.pressure());
+    else pressure += dissipation*velMag*(betaL+betaR-1)*aF*0.5*(V.i.density()+V.j.density());
+  }
+};
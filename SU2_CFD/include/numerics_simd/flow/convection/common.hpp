@@ -409,3 +409,139 @@ FORCEINLINE void scalarDissipationJacobian(const VariableType& V,
     jac(nVar-1,0) += dissipConst * pow(V.velocity(iDim), 2);
   }
 }
+
+/*!
+ * \brief Convective projected (onto normal) flux (incompressible flow).
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE VectorDbl<nDim+2> inviscidIncProjFlux(Double density,
+                                                  const RandomAccessIterator& velocity,
+                                                  Double pressure,
+                                                  Double enthalpy,
+                                                  const VectorDbl<nDim>& normal) {
+  Double mdot = density * dot(velocity, normal);
+  VectorDbl<nDim+2> flux;
+  flux(0) = mdot;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    flux(iDim+1) = mdot*velocity[iDim] + normal(iDim)*pressure;
+  }
+  flux(nDim+1) = mdot*enthalpy;
+  return flux;
+}
+
+/*!
+ * \brief Jacobian of the convective flux w.r.t. primitive variables (incompressible flow).
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE MatrixDbl<nDim+2> inviscidIncProjJac(Double density, const RandomAccessIterator& velocity,
+                                                 Double beta2, Double cp, Double temperature, Double dRhodT,
+                                                 const VectorDbl<nDim>& normal, Double scale) {
+  MatrixDbl<nDim+2> jac;
+
+  const Double projVel = dot(velocity, normal);
+  const Double enthalpy = cp*temperature;
+
+  jac(0,0) = scale * projVel / beta2;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(0,iDim+1) = scale * normal(iDim) * density;
+  }
+  jac(0,nDim+1) = scale * dRhodT * projVel;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(iDim+1,0) = scale * (normal(iDim) + velocity[iDim]*projVel/beta2);
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      jac(iDim+1,jDim+1) = scale * normal(jDim) * density * velocity[iDim];
+    }
+    jac(iDim+1,iDim+1) += scale * density * projVel;
+    jac(iDim+1,nDim+1) = scale * dRhodT * velocity[iDim] * projVel;
+  }
+
+  jac(nDim+1,0) = scale * enthalpy * projVel / beta2;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(nDim+1,iDim+1) = scale * enthalpy * normal(iDim) * density;
+  }
+  jac(nDim+1,nDim+1) = scale * cp * (temperature*dRhodT + density) * projVel;
+
+  return jac;
+}
+
+/*!
+ * \brief Compute and return the preconditioning matrix (incompressible flow),
+ * i.e. the Jacobian of the conservative variables w.r.t. the primitives.
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE MatrixDbl<nDim+2> incPreconditioner(Double density, const RandomAccessIterator& velocity,
+                                                Double beta2, Double cp, Double temperature, Double dRhodT) {
+  MatrixDbl<nDim+2> precon;
+
+  precon(0,0) = 1 / beta2;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    precon(iDim+1,0) = velocity[iDim] / beta2;
+  }
+  precon(nDim+1,0) = cp * temperature / beta2;
+
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    precon(0,jDim+1) = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      precon(iDim+1,jDim+1) = 0.0;
+    }
+    precon(jDim+1,jDim+1) = density;
+    precon(nDim+1,jDim+1) = 0.0;
+  }
+
+  precon(0,nDim+1) = dRhodT;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    precon(iDim+1,nDim+1) = velocity[iDim] * dRhodT;
+  }
+  precon(nDim+1,nDim+1) = cp * (dRhodT*temperature + density);
+
+  return precon;
+}
+
+/*!
+ * \brief Correct the incompressible flux and Jacobians for grid motion.
+ */
+template<class PrimVarType, size_t nVar>
+FORCEINLINE void incGridMotionFlux(Double projGridVel,
+                                   const CPair<PrimVarType>& V,
+                                   bool implicit,
+                                   VectorDbl<nVar>& flux,
+                                   MatrixDbl<nVar>& jac_i,
+                                   MatrixDbl<nVar>& jac_j) {
+  constexpr size_t nDim = PrimVarType::nDim;
+  const Double halfVel = 0.5 * projGridVel;
+
+  flux(0) -= halfVel * (V.i.density() + V.j.density());
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    flux(iDim+1) -= halfVel * (V.i.density()*V.i.velocity(iDim) + V.j.density()*V.j.velocity(iDim));
+  }
+  flux(nDim+1) -= halfVel * (V.i.density()*V.i.cp()*V.i.temperature() +
+                             V.j.density()*V.j.cp()*V.j.temperature());
+  if (!implicit) return;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac_i(iDim+1,iDim+1) -= halfVel * V.i.density();
+    jac_j(iDim+1,iDim+1) -= halfVel * V.j.density();
+  }
+  jac_i(nDim+1,nDim+1) -= halfVel * V.i.density() * V.i.cp();
+  jac_j(nDim+1,nDim+1) -= halfVel * V.j.density() * V.j.cp();
+}
+
+/*!
+ * \brief Remove the contributions of the energy equation (incompressible flow without heat transfer).
+ */
+template<size_t nVar>
+FORCEINLINE void removeEnergyTerms(bool implicit,
+                                   VectorDbl<nVar>& flux,
+                                   MatrixDbl<nVar>& jac_i,
+                                   MatrixDbl<nVar>& jac_j) {
+  flux(nVar-1) = 0.0;
+  if (!implicit) return;
+
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    jac_i(iVar,nVar-1) = 0.0;
+    jac_j(iVar,nVar-1) = 0.0;
+    jac_i(nVar-1,iVar) = 0.0;
+    jac_j(nVar-1,iVar) = 0.0;
+  }
+}
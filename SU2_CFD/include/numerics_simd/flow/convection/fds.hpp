@@ -0,0 +1,262 @@
+/*!
+ * \file fds.hpp
+ * \brief Flux difference splitting convective scheme (incompressible flow).
+ * \author P. Gomes, T. Economon
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CIncEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CFDSIncScheme
+ * \brief Flux difference splitting scheme for the artificial compressibility
+ * (preconditioned) incompressible equations, vectorized version of CUpwFDSInc_Flow.
+ * \note The system is in terms of primitive variables (p, v, T). See CRoeBase for
+ * the role of Decorator.
+ */
+template<class Decorator>
+class CFDSIncScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  static constexpr size_t nVar = nDim+2;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nDim+8);
+
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const bool variableDensity;
+  const bool energy;
+  const ENUM_LIMITER typeLimiter;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CFDSIncScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    variableDensity(config.GetKind_DensityModel() == INC_DENSITYMODEL::VARIABLE),
+    energy(config.GetEnergy_Equation()),
+    typeLimiter(static_cast<ENUM_LIMITER>(config.GetKind_SlopeLimit_Flow())) {
+  }
+
+  /*!
+   * \brief Implementation of the FDS flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix,
+                   const CSysVector<su2double>* direction) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CIncEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives, the specific heat is not reconstructed. ---*/
+
+    CPair<CIncompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto VRecon = reconstructPrimitives<CIncompressiblePrimitives<nDim,nPrimVarGrad> >(
+                      iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    auto V = V1st;
+    for (size_t iVar = 0; iVar < nPrimVarGrad; ++iVar) {
+      V.i.all(iVar) = VRecon.i.all(iVar);
+      V.j.all(iVar) = VRecon.j.all(iVar);
+    }
+
+    /*--- Fall back to first order if the reconstruction gives non-physical
+     *    temperature or density (pressure is the dynamic pressure). ---*/
+
+    if (muscl && energy) {
+      const Double badRecon_i = max(V.i.temperature() < 0.0, V.i.density() < 0.0);
+      const Double badRecon_j = max(V.j.temperature() < 0.0, V.j.density() < 0.0);
+      for (size_t iVar = 0; iVar < nPrimVarGrad; ++iVar) {
+        V.i.all(iVar) += badRecon_i * (V1st.i.all(iVar) - V.i.all(iVar));
+        V.j.all(iVar) += badRecon_j * (V1st.j.all(iVar) - V.j.all(iVar));
+      }
+    }
+
+    /*--- Mean variables, the preconditioner is built with arithmetic averages. ---*/
+
+    CIncompressiblePrimitives<nDim,nPrimVar> avgV;
+    for (size_t iVar = 0; iVar < nPrimVar; ++iVar) {
+      avgV.all(iVar) = 0.5 * (V.i.all(iVar) + V.j.all(iVar));
+    }
+
+    /*--- Derivative of the equation of state (ideal gas law for variable density). ---*/
+
+    Double dRhodT = 0.0, dRhodT_i = 0.0, dRhodT_j = 0.0;
+    if (variableDensity) {
+      dRhodT = -avgV.density() / avgV.temperature();
+      dRhodT_i = -V.i.density() / V.i.temperature();
+      dRhodT_j = -V.j.density() / V.j.temperature();
+    }
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), normal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+    }
+    const Double projVel = dot(avgV.velocity(), normal) - projGridVel;
+
+    /*--- Eigenvalues of the preconditioned system (artificial speed of sound). ---*/
+
+    const Double soundSpeed = sqrt(avgV.beta2()) * area;
+    const Double lambdaVel = abs(projVel);
+    const Double lambdaMinus = abs(projVel - soundSpeed);
+    const Double lambdaPlus = abs(projVel + soundSpeed);
+
+    /*--- Absolute value of the preconditioned Jacobian, |A_precon| = P x |Lambda| x inv(P). ---*/
+
+    MatrixDbl<nVar> absJac;
+    const Double sqrtBeta = sqrt(avgV.beta2());
+    const Double sumLambda = lambdaMinus + lambdaPlus;
+    const Double difLambda = lambdaPlus - lambdaMinus;
+
+    absJac(0,0) = 0.5 * sumLambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      absJac(iDim+1,0) = unitNormal(iDim) * difLambda / (2*sqrtBeta*avgV.density());
+      absJac(0,iDim+1) = 0.5 * sqrtBeta * unitNormal(iDim) * avgV.density() * difLambda;
+
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        absJac(iDim+1,jDim+1) = 0.5 * unitNormal(iDim) * unitNormal(jDim) * (sumLambda - 2*lambdaVel);
+      }
+      /*--- Diagonal, kept consistent with CNumerics::GetPreconditionedProjJac. ---*/
+      absJac(iDim+1,iDim+1) = 0.5 * sumLambda * pow(unitNormal(iDim),2);
+      for (size_t kDim = 0; kDim < nDim; ++kDim) {
+        if (kDim != iDim) absJac(iDim+1,iDim+1) += 2 * lambdaVel * pow(unitNormal(kDim),2);
+      }
+      absJac(iDim+1,nDim+1) = 0.0;
+      absJac(nDim+1,iDim+1) = 0.0;
+    }
+    absJac(nDim+1,0) = 0.0;
+    absJac(0,nDim+1) = 0.0;
+    absJac(nDim+1,nDim+1) = lambdaVel;
+
+    const auto precon = incPreconditioner<nDim>(avgV.density(), avgV.velocity(), avgV.beta2(),
+                                                avgV.cp(), avgV.temperature(), dRhodT);
+
+    /*--- Inviscid fluxes and Jacobians. ---*/
+
+    auto flux_i = inviscidIncProjFlux(V.i.density(), V.i.velocity(), V.i.pressure(),
+                                      V.i.cp()*V.i.temperature(), normal);
+    auto flux_j = inviscidIncProjFlux(V.j.density(), V.j.velocity(), V.j.pressure(),
+                                      V.j.cp()*V.j.temperature(), normal);
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = 0.5 * (flux_i(iVar) + flux_j(iVar));
+    }
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      jac_i = inviscidIncProjJac(V.i.density(), V.i.velocity(), V.i.beta2(), V.i.cp(),
+                                 V.i.temperature(), dRhodT_i, normal, 0.5);
+      jac_j = inviscidIncProjJac(V.j.density(), V.j.velocity(), V.j.beta2(), V.j.cp(),
+                                 V.j.temperature(), dRhodT_j, normal, 0.5);
+    }
+
+    /*--- Dissipation, Precon x |A_precon| x dV. ---*/
+
+    VectorDbl<nVar> diffV;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      diffV(iVar) = V.j.all(iVar) - V.i.all(iVar);
+    }
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double dissip = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          dissip += precon(iVar,kVar) * absJac(kVar,jVar);
+        }
+        dissip *= 0.5;
+        flux(iVar) -= dissip * diffV(jVar);
+        if (implicit) {
+          jac_i(iVar,jVar) += dissip;
+          jac_j(iVar,jVar) -= dissip;
+        }
+      }
+    }
+
+    /*--- Correct for grid motion. ---*/
+
+    if (dynamicGrid) {
+      incGridMotionFlux(projGridVel, V, implicit, flux, jac_i, jac_j);
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    if (!energy) removeEnergyTerms(implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix, direction);
+  }
+};
@@ -0,0 +1,336 @@
+/*!
+ * \file hllc.hpp
+ * \brief HLLC convective scheme.
+ * \author P. Gomes, G. Gori, A. Guardone
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CHLLCScheme
+ * \brief HLLC scheme (ideal gas), vectorized version of CUpwHLLC_Flow.
+ * \note The four regions of the Riemann fan are handled with masks. The side
+ * of the contact surface (upwind side, "k") is selected first, this way only
+ * one star state needs to be computed. See CRoeBase for the role of Decorator.
+ */
+template<class Decorator>
+class CHLLCScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double kappa;
+  const su2double gamma;
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const ENUM_LIMITER typeLimiter;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CHLLCScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    kappa(config.GetRoe_Kappa()),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(static_cast<ENUM_LIMITER>(config.GetKind_SlopeLimit_Flow())) {
+  }
+
+  /*!
+   * \brief Implementation of the HLLC flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix,
+                   const CSysVector<su2double>* direction) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Speed of sound and projected velocity (relative to the grid). ---*/
+
+    const Double sqVel_i = squaredNorm<nDim>(V.i.velocity());
+    const Double sqVel_j = squaredNorm<nDim>(V.j.velocity());
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure() / V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure() / V.j.density();
+
+    Double soundSpeed_i = sqrt((V.i.enthalpy() - 0.5*sqVel_i) * (gamma-1));
+    Double soundSpeed_j = sqrt((V.j.enthalpy() - 0.5*sqVel_j) * (gamma-1));
+
+    Double projVel_i = dot(V.i.velocity(), unitNormal);
+    Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+      soundSpeed_i -= projGridVel;
+      soundSpeed_j += projGridVel;
+      projVel_i -= projGridVel;
+      projVel_j -= projGridVel;
+    }
+
+    /*--- Roe's averaging. ---*/
+
+    const Double sqrtRho_i = sqrt(V.i.density());
+    const Double sqrtRho_j = sqrt(V.j.density());
+    const Double Rrho = sqrtRho_i + sqrtRho_j;
+
+    Double sqVelRoe = 0.0, roeProjVel = -projGridVel;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      const Double roeVel = (V.i.velocity(iDim)*sqrtRho_i + V.j.velocity(iDim)*sqrtRho_j) / Rrho;
+      sqVelRoe += roeVel * roeVel;
+      roeProjVel += roeVel * unitNormal(iDim);
+    }
+    const Double roeEnthalpy = (sqrtRho_j*V.j.enthalpy() + sqrtRho_i*V.i.enthalpy()) / Rrho;
+    const Double roeSoundSpeed = sqrt((gamma-1) * (roeEnthalpy - 0.5*sqVelRoe)) - projGridVel;
+
+    /*--- Wave speeds, speed of the contact surface, and star pressure. ---*/
+
+    const Double sL = min(roeProjVel - roeSoundSpeed, projVel_i - soundSpeed_i);
+    const Double sR = max(roeProjVel + roeSoundSpeed, projVel_j + soundSpeed_j);
+
+    const Double RHO = V.j.density()*(sR-projVel_j) - V.i.density()*(sL-projVel_i);
+    const Double sM = (V.i.pressure() - V.j.pressure() - V.i.density()*projVel_i*(sL-projVel_i) +
+                       V.j.density()*projVel_j*(sR-projVel_j)) / RHO;
+
+    const Double pStar = V.j.density()*(projVel_j-sR)*(projVel_j-sM) + V.j.pressure();
+
+    /*--- Select the side of the contact surface (1 for i, 0 for j),
+     *    and whether the whole fan is on the other side (supersonic). ---*/
+
+    const Double left = (sM > 0.0);
+    const Double supersonic = left * (sL > 0.0) + (1-left) * (sR < 0.0);
+
+    auto upwind = [&left](const Double& a_i, const Double& a_j) -> Double {
+      return left*a_i + (1-left)*a_j;
+    };
+
+    const Double rho_k = upwind(V.i.density(), V.j.density());
+    const Double pres_k = upwind(V.i.pressure(), V.j.pressure());
+    const Double enth_k = upwind(V.i.enthalpy(), V.j.enthalpy());
+    const Double energy_k = upwind(energy_i, energy_j);
+    const Double projVel_k = upwind(projVel_i, projVel_j);
+    const Double sqVel_k = upwind(sqVel_i, sqVel_j);
+    const Double s_k = upwind(sL, sR);
+    VectorDbl<nDim> vel_k;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      vel_k(iDim) = upwind(V.i.velocity(iDim), V.j.velocity(iDim));
+    }
+
+    /*--- Star state on the upwind side of the contact. ---*/
+
+    const Double omega = 1 / (s_k - sM);
+    const Double rhoStar = omega * (s_k - projVel_k);
+    const Double oneOnDeltaS = 1 / (s_k - projVel_k);
+
+    VectorDbl<nVar> UStar;
+    UStar(0) = rhoStar * rho_k;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      UStar(iDim+1) = rhoStar * (rho_k*vel_k(iDim) + (pStar-pres_k)*oneOnDeltaS*unitNormal(iDim));
+    }
+    UStar(nDim+1) = rhoStar * (rho_k*energy_k - (pres_k*projVel_k - pStar*sM)*oneOnDeltaS);
+
+    /*--- Flux, from the upwind state if supersonic otherwise from the star state. ---*/
+
+    VectorDbl<nVar> flux;
+    flux(0) = supersonic * rho_k*projVel_k + (1-supersonic) * sM*UStar(0);
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = supersonic * (rho_k*vel_k(iDim)*projVel_k + pres_k*unitNormal(iDim)) +
+                     (1-supersonic) * (sM*UStar(iDim+1) + pStar*unitNormal(iDim));
+    }
+    flux(nDim+1) = supersonic * enth_k*rho_k*projVel_k +
+                   (1-supersonic) * (sM*(UStar(nDim+1)+pStar) + pStar*projGridVel);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) *= area;
+    }
+
+    /*--- Jacobians. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+
+      /*--- Derivatives of sM w.r.t. U_i and U_j. ---*/
+
+      VectorDbl<nVar> dSm_dUi, dSm_dUj;
+      dSm_dUi(0) = (-projVel_i*projVel_i + sM*sL + 0.5*(gamma-1)*sqVel_i) / RHO;
+      dSm_dUj(0) = (projVel_j*projVel_j - sM*sR - 0.5*(gamma-1)*sqVel_j) / RHO;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        dSm_dUi(iDim+1) = (unitNormal(iDim)*(2*projVel_i-sL-sM) - (gamma-1)*V.i.velocity(iDim)) / RHO;
+        dSm_dUj(iDim+1) = -(unitNormal(iDim)*(2*projVel_j-sR-sM) - (gamma-1)*V.j.velocity(iDim)) / RHO;
+      }
+      dSm_dUi(nDim+1) = (gamma-1) / RHO;
+      dSm_dUj(nDim+1) = -(gamma-1) / RHO;
+
+      /*--- Same (approximate) derivatives of pStar as CUpwHLLC_Flow, for the upwind
+       *    (k) and the opposite (o) side, pStar derivative = factor * dSm_dU. ---*/
+
+      const Double dpStarFactor_k = upwind(V.i.density()*(sR-projVel_j), V.j.density()*(sL-projVel_i));
+      const Double dpStarFactor_o = upwind(V.j.density()*(sL-projVel_i), V.i.density()*(sR-projVel_j));
+
+      const Double omegaSM = omega * sM;
+      const Double EpStar = UStar(nDim+1) + pStar;
+
+      /*--- Pressure derivatives on the upwind side. ---*/
+
+      VectorDbl<nVar> dPI_dU;
+      dPI_dU(0) = 0.5*(gamma-1)*sqVel_k;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        dPI_dU(iDim+1) = -(gamma-1)*vel_k(iDim);
+      }
+      dPI_dU(nDim+1) = gamma-1;
+
+      MatrixDbl<nVar> jac_k, jac_o;
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+
+        /*--- Upwind side. ---*/
+
+        const Double dSm_k = upwind(dSm_dUi(iVar), dSm_dUj(iVar));
+        const Double dpStar_k = dpStarFactor_k * dSm_k;
+
+        Double drhoStar = omega * UStar(0) * dSm_k;
+        Double dEStar = omega * (sM*dpStar_k + EpStar*dSm_k);
+        if (iVar == 0) {
+          drhoStar += omega * s_k;
+          dEStar += omega * projVel_k * (enth_k - dPI_dU(0));
+        }
+        else if (iVar == nVar-1) {
+          dEStar += omega * (s_k - projVel_k - projVel_k*dPI_dU(iVar));
+        }
+        else {
+          drhoStar -= omega * unitNormal(iVar-1);
+          dEStar += omega * (-unitNormal(iVar-1)*enth_k - projVel_k*dPI_dU(iVar));
+        }
+
+        jac_k(0,iVar) = sM*drhoStar + UStar(0)*dSm_k;
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          jac_k(iDim+1,iVar) = (omegaSM+1) * (unitNormal(iDim)*dpStar_k + UStar(iDim+1)*dSm_k) -
+                               omegaSM * dPI_dU(iVar) * unitNormal(iDim);
+        }
+        jac_k(nDim+1,iVar) = sM*(dEStar+dpStar_k) + EpStar*dSm_k;
+
+        /*--- Opposite side. ---*/
+
+        const Double dSm_o = upwind(dSm_dUj(iVar), dSm_dUi(iVar));
+        const Double dpStar_o = dpStarFactor_o * dSm_o;
+        const Double dEStar_o = omega * (sM*dpStar_o + EpStar*dSm_o);
+
+        jac_o(0,iVar) = UStar(0) * (omegaSM+1) * dSm_o;
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          jac_o(iDim+1,iVar) = (omegaSM+1) * (UStar(iDim+1)*dSm_o + unitNormal(iDim)*dpStar_o);
+        }
+        jac_o(nDim+1,iVar) = sM*(dEStar_o+dpStar_o) + EpStar*dSm_o;
+      }
+
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        jac_k(jDim+1,0) += omegaSM * vel_k(jDim) * projVel_k;
+        jac_k(jDim+1,jDim+1) += omegaSM * (s_k - projVel_k);
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          jac_k(jDim+1,iDim+1) -= omegaSM * vel_k(jDim) * unitNormal(iDim);
+        }
+      }
+
+      /*--- Supersonic, physical Jacobian on the upwind side and zero on the other. ---*/
+
+      const auto jacSup = inviscidProjJac(gamma, vel_k, energy_k, unitNormal, 1.0);
+
+      /*--- Jacobians of the inviscid flux, scale = kappa, like CUpwHLLC_Flow. ---*/
+
+      const Double scale = kappa * area;
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          const Double jk = supersonic*jacSup(iVar,jVar) + (1-supersonic)*jac_k(iVar,jVar);
+          const Double jo = (1-supersonic)*jac_o(iVar,jVar);
+          jac_i(iVar,jVar) = scale * upwind(jk, jo);
+          jac_j(iVar,jVar) = scale * upwind(jo, jk);
+        }
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix, direction);
+  }
+};
@@ -86,7 +86,8 @@ public:
                    UpdateType updateType,
                    Double updateMask,
                    CSysVector<su2double>& vector,
-                   SparseMatrixType& matrix) const final {
+                   SparseMatrixType& matrix,
+                   const CSysVector<su2double>* direction) const final {
 
     /*--- Start preaccumulation, inputs are registered
      *    automatically in "gatherVariables". ---*/
@@ -209,7 +210,7 @@ public:
     /*--- Update the vector and system matrix. ---*/
 
     updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
-                       updateMask, flux, jac_i, jac_j, vector, matrix);
+                       updateMask, flux, jac_i, jac_j, vector, matrix, direction);
   }
 };
 
@@ -0,0 +1,251 @@
+/*!
+ * \file common.hpp
+ * \brief Common convection and diffusion machinery of the turbulence models.
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../flow/variables.hpp"
+#include "../../variables/CTurbVariable.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CTurbSchemeBase
+ * \brief Base class for the turbulence models, computes the scalar upwind convection
+ * (vectorized CUpwScalar) and the averaged-gradient diffusion (vectorized CAvgGrad_Scalar)
+ * in a single edge loop. Derived classes define the convected quantity and the diffusion
+ * coefficients in a const "diffusionTerms" method, and the sources in "ComputeSource".
+ * \note The flow variables are stored on construction, the interface only passes the
+ * turbulence variables. FlowPrimitives (compressible or incompressible) is used to
+ * access the primitives by name, FlowVariable is the corresponding CVariable type.
+ */
+template<class Derived, size_t NDIM, size_t NVAR, class FlowPrimitives, class FlowVariable>
+class CTurbSchemeBase : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nVar = NVAR;
+  static constexpr size_t nPrimVar = FlowPrimitives::nVar;
+  /*--- Velocity and density are the only reconstructed flow variables. ---*/
+  static constexpr size_t nPrimVarRecon = nDim+3;
+
+  const bool implicit;
+  const bool dynamicGrid;
+  const bool muscl;
+  const bool musclFlow;
+  const bool limiter;
+  const bool limiterFlow;
+  const FlowVariable& flowVars;
+
+  /*!
+   * \brief Constructor, store some constants.
+   */
+  CTurbSchemeBase(const CConfig& config, unsigned iMesh, const CVariable* flowVars_) :
+    implicit(config.GetKind_TimeIntScheme_Turb() == EULER_IMPLICIT),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(config.GetMUSCL_Turb() && (iMesh == MESH_0)),
+    musclFlow(muscl && config.GetMUSCL_Flow() && (config.GetKind_ConvNumScheme_Flow() == SPACE_UPWIND)),
+    limiter(config.GetKind_SlopeLimit_Turb() != NO_LIMITER),
+    /*--- Only cell-based flow limiters are used, edge-based would need to be recomputed. ---*/
+    limiterFlow((config.GetKind_SlopeLimit_Flow() != NO_LIMITER) &&
+                (config.GetKind_SlopeLimit_Flow() != VAN_ALBADA_EDGE)),
+    flowVars(*static_cast<const FlowVariable*>(flowVars_)) {
+  }
+
+private:
+  /*!
+   * \brief MUSCL reconstruction of the i/j values of a set of variables, optionally point-limited.
+   */
+  template<size_t N, class Gradient_t, class Limiter_t>
+  FORCEINLINE static void reconstruct(Int iPoint, Int jPoint, bool limited,
+                                      const VectorDbl<nDim>& vector_ij, const Gradient_t& gradients,
+                                      const Limiter_t& limiters, CPair<VectorDbl<N> >& V) {
+    /*--- Flat indexing of the gradients, see ComputeFlux. ---*/
+    const auto grad_i = gatherVariables<N,nDim>(iPoint, gradients);
+    const auto grad_j = gatherVariables<N,nDim>(jPoint, gradients);
+
+    VectorDbl<N> lim_i, lim_j;
+    if (limited) {
+      lim_i = gatherVariables<N>(iPoint, limiters);
+      lim_j = gatherVariables<N>(jPoint, limiters);
+    }
+    for (size_t iVar = 0; iVar < N; ++iVar) {
+      Double proj_i = 0.5 * dot<nDim>(grad_i.data() + iVar*nDim, vector_ij);
+      Double proj_j = 0.5 * dot<nDim>(grad_j.data() + iVar*nDim, vector_ij);
+      if (limited) {
+        proj_i *= lim_i(iVar);
+        proj_j *= lim_j(iVar);
+      }
+      V.i(iVar) += proj_i;
+      V.j(iVar) -= proj_j;
+    }
+  }
+
+public:
+  /*!
+   * \brief Implementation of the edge flux (convection minus diffusion).
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix,
+                   const CSysVector<su2double>* direction) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const auto& solution = static_cast<const CTurbVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+
+    /*--- Flow primitives and turbulence variables. ---*/
+
+    CPair<FlowPrimitives> V;
+    V.i.all = gatherVariables<nPrimVar>(iPoint, flowVars.GetPrimitive());
+    V.j.all = gatherVariables<nPrimVar>(jPoint, flowVars.GetPrimitive());
+
+    CPair<VectorDbl<nVar> > T;
+    T.i = gatherVariables<nVar>(iPoint, solution.GetSolution());
+    T.j = gatherVariables<nVar>(jPoint, solution.GetSolution());
+
+    /*--- Reconstruction of the convective quantities. ---*/
+
+    CPair<VectorDbl<nPrimVarRecon> > VRecon;
+    for (size_t iVar = 0; iVar < nPrimVarRecon; ++iVar) {
+      VRecon.i(iVar) = V.i.all(iVar);
+      VRecon.j(iVar) = V.j.all(iVar);
+    }
+    auto TRecon = T;
+
+    if (musclFlow) {
+      reconstruct(iPoint, jPoint, limiterFlow, vector_ij, flowVars.GetGradient_Reconstruction(),
+                  flowVars.GetLimiter_Primitive(), VRecon);
+    }
+    if (muscl) {
+      reconstruct(iPoint, jPoint, limiter, vector_ij, solution.GetGradient_Reconstruction(),
+                  solution.GetLimiter(), TRecon);
+    }
+
+    /*--- Scalar upwind convection. ---*/
+
+    Double projVel = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      projVel += 0.5 * (VRecon.i(iDim+1) + VRecon.j(iDim+1)) * normal(iDim);
+    }
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projVel -= 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), normal)+
+                      dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+    }
+    const Double a0 = 0.5 * (projVel + abs(projVel));
+    const Double a1 = 0.5 * (projVel - abs(projVel));
+
+    /*--- The convected quantity is rho*var for models in conservative form. ---*/
+    Double scale_i = 1.0, scale_j = 1.0;
+    if (Derived::conservative) {
+      scale_i = VRecon.i(nDim+2);
+      scale_j = VRecon.j(nDim+2);
+    }
+
+    /*--- Blocks and gradients are accessed with flat (row-major) indices because
+     *    they degenerate into vectors for one-equation models. ---*/
+
+    VectorDbl<nVar> flux;
+    MatrixDbl<nVar> jac_i, jac_j;
+    for (size_t k = 0; k < nVar*nVar; ++k) {
+      jac_i.data()[k] = 0.0;
+      jac_j.data()[k] = 0.0;
+    }
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = a0*scale_i*TRecon.i(iVar) + a1*scale_j*TRecon.j(iVar);
+      jac_i.data()[iVar*(nVar+1)] = a0;
+      jac_j.data()[iVar*(nVar+1)] = a1;
+    }
+
+    /*--- Mean gradient normal to the face, corrected to avoid odd-even decoupling. ---*/
+
+    const Double projVec_ij = dot(vector_ij, normal) / max(squaredNorm(vector_ij), EPS);
+
+    const auto grad_i = gatherVariables<nVar,nDim>(iPoint, solution.GetGradient());
+    const auto grad_j = gatherVariables<nVar,nDim>(jPoint, solution.GetGradient());
+
+    VectorDbl<nVar> projNormal, projCorrected;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      projNormal(iVar) = 0.0;
+      Double edgeProj = 0.0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        const Double meanGrad = 0.5 * (grad_i.data()[iVar*nDim+iDim] + grad_j.data()[iVar*nDim+iDim]);
+        projNormal(iVar) += meanGrad * normal(iDim);
+        edgeProj += meanGrad * vector_ij(iDim);
+      }
+      projCorrected(iVar) = projNormal(iVar) - (edgeProj - (T.j(iVar) - T.i(iVar))) * projVec_ij;
+    }
+
+    /*--- Subtract the diffusion flux (model specific). ---*/
+
+    static_cast<const Derived&>(*this).diffusionTerms(iPoint, jPoint, V, T, projNormal, projCorrected,
+                                                      projVec_ij, solution, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix, direction);
+  }
+};
+
+/*!
+ * \brief Subtract the source residual and Jacobian of some points from the linear system.
+ */
+template<size_t nVar>
+FORCEINLINE void subtractSource(Int iPoint,
+                                bool implicit,
+                                Double updateMask,
+                                const VectorDbl<nVar>& residual,
+                                const MatrixDbl<nVar>& jacobian,
+                                CSysVector<su2double>& vector,
+                                SparseMatrixType& matrix) {
+  vector.AddBlock(iPoint, residual, -updateMask);
+  if (implicit) {
+    auto wasActive = AD::BeginPassive();
+    matrix.AddBlock2Diag(iPoint, jacobian, -updateMask);
+    AD::EndPassive(wasActive);
+  }
+}
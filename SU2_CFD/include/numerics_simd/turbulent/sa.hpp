@@ -0,0 +1,208 @@
+/*!
+ * \file sa.hpp
+ * \brief Spalart-Allmaras turbulence model (convection, diffusion, and sources).
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common.hpp"
+
+/*!
+ * \class CTurbSAScheme
+ * \brief Vectorized version of CUpwSca_TurbSA, CAvgGrad_TurbSA(_Neg), and CSourcePieceWise_TurbSA.
+ * \note The diffusion is valid for all variants of the model, NEGATIVE selects the
+ * modified diffusion coefficient of SA-neg. The source is that of the standard model.
+ */
+template<size_t NDIM, class FlowPrimitives, class FlowVariable, bool NEGATIVE>
+class CTurbSAScheme : public CTurbSchemeBase<CTurbSAScheme<NDIM,FlowPrimitives,FlowVariable,NEGATIVE>,
+                                             NDIM, 1, FlowPrimitives, FlowVariable> {
+private:
+  using Base = CTurbSchemeBase<CTurbSAScheme, NDIM, 1, FlowPrimitives, FlowVariable>;
+  friend Base;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::nPrimVar;
+  using Base::implicit;
+  using Base::flowVars;
+
+  /*--- The model is solved for nu_tilde. ---*/
+  static constexpr bool conservative = false;
+
+  const bool rotatingFrame;
+
+  /*--- Closure constants. ---*/
+  const su2double sigma = 2.0/3.0;
+  const su2double cn1 = 16.0;
+  const su2double cv1_3 = pow(7.1, 3);
+  const su2double k2 = pow(0.41, 2);
+  const su2double cb1 = 0.1355;
+  const su2double cb2 = 0.622;
+  const su2double cw2 = 0.3;
+  const su2double cw3_6 = pow(2.0, 6);
+  const su2double cr1 = 0.5;
+  const su2double cw1 = cb1/k2 + (1.0+cb2)/sigma;
+
+  /*!
+   * \brief Subtract the diffusion flux from the convective flux.
+   */
+  template<class PrimPair, class VarPair>
+  FORCEINLINE void diffusionTerms(Int, Int, const PrimPair& V, const VarPair& T,
+                                  const VectorDbl<nVar>& projNormal,
+                                  const VectorDbl<nVar>& projCorrected,
+                                  Double projVec_ij, const CTurbVariable&,
+                                  VectorDbl<nVar>& flux, MatrixDbl<nVar>& jac_i,
+                                  MatrixDbl<nVar>& jac_j) const {
+
+    const Double nu_ij = 0.5*(V.i.laminarVisc()/V.i.density() + V.j.laminarVisc()/V.j.density());
+    const Double nuTilde_ij = 0.5*(T.i(0) + T.j(0));
+
+    Double nu_e = nu_ij + nuTilde_ij;
+    Double projGrad = projCorrected(0);
+
+    if (NEGATIVE) {
+      /*--- Blend the diffusion coefficient where nu_tilde is negative. ---*/
+      const Double Xi_3 = pow(nuTilde_ij/nu_ij, 3);
+      const Double fn = (cn1 + Xi_3) / (cn1 - Xi_3);
+      const Double positive = nuTilde_ij > 0.0;
+      nu_e = nu_ij + (positive + (1-positive)*fn) * nuTilde_ij;
+      projGrad = projNormal(0);
+    }
+
+    flux(0) -= nu_e * projGrad / sigma;
+
+    /*--- TSL approximation of the derivatives of the gradients (1x1 blocks). ---*/
+    if (implicit) {
+      jac_i(0) -= (0.5*projCorrected(0) - nu_e*projVec_ij) / sigma;
+      jac_j(0) -= (0.5*projCorrected(0) + nu_e*projVec_ij) / sigma;
+    }
+  }
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  CTurbSAScheme(const CConfig& config, unsigned iMesh, const CVariable* flowVars_) :
+    Base(config, iMesh, flowVars_),
+    rotatingFrame(config.GetRotating_Frame()) {
+  }
+
+  /*!
+   * \brief Source terms of the standard model (production, destruction, and cross-production).
+   * \note Transition, hybrid RANS/LES, and the variants of the model are not supported,
+   * in those cases the solver uses the scalar implementation.
+   */
+  void ComputeSource(Int iPoint,
+                     const CConfig& config,
+                     const CGeometry& geometry,
+                     const CVariable& solution_,
+                     Double updateMask,
+                     CSysVector<su2double>& vector,
+                     SparseMatrixType& matrix) const final {
+
+    AD::StartPreacc();
+
+    const auto& solution = static_cast<const CTurbVariable&>(solution_);
+
+    FlowPrimitives V;
+    V.all = gatherVariables<nPrimVar>(iPoint, flowVars.GetPrimitive());
+    const auto vorticity = gatherVariables<3>(iPoint, flowVars.GetVorticity());
+    const Double strainMag = gatherVariables(iPoint, flowVars.GetStrainMag());
+
+    const Double nuTilde = gatherVariables(iPoint, solution.GetSolution());
+    const auto grad = gatherVariables<1,nDim>(iPoint, solution.GetGradient());
+
+    const Double volume = gatherVariables(iPoint, geometry.nodes->GetVolume());
+    const Double roughness = gatherVariables(iPoint, geometry.nodes->GetRoughnessHeight());
+
+    /*--- Wall roughness is accounted for by shifting the wall distance, d_new = d + 0.03 k_s.
+     *    Points too close to the wall have no source, their distance is clipped to keep the
+     *    computation below well defined. ---*/
+    Double dist = gatherVariables(iPoint, geometry.nodes->GetWall_Distance()) + 0.03*roughness;
+    const Double validDist = dist > 1e-10;
+    dist = max(dist, 1e-10);
+
+    Double omega = sqrt(squaredNorm(vorticity));
+    if (rotatingFrame) omega += 2.0*min(0.0, strainMag-omega);
+
+    /*--- Production. ---*/
+
+    const Double dist_2 = dist * dist;
+    const Double nu = V.laminarVisc() / V.density();
+
+    const Double Ji = nuTilde/nu + cr1*(roughness/(dist+EPS));
+    const Double Ji_2 = Ji * Ji;
+    const Double Ji_3 = Ji_2 * Ji;
+    const Double fv1 = Ji_3 / (Ji_3+cv1_3);
+    const Double fv2 = 1.0 - nuTilde/(nu+nuTilde*fv1);
+
+    const Double inv_k2_d2 = 1.0 / (k2*dist_2);
+
+    Double Shat = omega + nuTilde*fv2*inv_k2_d2;
+    const Double clipShat = Shat <= 1e-10;
+    Shat = max(Shat, 1e-10);
+    const Double inv_Shat = 1.0 / Shat;
+
+    const Double production = cb1*Shat*nuTilde*volume;
+
+    /*--- Destruction. ---*/
+
+    const Double r = min(nuTilde*inv_Shat*inv_k2_d2, 10.0);
+    const Double g = r + cw2*(pow(r,6)-r);
+    const Double g_6 = pow(g,6);
+    const Double glim = pow((1.0+cw3_6)/(g_6+cw3_6), 1.0/6.0);
+    const Double fw = g*glim;
+
+    const Double destruction = cw1*fw*nuTilde*nuTilde/dist_2*volume;
+
+    /*--- Cross production. ---*/
+
+    const Double crossProduction = cb2/sigma*squaredNorm<nDim>(grad.data())*volume;
+
+    VectorDbl<1> residual;
+    residual(0) = validDist * (production - destruction + crossProduction);
+
+    /*--- Implicit part, production and destruction (1x1 block). ---*/
+
+    MatrixDbl<1> jacobian;
+    if (implicit) {
+      const Double dfv1 = 3.0*Ji_2*cv1_3/(nu*pow(Ji_3+cv1_3,2));
+      const Double dfv2 = -(1/nu-Ji_2*dfv1)/pow(1.0+Ji*fv1,2);
+      const Double dShat = (1-clipShat)*(fv2+nuTilde*dfv2)*inv_k2_d2;
+
+      jacobian(0) = cb1*(nuTilde*dShat+Shat)*volume;
+
+      const Double dr = (r < 10.0)*(Shat-nuTilde*dShat)*inv_Shat*inv_Shat*inv_k2_d2;
+      const Double dg = dr*(1.0+cw2*(6.0*pow(r,5)-1.0));
+      const Double dfw = dg*glim*(1.0-g_6/(g_6+cw3_6));
+
+      jacobian(0) -= cw1*(dfw*nuTilde + 2.0*fw)*nuTilde/dist_2*volume;
+      jacobian(0) *= validDist;
+    }
+
+    stopPreacc(residual);
+
+    subtractSource(iPoint, implicit, updateMask, residual, jacobian, vector, matrix);
+  }
+};
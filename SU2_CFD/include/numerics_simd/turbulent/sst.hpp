@@ -0,0 +1,194 @@
+/*!
+ * \file sst.hpp
+ * \brief Menter SST turbulence model (convection, diffusion, and sources).
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common.hpp"
+#include "../../variables/CTurbSSTVariable.hpp"
+
+/*!
+ * \class CTurbSSTScheme
+ * \brief Vectorized version of CUpwSca_TurbSST, CAvgGrad_TurbSST, and CSourcePieceWise_TurbSST.
+ */
+template<size_t NDIM, class FlowPrimitives, class FlowVariable>
+class CTurbSSTScheme : public CTurbSchemeBase<CTurbSSTScheme<NDIM,FlowPrimitives,FlowVariable>,
+                                              NDIM, 2, FlowPrimitives, FlowVariable> {
+private:
+  using Base = CTurbSchemeBase<CTurbSSTScheme, NDIM, 2, FlowPrimitives, FlowVariable>;
+  friend Base;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::nPrimVar;
+  using Base::implicit;
+  using Base::flowVars;
+
+  /*--- The model is solved for rho*k and rho*omega. ---*/
+  static constexpr bool conservative = true;
+
+  const bool sustainingTerms;
+
+  /*--- Closure constants (see CTurbSSTSolver) and ambient values. ---*/
+  const su2double sigma_k1, sigma_k2, sigma_om1, sigma_om2;
+  const su2double beta_1, beta_2, beta_star, a1, alfa_1, alfa_2;
+  const su2double kAmb, omegaAmb;
+
+  /*!
+   * \brief Subtract the diffusion flux from the convective flux.
+   */
+  template<class PrimPair, class VarPair>
+  FORCEINLINE void diffusionTerms(Int iPoint, Int jPoint, const PrimPair& V, const VarPair&,
+                                  const VectorDbl<nVar>&, const VectorDbl<nVar>& projCorrected,
+                                  Double projVec_ij, const CTurbVariable& solution,
+                                  VectorDbl<nVar>& flux, MatrixDbl<nVar>& jac_i,
+                                  MatrixDbl<nVar>& jac_j) const {
+
+    const auto& F1 = static_cast<const CTurbSSTVariable&>(solution).GetF1blending();
+    const Double F1_i = gatherVariables(iPoint, F1);
+    const Double F1_j = gatherVariables(jPoint, F1);
+
+    /*--- Blended constants and mean effective viscosities. ---*/
+
+    const Double sigma_k_i = F1_i*sigma_k1 + (1.0-F1_i)*sigma_k2;
+    const Double sigma_k_j = F1_j*sigma_k1 + (1.0-F1_j)*sigma_k2;
+    const Double sigma_om_i = F1_i*sigma_om1 + (1.0-F1_i)*sigma_om2;
+    const Double sigma_om_j = F1_j*sigma_om1 + (1.0-F1_j)*sigma_om2;
+
+    const Double diff_k = 0.5*(V.i.laminarVisc() + sigma_k_i*V.i.eddyVisc() +
+                               V.j.laminarVisc() + sigma_k_j*V.j.eddyVisc());
+    const Double diff_om = 0.5*(V.i.laminarVisc() + sigma_om_i*V.i.eddyVisc() +
+                                V.j.laminarVisc() + sigma_om_j*V.j.eddyVisc());
+
+    flux(0) -= diff_k * projCorrected(0);
+    flux(1) -= diff_om * projCorrected(1);
+
+    /*--- TSL approximation of the derivatives of the gradients. ---*/
+    if (implicit) {
+      const Double proj_on_rho_i = projVec_ij / V.i.density();
+      const Double proj_on_rho_j = projVec_ij / V.j.density();
+      jac_i(0,0) += diff_k * proj_on_rho_i;
+      jac_i(1,1) += diff_om * proj_on_rho_i;
+      jac_j(0,0) -= diff_k * proj_on_rho_j;
+      jac_j(1,1) -= diff_om * proj_on_rho_j;
+    }
+  }
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  CTurbSSTScheme(const CConfig& config, unsigned iMesh, const CVariable* flowVars_,
+                 const su2double* constants, const su2double* freeStream) :
+    Base(config, iMesh, flowVars_),
+    sustainingTerms(config.GetKind_Turb_Model() == SST_SUST),
+    sigma_k1(constants[0]), sigma_k2(constants[1]),
+    sigma_om1(constants[2]), sigma_om2(constants[3]),
+    beta_1(constants[4]), beta_2(constants[5]), beta_star(constants[6]),
+    a1(constants[7]), alfa_1(constants[8]), alfa_2(constants[9]),
+    kAmb(freeStream[0]), omegaAmb(freeStream[1]) {
+  }
+
+  /*!
+   * \brief Source terms (production, dissipation, and cross diffusion).
+   * \note The axisymmetric and UQ modifications are not supported, in those
+   * cases the solver uses the scalar implementation.
+   */
+  void ComputeSource(Int iPoint,
+                     const CConfig& config,
+                     const CGeometry& geometry,
+                     const CVariable& solution_,
+                     Double updateMask,
+                     CSysVector<su2double>& vector,
+                     SparseMatrixType& matrix) const final {
+
+    AD::StartPreacc();
+
+    const auto& solution = static_cast<const CTurbSSTVariable&>(solution_);
+
+    FlowPrimitives V;
+    V.all = gatherVariables<nPrimVar>(iPoint, flowVars.GetPrimitive());
+    const auto gradV = gatherVariables<nDim+1,nDim>(iPoint, flowVars.GetGradient_Primitive());
+    const auto vorticity = gatherVariables<3>(iPoint, flowVars.GetVorticity());
+    const Double strainMag = gatherVariables(iPoint, flowVars.GetStrainMag());
+
+    const auto T = gatherVariables<nVar>(iPoint, solution.GetSolution());
+    const Double F1 = gatherVariables(iPoint, solution.GetF1blending());
+    const Double F2 = gatherVariables(iPoint, solution.GetF2blending());
+    const Double CDkw = gatherVariables(iPoint, solution.GetCrossDiff());
+
+    const Double volume = gatherVariables(iPoint, geometry.nodes->GetVolume());
+    const Double validDist = gatherVariables(iPoint, geometry.nodes->GetWall_Distance()) > 1e-10;
+
+    const Double& density = V.density();
+    const Double& kine = T(0);
+    const Double& omega = T(1);
+
+    /*--- Blended constants. ---*/
+
+    const Double alfa = F1*alfa_1 + (1.0-F1)*alfa_2;
+    const Double beta = F1*beta_1 + (1.0-F1)*beta_2;
+
+    /*--- Production. ---*/
+
+    Double diverg = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) diverg += gradV(iDim+1,iDim);
+
+    Double pk = V.eddyVisc()*strainMag*strainMag - 2.0/3.0*density*kine*diverg;
+    pk = max(min(pk, 20.0*beta_star*density*omega*kine), 0.0);
+
+    const Double zeta = max(omega, sqrt(squaredNorm(vorticity))*F2/a1);
+
+    Double pw = strainMag*strainMag - 2.0/3.0*zeta*diverg;
+    pw = alfa*density*max(pw, 0.0);
+
+    /*--- Sustaining terms, only active if larger than the production. ---*/
+
+    if (sustainingTerms) {
+      pk = max(pk, beta_star*density*kAmb*omegaAmb);
+      pw = max(pw, beta*density*omegaAmb*omegaAmb);
+    }
+
+    /*--- Production, dissipation, and cross diffusion. ---*/
+
+    VectorDbl<nVar> residual;
+    residual(0) = (pk - beta_star*density*omega*kine) * volume * validDist;
+    residual(1) = (pw - beta*density*omega*omega + (1.0-F1)*CDkw) * volume * validDist;
+
+    /*--- Implicit part. ---*/
+
+    MatrixDbl<nVar> jacobian;
+    if (implicit) {
+      jacobian(0,0) = -beta_star*omega*volume*validDist;
+      jacobian(0,1) = -beta_star*kine*volume*validDist;
+      jacobian(1,0) = 0.0;
+      jacobian(1,1) = -2.0*beta*omega*volume*validDist;
+    }
+
+    stopPreacc(residual);
+
+    subtractSource(iPoint, implicit, updateMask, residual, jacobian, vector, matrix);
+  }
+};
@@ -197,7 +197,8 @@ FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container&
     for (size_t j=0; j<nCols; ++j) {
       for (size_t k=0; k<Double::Size; ++k) {
         AD::SetPreaccIn(vars(iPoint[k],i,j));
-        x(i,j)[k] = vars(iPoint[k],i,j);
+        /*--- Flat indexing, x is a vector if nRows is 1. ---*/
+        x.data()[i*nCols+j][k] = vars(iPoint[k],i,j);
       }
     }
   }
@@ -231,6 +232,10 @@ FORCEINLINE VectorDbl<nDim> distanceVector(Int iPoint, Int jPoint,
 
 /*!
  * \brief Update the matrix and right-hand-side of a linear system.
+ * \note For UpdateType::PRODUCT the Jacobians are not stored, instead
+ * jac_j*d_j is added to row i and jac_i*d_i is subtracted from row j.
+ * That is the product of the off-diagonal blocks of the matrix with
+ * the direction d, the diagonal blocks are applied by the caller.
  */
 template<size_t nVar>
 FORCEINLINE void updateLinearSystem(Int iEdge,
@@ -243,8 +248,30 @@ FORCEINLINE void updateLinearSystem(Int iEdge,
                                     const MatrixDbl<nVar>& jac_i,
                                     const MatrixDbl<nVar>& jac_j,
                                     CSysVector<su2double>& vector,
-                                    SparseMatrixType& matrix) {
-  if (updateType == UpdateType::COLORING) {
+                                    SparseMatrixType& matrix,
+                                    const CSysVector<su2double>* direction) {
+  if (updateType == UpdateType::PRODUCT) {
+    auto wasActive = AD::BeginPassive();
+    VectorDbl<nVar> dir_i, dir_j, prod_i, prod_j;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t k = 0; k < Double::Size; ++k) {
+        dir_i[iVar][k] = (*direction)(iPoint[k],iVar);
+        dir_j[iVar][k] = (*direction)(jPoint[k],iVar);
+      }
+    }
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      prod_i(iVar) = 0.0;
+      prod_j(iVar) = 0.0;
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        prod_i(iVar) += jac_j.data()[iVar*nVar+jVar] * dir_j(jVar);
+        prod_j(iVar) -= jac_i.data()[iVar*nVar+jVar] * dir_i(jVar);
+      }
+    }
+    vector.AddBlock(iPoint, prod_i, updateMask);
+    vector.AddBlock(jPoint, prod_j, updateMask);
+    AD::EndPassive(wasActive);
+  }
+  else if (updateType == UpdateType::COLORING) {
     vector.UpdateBlocks(iPoint, jPoint, flux, updateMask);
     if(implicit) {
       auto wasActive = AD::BeginPassive();
@@ -187,4 +187,10 @@ protected:
    */
   void SetFixedCLScreenOutput(const CConfig *config);
 
+  /*!
+   * \brief Add the groups that set values used by the objective function to the demand of the history groups.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetHistoryGroupDemand(const CConfig *config) override;
+
 };
@@ -34,6 +34,9 @@
 #include <iomanip>
 #include <limits>
 #include <vector>
+#include <set>
+#include <deque>
+#include <functional>
 
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "tools/CWindowingTools.hpp"
@@ -42,6 +45,7 @@
 class CGeometry;
 class CSolver;
 class CFileWriter;
+class CSU2BinaryFileWriter;
 class CParallelDataSorter;
 class CConfig;
 
@@ -60,6 +64,8 @@ protected:
   const int rank;     /*!< \brief MPI Rank. */
   const int size;     /*!< \brief MPI Size. */
 
+  enum : size_t {OMP_MIN_SIZE = 32}; /*!< \brief Chunk size for the point loops. */
+
   const unsigned short nDim;   /*!< \brief Physical Dimension */
 
   const bool multiZone;     /*!< \brief Boolean to store whether we are running a multizone problem */
@@ -159,6 +165,23 @@ protected:
   //! Structure to store the value initial residuals for relative residual computation
   std::map<string, su2double> initialResiduals;
 
+  /*----------------------------- Demand of the history groups ----------------------------*/
+
+  /*! \brief Consumers of the history groups. */
+  enum HistoryDemand : unsigned short {
+    DEMAND_SCREEN = 1,  /*!< \brief Printed to screen. */
+    DEMAND_FILE = 2,    /*!< \brief Written to the history file. */
+    DEMAND_ALWAYS = 4   /*!< \brief Needed at every iteration (convergence, averages, objectives, external callers). */
+  };
+
+  std::map<string, unsigned short> historyGroupDemand;  //!< Consumers of each group, groups not in the map are not needed
+  std::vector<string> historyExternalRequests;          //!< Fields or groups requested by external callers (e.g. Python)
+  bool historyAllGroups = true;                         //!< Evaluate all the groups at the current iteration
+  bool historyScreenIter = false;                       //!< Screen output is written at the current iteration
+  bool historyFileIter = false;                         //!< History file output is written at the current iteration
+  std::set<string> historyGroupsDone;                   //!< Groups already evaluated at the current iteration
+  std::map<string, pair<passivedouble, unsigned long> > historyGroupCost;  //!< Time spent on each group and number of evaluations
+
    /*----------------------------- Volume output ----------------------------*/
 
    CParallelDataSorter* volumeDataSorter;    //!< Volume data sorter
@@ -171,6 +194,16 @@ protected:
    surfaceFilename,                     //!< Surface output filename
    restartFilename;                     //!< Restart output filename
 
+   std::deque<CSU2BinaryFileWriter*> asyncWriters;  //!< Binary restarts being written asynchronously, oldest first
+   su2double asyncWriteTime = 0.0;      //!< Time the asynchronous writes were in flight
+   su2double asyncWaitTime = 0.0;       //!< Time spent waiting for asynchronous writes
+
+  /** \brief Enum to identify the volume field type. */
+  enum class VolumeFieldType {
+    RESTART,          /*!< \brief Field that is read back from restart files (solvers, SU2_DOT), never lossy */
+    DEFAULT           /*!< \brief Default field type */
+  };
+
   /** \brief Structure to store information for a volume output field.
    *
    *  The stored information is used to create the volume solution file.
@@ -182,14 +215,17 @@ protected:
     short  offset;
     /*! \brief The group this field belongs to. */
     string outputGroup;
+    /*! \brief The field type. */
+    VolumeFieldType fieldType = VolumeFieldType::DEFAULT;
     /*! \brief String containing the description of the field */
     string description;
     /*! \brief Default constructor. */
     VolumeOutputField () {}
     /*! \brief Constructor to initialize all members. */
-    VolumeOutputField(string fieldName_, int offset_, string volumeOutputGroup_, string description_):
+    VolumeOutputField(string fieldName_, int offset_, string volumeOutputGroup_, string description_,
+                      VolumeFieldType fieldType_):
       fieldName(std::move(fieldName_)), offset(std::move(offset_)),
-      outputGroup(std::move(volumeOutputGroup_)), description(std::move(description_)){}
+      outputGroup(std::move(volumeOutputGroup_)), fieldType(fieldType_), description(std::move(description_)){}
   };
 
   /*! \brief Associative map to access data stored in the volume output fields by a string identifier. */
@@ -197,16 +233,21 @@ protected:
   /*! \brief Vector that contains the keys of the ::volumeOutput_Map in the order of their insertion. */
   std::vector<string>                           volumeOutput_List;
 
+  /*! \brief Position of a thread in the field index caches, padded to avoid false sharing. */
+  struct FieldCacheCursor {
+    unsigned short set = 0;  /*!< \brief Current index in ::fieldIndexCache. */
+    unsigned short get = 0;  /*!< \brief Current index in ::fieldGetIndexCache. */
+    char padding[64 - 2*sizeof(unsigned short)];
+  };
+
   /*! \brief Vector to cache the positions of the field in the data array */
   std::vector<short>                            fieldIndexCache;
-  /*! \brief Current value of the cache index */
-  unsigned short                                cachePosition;
   /*! \brief Boolean to store whether the field index cache should be build. */
   bool                                          buildFieldIndexCache;
   /*! \brief Vector to cache the positions of the field in the data array */
   std::vector<short>                            fieldGetIndexCache;
-  /*! \brief Current value of the cache index */
-  unsigned short                                curGetFieldIndex;
+  /*! \brief Current values of the cache indices, one per thread (the caches are shared). */
+  std::vector<FieldCacheCursor>                 cacheCursor;
 
   /*! \brief Requested volume field names in the config file. */
   std::vector<string> requestedVolumeFields;
@@ -394,6 +435,20 @@ public:
     return HistoryGroup;
   }
 
+  /*!
+   * \brief Request history fields (or groups) that must be evaluated at every iteration, regardless of
+   *        the screen and history file output frequencies, e.g. because an external caller reads them.
+   * \param[in] fields - Names of fields or groups, "ALL" requests all the groups.
+   */
+  void RequestHistoryFields(const vector<string>& fields);
+
+  /*!
+   * \brief Get the time spent evaluating the expensive history groups (and the number of evaluations).
+   */
+  inline const map<string, pair<passivedouble, unsigned long> >& GetHistoryGroupCost() const {
+    return historyGroupCost;
+  }
+
   /*!
    * \brief Get the list of all output fields
    * \return Vector container all output fields
@@ -410,6 +465,14 @@ public:
     return historyOutput_Map;
   }
 
+  /*!
+   * \brief Broadcast the values of the history fields from one rank to the others.
+   * \note Used when the zone of this output is only computed by some of the ranks (concurrent zones).
+   * \param[in] root - Rank that has the values.
+   * \param[in] comm - Communicator of all the ranks that need the values.
+   */
+  void BroadcastHistoryFields(int root, SU2_Comm comm);
+
   /*!
    * \brief Monitor the convergence of an output field
    * \param[in] config - Definition of the particular problem.
@@ -466,6 +529,18 @@ public:
   bool SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** solver_container,
                        unsigned long iter, bool force_writing = false);
 
+  /*!
+   * \brief Wait for all the asynchronous writes of output files (collective).
+   * \param[in,out] config - Definition of the particular problem (the restart bandwidth is updated).
+   */
+  void CompleteAsyncOutput(CConfig *config);
+
+  /*!
+   * \brief Get the time the asynchronous writes were in flight, and the time spent waiting for them.
+   */
+  inline su2double GetAsyncWriteTime() const { return asyncWriteTime; }
+  inline su2double GetAsyncWaitTime() const { return asyncWaitTime; }
+
   /*!
    * \brief Get convergence time convergence of the specified windowed-time-averaged ouput of the problem.
    *        Delays solver stop, if Cauchy time convergence criterion is fullfilled, but 2nd order
@@ -586,9 +661,11 @@ protected:
    * \param[in] field_name - Header that is printed in the output files.
    * \param[in] groupname - The name of the group this field belongs to.
    * \param[in] description - Description of the volume field.
+   * \param[in] field_type - The type of the field (::VolumeFieldType).
    */
-  inline void AddVolumeOutput(string name, string field_name, string groupname, string description){
-    volumeOutput_Map[name] = VolumeOutputField(field_name, -1, groupname, description);
+  inline void AddVolumeOutput(string name, string field_name, string groupname, string description,
+                              VolumeFieldType field_type = VolumeFieldType::DEFAULT){
+    volumeOutput_Map[name] = VolumeOutputField(field_name, -1, groupname, description, field_type);
     volumeOutput_List.push_back(name);
   }
 
@@ -598,27 +675,89 @@ protected:
    * \param[in] name - Name of the field.
    * \param[in] value - The new value of this field.
    */
-  su2double GetVolumeOutputValue(string name, unsigned long iPoint);
+  su2double GetVolumeOutputValue(const string& name, unsigned long iPoint);
 
   /*!
    * \brief Set the value of a volume output field
    * \param[in] name - Name of the field.
    * \param[in] value - The new value of this field.
    */
-  void SetVolumeOutputValue(string name, unsigned long iPoint, su2double value);
+  void SetVolumeOutputValue(const string& name, unsigned long iPoint, su2double value);
 
   /*!
    * \brief Set the value of a volume output field
    * \param[in] name - Name of the field.
    * \param[in] value - The new value of this field.
    */
-  void SetAvgVolumeOutputValue(string name, unsigned long iPoint, su2double value);
+  void SetAvgVolumeOutputValue(const string& name, unsigned long iPoint, su2double value);
 
   /*!
    * \brief CheckHistoryOutput
    */
   void CheckHistoryOutput();
 
+  /*!
+   * \brief Start writing a binary restart asynchronously.
+   * \note If all the staging buffers are in use, or the same file is being written, the solver waits
+   *       for the oldest writes (back-pressure).
+   * \param[in,out] config - Definition of the particular problem.
+   * \param[in] writer - Writer of the file, owned by this class from now on.
+   */
+  void StartAsyncWrite(CConfig *config, CSU2BinaryFileWriter* writer);
+
+  /*!
+   * \brief Wait for the oldest asynchronous write and account for its bandwidth.
+   * \param[in,out] config - Definition of the particular problem.
+   */
+  void CompleteAsyncWrite(CConfig *config);
+
+  /*!
+   * \brief Set the compression of a binary restart file. With lossy compression the fields that are
+   *        read back (VolumeFieldType::RESTART) remain lossless.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] writer - Writer of the file.
+   */
+  void SetRestartCompression(const CConfig *config, CSU2BinaryFileWriter* writer) const;
+
+  /*!
+   * \brief Get the group of a history field (or per-surface field), names of groups are returned as is.
+   */
+  string GetHistoryFieldGroup(const string& name) const;
+
+  /*!
+   * \brief Add a consumer to the group of a history field (or to all the groups if the name is "ALL").
+   */
+  void AddHistoryGroupDemand(const string& name, unsigned short demand);
+
+  /*!
+   * \brief Determine the consumers of each history group (screen, file, convergence monitoring, etc.).
+   * \note The demand only depends on the config, hence it is the same on all ranks, which is required
+   *       since the evaluation of some groups involves collective communication.
+   * \param[in] config - Definition of the particular problem.
+   */
+  virtual void SetHistoryGroupDemand(const CConfig *config);
+
+  /*!
+   * \brief Determine whether the screen and history file outputs are written at the current iteration.
+   * \param[in] config - Definition of the particular problem.
+   * \return True if the demand increased since the last call (e.g. due to convergence).
+   */
+  bool SetHistoryIterationDemand(const CConfig *config);
+
+  /*!
+   * \brief Whether a history group is needed at the current iteration.
+   */
+  bool HistoryGroupRequired(const string& group) const;
+
+  /*!
+   * \brief Evaluate the fields of expensive history groups if any of them is needed at the current iteration.
+   * \note Fields that are not evaluated keep their previous values. The time is accounted to the first group.
+   * \param[in] groups - Groups whose fields are set by "load".
+   * \param[in] load - Function that sets the values of the fields.
+   * \param[in] force - Evaluate regardless of the demand (e.g. if the function has side effects).
+   */
+  void LoadHistoryGroups(const vector<string>& groups, const std::function<void()>& load, bool force = false);
+
   /*!
    * \brief Open the history file and write the header.
    * \param[in] config - Definition of the particular problem.
@@ -627,6 +766,8 @@ protected:
 
   /*!
    * \brief Load up the values of the requested volume fields into ::Local_Data array.
+   * \note For FVM the points (and the vertices of each marker) are loaded by multiple threads,
+   *       therefore LoadVolumeData and LoadSurfaceData may only write to the output of their point.
    * \param[in] config - Definition of the particular problem.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - The container holding all solution data.
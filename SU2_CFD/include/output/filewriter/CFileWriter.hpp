@@ -143,6 +143,11 @@ public:
    */
   su2double Get_UsedTime() const {return usedTime;}
 
+  /*!
+   * \brief Get the name of the file (with extension).
+   */
+  const string& Get_FileName() const {return fileName;}
+
 protected:
 
   /*!
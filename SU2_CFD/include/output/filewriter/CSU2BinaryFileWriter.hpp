@@ -27,9 +27,40 @@
 
 #pragma once
 #include "CFileWriter.hpp"
+#ifndef HAVE_MPI
+#include <chrono>
+#include <future>
+#endif
 
 class CSU2BinaryFileWriter final: public CFileWriter{
 
+private:
+
+  RESTART_COMPRESSION compression = RESTART_COMPRESSION::NONE; /*!< \brief Compression of the file. */
+  vector<passivedouble> tolerance;     /*!< \brief Relative error bound of each field (lossy compression). */
+  vector<uint8_t> stagingBuffer;       /*!< \brief Compressed data, or copy of the data written asynchronously. */
+  bool writing = false;                /*!< \brief An asynchronous write was started and not completed. */
+  bool finished = false;               /*!< \brief The completion of the write was observed by this rank. */
+  su2double finishTime = 0.0;          /*!< \brief When the completion was observed (by a test or the wait). */
+  su2double waitTime = 0.0;            /*!< \brief Time spent waiting for the write to complete. */
+#ifdef HAVE_MPI
+  MPI_Request request;                 /*!< \brief Request of the non-blocking collective write. */
+  MPI_Datatype filetype;               /*!< \brief View of the file for this rank. */
+#else
+  std::future<bool> success;           /*!< \brief Result of the write (in a separate thread). */
+#endif
+
+  /*!
+   * \brief Compress (or copy) the local data, open the file, and write everything before the data section,
+   *        i.e. the header, the names of the fields, and the block table of compressed files.
+   * \param[in] snapshot - Copy uncompressed data, so that the data sorter can be reused.
+   * \param[out] sizeInBytesLocal - Size of the local data.
+   * \param[out] sizeInBytesGlobal - Size of the data section.
+   * \param[out] offsetInBytes - Offset of the local data in the data section.
+   * \return Pointer to the local data.
+   */
+  const void* Write_Header(bool snapshot, unsigned long& sizeInBytesLocal, unsigned long& sizeInBytesGlobal,
+                           unsigned long& offsetInBytes);
 
 public:
 
@@ -50,9 +81,41 @@ public:
    */
   ~CSU2BinaryFileWriter() override;
 
+  /*!
+   * \brief Write a compressed file (see CompressionToolbox::CRestartBlockTable for the format).
+   * \param[in] kind - Type of compression.
+   * \param[in] fieldTolerance - Relative error bound of each field, 0 is lossless, empty if all are lossless.
+   */
+  void Set_Compression(RESTART_COMPRESSION kind, vector<passivedouble> fieldTolerance = {});
+
   /*!
    * \brief Write sorted data to file in SU2 binary file format
    */
   void Write_Data() override;
 
+  /*!
+   * \brief Start writing the sorted data, the data is copied so that the data sorter can be reused.
+   * \note The write must be completed with Write_Data_Wait (by all ranks, it is collective).
+   */
+  void Write_Data_Start();
+
+  /*!
+   * \brief Check (locally) whether the asynchronous write has completed, this also progresses it.
+   */
+  bool Write_Data_Test();
+
+  /*!
+   * \brief Wait for the asynchronous write, close the file, and compute the bandwidth.
+   * \note The used time is the time the write was in flight, i.e. mostly overlapped with computations.
+   *       The completion is recorded when it is first observed, by Write_Data_Test or by this method if the
+   *       write had not been seen to complete, the used time is therefore an upper bound (the bandwidth a
+   *       lower bound) that depends on how often the writes are tested.
+   */
+  void Write_Data_Wait();
+
+  /*!
+   * \brief Get the time spent waiting for the last asynchronous write.
+   */
+  su2double Get_WaitTime() const {return waitTime;}
+
 };
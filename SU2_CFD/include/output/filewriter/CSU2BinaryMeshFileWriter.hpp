@@ -0,0 +1,73 @@
+/*!
+ * \file CSU2BinaryMeshFileWriter.hpp
+ * \brief Headers for the SU2 binary mesh file writer class.
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CSU2BinaryMeshFileWriter
+ * \brief Writes the mesh in the SU2_BINARY format (see BINARY_MESH_HEADER in option_structure.hpp).
+ * \note Points and volume elements are written collectively with MPI I/O, the markers are
+ * read by the master node from the boundary file written by SU2_DEF (as in CSU2MeshFileWriter).
+ * Each zone is written to a separate file.
+ */
+class CSU2BinaryMeshFileWriter final: public CFileWriter{
+
+private:
+  unsigned short iZone, //!< Index of the current zone
+  nZone;                //!< Number of zones
+
+  /*!
+   * \brief Read the markers from the boundary file and serialize them in binary format.
+   * \param[out] nMarker - Number of markers.
+   * \param[out] buffer - Serialized markers.
+   */
+  void ReadBoundaryFile(unsigned long& nMarker, vector<char>& buffer) const;
+
+public:
+
+  /*!
+   * \brief File extension
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Construct a file writer using field names, dimension.
+   * \param[in] valFileName - The name of the file
+   * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valiZone - The index of the current zone
+   * \param[in] valnZone - The total number of zones
+   */
+  CSU2BinaryMeshFileWriter(string valFileName, CParallelDataSorter* valDataSorter,
+                           unsigned short valiZone, unsigned short valnZone);
+
+  /*!
+   * \brief Write sorted data to file in SU2 binary mesh file format
+   */
+  void Write_Data() override;
+
+};
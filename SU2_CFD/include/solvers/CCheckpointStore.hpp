@@ -0,0 +1,160 @@
+/*!
+ * \file CCheckpointStore.hpp
+ * \brief In-memory store of primal states (restart data) for the unsteady discrete adjoint.
+ *        The implementations are in the <i>CCheckpointStore.cpp</i> file.
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../../Common/include/parallelization/mpi_structure.hpp"
+
+#include <list>
+#include <string>
+#include <vector>
+#include <cstdint>
+#ifndef HAVE_MPI
+#include <future>
+#endif
+
+class CGeometry;
+
+/*!
+ * \class CCheckpointStore
+ * \brief Keeps the local part of recently read restart files in memory, optionally compressed.
+ * \note In the unsteady adjoint each restart file is read by the flow, turbulence, and mesh solvers,
+ *       sometimes in different time iterations. With the store, the file is read once and the other
+ *       solvers copy the data from memory. The file needed by the next time iteration can also be
+ *       prefetched, the read (non-blocking collective MPI I/O, or a thread in serial builds) then
+ *       overlaps with the evaluation of the tape. States are evicted in least-recently-used order.
+ *       The store is only used for binary files (prefetch) and files that do not require interpolation.
+ *       All ranks must call the methods in the same order since the reads are collective.
+ *       This is only a cache of the restart files written by the primal run, primal states are never
+ *       recomputed (there is no revolve-type checkpointing schedule), and nothing is kept outside memory.
+ * \author P. Gomes
+ */
+class CCheckpointStore {
+public:
+  enum : int {NHEADER = 5}; /*!< \brief Size of the header of a restart file. */
+
+private:
+  /*!
+   * \brief Local restart data of one file.
+   */
+  struct CState {
+    std::string filename;               /*!< \brief Name of the file (with extension), used as key. */
+    int header[NHEADER] = {0};          /*!< \brief Header of the file (Restart_Vars). */
+    std::vector<std::string> fields;    /*!< \brief Names of the fields. */
+    unsigned long nValues = 0;          /*!< \brief Number of values (local points times fields). */
+    unsigned long stride = 1;           /*!< \brief Number of fields, used as stride for compression. */
+    std::vector<passivedouble> data;    /*!< \brief Uncompressed values. */
+    std::vector<uint8_t> compressed;    /*!< \brief Compressed values. */
+  };
+
+  unsigned long capacity = 0;   /*!< \brief Maximum number of states, 0 disables the store. */
+  bool compress = false;        /*!< \brief Compress the stored states. */
+  std::list<CState> states;     /*!< \brief Stored states, most recently used first. */
+
+  /*!
+   * \brief A prefetch that has been started but not completed.
+   */
+  struct CPending {
+    bool active = false;
+    CState state;
+#ifdef HAVE_MPI
+    MPI_File fileHandle;
+    MPI_Datatype fileType;
+    MPI_Request request;
+#else
+    std::future<bool> success;
+#endif
+  } pending;
+
+  /*!
+   * \brief Wait for the pending prefetch and store the result.
+   */
+  void CompletePrefetch();
+
+  /*!
+   * \brief Add a state, evicting the least recently used if needed.
+   */
+  void Store(CState&& state);
+
+  CCheckpointStore() = default;
+
+public:
+  /*!
+   * \brief Get the (unique) instance of the store.
+   */
+  static CCheckpointStore& GetInstance();
+
+  /*!
+   * \brief Set the number of states kept in memory and whether they are compressed.
+   * \note A capacity of 0 disables the store.
+   */
+  void SetOptions(unsigned long maxStates, bool compressStates);
+
+  /*!
+   * \brief Whether the store is in use.
+   */
+  inline bool IsEnabled() const { return capacity > 0; }
+
+  /*!
+   * \brief Copy a stored state, completing a prefetch of the file if needed.
+   * \param[in] filename - Name of the file (with extension).
+   * \param[out] header - Header of the file (NHEADER values).
+   * \param[out] fields - Names of the fields.
+   * \param[out] data - Values, allocated with new[] here (ownership passes to the caller).
+   * \return True if the state was found.
+   */
+  bool Load(const std::string& filename, int* header, std::vector<std::string>& fields, passivedouble*& data);
+
+  /*!
+   * \brief Store the data of a file that was just read.
+   * \param[in] filename - Name of the file (with extension).
+   * \param[in] header - Header of the file (NHEADER values).
+   * \param[in] fields - Names of the fields.
+   * \param[in] data - Values, nValues = number of local points times header[1].
+   * \param[in] nValues - Number of values.
+   */
+  void Save(const std::string& filename, const int* header, const std::vector<std::string>& fields,
+            const passivedouble* data, unsigned long nValues);
+
+  /*!
+   * \brief Start reading a binary restart file (if it is not stored yet), to be completed by Load.
+   * \note Only one prefetch can be pending, starting a new one completes the previous.
+   *       If the file cannot be read or needs interpolation, nothing is prefetched (errors are
+   *       reported by the normal read). Compressed files are decompressed with the blocks of the local
+   *       points, in parallel this is blocking and the file is stored before returning.
+   * \param[in] geometry - Geometry whose local points are read.
+   * \param[in] filename - Name of the file (with extension).
+   */
+  void Prefetch(const CGeometry* geometry, const std::string& filename);
+
+  /*!
+   * \brief Remove all the states.
+   */
+  void Clear();
+
+};
@@ -196,11 +196,11 @@ class CFVMFlowSolverBase : public CSolver {
 
   /*--- Shallow copy of grid coloring for OpenMP parallelization. ---*/
 
+  vector<GridColor<> > EdgeColoring;   /*!< \brief Edge colors. */
+  unsigned long nEdgeColorInterior = 0; /*!< \brief Number of leading colors without halo points (OVERLAP_HALO_COMMS). */
 #ifdef HAVE_OMP
-  vector<GridColor<> > EdgeColoring; /*!< \brief Edge colors. */
   bool ReducerStrategy = false;      /*!< \brief If the reducer strategy is in use. */
 #else
-  array<DummyGridColor<>, 1> EdgeColoring;
   /*--- Never use the reducer strategy if compiling for MPI-only. ---*/
   static constexpr bool ReducerStrategy = false;
 #endif
@@ -1151,6 +1151,17 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) final;
 
+  /*!
+   * \brief Product of the off-diagonal blocks of the edge flux Jacobians with a direction.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] direction - Vector to multiply, including its halo values.
+   * \param[out] product - Result of the product.
+   * \return False if the vectorized numerics are not in use.
+   */
+  bool EdgeFluxProduct(const CGeometry *geometry, const CConfig *config,
+                       const CSysVector<su2double>& direction, CSysVector<su2double>& product) final;
+
   /*!
    * \brief Set the total residual adding the term that comes from the Dual Time Strategy.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1725,6 +1736,18 @@ class CFVMFlowSolverBase : public CSolver {
    */
   inline void SetTotal_CL(su2double val_Total_CL) final { TotalCoeff.CL = val_Total_CL; }
 
+  /*!
+   * \brief Store the total (inviscid + viscous) non dimensional moment coefficients.
+   * \param[in] val_Total_CMx - Value of the total moment coefficient about the x axis.
+   * \param[in] val_Total_CMy - Value of the total moment coefficient about the y axis.
+   * \param[in] val_Total_CMz - Value of the total moment coefficient about the z axis.
+   */
+  inline void SetTotal_CM(su2double val_Total_CMx, su2double val_Total_CMy, su2double val_Total_CMz) final {
+    TotalCoeff.CMx = val_Total_CMx;
+    TotalCoeff.CMy = val_Total_CMy;
+    TotalCoeff.CMz = val_Total_CMz;
+  }
+
   /*!
    * \brief Get the inviscid contribution to the lift coefficient.
    * \return Value of the lift coefficient (inviscid contribution).
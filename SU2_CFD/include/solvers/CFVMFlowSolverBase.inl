@@ -30,6 +30,7 @@
 #include "../gradients/computeGradientsLeastSquares.hpp"
 #include "../limiters/computeLimiters.hpp"
 #include "../numerics_simd/CNumericsSIMD.hpp"
+#include "../../../Common/include/toolboxes/CMonitorReduction.hpp"
 #include "CFVMFlowSolverBase.hpp"
 
 template <class V, ENUM_REGIME R>
@@ -296,17 +297,6 @@ void CFVMFlowSolverBase<V, R>::HybridParallelInitialization(const CConfig& confi
   /*--- When using the reducer force a single color to reduce the color loop overhead. ---*/
   if (ReducerStrategy && (coloring.getOuterSize() > 1)) geometry.SetNaturalEdgeColoring();
 
-  if (!coloring.empty()) {
-    /*--- If the reducer strategy is used we are not constrained by group
-     *    size as we have no other edge loops in the Euler/NS solvers. ---*/
-    auto groupSize = ReducerStrategy ? 1ul : geometry.GetEdgeColorGroupSize();
-    auto nColor = coloring.getOuterSize();
-    EdgeColoring.reserve(nColor);
-
-    for (auto iColor = 0ul; iColor < nColor; ++iColor)
-      EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
-  }
-
   /*--- If the reducer strategy is not being forced (by EDGE_COLORING_GROUP_SIZE=0) print some messages. ---*/
   if (config.GetEdgeColoringGroupSize() != 1 << 30) {
     su2double minEff = 1.0;
@@ -336,9 +326,31 @@ void CFVMFlowSolverBase<V, R>::HybridParallelInitialization(const CConfig& confi
   if (ReducerStrategy) EdgeFluxes.Initialize(geometry.GetnEdge(), geometry.GetnEdge(), nVar, nullptr);
 
   omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
-#else
-  EdgeColoring[0] = DummyGridColor<>(geometry.GetnEdge());
 #endif
+
+  /*--- To overlap the halo comms of reconstruction gradients and limiters with the computation of
+   *    the interior edges (both points owned by this rank), these are put in separate colors (with
+   *    one thread the edges are split individually). The convective residual completes the comms
+   *    before the colors of partition boundary edges. ---*/
+  overlapHaloComms = config.GetOverlapHaloComms() && !config.GetContinuous_Adjoint();
+
+  /*--- If the reducer strategy is used we are not constrained by group
+   *    size as we have no other edge loops in the Euler/NS solvers. ---*/
+  const auto groupSize = ReducerStrategy ? 1ul : geometry.GetEdgeColorGroupSize();
+  const auto& colors = overlapHaloComms ?
+    geometry.GetEdgeColoringSplit(omp_get_max_threads() > 1 ? groupSize : 1ul, nEdgeColorInterior) :
+    geometry.GetEdgeColoring();
+
+  if (!colors.empty()) {
+    auto nColor = colors.getOuterSize();
+    EdgeColoring.reserve(nColor);
+
+    for (auto iColor = 0ul; iColor < nColor; ++iColor)
+      EdgeColoring.emplace_back(colors.innerIdx(iColor), colors.getNumNonZeros(iColor), groupSize);
+  }
+
+  /*--- Without partition boundary edges there is nothing to overlap. ---*/
+  if (nEdgeColorInterior == EdgeColoring.size()) nEdgeColorInterior = 0;
 }
 
 template <class V, ENUM_REGIME R>
@@ -1542,7 +1554,11 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
   else AD::StartNoSharedReading();
 
   /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring) {
+  for (auto iColor = 0ul; iColor < EdgeColoring.size(); ++iColor) {
+    /*--- Partition boundary edges need the halo data of gradients and limiters. ---*/
+    if (iColor == nEdgeColorInterior) CompleteDeferredComms();
+    const auto& color = EdgeColoring[iColor];
+
     /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
     SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
     for(auto k = 0ul; k < color.size; k += Double::Size) {
@@ -1563,6 +1579,9 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
     END_SU2_OMP_FOR
   }
 
+  /*--- In case there are no partition boundary colors (or no colors at all). ---*/
+  CompleteDeferredComms();
+
   /*--- Restore preaccumulation and adjoint evaluation state. ---*/
   AD::ResumePreaccumulation(pausePreacc);
   if (!ReducerStrategy) AD::EndNoSharedReading();
@@ -1575,6 +1594,46 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
   }
 }
 
+template <class V, ENUM_REGIME R>
+bool CFVMFlowSolverBase<V, R>::EdgeFluxProduct(const CGeometry *geometry, const CConfig *config,
+                                               const CSysVector<su2double>& direction,
+                                               CSysVector<su2double>& product) {
+  if (!edgeNumerics) return false;
+
+  product.SetValZero();
+  SU2_OMP_BARRIER
+
+  /*--- The same loop as EdgeFluxResidual, but the Jacobians are applied to the direction instead
+   * of being stored, no fluxes are kept, and the halo data is already up to date. ---*/
+  auto edgeProducts = [&](const GridColor<>& color, unsigned long k) {
+    Int iEdge;
+    Double mask;
+    for (auto j = 0ul; j < Double::Size; ++j) {
+      bool in = (k+j < color.size);
+      mask[j] = in;
+      iEdge[j] = color.indices[k+j*in];
+    }
+    edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::PRODUCT, mask, product, Jacobian, &direction);
+  };
+
+  if (ReducerStrategy) {
+    /*--- The edges are not colored, the products are added to both end points by one thread. ---*/
+    SU2_OMP_MASTER
+    for (const auto& color : EdgeColoring)
+      for (auto k = 0ul; k < color.size; k += Double::Size) edgeProducts(color, k);
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+  else {
+    for (const auto& color : EdgeColoring) {
+      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+      for(auto k = 0ul; k < color.size; k += Double::Size) edgeProducts(color, k);
+      END_SU2_OMP_FOR
+    }
+  }
+  return true;
+}
+
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::SumEdgeFluxes(const CGeometry* geometry) {
 
@@ -1996,111 +2055,71 @@ void CFVMFlowSolverBase<V, FlowRegime>::Pressure_Forces(const CGeometry* geometr
     }
   }
 
-#ifdef HAVE_MPI
+  /*--- Add AllBound information and the forces on the surfaces using all the nodes. The totals are
+   * updated once the values are reduced, at the end of the batch if one is open (see CMonitorReduction). ---*/
 
-  /*--- Add AllBound information using all the nodes ---*/
+  auto& reduction = CMonitorReduction::GetInstance();
 
   if (config->GetComm_Level() == COMM_FULL) {
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x;
-      x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
-    };
-    AllBoundInvCoeff.CD = Allreduce(AllBoundInvCoeff.CD);
-    AllBoundInvCoeff.CL = Allreduce(AllBoundInvCoeff.CL);
-    AllBoundInvCoeff.CSF = Allreduce(AllBoundInvCoeff.CSF);
-    AllBoundInvCoeff.CEff = AllBoundInvCoeff.CL / (AllBoundInvCoeff.CD + EPS);
-
-    AllBoundInvCoeff.CMx = Allreduce(AllBoundInvCoeff.CMx);
-    AllBoundInvCoeff.CMy = Allreduce(AllBoundInvCoeff.CMy);
-    AllBoundInvCoeff.CMz = Allreduce(AllBoundInvCoeff.CMz);
+    const auto nMarkerMon = config->GetnMarker_Monitoring();
 
-    AllBoundInvCoeff.CoPx = Allreduce(AllBoundInvCoeff.CoPx);
-    AllBoundInvCoeff.CoPy = Allreduce(AllBoundInvCoeff.CoPy);
-    AllBoundInvCoeff.CoPz = Allreduce(AllBoundInvCoeff.CoPz);
+    for (su2double* x : {&AllBoundInvCoeff.CD, &AllBoundInvCoeff.CL, &AllBoundInvCoeff.CSF,
+                         &AllBoundInvCoeff.CMx, &AllBoundInvCoeff.CMy, &AllBoundInvCoeff.CMz,
+                         &AllBoundInvCoeff.CoPx, &AllBoundInvCoeff.CoPy, &AllBoundInvCoeff.CoPz,
+                         &AllBoundInvCoeff.CFx, &AllBoundInvCoeff.CFy, &AllBoundInvCoeff.CFz,
+                         &AllBoundInvCoeff.CT, &AllBoundInvCoeff.CQ, &AllBound_CNearFieldOF_Inv})
+      reduction.Sum(x, 1);
 
-    AllBoundInvCoeff.CFx = Allreduce(AllBoundInvCoeff.CFx);
-    AllBoundInvCoeff.CFy = Allreduce(AllBoundInvCoeff.CFy);
-    AllBoundInvCoeff.CFz = Allreduce(AllBoundInvCoeff.CFz);
-
-    AllBoundInvCoeff.CT = Allreduce(AllBoundInvCoeff.CT);
-    AllBoundInvCoeff.CQ = Allreduce(AllBoundInvCoeff.CQ);
-    AllBoundInvCoeff.CMerit = AllBoundInvCoeff.CT / (AllBoundInvCoeff.CQ + EPS);
-    AllBound_CNearFieldOF_Inv = Allreduce(AllBound_CNearFieldOF_Inv);
+    for (su2double* x : {SurfaceInvCoeff.CL, SurfaceInvCoeff.CD, SurfaceInvCoeff.CSF, SurfaceInvCoeff.CFx,
+                         SurfaceInvCoeff.CFy, SurfaceInvCoeff.CFz, SurfaceInvCoeff.CMx, SurfaceInvCoeff.CMy,
+                         SurfaceInvCoeff.CMz})
+      reduction.Sum(x, nMarkerMon);
   }
 
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    int nMarkerMon = config->GetnMarker_Monitoring();
-
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
-
-    su2double* buffer = new su2double[nMarkerMon];
-
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for (int i = 0; i < size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CSF);
+  reduction.Reduce([this, config]() {
+    AllBoundInvCoeff.CEff = AllBoundInvCoeff.CL / (AllBoundInvCoeff.CD + EPS);
+    AllBoundInvCoeff.CMerit = AllBoundInvCoeff.CT / (AllBoundInvCoeff.CQ + EPS);
 
-    for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
+    for (auto iMarker_Monitoring = 0u; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++)
       SurfaceInvCoeff.CEff[iMarker_Monitoring] =
           SurfaceInvCoeff.CL[iMarker_Monitoring] / (SurfaceInvCoeff.CD[iMarker_Monitoring] + EPS);
 
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMz);
-
-    delete[] buffer;
-  }
-
-#endif
-
-  /*--- Update the total coefficients (note that all the nodes have the same value) ---*/
-
-  TotalCoeff.CD = AllBoundInvCoeff.CD;
-  TotalCoeff.CL = AllBoundInvCoeff.CL;
-  TotalCoeff.CSF = AllBoundInvCoeff.CSF;
-  TotalCoeff.CEff = TotalCoeff.CL / (TotalCoeff.CD + EPS);
-  TotalCoeff.CFx = AllBoundInvCoeff.CFx;
-  TotalCoeff.CFy = AllBoundInvCoeff.CFy;
-  TotalCoeff.CFz = AllBoundInvCoeff.CFz;
-  TotalCoeff.CMx = AllBoundInvCoeff.CMx;
-  TotalCoeff.CMy = AllBoundInvCoeff.CMy;
-  TotalCoeff.CMz = AllBoundInvCoeff.CMz;
-  TotalCoeff.CoPx = AllBoundInvCoeff.CoPx;
-  TotalCoeff.CoPy = AllBoundInvCoeff.CoPy;
-  TotalCoeff.CoPz = AllBoundInvCoeff.CoPz;
-  TotalCoeff.CT = AllBoundInvCoeff.CT;
-  TotalCoeff.CQ = AllBoundInvCoeff.CQ;
-  TotalCoeff.CMerit = TotalCoeff.CT / (TotalCoeff.CQ + EPS);
-  Total_CNearFieldOF = AllBound_CNearFieldOF_Inv;
-
-  /*--- Update the total coefficients per surface (note that all the nodes have the same value)---*/
-
-  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-    SurfaceCoeff.CL[iMarker_Monitoring] = SurfaceInvCoeff.CL[iMarker_Monitoring];
-    SurfaceCoeff.CD[iMarker_Monitoring] = SurfaceInvCoeff.CD[iMarker_Monitoring];
-    SurfaceCoeff.CSF[iMarker_Monitoring] = SurfaceInvCoeff.CSF[iMarker_Monitoring];
-    SurfaceCoeff.CEff[iMarker_Monitoring] =
-        SurfaceCoeff.CL[iMarker_Monitoring] / (SurfaceCoeff.CD[iMarker_Monitoring] + EPS);
-    SurfaceCoeff.CFx[iMarker_Monitoring] = SurfaceInvCoeff.CFx[iMarker_Monitoring];
-    SurfaceCoeff.CFy[iMarker_Monitoring] = SurfaceInvCoeff.CFy[iMarker_Monitoring];
-    SurfaceCoeff.CFz[iMarker_Monitoring] = SurfaceInvCoeff.CFz[iMarker_Monitoring];
-    SurfaceCoeff.CMx[iMarker_Monitoring] = SurfaceInvCoeff.CMx[iMarker_Monitoring];
-    SurfaceCoeff.CMy[iMarker_Monitoring] = SurfaceInvCoeff.CMy[iMarker_Monitoring];
-    SurfaceCoeff.CMz[iMarker_Monitoring] = SurfaceInvCoeff.CMz[iMarker_Monitoring];
-  }
+    /*--- Update the total coefficients (note that all the nodes have the same value) ---*/
+
+    TotalCoeff.CD = AllBoundInvCoeff.CD;
+    TotalCoeff.CL = AllBoundInvCoeff.CL;
+    TotalCoeff.CSF = AllBoundInvCoeff.CSF;
+    TotalCoeff.CEff = TotalCoeff.CL / (TotalCoeff.CD + EPS);
+    TotalCoeff.CFx = AllBoundInvCoeff.CFx;
+    TotalCoeff.CFy = AllBoundInvCoeff.CFy;
+    TotalCoeff.CFz = AllBoundInvCoeff.CFz;
+    TotalCoeff.CMx = AllBoundInvCoeff.CMx;
+    TotalCoeff.CMy = AllBoundInvCoeff.CMy;
+    TotalCoeff.CMz = AllBoundInvCoeff.CMz;
+    TotalCoeff.CoPx = AllBoundInvCoeff.CoPx;
+    TotalCoeff.CoPy = AllBoundInvCoeff.CoPy;
+    TotalCoeff.CoPz = AllBoundInvCoeff.CoPz;
+    TotalCoeff.CT = AllBoundInvCoeff.CT;
+    TotalCoeff.CQ = AllBoundInvCoeff.CQ;
+    TotalCoeff.CMerit = TotalCoeff.CT / (TotalCoeff.CQ + EPS);
+    Total_CNearFieldOF = AllBound_CNearFieldOF_Inv;
+
+    /*--- Update the total coefficients per surface (note that all the nodes have the same value)---*/
+
+    for (auto iMarker_Monitoring = 0u; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
+      SurfaceCoeff.CL[iMarker_Monitoring] = SurfaceInvCoeff.CL[iMarker_Monitoring];
+      SurfaceCoeff.CD[iMarker_Monitoring] = SurfaceInvCoeff.CD[iMarker_Monitoring];
+      SurfaceCoeff.CSF[iMarker_Monitoring] = SurfaceInvCoeff.CSF[iMarker_Monitoring];
+      SurfaceCoeff.CEff[iMarker_Monitoring] =
+          SurfaceCoeff.CL[iMarker_Monitoring] / (SurfaceCoeff.CD[iMarker_Monitoring] + EPS);
+      SurfaceCoeff.CFx[iMarker_Monitoring] = SurfaceInvCoeff.CFx[iMarker_Monitoring];
+      SurfaceCoeff.CFy[iMarker_Monitoring] = SurfaceInvCoeff.CFy[iMarker_Monitoring];
+      SurfaceCoeff.CFz[iMarker_Monitoring] = SurfaceInvCoeff.CFz[iMarker_Monitoring];
+      SurfaceCoeff.CMx[iMarker_Monitoring] = SurfaceInvCoeff.CMx[iMarker_Monitoring];
+      SurfaceCoeff.CMy[iMarker_Monitoring] = SurfaceInvCoeff.CMy[iMarker_Monitoring];
+      SurfaceCoeff.CMz[iMarker_Monitoring] = SurfaceInvCoeff.CMz[iMarker_Monitoring];
+    }
+  });
 }
 
 template <class V, ENUM_REGIME FlowRegime>
@@ -2278,110 +2297,70 @@ void CFVMFlowSolverBase<V, FlowRegime>::Momentum_Forces(const CGeometry* geometr
     }
   }
 
-#ifdef HAVE_MPI
+  /*--- Add AllBound information and the forces on the surfaces using all the nodes. The totals are
+   * updated once the values are reduced, at the end of the batch if one is open (see CMonitorReduction). ---*/
 
-  /*--- Add AllBound information using all the nodes ---*/
+  auto& reduction = CMonitorReduction::GetInstance();
 
   if (config->GetComm_Level() == COMM_FULL) {
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x;
-      x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
-    };
-
-    AllBoundMntCoeff.CD = Allreduce(AllBoundMntCoeff.CD);
-    AllBoundMntCoeff.CL = Allreduce(AllBoundMntCoeff.CL);
-    AllBoundMntCoeff.CSF = Allreduce(AllBoundMntCoeff.CSF);
-    AllBoundMntCoeff.CEff = AllBoundMntCoeff.CL / (AllBoundMntCoeff.CD + EPS);
+    const auto nMarkerMon = config->GetnMarker_Monitoring();
 
-    AllBoundMntCoeff.CFx = Allreduce(AllBoundMntCoeff.CFx);
-    AllBoundMntCoeff.CFy = Allreduce(AllBoundMntCoeff.CFy);
-    AllBoundMntCoeff.CFz = Allreduce(AllBoundMntCoeff.CFz);
+    for (su2double* x : {&AllBoundMntCoeff.CD, &AllBoundMntCoeff.CL, &AllBoundMntCoeff.CSF,
+                         &AllBoundMntCoeff.CMx, &AllBoundMntCoeff.CMy, &AllBoundMntCoeff.CMz,
+                         &AllBoundMntCoeff.CoPx, &AllBoundMntCoeff.CoPy, &AllBoundMntCoeff.CoPz,
+                         &AllBoundMntCoeff.CFx, &AllBoundMntCoeff.CFy, &AllBoundMntCoeff.CFz,
+                         &AllBoundMntCoeff.CT, &AllBoundMntCoeff.CQ})
+      reduction.Sum(x, 1);
 
-    AllBoundMntCoeff.CMx = Allreduce(AllBoundMntCoeff.CMx);
-    AllBoundMntCoeff.CMy = Allreduce(AllBoundMntCoeff.CMy);
-    AllBoundMntCoeff.CMz = Allreduce(AllBoundMntCoeff.CMz);
-
-    AllBoundMntCoeff.CoPx = Allreduce(AllBoundMntCoeff.CoPx);
-    AllBoundMntCoeff.CoPy = Allreduce(AllBoundMntCoeff.CoPy);
-    AllBoundMntCoeff.CoPz = Allreduce(AllBoundMntCoeff.CoPz);
-
-    AllBoundMntCoeff.CT = Allreduce(AllBoundMntCoeff.CT);
-    AllBoundMntCoeff.CQ = Allreduce(AllBoundMntCoeff.CQ);
-    AllBoundMntCoeff.CMerit = AllBoundMntCoeff.CT / (AllBoundMntCoeff.CQ + EPS);
+    for (su2double* x : {SurfaceMntCoeff.CL, SurfaceMntCoeff.CD, SurfaceMntCoeff.CSF, SurfaceMntCoeff.CFx,
+                         SurfaceMntCoeff.CFy, SurfaceMntCoeff.CFz, SurfaceMntCoeff.CMx, SurfaceMntCoeff.CMy,
+                         SurfaceMntCoeff.CMz})
+      reduction.Sum(x, nMarkerMon);
   }
 
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    int nMarkerMon = config->GetnMarker_Monitoring();
-
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
-
-    su2double* buffer = new su2double[nMarkerMon];
-
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for (int i = 0; i < size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CSF);
+  reduction.Reduce([this, config]() {
+    AllBoundMntCoeff.CEff = AllBoundMntCoeff.CL / (AllBoundMntCoeff.CD + EPS);
+    AllBoundMntCoeff.CMerit = AllBoundMntCoeff.CT / (AllBoundMntCoeff.CQ + EPS);
 
-    for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
+    for (auto iMarker_Monitoring = 0u; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++)
       SurfaceMntCoeff.CEff[iMarker_Monitoring] =
           SurfaceMntCoeff.CL[iMarker_Monitoring] / (SurfaceMntCoeff.CD[iMarker_Monitoring] + EPS);
 
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMz);
-
-    delete[] buffer;
-  }
-
-#endif
-
-  /*--- Update the total coefficients (note that all the nodes have the same value) ---*/
-
-  TotalCoeff.CD += AllBoundMntCoeff.CD;
-  TotalCoeff.CL += AllBoundMntCoeff.CL;
-  TotalCoeff.CSF += AllBoundMntCoeff.CSF;
-  TotalCoeff.CEff = TotalCoeff.CL / (TotalCoeff.CD + EPS);
-  TotalCoeff.CFx += AllBoundMntCoeff.CFx;
-  TotalCoeff.CFy += AllBoundMntCoeff.CFy;
-  TotalCoeff.CFz += AllBoundMntCoeff.CFz;
-  TotalCoeff.CMx += AllBoundMntCoeff.CMx;
-  TotalCoeff.CMy += AllBoundMntCoeff.CMy;
-  TotalCoeff.CMz += AllBoundMntCoeff.CMz;
-  TotalCoeff.CoPx += AllBoundMntCoeff.CoPx;
-  TotalCoeff.CoPy += AllBoundMntCoeff.CoPy;
-  TotalCoeff.CoPz += AllBoundMntCoeff.CoPz;
-  TotalCoeff.CT += AllBoundMntCoeff.CT;
-  TotalCoeff.CQ += AllBoundMntCoeff.CQ;
-  TotalCoeff.CMerit = TotalCoeff.CT / (TotalCoeff.CQ + EPS);
-
-  /*--- Update the total coefficients per surface (note that all the nodes have the same value)---*/
-
-  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-    SurfaceCoeff.CL[iMarker_Monitoring] += SurfaceMntCoeff.CL[iMarker_Monitoring];
-    SurfaceCoeff.CD[iMarker_Monitoring] += SurfaceMntCoeff.CD[iMarker_Monitoring];
-    SurfaceCoeff.CSF[iMarker_Monitoring] += SurfaceMntCoeff.CSF[iMarker_Monitoring];
-    SurfaceCoeff.CEff[iMarker_Monitoring] =
-        SurfaceCoeff.CL[iMarker_Monitoring] / (SurfaceCoeff.CD[iMarker_Monitoring] + EPS);
-    SurfaceCoeff.CFx[iMarker_Monitoring] += SurfaceMntCoeff.CFx[iMarker_Monitoring];
-    SurfaceCoeff.CFy[iMarker_Monitoring] += SurfaceMntCoeff.CFy[iMarker_Monitoring];
-    SurfaceCoeff.CFz[iMarker_Monitoring] += SurfaceMntCoeff.CFz[iMarker_Monitoring];
-    SurfaceCoeff.CMx[iMarker_Monitoring] += SurfaceMntCoeff.CMx[iMarker_Monitoring];
-    SurfaceCoeff.CMy[iMarker_Monitoring] += SurfaceMntCoeff.CMy[iMarker_Monitoring];
-    SurfaceCoeff.CMz[iMarker_Monitoring] += SurfaceMntCoeff.CMz[iMarker_Monitoring];
-  }
+    /*--- Update the total coefficients (note that all the nodes have the same value) ---*/
+
+    TotalCoeff.CD += AllBoundMntCoeff.CD;
+    TotalCoeff.CL += AllBoundMntCoeff.CL;
+    TotalCoeff.CSF += AllBoundMntCoeff.CSF;
+    TotalCoeff.CEff = TotalCoeff.CL / (TotalCoeff.CD + EPS);
+    TotalCoeff.CFx += AllBoundMntCoeff.CFx;
+    TotalCoeff.CFy += AllBoundMntCoeff.CFy;
+    TotalCoeff.CFz += AllBoundMntCoeff.CFz;
+    TotalCoeff.CMx += AllBoundMntCoeff.CMx;
+    TotalCoeff.CMy += AllBoundMntCoeff.CMy;
+    TotalCoeff.CMz += AllBoundMntCoeff.CMz;
+    TotalCoeff.CoPx += AllBoundMntCoeff.CoPx;
+    TotalCoeff.CoPy += AllBoundMntCoeff.CoPy;
+    TotalCoeff.CoPz += AllBoundMntCoeff.CoPz;
+    TotalCoeff.CT += AllBoundMntCoeff.CT;
+    TotalCoeff.CQ += AllBoundMntCoeff.CQ;
+    TotalCoeff.CMerit = TotalCoeff.CT / (TotalCoeff.CQ + EPS);
+
+    /*--- Update the total coefficients per surface (note that all the nodes have the same value)---*/
+
+    for (auto iMarker_Monitoring = 0u; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
+      SurfaceCoeff.CL[iMarker_Monitoring] += SurfaceMntCoeff.CL[iMarker_Monitoring];
+      SurfaceCoeff.CD[iMarker_Monitoring] += SurfaceMntCoeff.CD[iMarker_Monitoring];
+      SurfaceCoeff.CSF[iMarker_Monitoring] += SurfaceMntCoeff.CSF[iMarker_Monitoring];
+      SurfaceCoeff.CEff[iMarker_Monitoring] =
+          SurfaceCoeff.CL[iMarker_Monitoring] / (SurfaceCoeff.CD[iMarker_Monitoring] + EPS);
+      SurfaceCoeff.CFx[iMarker_Monitoring] += SurfaceMntCoeff.CFx[iMarker_Monitoring];
+      SurfaceCoeff.CFy[iMarker_Monitoring] += SurfaceMntCoeff.CFy[iMarker_Monitoring];
+      SurfaceCoeff.CFz[iMarker_Monitoring] += SurfaceMntCoeff.CFz[iMarker_Monitoring];
+      SurfaceCoeff.CMx[iMarker_Monitoring] += SurfaceMntCoeff.CMx[iMarker_Monitoring];
+      SurfaceCoeff.CMy[iMarker_Monitoring] += SurfaceMntCoeff.CMy[iMarker_Monitoring];
+      SurfaceCoeff.CMz[iMarker_Monitoring] += SurfaceMntCoeff.CMz[iMarker_Monitoring];
+    }
+  });
 }
 
 template <class V, ENUM_REGIME FlowRegime>
@@ -2711,127 +2690,76 @@ void CFVMFlowSolverBase<V, FlowRegime>::Friction_Forces(const CGeometry* geometr
     }
   }
 
-  /*--- Update some global coeffients ---*/
-
-  AllBoundViscCoeff.CEff = AllBoundViscCoeff.CL / (AllBoundViscCoeff.CD + EPS);
-  AllBoundViscCoeff.CMerit = AllBoundViscCoeff.CT / (AllBoundViscCoeff.CQ + EPS);
-  AllBound_MaxHF_Visc = pow(AllBound_MaxHF_Visc, 1.0 / MaxNorm);
+  /*--- Add AllBound information and the forces on the surfaces using all the nodes. The totals are
+   * updated once the values are reduced, at the end of the batch if one is open (see CMonitorReduction). ---*/
 
-#ifdef HAVE_MPI
-
-  /*--- Add AllBound information using all the nodes ---*/
+  auto& reduction = CMonitorReduction::GetInstance();
 
   if (config->GetComm_Level() == COMM_FULL) {
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x;
-      x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
-    };
-    AllBoundViscCoeff.CD = Allreduce(AllBoundViscCoeff.CD);
-    AllBoundViscCoeff.CL = Allreduce(AllBoundViscCoeff.CL);
-    AllBoundViscCoeff.CSF = Allreduce(AllBoundViscCoeff.CSF);
-    AllBoundViscCoeff.CEff = AllBoundViscCoeff.CL / (AllBoundViscCoeff.CD + EPS);
-
-    AllBoundViscCoeff.CMx = Allreduce(AllBoundViscCoeff.CMx);
-    AllBoundViscCoeff.CMy = Allreduce(AllBoundViscCoeff.CMy);
-    AllBoundViscCoeff.CMz = Allreduce(AllBoundViscCoeff.CMz);
+    const auto nMarkerMon = config->GetnMarker_Monitoring();
 
-    AllBoundViscCoeff.CFx = Allreduce(AllBoundViscCoeff.CFx);
-    AllBoundViscCoeff.CFy = Allreduce(AllBoundViscCoeff.CFy);
-    AllBoundViscCoeff.CFz = Allreduce(AllBoundViscCoeff.CFz);
+    for (su2double* x : {&AllBoundViscCoeff.CD, &AllBoundViscCoeff.CL, &AllBoundViscCoeff.CSF,
+                         &AllBoundViscCoeff.CMx, &AllBoundViscCoeff.CMy, &AllBoundViscCoeff.CMz,
+                         &AllBoundViscCoeff.CoPx, &AllBoundViscCoeff.CoPy, &AllBoundViscCoeff.CoPz,
+                         &AllBoundViscCoeff.CFx, &AllBoundViscCoeff.CFy, &AllBoundViscCoeff.CFz,
+                         &AllBoundViscCoeff.CT, &AllBoundViscCoeff.CQ, &AllBound_HF_Visc, &AllBound_MaxHF_Visc})
+      reduction.Sum(x, 1);
 
-    AllBoundViscCoeff.CoPx = Allreduce(AllBoundViscCoeff.CoPx);
-    AllBoundViscCoeff.CoPy = Allreduce(AllBoundViscCoeff.CoPy);
-    AllBoundViscCoeff.CoPz = Allreduce(AllBoundViscCoeff.CoPz);
-
-    AllBoundViscCoeff.CT = Allreduce(AllBoundViscCoeff.CT);
-    AllBoundViscCoeff.CQ = Allreduce(AllBoundViscCoeff.CQ);
-    AllBoundViscCoeff.CMerit = AllBoundViscCoeff.CT / (AllBoundViscCoeff.CQ + EPS);
-
-    AllBound_HF_Visc = Allreduce(AllBound_HF_Visc);
-    AllBound_MaxHF_Visc = pow(Allreduce(pow(AllBound_MaxHF_Visc, MaxNorm)), 1.0 / MaxNorm);
+    for (su2double* x : {SurfaceViscCoeff.CL, SurfaceViscCoeff.CD, SurfaceViscCoeff.CSF, SurfaceViscCoeff.CFx,
+                         SurfaceViscCoeff.CFy, SurfaceViscCoeff.CFz, SurfaceViscCoeff.CMx,
+                         SurfaceViscCoeff.CMy, SurfaceViscCoeff.CMz, Surface_HF_Visc.data(),
+                         Surface_MaxHF_Visc.data()})
+      reduction.Sum(x, nMarkerMon);
   }
 
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    int nMarkerMon = config->GetnMarker_Monitoring();
-
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
-
-    su2double* buffer = new su2double[nMarkerMon];
-
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for (int i = 0; i < size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CSF);
+  reduction.Reduce([this, config, MaxNorm]() {
+    AllBound_MaxHF_Visc = pow(AllBound_MaxHF_Visc, 1.0 / MaxNorm);
+    AllBoundViscCoeff.CEff = AllBoundViscCoeff.CL / (AllBoundViscCoeff.CD + EPS);
+    AllBoundViscCoeff.CMerit = AllBoundViscCoeff.CT / (AllBoundViscCoeff.CQ + EPS);
 
-    for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
+    for (auto iMarker_Monitoring = 0u; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++)
       SurfaceViscCoeff.CEff[iMarker_Monitoring] =
           SurfaceViscCoeff.CL[iMarker_Monitoring] / (SurfaceViscCoeff.CD[iMarker_Monitoring] + EPS);
 
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMz);
-
-    Allreduce_inplace(nMarkerMon, Surface_HF_Visc.data());
-    Allreduce_inplace(nMarkerMon, Surface_MaxHF_Visc.data());
-
-    delete[] buffer;
-  }
-
-#endif
-
-  /*--- Update the total coefficients (note that all the nodes have the same value)---*/
-
-  TotalCoeff.CD += AllBoundViscCoeff.CD;
-  TotalCoeff.CL += AllBoundViscCoeff.CL;
-  TotalCoeff.CSF += AllBoundViscCoeff.CSF;
-  TotalCoeff.CEff = TotalCoeff.CL / (TotalCoeff.CD + EPS);
-  TotalCoeff.CFx += AllBoundViscCoeff.CFx;
-  TotalCoeff.CFy += AllBoundViscCoeff.CFy;
-  TotalCoeff.CFz += AllBoundViscCoeff.CFz;
-  TotalCoeff.CMx += AllBoundViscCoeff.CMx;
-  TotalCoeff.CMy += AllBoundViscCoeff.CMy;
-  TotalCoeff.CMz += AllBoundViscCoeff.CMz;
-  TotalCoeff.CoPx += AllBoundViscCoeff.CoPx;
-  TotalCoeff.CoPy += AllBoundViscCoeff.CoPy;
-  TotalCoeff.CoPz += AllBoundViscCoeff.CoPz;
-  TotalCoeff.CT += AllBoundViscCoeff.CT;
-  TotalCoeff.CQ += AllBoundViscCoeff.CQ;
-  TotalCoeff.CMerit = AllBoundViscCoeff.CT / (AllBoundViscCoeff.CQ + EPS);
-  Total_Heat = AllBound_HF_Visc;
-  Total_MaxHeat = AllBound_MaxHF_Visc;
-
-  /*--- Update the total coefficients per surface (note that all the nodes have the same value)---*/
-
-  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-    SurfaceCoeff.CL[iMarker_Monitoring] += SurfaceViscCoeff.CL[iMarker_Monitoring];
-    SurfaceCoeff.CD[iMarker_Monitoring] += SurfaceViscCoeff.CD[iMarker_Monitoring];
-    SurfaceCoeff.CSF[iMarker_Monitoring] += SurfaceViscCoeff.CSF[iMarker_Monitoring];
-    SurfaceCoeff.CEff[iMarker_Monitoring] =
-        SurfaceCoeff.CL[iMarker_Monitoring] / (SurfaceCoeff.CD[iMarker_Monitoring] + EPS);
-    SurfaceCoeff.CFx[iMarker_Monitoring] += SurfaceViscCoeff.CFx[iMarker_Monitoring];
-    SurfaceCoeff.CFy[iMarker_Monitoring] += SurfaceViscCoeff.CFy[iMarker_Monitoring];
-    SurfaceCoeff.CFz[iMarker_Monitoring] += SurfaceViscCoeff.CFz[iMarker_Monitoring];
-    SurfaceCoeff.CMx[iMarker_Monitoring] += SurfaceViscCoeff.CMx[iMarker_Monitoring];
-    SurfaceCoeff.CMy[iMarker_Monitoring] += SurfaceViscCoeff.CMy[iMarker_Monitoring];
-    SurfaceCoeff.CMz[iMarker_Monitoring] += SurfaceViscCoeff.CMz[iMarker_Monitoring];
-  }
-
+    /*--- Update the total coefficients (note that all the nodes have the same value)---*/
+
+    TotalCoeff.CD += AllBoundViscCoeff.CD;
+    TotalCoeff.CL += AllBoundViscCoeff.CL;
+    TotalCoeff.CSF += AllBoundViscCoeff.CSF;
+    TotalCoeff.CEff = TotalCoeff.CL / (TotalCoeff.CD + EPS);
+    TotalCoeff.CFx += AllBoundViscCoeff.CFx;
+    TotalCoeff.CFy += AllBoundViscCoeff.CFy;
+    TotalCoeff.CFz += AllBoundViscCoeff.CFz;
+    TotalCoeff.CMx += AllBoundViscCoeff.CMx;
+    TotalCoeff.CMy += AllBoundViscCoeff.CMy;
+    TotalCoeff.CMz += AllBoundViscCoeff.CMz;
+    TotalCoeff.CoPx += AllBoundViscCoeff.CoPx;
+    TotalCoeff.CoPy += AllBoundViscCoeff.CoPy;
+    TotalCoeff.CoPz += AllBoundViscCoeff.CoPz;
+    TotalCoeff.CT += AllBoundViscCoeff.CT;
+    TotalCoeff.CQ += AllBoundViscCoeff.CQ;
+    TotalCoeff.CMerit = AllBoundViscCoeff.CT / (AllBoundViscCoeff.CQ + EPS);
+    Total_Heat = AllBound_HF_Visc;
+    Total_MaxHeat = AllBound_MaxHF_Visc;
+
+    /*--- Update the total coefficients per surface (note that all the nodes have the same value)---*/
+
+    for (auto iMarker_Monitoring = 0u; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
+      SurfaceCoeff.CL[iMarker_Monitoring] += SurfaceViscCoeff.CL[iMarker_Monitoring];
+      SurfaceCoeff.CD[iMarker_Monitoring] += SurfaceViscCoeff.CD[iMarker_Monitoring];
+      SurfaceCoeff.CSF[iMarker_Monitoring] += SurfaceViscCoeff.CSF[iMarker_Monitoring];
+      SurfaceCoeff.CEff[iMarker_Monitoring] =
+          SurfaceCoeff.CL[iMarker_Monitoring] / (SurfaceCoeff.CD[iMarker_Monitoring] + EPS);
+      SurfaceCoeff.CFx[iMarker_Monitoring] += SurfaceViscCoeff.CFx[iMarker_Monitoring];
+      SurfaceCoeff.CFy[iMarker_Monitoring] += SurfaceViscCoeff.CFy[iMarker_Monitoring];
+      SurfaceCoeff.CFz[iMarker_Monitoring] += SurfaceViscCoeff.CFz[iMarker_Monitoring];
+      SurfaceCoeff.CMx[iMarker_Monitoring] += SurfaceViscCoeff.CMx[iMarker_Monitoring];
+      SurfaceCoeff.CMy[iMarker_Monitoring] += SurfaceViscCoeff.CMy[iMarker_Monitoring];
+      SurfaceCoeff.CMz[iMarker_Monitoring] += SurfaceViscCoeff.CMz[iMarker_Monitoring];
+    }
+  });
 
   Buffet_Monitoring(geometry, config);
-
 }
 
 template<class V, ENUM_REGIME R>
@@ -86,6 +86,22 @@ protected:
    */
   virtual unsigned long SetPrimitive_Variables(CSolver **solver_container, const CConfig *config);
 
+  /*!
+   * \brief Instantiate a SIMD numerics object.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) final;
+
+  /*!
+   * \brief Whether the vectorized edge loop is used, the scalar numerics are used with wall
+   *        functions since the SIMD viscous flux does not apply the wall shear stress.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline bool UseEdgeNumericsSIMD(const CConfig* config) const {
+    return config->GetUseVectorization() && !config->GetWall_Functions();
+  }
+
   /*!
    * \brief Update the Beta parameter for the incompressible preconditioner.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -59,7 +59,7 @@ protected:
   su2double Global_Delta_Time = 0.0, /*!< \brief Time-step for TIME_STEPPING time marching strategy. */
   Global_Delta_UnstTimeND = 0.0;     /*!< \brief Unsteady time step for the dual time strategy. */
 
-  CNEMOGas  *FluidModel;          /*!< \brief fluid model used in the solver */
+  vector<CNEMOGas*> FluidModel;   /*!< \brief Fluid models used in the solver (one per thread). */
 
   CNEMOEulerVariable* node_infty = nullptr;
 
@@ -221,7 +221,7 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CNEMOGas* GetFluidModel(void) const final { return FluidModel;}
+  inline CNEMOGas* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()]; }
 
   /*!
    * \brief Impose the far-field boundary condition using characteristics.
@@ -342,4 +342,9 @@ public:
    */
   void PrintVerificationError(const CConfig* config) const final { }
 
+  /*!
+   * \brief The NEMO Euler and NS solvers support MPI+OpenMP.
+   */
+  inline bool GetHasHybridParallel() const final { return true; }
+
 };
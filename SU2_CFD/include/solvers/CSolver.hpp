@@ -144,6 +144,14 @@ protected:
 
   bool dynamic_grid;       /*!< \brief Flag that determines whether the grid is dynamic (moving or deforming + grid velocities). */
 
+  bool overlapHaloComms = false;  /*!< \brief The solver can overlap halo comms with its interior edges (see CompleteOrDeferComms). */
+  bool deferHaloComms = false;    /*!< \brief The halo comms of reconstruction gradients and limiters are being deferred. */
+  struct {
+    CGeometry* geometry = nullptr;
+    const CConfig* config = nullptr;
+    unsigned short commType = 0;
+  } deferredComm;                 /*!< \brief Halo comm that was initiated but not completed. */
+
   vector<su2activematrix> VertexTraction;          /*- Temporary, this will be moved to a new postprocessing structure once in place -*/
   vector<su2activematrix> VertexTractionAdjoint;   /*- Also temporary -*/
 
@@ -178,6 +186,15 @@ private:
    */
   void InterpolateRestartData(const CGeometry *geometry, const CConfig *config);
 
+  /*!
+   * \brief Read the data of a compressed restart file, the header (Restart_Vars) was read already.
+   * \note Only the blocks that contain the points of this rank are read (collectively) and decompressed.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] filename - Name of the restart file (with extension).
+   */
+  void Read_SU2_Restart_Compressed(const CGeometry *geometry, const CConfig *config, const string& filename);
+
   /*--- Private to prevent use by derived solvers, each solver MUST have its own "nodes" member of the
    most derived type possible, e.g. CEulerSolver has nodes of CEulerVariable* and not CVariable*.
    This variable is to avoid two virtual functions calls per call i.e. CSolver::GetNodes() returns
@@ -262,6 +279,38 @@ public:
                      const CConfig *config,
                      unsigned short commType);
 
+  /*!
+   * \brief Complete the comms launched by InitiateComms(), or defer their completion if they are the halo
+   *        comms of reconstruction gradients or limiters and the solver is deferring them (SetDeferHaloComms).
+   * \note The deferred comms are completed by the next InitiateComms() or by the convective residual,
+   *       before the partition boundary edges, which are the only ones that need the halo data.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config   - Definition of the particular problem.
+   * \param[in] commType - Enumerated type for the quantity to be unpacked.
+   */
+  void CompleteOrDeferComms(CGeometry *geometry,
+                            const CConfig *config,
+                            unsigned short commType);
+
+  /*!
+   * \brief Complete the deferred comms, if there are any.
+   * \param[in] stopDeferring - Also stop deferring comms (until the next SetDeferHaloComms).
+   */
+  void CompleteDeferredComms(bool stopDeferring = true);
+
+  /*!
+   * \brief Let the next preprocessing defer the halo comms of reconstruction gradients and limiters,
+   *        if the solver supports it (OVERLAP_HALO_COMMS).
+   * \note Only for the integrations, where the convective residual always follows the preprocessing.
+   */
+  inline void SetDeferHaloComms() {
+    if (!overlapHaloComms) return;
+    SU2_OMP_MASTER
+    deferHaloComms = true;
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
   /*!
    * \brief Helper function to define the type and number of variables per point for each communication type.
    * \param[in] config - Definition of the particular problem.
@@ -1442,6 +1491,22 @@ public:
                                                 CSolver **solver_container,
                                                 CConfig *config) { }
 
+  /*!
+   * \brief Product of the off-diagonal blocks of the flux Jacobians with a direction, computed edge
+   *        by edge with the vectorized numerics, without storing the blocks (see UpdateType::PRODUCT).
+   * \note Gradients, limiters, and primitives are those of the last residual evaluation. The diagonal
+   *       blocks (boundary conditions, sources, pseudotime) are not included, nor is the MPI communication.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] direction - Vector to multiply, including its halo values.
+   * \param[out] product - Result of the product.
+   * \return False if the edge fluxes of the solver are not computed with vectorized numerics.
+   */
+  inline virtual bool EdgeFluxProduct(const CGeometry *geometry,
+                                      const CConfig *config,
+                                      const CSysVector<su2double>& direction,
+                                      CSysVector<su2double>& product) { return false; }
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1659,6 +1724,14 @@ public:
    */
   inline virtual void SetTotal_CL(su2double val_Total_CL) { }
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] val_Total_CMx - Value of the total moment coefficient about the x axis.
+   * \param[in] val_Total_CMy - Value of the total moment coefficient about the y axis.
+   * \param[in] val_Total_CMz - Value of the total moment coefficient about the z axis.
+   */
+  inline virtual void SetTotal_CM(su2double val_Total_CMx, su2double val_Total_CMy, su2double val_Total_CMz) { }
+
   /*!
    * \brief A virtual member.
    * \param[in] val_Total_CD - Value of the total drag coefficient.
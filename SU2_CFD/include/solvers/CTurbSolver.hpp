@@ -31,6 +31,8 @@
 #include "../variables/CTurbVariable.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 
+class CNumericsSIMD;
+
 /*!
  * \class CTurbSolver
  * \brief Main class for defining the turbulence model solver.
@@ -64,11 +66,11 @@ protected:
 
   /*--- Shallow copy of grid coloring for OpenMP parallelization. ---*/
 
-#ifdef HAVE_OMP
   vector<GridColor<> > EdgeColoring;   /*!< \brief Edge colors. */
+  unsigned long nEdgeColorInterior = 0; /*!< \brief Number of leading colors without halo points (OVERLAP_HALO_COMMS). */
+#ifdef HAVE_OMP
   bool ReducerStrategy = false;        /*!< \brief If the reducer strategy is in use. */
 #else
-  array<DummyGridColor<>,1> EdgeColoring;
   /*--- Never use the reducer strategy if compiling for MPI-only. ---*/
   static constexpr bool ReducerStrategy = false;
 #endif
@@ -76,6 +78,8 @@ protected:
   /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for edge flux and source computation. */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -86,6 +90,15 @@ protected:
    */
   inline CVariable* GetBaseClassPointerToNodes() final { return nodes; }
 
+  /*!
+   * \brief Compute the source residual contribution of all points using vectorized numerics.
+   * \note Only the models for which "CNumericsSIMD::ComputeSource" is implemented can use this.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PointSourceResidual(const CGeometry *geometry, const CSolver* const* solvers, const CConfig *config);
+
 private:
 
   /*!
@@ -109,6 +122,21 @@ private:
    */
   void SumEdgeFluxes(CGeometry* geometry);
 
+  /*!
+   * \brief Instantiate a SIMD numerics object.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config);
+
+  /*!
+   * \brief Method to compute convective and viscous residual contribution using vectorized numerics.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void EdgeFluxResidual(CGeometry *geometry, const CSolver* const* solvers, const CConfig *config);
+
   /*!
    * \brief Compute a suitable under-relaxation parameter to limit the change in the solution variables over
    * a nonlinear iteration for stability.
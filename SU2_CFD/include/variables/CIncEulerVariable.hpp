@@ -320,6 +320,7 @@ public:
    * \return Value of the vorticity.
    */
   inline su2double *GetVorticity(unsigned long iPoint) final { return Vorticity[iPoint]; }
+  inline const MatrixType& GetVorticity() const { return Vorticity; }
 
   /*!
    * \brief Get the value of the magnitude of rate of strain.
@@ -327,6 +328,7 @@ public:
    */
   inline su2double GetStrainMag(unsigned long iPoint) const final { return StrainMag(iPoint); }
   inline su2activevector& GetStrainMag() { return StrainMag; }
+  inline const su2activevector& GetStrainMag() const { return StrainMag; }
 
   /*!
    * \brief Set the recovered pressure for streamwise periodic flow.
@@ -73,8 +73,6 @@ protected:
   MatrixType Cvves;  /*!< \brief Specific heat of vib-el mode w.r.t. species. */
   VectorType Gamma;  /*!< \brief Ratio of specific heats. */
 
-  CNEMOGas *fluidmodel;
-
   /*!< \brief Index definition for NEMO pritimive variables. */
   unsigned long RHOS_INDEX, T_INDEX, TVE_INDEX, VEL_INDEX, P_INDEX,
   RHO_INDEX, H_INDEX, A_INDEX, RHOCVTR_INDEX, RHOCVVE_INDEX,
@@ -301,10 +299,11 @@ public:
 
    /*!
   * \brief Set all the primitive and secondary variables from the conserved vector.
+  * \note The gas model is passed explicitly (rather than stored) for thread safety.
   */
-  bool Cons2PrimVar(su2double *U, su2double *V, su2double *dPdU,
+  bool Cons2PrimVar(CNEMOGas *fluidmodel, su2double *U, su2double *V, su2double *dPdU,
                     su2double *dTdU, su2double *dTvedU, su2double *val_eves,
-                    su2double *val_Cvves);
+                    su2double *val_Cvves) const;
 
   /*---------------------------------------*/
   /*---   Specific variable routines    ---*/
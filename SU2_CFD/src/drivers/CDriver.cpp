@@ -31,9 +31,11 @@
 #include "../../../Common/include/geometry/CDummyGeometry.hpp"
 #include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
 #include "../../../Common/include/geometry/CMultiGridGeometry.hpp"
+#include "../../../Common/include/toolboxes/CMonitorReduction.hpp"
 
 #include "../../include/solvers/CSolverFactory.hpp"
 #include "../../include/solvers/CFEM_DG_EulerSolver.hpp"
+#include "../../include/solvers/CCheckpointStore.hpp"
 
 #include "../../include/output/COutputFactory.hpp"
 #include "../../include/output/COutput.hpp"
@@ -112,6 +114,10 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
 
+  globalComm = MPICommunicator;
+  zoneComm = MPICommunicator;
+  instComm = MPICommunicator;
+
   /*--- Start timer to track preprocessing for benchmarking. ---*/
 
   StartTime = SU2_MPI::Wtime();
@@ -124,6 +130,14 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
 
   Input_Preprocessing(config_container, driver_config);
 
+  /*--- Split the ranks among the zones if they are computed concurrently. ---*/
+
+  Concurrent_Zones_Preprocessing();
+
+  /*--- Or among the harmonic balance instances. ---*/
+
+  Instance_Groups_Preprocessing();
+
   /*--- Retrieve dimension from mesh file ---*/
 
   nDim = CConfig::GetnDim(config_container[ZONE_0]->GetMesh_FileName(),
@@ -159,15 +173,18 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
       /*--- Preprocessing of the geometry for all zones. In this routine, the edge-
        based data structure is constructed, i.e. node and cell neighbors are
        identified and linked, face areas and volumes of the dual mesh cells are
-       computed, and the multigrid levels are created using an agglomeration procedure. ---*/
+       computed, and the multigrid levels are created using an agglomeration procedure.
+       Zones and instances computed by other ranks are represented by a dummy geometry. ---*/
 
-      Geometrical_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], dry_run);
+      Geometrical_Preprocessing(config_container[iZone], geometry_container[iZone][iInst],
+                                dry_run || !OwnsZone(iZone) || !OwnsInstance(iInst));
 
     }
   }
 
   /*--- Before we proceed with the zone loop we have to compute the wall distances.
-     * This computation depends on all zones at once. ---*/
+     * This computation depends on all zones at once (except for concurrent zones,
+     * where only the walls of the zone computed by the rank are considered). ---*/
   if (rank == MASTER_NODE)
     cout << "Computing wall distances." << endl;
 
@@ -177,6 +194,8 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
 
     for (iInst = 0; iInst < nInst[iZone]; iInst++){
 
+      config_container[iZone]->SetiInst(iInst);
+
       /*--- Definition of the solver class: solver_container[#ZONES][#INSTANCES][#MG_GRIDS][#EQ_SYSTEMS].
        The solver classes are specific to a particular set of governing equations,
        and they contain the subroutines with instructions for computing each spatial
@@ -214,8 +233,9 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
 
       /*--- Dynamic mesh processing.  ---*/
 
-      DynamicMesh_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], solver_container[iZone][iInst],
-                                iteration_container[iZone][iInst], grid_movement[iZone][iInst], surface_movement[iZone]);
+      if (OwnsInstance(iInst))
+        DynamicMesh_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], solver_container[iZone][iInst],
+                                  iteration_container[iZone][iInst], grid_movement[iZone][iInst], surface_movement[iZone]);
       /*--- Static mesh processing.  ---*/
 
       StaticMesh_Preprocessing(config_container[iZone], geometry_container[iZone][iInst]);
@@ -235,8 +255,13 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
     if (rank == MASTER_NODE)
       cout << endl <<"------------------- Multizone Interface Preprocessing -------------------" << endl;
 
+    /*--- The interfaces connect ranks of different zones. ---*/
+
+    SetGlobalComm();
+
     Interface_Preprocessing(config_container, solver_container, geometry_container,
                             interface_types, interface_container, interpolator_container);
+    SetZoneComm();
   }
 
   if (fsi) {
@@ -275,12 +300,20 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
   MDOFsDomain        = 0.0;
   Mpoints            = 0.0;
   MpointsDomain      = 0.0;
+  MeshBandwidth      = config_container[ZONE_0]->GetMesh_Read_Bandwidth();
   for (iZone = 0; iZone < nZone; iZone++) {
     Mpoints       += geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPoint()/(1.0e6);
     MpointsDomain += geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPointDomain()/(1.0e6);
     MDOFs         += DOFsPerPoint*geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPoint()/(1.0e6);
     MDOFsDomain   += DOFsPerPoint*geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPointDomain()/(1.0e6);
   }
+  if (concurrentZones) {
+    /*--- Each rank only has the points of its zone, sum the counts of the roots of the zones. ---*/
+    su2double counts[] = {Mpoints, MpointsDomain, MDOFs, MDOFsDomain}, total[4];
+    if (rank != zoneRoot[ownZone]) for (auto& count : counts) count = 0.0;
+    SU2_MPI::Allreduce(counts, total, 4, MPI_DOUBLE, MPI_SUM, globalComm);
+    Mpoints = total[0]; MpointsDomain = total[1]; MDOFs = total[2]; MDOFsDomain = total[3];
+  }
 
   /*--- Reset timer for compute/output performance benchmarking. ---*/
 
@@ -364,6 +397,24 @@ void CDriver::Postprocessing() {
       cout << "Warning: " << config_container[ZONE_0]->GetNonphysical_Reconstr() << " reconstructed states for upwinding are non-physical." << endl;
   }
 
+  /*--- Complete pending reads of the checkpoint store, and free the MPI objects of the
+   * monitoring reductions, before MPI is finalized. ---*/
+
+  CCheckpointStore::GetInstance().Clear();
+  CMonitorReduction::GetInstance().Clear();
+
+  /*--- Complete the asynchronous writes of restart files. ---*/
+
+  if (output_container != nullptr) {
+    for (iZone = 0; iZone < nZone; iZone++) {
+      if (output_container[iZone] == nullptr) continue;
+      output_container[iZone]->CompleteAsyncOutput(config_container[iZone]);
+      AsyncWriteTime += output_container[iZone]->GetAsyncWriteTime();
+      AsyncWaitTime += output_container[iZone]->GetAsyncWaitTime();
+    }
+    if (AsyncWriteTime > 0.0) BandwidthSum = config_container[ZONE_0]->GetRestart_Bandwidth_Agg();
+  }
+
   if (rank == MASTER_NODE)
     cout << endl <<"------------------------- Solver Postprocessing -------------------------" << endl;
 
@@ -479,9 +530,16 @@ void CDriver::Postprocessing() {
   delete [] nInst;
   if (rank == MASTER_NODE) cout << "Deleted nInst container." << endl;
 
-  /*--- Deallocate output container ---*/
+  /*--- Deallocate output container, keeping the cost of the history groups for the performance summary. ---*/
 
   if (output_container!= nullptr) {
+    for (iZone = 0; iZone < nZone; iZone++) {
+      if (output_container[iZone] == nullptr) continue;
+      for (const auto& cost : output_container[iZone]->GetHistoryGroupCost()) {
+        HistoryGroupCost[cost.first].first += cost.second.first;
+        HistoryGroupCost[cost.first].second += cost.second.second;
+      }
+    }
     for (iZone = 0; iZone < nZone; iZone++)
       delete output_container[iZone];
     delete [] output_container;
@@ -491,6 +549,16 @@ void CDriver::Postprocessing() {
 
   if (rank == MASTER_NODE) cout << "Deleted COutput class." << endl;
 
+#ifdef HAVE_MPI
+  if (concurrentZones || instanceGroups) {
+    SetGlobalComm();
+    MPI_Comm_free(&zoneComm);
+    if (instanceGroups) MPI_Comm_free(&instComm);
+    concurrentZones = false;
+    instanceGroups = false;
+  }
+#endif
+
   if (rank == MASTER_NODE) cout << "-------------------------------------------------------------------------" << endl;
 
 
@@ -517,6 +585,10 @@ void CDriver::Postprocessing() {
     cout << "Preprocessing phase:" << endl;
     cout << setw(25) << "Preproc. Time (s):"  << setw(12)<< UsedTimePreproc << " | ";
     cout << setw(20) << "Preproc. Time (%):" << setw(12)<< ((UsedTimePreproc * 100.0) / (TotalTime)) << endl;
+    if (MeshBandwidth > 0) {
+      cout << setw(25) << "Mesh Read BW (MB/s):" << setw(12)<< MeshBandwidth << " | ";
+      cout << setw(20) << "MB/s/core:" << setw(12)<< MeshBandwidth/size << endl;
+    }
     cout << endl;
     cout << "Compute phase:" << endl;
     cout << setw(25) << "Compute Time (s):"  << setw(12)<< UsedTimeCompute << " | ";
@@ -538,7 +610,19 @@ void CDriver::Postprocessing() {
         cout << setw(25)<< "Restart Aggr. BW (MB/s):" << setw(12)<< BandwidthSum/OutputCount << " | ";
         cout << setw(20)<< "MB/s/core:" << setw(12)<< BandwidthSum/OutputCount/size << endl;
       }
+      if (AsyncWriteTime > 0) {
+        cout << setw(25)<< "Async. Restart Write (s):" << setw(12)<< AsyncWriteTime << " | ";
+        cout << setw(20)<< "Overlap (%):" << setw(12)<< 100.0*(1.0-AsyncWaitTime/AsyncWriteTime) << endl;
+      }
     } else cout << endl;
+    if (!HistoryGroupCost.empty()) {
+      cout << endl;
+      cout << "History output groups (evaluated on demand):" << endl;
+      for (const auto& cost : HistoryGroupCost) {
+        cout << setw(25) << (cost.first + " (s):") << setw(12) << cost.second.first << " | ";
+        cout << setw(20) << "Evaluations:" << setw(12) << cost.second.second << endl;
+      }
+    }
     cout << "-------------------------------------------------------------------------" << endl;
     cout << endl;
   }
@@ -599,6 +683,222 @@ void CDriver::Input_Preprocessing(CConfig **&config, CConfig *&driver_config) {
   fsi = config_container[ZONE_0]->GetFSI_Simulation();
 }
 
+void CDriver::Concurrent_Zones_Preprocessing() {
+
+  if (!driver_config->GetConcurrent_Zones() || (nZone < 2) || dry_run) return;
+
+#ifdef HAVE_MPI
+
+  /*--- Only the Jacobi coupling lets the zones iterate at the same time, and only the
+   * transfers of the interface conditions are prepared for zones without points. ---*/
+
+  if (driver_config->GetKind_MZSolver() != ENUM_MULTIZONE::MZ_BLOCK_JACOBI)
+    SU2_MPI::Error("CONCURRENT_ZONES requires MULTIZONE_SOLVER= BLOCK_JACOBI.", CURRENT_FUNCTION);
+
+  if (driver_config->GetDiscrete_Adjoint())
+    SU2_MPI::Error("CONCURRENT_ZONES is not available for the discrete adjoint.", CURRENT_FUNCTION);
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    const auto config = config_container[iZone];
+    if (config->GetStructuralProblem() || config->GetDeform_Mesh() || config->GetBoolTurbomachinery() ||
+        config->GetFEMSolver() || (config->GetnTimeInstances() > 1)) {
+      SU2_MPI::Error("CONCURRENT_ZONES is not available with structural zones, mesh deformation,\n"
+                     "turbomachinery, harmonic balance, or the FEM solver.", CURRENT_FUNCTION);
+    }
+  }
+
+  if (size < nZone)
+    SU2_MPI::Error("CONCURRENT_ZONES requires at least one MPI rank per zone.", CURRENT_FUNCTION);
+
+  /*--- Cost of each zone, proportional to the number of points by default, or equal
+   * if that is not known for some zone. ZONE_COST overrides the default. ---*/
+
+  vector<su2double> cost(nZone, 1.0);
+
+  if (driver_config->GetnZone_Cost() == 0) {
+    vector<unsigned long> nPointZone(nZone, 0);
+    if (rank == MASTER_NODE) {
+      for (iZone = 0; iZone < nZone; iZone++)
+        nPointZone[iZone] = GetZone_nPointGlobal(config_container[iZone], iZone);
+    }
+    SU2_MPI::Bcast(nPointZone.data(), nZone, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+
+    if (find(nPointZone.begin(), nPointZone.end(), 0ul) == nPointZone.end()) {
+      for (iZone = 0; iZone < nZone; iZone++) cost[iZone] = nPointZone[iZone];
+    }
+  }
+  else {
+    if (driver_config->GetnZone_Cost() != nZone)
+      SU2_MPI::Error("ZONE_COST must have one value per zone.", CURRENT_FUNCTION);
+
+    for (iZone = 0; iZone < nZone; iZone++) {
+      cost[iZone] = driver_config->GetZone_Cost(iZone);
+      if (cost[iZone] <= 0.0) SU2_MPI::Error("The values of ZONE_COST must be positive.", CURRENT_FUNCTION);
+    }
+  }
+
+  /*--- Each zone gets one rank, the others are given one at a time to the
+   * zone with the highest cost per rank. Zones get contiguous blocks of ranks. ---*/
+
+  vector<int> nRanks(nZone, 1);
+
+  for (int iRank = nZone; iRank < size; iRank++) {
+    unsigned short maxZone = 0;
+    for (iZone = 1; iZone < nZone; iZone++) {
+      if (cost[iZone] / nRanks[iZone] > cost[maxZone] / nRanks[maxZone]) maxZone = iZone;
+    }
+    nRanks[maxZone]++;
+  }
+
+  zoneRoot.assign(nZone, 0);
+  for (iZone = 1; iZone < nZone; iZone++) zoneRoot[iZone] = zoneRoot[iZone-1] + nRanks[iZone-1];
+
+  ownZone = 0;
+  while ((ownZone+1 < nZone) && (rank >= zoneRoot[ownZone+1])) ownZone++;
+
+  MPI_Comm_split(globalComm, ownZone, rank, &zoneComm);
+  concurrentZones = true;
+
+  if (rank == MASTER_NODE) {
+    cout << endl << "Concurrent zones, ranks per zone:";
+    for (iZone = 0; iZone < nZone; iZone++) cout << " " << nRanks[iZone];
+    cout << "." << endl;
+  }
+
+  /*--- From here on, the current communicator is that of the zone, collective
+   * operations that involve all the zones must switch to the global one. ---*/
+
+  SetZoneComm();
+
+#endif
+}
+
+unsigned long CDriver::GetZone_nPointGlobal(const CConfig* config, unsigned short val_iZone) const {
+
+  const string meshFilename = config->GetMesh_FileName();
+  unsigned long nPointGlobal = 0;
+
+  switch (config->GetMesh_FileFormat()) {
+    case SU2: {
+      ifstream mesh_file(meshFilename);
+      if (mesh_file.fail()) break;
+
+      /*--- Find the zone in multizone files, then its NPOIN= keyword. ---*/
+
+      string text_line;
+      if (config->GetMultizone_Mesh()) {
+        bool foundZone = false;
+        while (!foundZone && getline(mesh_file, text_line)) {
+          const auto position = text_line.find("IZONE=", 0);
+          if (position != string::npos)
+            foundZone = (atoi(text_line.substr(position+6).c_str()) == val_iZone+1);
+        }
+        if (!foundZone) break;
+      }
+      while (getline(mesh_file, text_line)) {
+        const auto position = text_line.find("NPOIN=", 0);
+        if (position != string::npos) {
+          nPointGlobal = atol(text_line.substr(position+6).c_str());
+          break;
+        }
+        if (text_line.find("IZONE=", 0) != string::npos) break;
+      }
+      break;
+    }
+    case SU2_BINARY: {
+      unsigned long header[BINARY_MESH_HEADER_SIZE] = {0};
+      FILE* meshFile = fopen(meshFilename.c_str(), "rb");
+      if (meshFile == nullptr) break;
+      if ((fread(header, sizeof(unsigned long), BINARY_MESH_HEADER_SIZE, meshFile) == BINARY_MESH_HEADER_SIZE) &&
+          (header[BINARY_MESH_MAGIC] == SU2_BINARY_MESH_MAGIC)) {
+        nPointGlobal = header[BINARY_MESH_NPOINT];
+      }
+      fclose(meshFile);
+      break;
+    }
+#ifdef HAVE_CGNS
+    case CGNS_GRID: {
+      /*--- CGNS files contain a single zone. ---*/
+      int fileID;
+      if (cg_open(meshFilename.c_str(), CG_MODE_READ, &fileID)) break;
+      cgsize_t cgsize[3] = {0};
+      char zonename[CGNS_STRING_SIZE];
+      if (!cg_zone_read(fileID, 1, 1, zonename, cgsize)) nPointGlobal = cgsize[0];
+      cg_close(fileID);
+      break;
+    }
+#endif
+    case RECTANGLE:
+      nPointGlobal = static_cast<unsigned long>(config->GetMeshBoxSize(0)) * config->GetMeshBoxSize(1);
+      break;
+    case BOX:
+      nPointGlobal = static_cast<unsigned long>(config->GetMeshBoxSize(0)) * config->GetMeshBoxSize(1) *
+                     config->GetMeshBoxSize(2);
+      break;
+    default:
+      break;
+  }
+  return nPointGlobal;
+}
+
+void CDriver::Instance_Groups_Preprocessing() {
+
+  const auto config = config_container[ZONE_0];
+  const int nGroups = config->GetnHB_InstanceGroups();
+
+  if ((nGroups < 2) || dry_run) return;
+
+  if (config->GetTime_Marching() != TIME_MARCHING::HARMONIC_BALANCE)
+    SU2_MPI::Error("HB_INSTANCE_GROUPS requires TIME_MARCHING= HARMONIC_BALANCE.", CURRENT_FUNCTION);
+
+#ifdef HAVE_MPI
+
+  if ((nZone > 1) || config->GetBoolTurbomachinery() || config->GetDeform_Mesh() || config->GetDiscrete_Adjoint())
+    SU2_MPI::Error("HB_INSTANCE_GROUPS is not available for multiple zones, turbomachinery,\n"
+                   "mesh deformation, or the discrete adjoint.", CURRENT_FUNCTION);
+
+  const unsigned short nInstTotal = config->GetnTimeInstances();
+
+  if (nInstTotal % nGroups != 0)
+    SU2_MPI::Error("TIME_INSTANCES must be a multiple of HB_INSTANCE_GROUPS.", CURRENT_FUNCTION);
+
+  /*--- Groups of the same size partition the mesh in the same way, which
+   * allows the instances to be coupled point by point. ---*/
+
+  if (size % nGroups != 0)
+    SU2_MPI::Error("The number of MPI ranks must be a multiple of HB_INSTANCE_GROUPS.", CURRENT_FUNCTION);
+
+  const int groupSize = size / nGroups;
+  const int group = rank / groupSize;
+
+  nInstGroup = nInstTotal / nGroups;
+  firstInst = group * nInstGroup;
+
+  /*--- Ranks of the same group compute together, ranks with the same position
+   * in their groups (same partition) exchange the instances. ---*/
+
+  MPI_Comm_split(globalComm, group, rank, &zoneComm);
+  MPI_Comm_split(globalComm, rank % groupSize, group, &instComm);
+  instanceGroups = true;
+
+  if (rank == MASTER_NODE) {
+    cout << endl << "Harmonic balance instances split among " << nGroups << " groups of "
+         << groupSize << " ranks (" << nInstGroup << " instances per group)." << endl;
+  }
+
+  SetZoneComm();
+
+#endif
+}
+
+void CDriver::SetGlobalComm() const {
+  if (concurrentZones || instanceGroups) SU2_MPI::SetComm(globalComm);
+}
+
+void CDriver::SetZoneComm() const {
+  if (concurrentZones || instanceGroups) SU2_MPI::SetComm(zoneComm);
+}
+
 void CDriver::Geometrical_Preprocessing(CConfig* config, CGeometry **&geometry, bool dummy){
 
   if (!dummy){
@@ -1028,7 +1328,8 @@ void CDriver::Solver_Preprocessing(CConfig* config, CGeometry** geometry, CSolve
   /*--- Restart solvers, for FSI the geometry cannot be updated because the interpolation classes
    * should always use the undeformed mesh (otherwise the results would not be repeatable). ---*/
 
-  if (!fsi) Solver_Restart(solver, geometry, config, true);
+  if (!fsi && OwnsZone(config->GetiZone()) && OwnsInstance(config->GetiInst()))
+    Solver_Restart(solver, geometry, config, true);
 
   /*--- Set up any necessary inlet profiles ---*/
 
@@ -2499,8 +2800,8 @@ void CDriver::Output_Preprocessing(CConfig **config, CConfig *driver_config, COu
 
     output[iZone] = COutputFactory::CreateOutput(kindSolver, config[iZone], nDim);
 
-    /*--- If dry-run is used, do not open/overwrite history file. ---*/
-    output[iZone]->PreprocessHistoryOutput(config[iZone], !dry_run);
+    /*--- If dry-run is used, do not open/overwrite history file. The same for zones computed by other ranks. ---*/
+    output[iZone]->PreprocessHistoryOutput(config[iZone], !dry_run && OwnsZone(iZone));
 
     output[iZone]->PreprocessVolumeOutput(config[iZone]);
 
@@ -2510,9 +2811,15 @@ void CDriver::Output_Preprocessing(CConfig **config, CConfig *driver_config, COu
     if (rank == MASTER_NODE)
       cout << endl <<"------------------- Output Preprocessing ( Multizone ) ------------------" << endl;
 
+    /*--- The multizone output gathers all the zones. ---*/
+
+    SetGlobalComm();
+
     driver_output = COutputFactory::CreateMultizoneOutput(driver_config, config, nDim);
 
     driver_output->PreprocessMultizoneHistoryOutput(output, config, driver_config, !dry_run);
+
+    SetZoneComm();
   }
 
   /*--- Check for an unsteady restart. Update ExtIter if necessary. ---*/
@@ -2737,8 +3044,10 @@ void CFluidDriver::Preprocess(unsigned long Iter) {
   if(!fsi) {
     for (iZone = 0; iZone < nZone; iZone++) {
       if (config_container[iZone]->GetFluidProblem()) {
-        for (iInst = 0; iInst < nInst[iZone]; iInst++)
-          solver_container[iZone][iInst][MESH_0][FLOW_SOL]->SetInitialCondition(geometry_container[iZone][INST_0], solver_container[iZone][iInst], config_container[iZone], Iter);
+        for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+          if (!OwnsInstance(iInst)) continue;
+          solver_container[iZone][iInst][MESH_0][FLOW_SOL]->SetInitialCondition(geometry_container[iZone][iInst], solver_container[iZone][iInst], config_container[iZone], Iter);
+        }
       }
     }
   }
@@ -2899,6 +3208,7 @@ void CFluidDriver::Output(unsigned long InnerIter) {
     const auto inst = config_container[iZone]->GetiInst();
 
     for (iInst = 0; iInst < nInst[iZone]; ++iInst) {
+      if (!OwnsInstance(iInst)) continue;
       config_container[iZone]->SetiInst(iInst);
       output_container[iZone]->SetResult_Files(geometry_container[iZone][iInst][MESH_0],
                                                config_container[iZone],
@@ -3163,14 +3473,17 @@ CHBDriver::CHBDriver(char* confFile,
 
   output_legacy = COutputFactory::CreateLegacyOutput(config_container[ZONE_0]);
 
-  /*--- Open the convergence history file ---*/
+  if (instanceGroups) CheckInstancePartitions();
+
+  /*--- Open the convergence history file (of each instance, by the root of the ranks that compute it). ---*/
   ConvHist_file = nullptr;
   ConvHist_file = new ofstream*[nZone];
   for (iZone = 0; iZone < nZone; iZone++) {
     ConvHist_file[iZone] = nullptr;
-    if (rank == MASTER_NODE){
+    if (SU2_MPI::GetRank() == MASTER_NODE){
       ConvHist_file[iZone] = new ofstream[nInst[iZone]];
       for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+        if (!OwnsInstance(iInst)) continue;
         output_legacy->SetConvHistory_Header(&ConvHist_file[iZone][iInst], config_container[iZone], iZone, iInst);
       }
     }
@@ -3187,16 +3500,61 @@ CHBDriver::~CHBDriver(void) {
   for (kInst = 0; kInst < nInstHB; kInst++) delete [] D[kInst];
   delete [] D;
 
-  if (rank == MASTER_NODE){
   /*--- Close the convergence history file. ---*/
   for (iZone = 0; iZone < nZone; iZone++) {
+    if (ConvHist_file[iZone] == nullptr) continue;
     for (iInst = 0; iInst < nInstHB; iInst++) {
       ConvHist_file[iZone][iInst].close();
     }
     delete [] ConvHist_file[iZone];
   }
   delete [] ConvHist_file;
+}
+
+template<class F>
+void CHBDriver::GatherInstances(unsigned long blockSize, const F& pack, vector<su2double>& data) const {
+
+  data.resize(nInstHB*blockSize);
+
+  if (!instanceGroups) {
+    for (auto kInst = 0u; kInst < nInstHB; kInst++) pack(kInst, &data[kInst*blockSize]);
+    return;
   }
+
+  /*--- The groups own consecutive instances, in the order of their rank in instComm. ---*/
+
+  vector<su2double> sendBuf(nInstGroup*blockSize);
+  for (auto kInst = 0u; kInst < nInstGroup; kInst++) pack(firstInst+kInst, &sendBuf[kInst*blockSize]);
+
+  SU2_MPI::Allgather(sendBuf.data(), nInstGroup*blockSize, MPI_DOUBLE,
+                     data.data(), nInstGroup*blockSize, MPI_DOUBLE, instComm);
+}
+
+void CHBDriver::CheckInstancePartitions() const {
+
+  /*--- The instances are coupled point by point, the ranks that exchange them must have the
+   * same points on all grid levels. Compare the counts and a checksum of the global indices. ---*/
+
+  const auto geometry = geometry_container[ZONE_0][firstInst];
+  const auto nMGlevels = config_container[ZONE_0]->GetnMGLevels();
+
+  vector<unsigned long> local(nMGlevels+2, 0);
+  for (auto iMGlevel = 0u; iMGlevel <= nMGlevels; iMGlevel++)
+    local[iMGlevel] = geometry[iMGlevel]->GetnPoint();
+
+  for (auto iPoint = 0ul; iPoint < geometry[MESH_0]->GetnPoint(); iPoint++)
+    local[nMGlevels+1] += geometry[MESH_0]->nodes->GetGlobalIndex(iPoint) % 65521;
+
+  vector<unsigned long> minVal(local.size()), maxVal(local.size());
+  SU2_MPI::Allreduce(local.data(), minVal.data(), local.size(), MPI_UNSIGNED_LONG, MPI_MIN, instComm);
+  SU2_MPI::Allreduce(local.data(), maxVal.data(), local.size(), MPI_UNSIGNED_LONG, MPI_MAX, instComm);
+
+  int mismatch = (minVal != maxVal), anyMismatch = 0;
+  SU2_MPI::Allreduce(&mismatch, &anyMismatch, 1, MPI_INT, MPI_MAX, globalComm);
+
+  if (anyMismatch)
+    SU2_MPI::Error("The instance groups have different partitions of the mesh, HB_INSTANCE_GROUPS\n"
+                   "requires a deterministic partitioner.", CURRENT_FUNCTION);
 }
 
 
@@ -3206,20 +3564,43 @@ void CHBDriver::Run() {
    all zones before beginning the iteration. ---*/
 
   for (iInst = 0; iInst < nInstHB; iInst++)
-    iteration_container[ZONE_0][iInst]->Preprocess(output_container[ZONE_0], integration_container, geometry_container,
-        solver_container, numerics_container, config_container,
-        surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+    if (OwnsInstance(iInst))
+      iteration_container[ZONE_0][iInst]->Preprocess(output_container[ZONE_0], integration_container, geometry_container,
+          solver_container, numerics_container, config_container,
+          surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
 
   for (iInst = 0; iInst < nInstHB; iInst++)
-    iteration_container[ZONE_0][iInst]->Iterate(output_container[ZONE_0], integration_container, geometry_container,
-        solver_container, numerics_container, config_container,
-        surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+    if (OwnsInstance(iInst))
+      iteration_container[ZONE_0][iInst]->Iterate(output_container[ZONE_0], integration_container, geometry_container,
+          solver_container, numerics_container, config_container,
+          surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+
+  /*--- The HB output of the first instance uses the coefficients of all the instances. ---*/
+
+  if (instanceGroups) {
+    vector<su2double> coeffs;
+    GatherInstances(5, [&](unsigned short kInst, su2double* coeff) {
+      const auto solver = solver_container[ZONE_0][kInst][MESH_0][FLOW_SOL];
+      coeff[0] = solver->GetTotal_CL();  coeff[1] = solver->GetTotal_CD();
+      coeff[2] = solver->GetTotal_CMx(); coeff[3] = solver->GetTotal_CMy(); coeff[4] = solver->GetTotal_CMz();
+    }, coeffs);
+
+    for (iInst = 0; iInst < nInstHB; iInst++) {
+      if (OwnsInstance(iInst)) continue;
+      const auto solver = solver_container[ZONE_0][iInst][MESH_0][FLOW_SOL];
+      const su2double* coeff = &coeffs[5*iInst];
+      solver->SetTotal_CL(coeff[0]);
+      solver->SetTotal_CD(coeff[1]);
+      solver->SetTotal_CM(coeff[2], coeff[3], coeff[4]);
+    }
+  }
 
   /*--- Update the convergence history file (serial and parallel computations). ---*/
 
   for (iZone = 0; iZone < nZone; iZone++) {
     for (iInst = 0; iInst < nInst[iZone]; iInst++)
-      output_legacy->SetConvHistory_Body(&ConvHist_file[iZone][iInst], geometry_container, solver_container,
+      if (OwnsInstance(iInst))
+        output_legacy->SetConvHistory_Body(&ConvHist_file[iZone][iInst], geometry_container, solver_container,
           config_container, integration_container, false, UsedTime, iZone, iInst);
   }
 
@@ -3227,9 +3608,52 @@ void CHBDriver::Run() {
 
 void CHBDriver::Update() {
 
+  /*--- With instance groups, first gather the solutions of the instances computed by other ranks. ---*/
+
+  if (instanceGroups) {
+    const auto config = config_container[ZONE_0];
+    const bool adjoint = config->GetContinuous_Adjoint();
+    const bool implicit = adjoint ? (config->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT) :
+                                    (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+    const auto kindSol = adjoint ? ADJFLOW_SOL : FLOW_SOL;
+    const bool rans = (config->GetKind_Solver() == RANS);
+    const auto nMGlevels = config->GetnMGLevels();
+    const auto geometry = geometry_container[ZONE_0][firstInst];
+    const auto nVar = solver_container[ZONE_0][firstInst][MESH_0][kindSol]->GetnVar();
+    const unsigned short nVarTurb = rans ? solver_container[ZONE_0][firstInst][MESH_0][TURB_SOL]->GetnVar() : 0;
+
+    /*--- Values of one instance: solution (and old solution) at each point of each grid level,
+     * then the turbulence solution on the finest grid. ---*/
+
+    instanceOffset.resize(nMGlevels+2);
+    instanceSize = 0;
+    for (auto iMGlevel = 0u; iMGlevel <= nMGlevels; iMGlevel++) {
+      instanceOffset[iMGlevel] = instanceSize;
+      instanceSize += geometry[iMGlevel]->GetnPoint() * nVar * (implicit ? 2 : 1);
+    }
+    instanceOffset[nMGlevels+1] = instanceSize;
+    instanceSize += geometry[MESH_0]->GetnPoint() * nVarTurb;
+
+    GatherInstances(instanceSize, [&](unsigned short kInst, su2double* values) {
+      for (auto iMGlevel = 0u; iMGlevel <= nMGlevels; iMGlevel++) {
+        const auto nodes = solver_container[ZONE_0][kInst][iMGlevel][kindSol]->GetNodes();
+        for (auto iPoint = 0ul; iPoint < geometry[iMGlevel]->GetnPoint(); iPoint++) {
+          for (auto iVar = 0u; iVar < nVar; iVar++) *(values++) = nodes->GetSolution(iPoint, iVar);
+          if (implicit)
+            for (auto iVar = 0u; iVar < nVar; iVar++) *(values++) = nodes->GetSolution_Old(iPoint, iVar);
+        }
+      }
+      if (rans) {
+        const auto nodes = solver_container[ZONE_0][kInst][MESH_0][TURB_SOL]->GetNodes();
+        for (auto iPoint = 0ul; iPoint < geometry[MESH_0]->GetnPoint(); iPoint++)
+          for (auto iVar = 0u; iVar < nVarTurb; iVar++) *(values++) = nodes->GetSolution(iPoint, iVar);
+      }
+    }, instanceData);
+  }
+
   for (iInst = 0; iInst < nInstHB; iInst++) {
     /*--- Compute the harmonic balance terms across all zones ---*/
-    SetHarmonicBalance(iInst);
+    if (OwnsInstance(iInst)) SetHarmonicBalance(iInst);
 
   }
 
@@ -3241,6 +3665,8 @@ void CHBDriver::Update() {
 
   for (iInst = 0; iInst < nInstHB; iInst++) {
 
+    if (!OwnsInstance(iInst)) continue;
+
     /*--- Update the harmonic balance terms across all zones ---*/
     iteration_container[ZONE_0][iInst]->Update(output_container[ZONE_0], integration_container, geometry_container,
         solver_container, numerics_container, config_container,
@@ -3250,6 +3676,20 @@ void CHBDriver::Update() {
 
 }
 
+bool CHBDriver::Monitor(unsigned long ExtIter) {
+
+  CFluidDriver::Monitor(ExtIter);
+
+  /*--- The convergence of the first instance is known by its group, the other groups follow. ---*/
+
+  if (instanceGroups) {
+    int stop = StopCalc;
+    SU2_MPI::Bcast(&stop, 1, MPI_INT, MASTER_NODE, globalComm);
+    StopCalc = stop;
+  }
+  return StopCalc;
+}
+
 void CHBDriver::ResetConvergence() {
 
   for(iInst = 0; iInst < nZone; iInst++) {
@@ -3278,7 +3718,7 @@ void CHBDriver::ResetConvergence() {
 void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
 
   unsigned short iVar, jInst, iMGlevel;
-  unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
+  unsigned short nVar = solver_container[ZONE_0][iInst][MESH_0][FLOW_SOL]->GetnVar();
   unsigned long iPoint;
   bool implicit = (config_container[ZONE_0]->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   bool adjoint = (config_container[ZONE_0]->GetContinuous_Adjoint());
@@ -3286,6 +3726,18 @@ void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
     implicit = (config_container[ZONE_0]->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT);
   }
 
+  /*--- Solution of instance jInst, from the gathered values if the instances are split among groups. ---*/
+  const auto kindSol = adjoint ? ADJFLOW_SOL : FLOW_SOL;
+  const unsigned long stride = nVar * (implicit ? 2 : 1);
+  auto solution = [&](unsigned short jInst, unsigned short iMGlevel, unsigned long iPoint,
+                      unsigned short iVar, bool old) -> su2double {
+    if (!instanceGroups) {
+      const auto nodes = solver_container[ZONE_0][jInst][iMGlevel][kindSol]->GetNodes();
+      return old ? nodes->GetSolution_Old(iPoint, iVar) : nodes->GetSolution(iPoint, iVar);
+    }
+    return instanceData[jInst*instanceSize + instanceOffset[iMGlevel] + iPoint*stride + old*nVar + iVar];
+  };
+
   unsigned long InnerIter = config_container[ZONE_0]->GetInnerIter();
 
   /*--- Retrieve values from the config file ---*/
@@ -3323,11 +3775,11 @@ void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
         for (iVar = 0; iVar < nVar; iVar++) {
 
           if (!adjoint) {
-            U[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->GetNodes()->GetSolution(iPoint, iVar);
+            U[iVar] = solution(jInst, iMGlevel, iPoint, iVar, false);
             Source[iVar] += U[iVar]*D[iInst][jInst];
 
             if (implicit) {
-              U_old[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->GetNodes()->GetSolution_Old(iPoint, iVar);
+              U_old[iVar] = solution(jInst, iMGlevel, iPoint, iVar, true);
               deltaU = U[iVar] - U_old[iVar];
               Source[iVar] += deltaU*D[iInst][jInst];
             }
@@ -3335,11 +3787,11 @@ void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
           }
 
           else {
-            Psi[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->GetSolution(iPoint, iVar);
+            Psi[iVar] = solution(jInst, iMGlevel, iPoint, iVar, false);
             Source[iVar] += Psi[iVar]*D[jInst][iInst];
 
             if (implicit) {
-              Psi_old[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->GetSolution_Old(iPoint, iVar);
+              Psi_old[iVar] = solution(jInst, iMGlevel, iPoint, iVar, true);
               deltaPsi = Psi[iVar] - Psi_old[iVar];
               Source[iVar] += deltaPsi*D[jInst][iInst];
             }
@@ -3364,19 +3816,23 @@ void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
   if (config_container[ZONE_0]->GetKind_Solver() == RANS) {
 
     /*--- Extra variables needed if we have a turbulence model. ---*/
-    unsigned short nVar_Turb = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetnVar();
+    unsigned short nVar_Turb = solver_container[ZONE_0][iInst][MESH_0][TURB_SOL]->GetnVar();
     su2double *U_Turb = new su2double[nVar_Turb];
     su2double *Source_Turb = new su2double[nVar_Turb];
+    const unsigned long offsetTurb = instanceOffset.empty() ? 0 : instanceOffset.back();
 
     /*--- Loop over only the finest mesh level (turbulence is always solved
      on the original grid only). ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint(); iPoint++) {
+    for (iPoint = 0; iPoint < geometry_container[ZONE_0][iInst][MESH_0]->GetnPoint(); iPoint++) {
       for (iVar = 0; iVar < nVar_Turb; iVar++) Source_Turb[iVar] = 0.0;
       for (jInst = 0; jInst < nInstHB; jInst++) {
 
         /*--- Retrieve solution at this node in current zone ---*/
         for (iVar = 0; iVar < nVar_Turb; iVar++) {
-          U_Turb[iVar] = solver_container[ZONE_0][jInst][MESH_0][TURB_SOL]->GetNodes()->GetSolution(iPoint, iVar);
+          if (!instanceGroups)
+            U_Turb[iVar] = solver_container[ZONE_0][jInst][MESH_0][TURB_SOL]->GetNodes()->GetSolution(iPoint, iVar);
+          else
+            U_Turb[iVar] = instanceData[jInst*instanceSize + offsetTurb + iPoint*nVar_Turb + iVar];
           Source_Turb[iVar] += U_Turb[iVar]*D[iInst][jInst];
         }
       }
@@ -3401,10 +3857,34 @@ void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
 void CHBDriver::StabilizeHarmonicBalance() {
 
   unsigned short i, j, k, iVar, iInst, jInst, iMGlevel;
-  unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
+  unsigned short nVar = solver_container[ZONE_0][firstInst][MESH_0][FLOW_SOL]->GetnVar();
   unsigned long iPoint;
   bool adjoint = (config_container[ZONE_0]->GetContinuous_Adjoint());
 
+  /*--- With instance groups, gather the sources of all the instances and the time step of the first. ---*/
+  CGeometry** geometry = geometry_container[ZONE_0][firstInst];
+  const unsigned short nMGlevels = config_container[ZONE_0]->GetnMGLevels();
+  const unsigned long stride = nVar + 1;
+  vector<unsigned long> offset(nMGlevels+1, 0);
+  unsigned long blockSize = 0;
+  vector<su2double> sources;
+
+  if (instanceGroups) {
+    for (iMGlevel = 0; iMGlevel <= nMGlevels; iMGlevel++) {
+      offset[iMGlevel] = blockSize;
+      blockSize += geometry[iMGlevel]->GetnPoint() * stride;
+    }
+    GatherInstances(blockSize, [&](unsigned short kInst, su2double* values) {
+      for (auto kMGlevel = 0u; kMGlevel <= nMGlevels; kMGlevel++) {
+        const auto nodes = solver_container[ZONE_0][kInst][kMGlevel][FLOW_SOL]->GetNodes();
+        for (auto kPoint = 0ul; kPoint < geometry[kMGlevel]->GetnPoint(); kPoint++) {
+          for (auto kVar = 0u; kVar < nVar; kVar++) *(values++) = nodes->GetHarmonicBalance_Source(kPoint, kVar);
+          *(values++) = nodes->GetDelta_Time(kPoint);
+        }
+      }
+    }, sources);
+  }
+
   /*--- Retrieve values from the config file ---*/
   su2double *Source     = new su2double[nInstHB];
   su2double *Source_old = new su2double[nInstHB];
@@ -3421,10 +3901,13 @@ void CHBDriver::StabilizeHarmonicBalance() {
   for (iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
 
     /*--- Loop over each node in the volume mesh ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][INST_0][iMGlevel]->GetnPoint(); iPoint++) {
+    for (iPoint = 0; iPoint < geometry[iMGlevel]->GetnPoint(); iPoint++) {
 
       /*--- Get time step for current node ---*/
-      Delta = solver_container[ZONE_0][INST_0][iMGlevel][FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint);
+      if (!instanceGroups)
+        Delta = solver_container[ZONE_0][INST_0][iMGlevel][FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint);
+      else
+        Delta = sources[offset[iMGlevel] + iPoint*stride + nVar];
 
       /*--- Setup stabilization matrix for this node ---*/
       for (iInst = 0; iInst < nInstHB; iInst++) {
@@ -3523,7 +4006,10 @@ void CHBDriver::StabilizeHarmonicBalance() {
 
         /*--- Get current source terms (not yet preconditioned) and zero source array to prepare preconditioning ---*/
         for (iInst = 0; iInst < nInstHB; iInst++) {
-          Source_old[iInst] = solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes()->GetHarmonicBalance_Source(iPoint, iVar);
+          if (!instanceGroups)
+            Source_old[iInst] = solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes()->GetHarmonicBalance_Source(iPoint, iVar);
+          else
+            Source_old[iInst] = sources[iInst*blockSize + offset[iMGlevel] + iPoint*stride + iVar];
           Source[iInst] = 0;
         }
 
@@ -3532,6 +4018,7 @@ void CHBDriver::StabilizeHarmonicBalance() {
           for (jInst = 0; jInst < nInstHB; jInst++) {
             Source[iInst] += P[iInst][jInst]*Source_old[jInst];
           }
+          if (!OwnsInstance(iInst)) continue;
 
           /*--- Store updated source terms for current node ---*/
           if (!adjoint) {
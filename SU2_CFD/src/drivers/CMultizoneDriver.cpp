@@ -234,6 +234,8 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
       config_container[iZone]->SetPhysicalTime(0.0);
     }
 
+    if (!OwnsZone(iZone)) continue;
+
     /*--- Set the initial condition for EULER/N-S/RANS ---------------------------------------------*/
     /*--- For FSI, the initial conditions are set, after the mesh has been moved. --------------------------------------*/
     if (!fsi && config_container[iZone]->GetFluidProblem()) {
@@ -253,7 +255,7 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
 
   /*--- Run a predictor step ---*/
   for (iZone = 0; iZone < nZone; iZone++) {
-    if (config_container[iZone]->GetPredictor())
+    if (config_container[iZone]->GetPredictor() && OwnsZone(iZone))
       iteration_container[iZone][INST_0]->Predictor(output_container[iZone], integration_container, geometry_container,
                                                     solver_container, numerics_container, config_container, surface_movement,
                                                     grid_movement, FFDBox, iZone, INST_0);
@@ -265,12 +267,14 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
 
   /*--- Updating zone interface communication patterns for unsteady problems with pre-fixed motion in the config file ---*/
   if (driver_config->GetTime_Domain()) {
+    SetGlobalComm();
     for (iZone = 0; iZone < nZone; iZone++) {
       for (unsigned short jZone = 0; jZone < nZone; jZone++){
         if(jZone != iZone && interpolator_container[iZone][jZone] != nullptr && prefixed_motion[iZone])
           interpolator_container[iZone][jZone]->SetTransferCoeff(config_container);
       }
     }
+    SetZoneComm();
   }
 
 }
@@ -337,7 +341,9 @@ void CMultizoneDriver::Run_Jacobi() {
   /*--- Loop over the number of outer iterations ---*/
   for (auto iOuter_Iter = 0ul; iOuter_Iter < driver_config->GetnOuter_Iter(); iOuter_Iter++){
 
-    /*--- Transfer from all zones ---*/
+    /*--- Transfer from all zones. With concurrent zones all ranks take part in all the transfers. ---*/
+    SetGlobalComm();
+
     for (iZone = 0; iZone < nZone; iZone++){
 
       /*--- In principle, the mesh does not need to be updated ---*/
@@ -360,7 +366,9 @@ void CMultizoneDriver::Run_Jacobi() {
 
     }
 
-      /*--- Loop over the number of zones (IZONE) ---*/
+    SetZoneComm();
+
+      /*--- Loop over the number of zones (IZONE), with concurrent zones each rank only iterates its own. ---*/
     for (iZone = 0; iZone < nZone; iZone++){
 
       /*--- Set the OuterIter ---*/
@@ -368,6 +376,8 @@ void CMultizoneDriver::Run_Jacobi() {
       config_container[iZone]->Set_StartTime(SU2_MPI::Wtime());
       driver_config->SetOuterIter(iOuter_Iter);
 
+      if (!OwnsZone(iZone)) continue;
+
       /*--- Iterate the zone as a block, either to convergence or to a max number of iterations ---*/
       iteration_container[iZone][INST_0]->Solve(output_container[iZone], integration_container, geometry_container,
                                                 solver_container, numerics_container, config_container,
@@ -398,6 +408,8 @@ bool CMultizoneDriver::OuterConvergence(unsigned long OuterIter) {
 
   for (iZone = 0; iZone < nZone; iZone++) {
 
+    if (!OwnsZone(iZone)) continue;
+
     /*--- Account for all the solvers in this zone. ---*/
 
     auto solvers = solver_container[iZone][INST_0][MESH_0];
@@ -413,11 +425,23 @@ bool CMultizoneDriver::OuterConvergence(unsigned long OuterIter) {
 
   }
 
+  /*--- With concurrent zones, the history of each zone is sent to all ranks by the first rank of the zone,
+   * which makes the convergence decision the same on all ranks. ---*/
+
+  SetGlobalComm();
+
+  if (concurrentZones) {
+    for (iZone = 0; iZone < nZone; iZone++)
+      output_container[iZone]->BroadcastHistoryFields(zoneRoot[iZone], globalComm);
+  }
+
   /*--- Print out the convergence data to screen and history file. ---*/
 
   driver_output->SetMultizoneHistory_Output(output_container, config_container, driver_config,
                                             driver_config->GetTimeIter(), driver_config->GetOuterIter());
 
+  SetZoneComm();
+
   return driver_output->GetConvergence();
 
 }
@@ -431,12 +455,17 @@ void CMultizoneDriver::Update() {
     unsigned short UpdateMesh = 0;
 
     /*--- Transfer from all the remaining zones (JZONE != IZONE)---*/
+    SetGlobalComm();
     for (auto jZone = 0u; jZone < nZone; jZone++){
       /*--- The target zone is iZone ---*/
       if (jZone != iZone){
         UpdateMesh += Transfer_Data(jZone, iZone);
       }
     }
+    SetZoneComm();
+
+    if (!OwnsZone(iZone)) continue;
+
     /*--- If a mesh update is required due to the transfer of data ---*/
     if (UpdateMesh > 0) DynamicMeshUpdate(iZone, TimeIter);
 
@@ -467,6 +496,7 @@ void CMultizoneDriver::Output(unsigned long TimeIter) {
   bool wrote_files = false;
 
   for (iZone = 0; iZone < nZone; iZone++){
+    if (!OwnsZone(iZone)) continue;
     wrote_files = output_container[iZone]->SetResult_Files(geometry_container[iZone][INST_0][MESH_0],
                                                             config_container[iZone],
                                                             solver_container[iZone][INST_0][MESH_0], TimeIter, StopCalc );
@@ -494,7 +524,7 @@ void CMultizoneDriver::DynamicMeshUpdate(unsigned long TimeIter) {
   for (iZone = 0; iZone < nZone; iZone++) {
     const auto harmonic_balance = (config_container[iZone]->GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE);
     /*--- Dynamic mesh update ---*/
-    if ((config_container[iZone]->GetGrid_Movement()) && (!harmonic_balance) && (!fsi)) {
+    if ((config_container[iZone]->GetGrid_Movement()) && (!harmonic_balance) && (!fsi) && OwnsZone(iZone)) {
       iteration_container[iZone][INST_0]->SetGrid_Movement(geometry_container[iZone][INST_0],surface_movement[iZone],
                                                            grid_movement[iZone][INST_0], solver_container[iZone][INST_0],
                                                            config_container[iZone], 0, TimeIter);
@@ -211,6 +211,56 @@ void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_contai
 
 }
 
+void CIntegration::SetRestricted_EddyVisc(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
+                                          CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
+
+  unsigned long iVertex, Point_Fine, Point_Coarse;
+  unsigned short iMarker, iChildren;
+  su2double Area_Parent, Area_Children, EddyVisc_Fine, EddyVisc;
+
+  /*--- Compute coarse Eddy Viscosity from fine solution ---*/
+
+  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
+  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+
+    Area_Parent = geo_coarse->nodes->GetVolume(Point_Coarse);
+
+    EddyVisc = 0.0;
+
+    for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
+      Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
+      Area_Children = geo_fine->nodes->GetVolume(Point_Fine);
+      EddyVisc_Fine = sol_fine->GetNodes()->GetmuT(Point_Fine);
+      EddyVisc += EddyVisc_Fine*Area_Children/Area_Parent;
+    }
+
+    sol_coarse->GetNodes()->SetmuT(Point_Coarse,EddyVisc);
+
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Update solution at the no slip wall boundary, only the first
+   variable (nu_tilde -in SA and SA_NEG- and k -in SST-), to guarantee that the eddy viscoisty
+   is zero on the surface ---*/
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetViscous_Wall(iMarker)) {
+      SU2_OMP_FOR_STAT(32)
+      for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
+        Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
+        sol_coarse->GetNodes()->SetmuT(Point_Coarse,0.0);
+      }
+      END_SU2_OMP_FOR
+    }
+  }
+
+  /*--- MPI the new interpolated solution (this also includes the eddy viscosity) ---*/
+
+  sol_coarse->InitiateComms(geo_coarse, config, SOLUTION_EDDY);
+  sol_coarse->CompleteComms(geo_coarse, config, SOLUTION_EDDY);
+
+}
+
 void CIntegration::SetDualTime_Geometry(CGeometry *geometry, CSolver *mesh_solver, const CConfig *config, unsigned short iMesh) {
 
   SU2_OMP_PARALLEL
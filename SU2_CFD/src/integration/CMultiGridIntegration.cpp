@@ -27,6 +27,7 @@
 
 #include "../../include/integration/CMultiGridIntegration.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CMonitorReduction.hpp"
 
 
 CMultiGridIntegration::CMultiGridIntegration() : CIntegration() { }
@@ -107,6 +108,34 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
   MultiGrid_Cycle(geometry, solver_container, numerics_container, config,
                   FinestMesh, RecursiveParam, RunTime_EqSystem, iZone, iInst);
 
+  /*--- For the turbulence equations, update the eddy viscosity with the corrected solution and
+   copy the turbulence variables to the coarse levels (as the single grid integration), which is
+   what the mean flow uses on those levels. ---*/
+
+  if (RunTime_EqSystem == RUNTIME_TURB_SYS) {
+
+    solver_container[iZone][iInst][FinestMesh][Solver_Position]->Postprocessing(geometry[iZone][iInst][FinestMesh],
+                                                                                solver_container[iZone][iInst][FinestMesh],
+                                                                                config[iZone], FinestMesh);
+
+    for (unsigned short iMesh = FinestMesh; iMesh < config[iZone]->GetnMGLevels(); iMesh++) {
+
+      SetRestricted_Solution(RunTime_EqSystem,
+                             solver_container[iZone][iInst][iMesh][Solver_Position],
+                             solver_container[iZone][iInst][iMesh+1][Solver_Position],
+                             geometry[iZone][iInst][iMesh],
+                             geometry[iZone][iInst][iMesh+1],
+                             config[iZone]);
+
+      SetRestricted_EddyVisc(RunTime_EqSystem,
+                             solver_container[iZone][iInst][iMesh][Solver_Position],
+                             solver_container[iZone][iInst][iMesh+1][Solver_Position],
+                             geometry[iZone][iInst][iMesh],
+                             geometry[iZone][iInst][iMesh+1],
+                             config[iZone]);
+    }
+  }
+
 
   /*--- Computes primitive variables and gradients in the finest mesh (useful for the next solver (turbulence) and output ---*/
 
@@ -174,8 +203,10 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     for (unsigned short iRKStep = 0; iRKStep < iRKLimit; iRKStep++) {
 
-      /*--- Send-Receive boundary conditions, and preprocessing ---*/
+      /*--- Send-Receive boundary conditions, and preprocessing (the halo comms of gradients
+       *    and limiters may be completed by the space integration). ---*/
 
+      solver_fine->SetDeferHaloComms();
       solver_fine->Preprocessing(geometry_fine, solver_container_fine, config, iMesh, iRKStep, RunTime_EqSystem, false);
 
 
@@ -231,6 +262,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     /*--- Compute $r_k = P_k + F_k(u_k)$ ---*/
 
+    solver_fine->SetDeferHaloComms();
     solver_fine->Preprocessing(geometry_fine, solver_container_fine, config, iMesh, NO_RK_ITER, RunTime_EqSystem, false);
 
     Space_Integration(geometry_fine, solver_container_fine, numerics_fine, config, iMesh, NO_RK_ITER, RunTime_EqSystem);
@@ -241,13 +273,14 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     SetRestricted_Solution(RunTime_EqSystem, solver_fine, solver_coarse, geometry_fine, geometry_coarse, config);
 
+    solver_coarse->SetDeferHaloComms();
     solver_coarse->Preprocessing(geometry_coarse, solver_container_coarse, config, iMesh+1, NO_RK_ITER, RunTime_EqSystem, false);
 
     Space_Integration(geometry_coarse, solver_container_coarse, numerics_coarse, config, iMesh+1, NO_RK_ITER, RunTime_EqSystem);
 
     /*--- Compute $P_(k+1) = I^(k+1)_k(r_k) - r_(k+1) ---*/
 
-    SetForcing_Term(solver_fine, solver_coarse, geometry_fine, geometry_coarse, config, iMesh+1);
+    SetForcing_Term(RunTime_EqSystem, solver_fine, solver_coarse, geometry_fine, geometry_coarse, config, iMesh+1);
 
     /*--- Restore the time integration settings. ---*/
 
@@ -271,7 +304,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     SmoothProlongated_Correction(RunTime_EqSystem, solver_fine, geometry_fine, config->GetMG_CorrecSmooth(iMesh), 1.25, config);
 
-    SetProlongated_Correction(solver_fine, geometry_fine, config, iMesh);
+    SetProlongated_Correction(RunTime_EqSystem, solver_fine, geometry_fine, config, iMesh);
 
 
     /*--- Solution post-smoothing in the prolongated grid. ---*/
@@ -280,6 +313,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
       for (unsigned short iRKStep = 0; iRKStep < iRKLimit; iRKStep++) {
 
+        solver_fine->SetDeferHaloComms();
         solver_fine->Preprocessing(geometry_fine, solver_container_fine, config, iMesh, iRKStep, RunTime_EqSystem, false);
 
         if (iRKStep == 0) {
@@ -342,6 +376,8 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
 
   /*--- Remove any contributions from no-slip walls. ---*/
 
+  const vector<su2double> zeroCorrection(nVar, 0.0);
+
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetViscous_Wall(iMarker)) {
 
@@ -353,8 +389,13 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
         /*--- For dirichlet boundary condtions, set the correction to zero.
          Note that Solution_Old stores the correction not the actual value ---*/
 
-        su2double zero[3] = {0.0};
-        sol_coarse->GetNodes()->SetVelocity_Old(Point_Coarse, zero);
+        if (RunTime_EqSystem == RUNTIME_TURB_SYS) {
+          sol_coarse->GetNodes()->SetSolution_Old(Point_Coarse, zeroCorrection.data());
+        }
+        else {
+          su2double zero[3] = {0.0};
+          sol_coarse->GetNodes()->SetVelocity_Old(Point_Coarse, zero);
+        }
 
       }
       END_SU2_OMP_FOR
@@ -366,11 +407,14 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
   sol_coarse->InitiateComms(geo_coarse, config, SOLUTION_OLD);
   sol_coarse->CompleteComms(geo_coarse, config, SOLUTION_OLD);
 
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+  /*--- The parent of a fine point may be a halo if the agglomeration crosses partitions. ---*/
+
+  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPoint(), omp_get_num_threads()))
+  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPoint(); Point_Coarse++) {
     for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
       Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      sol_fine->LinSysRes.SetBlock(Point_Fine, sol_coarse->GetNodes()->GetSolution_Old(Point_Coarse));
+      if (geo_fine->nodes->GetDomain(Point_Fine))
+        sol_fine->LinSysRes.SetBlock(Point_Fine, sol_coarse->GetNodes()->GetSolution_Old(Point_Coarse));
     }
   }
   END_SU2_OMP_FOR
@@ -452,7 +496,7 @@ void CMultiGridIntegration::SmoothProlongated_Correction(unsigned short RunTime_
 
 }
 
-void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeometry *geo_fine,
+void CMultiGridIntegration::SetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine, CGeometry *geo_fine,
                                                       CConfig *config, unsigned short iMesh) {
   unsigned long Point_Fine;
   unsigned short iVar;
@@ -461,16 +505,28 @@ void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeomet
   const unsigned short nVar = sol_fine->GetnVar();
   const su2double factor = config->GetDamp_Correc_Prolong();
 
+  /*--- The turbulence variables (except for the negative SA model) must stay positive. The restriction
+   (volume average) preserves positivity, the correction is scaled such that no variable decreases by more
+   than a fraction of its value, the same factor is used for all variables of a point to keep their ratios. ---*/
+
+  const bool positive = (RunTime_EqSystem == RUNTIME_TURB_SYS) && (config->GetKind_Turb_Model() != SA_NEG);
+  const su2double allowableRatio = 0.99;
+
   SU2_OMP_FOR_STAT(roundUpDiv(geo_fine->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Fine = 0; Point_Fine < geo_fine->GetnPointDomain(); Point_Fine++) {
     Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
     Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
+    su2double limiter = factor;
     for (iVar = 0; iVar < nVar; iVar++) {
       /*--- Prevent a fine grid divergence due to a coarse grid divergence ---*/
       if (Residual_Fine[iVar] != Residual_Fine[iVar])
         Residual_Fine[iVar] = 0.0;
-      Solution_Fine[iVar] += factor*Residual_Fine[iVar];
+      if (positive && (Solution_Fine[iVar] >= 0.0) &&
+          (factor*Residual_Fine[iVar] < -allowableRatio*Solution_Fine[iVar]))
+        limiter = min(limiter, -allowableRatio*Solution_Fine[iVar]/Residual_Fine[iVar]);
     }
+    for (iVar = 0; iVar < nVar; iVar++)
+      Solution_Fine[iVar] += limiter*Residual_Fine[iVar];
   }
   END_SU2_OMP_FOR
 
@@ -486,18 +542,19 @@ void CMultiGridIntegration::SetProlongated_Solution(unsigned short RunTime_EqSys
   unsigned long Point_Fine, Point_Coarse;
   unsigned short iChildren;
 
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPoint(), omp_get_num_threads()))
+  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPoint(); Point_Coarse++) {
     for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
       Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      sol_fine->GetNodes()->SetSolution(Point_Fine, sol_coarse->GetNodes()->GetSolution(Point_Coarse));
+      if (geo_fine->nodes->GetDomain(Point_Fine))
+        sol_fine->GetNodes()->SetSolution(Point_Fine, sol_coarse->GetNodes()->GetSolution(Point_Coarse));
     }
   }
   END_SU2_OMP_FOR
 }
 
-void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
-                                            CGeometry *geo_coarse, CConfig *config, unsigned short iMesh) {
+void CMultiGridIntegration::SetForcing_Term(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
+                                            CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config, unsigned short iMesh) {
 
   unsigned long Point_Fine, Point_Coarse, iVertex;
   unsigned short iMarker, iVar, iChildren;
@@ -508,6 +565,13 @@ void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coar
 
   su2double *Residual = new su2double[nVar];
 
+  /*--- Coarse control volumes may contain fine halo points, which need the residual of their owner. ---*/
+
+  if (config->GetMG_PartitionAgglomeration()) {
+    CSysMatrixComms::Initiate(sol_fine->LinSysRes, geo_fine, config);
+    CSysMatrixComms::Complete(sol_fine->LinSysRes, geo_fine, config);
+  }
+
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
 
@@ -532,7 +596,11 @@ void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coar
       SU2_OMP_FOR_STAT(32)
       for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
         Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
-        sol_coarse->GetNodes()->SetVel_ResTruncError_Zero(Point_Coarse);
+        /*--- All the turbulence variables have dirichlet conditions at the walls. ---*/
+        if (RunTime_EqSystem == RUNTIME_TURB_SYS)
+          sol_coarse->GetNodes()->SetRes_TruncErrorZero(Point_Coarse);
+        else
+          sol_coarse->GetNodes()->SetVel_ResTruncError_Zero(Point_Coarse);
       }
       END_SU2_OMP_FOR
     }
@@ -688,11 +756,13 @@ void CMultiGridIntegration::NonDimensional_Parameters(CGeometry **geometry, CSol
 
     case RUNTIME_FLOW_SYS:
 
-      /*--- Calculate the inviscid and viscous forces ---*/
+      /*--- Calculate the inviscid and viscous forces, all reduced with a single collective. ---*/
 
+      CMonitorReduction::GetInstance().Begin();
       solver_container[FinestMesh][FLOW_SOL]->Pressure_Forces(geometry[FinestMesh], config);
       solver_container[FinestMesh][FLOW_SOL]->Momentum_Forces(geometry[FinestMesh], config);
       solver_container[FinestMesh][FLOW_SOL]->Friction_Forces(geometry[FinestMesh], config);
+      CMonitorReduction::GetInstance().End();
 
       break;
 
@@ -27,6 +27,7 @@
 
 #include "../../include/integration/CNewtonIntegration.hpp"
 #include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/toolboxes/CMonitorReduction.hpp"
 
 using Scalar = CNewtonIntegration::Scalar;
 
@@ -73,6 +74,8 @@ void CNewtonIntegration::Setup() {
   tolRelaxFactor = iparam[2];
   fullTolResidual = dparam[2];
   finDiffStepND = SU2_TYPE::GetValue(dparam[3]);
+  frozenCoeff = config->GetNewtonKrylovFrozenCoeff();
+  edgeProducts = config->GetNewtonKrylovEdgeProducts();
 
   const auto nVar = solvers[FLOW_SOL]->GetnVar();
   const auto nPoint = geometry->GetnPoint();
@@ -88,6 +91,19 @@ void CNewtonIntegration::Setup() {
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, nullptr);
   }
 
+  if (edgeProducts) {
+    /*--- The boundary conditions are only available via the diagonal of the Jacobian. ---*/
+    if (config->GetKind_TimeIntScheme() != EULER_IMPLICIT)
+      SU2_MPI::Error("NEWTON_KRYLOV_EDGE_PRODUCTS requires an implicit time discretization.", CURRENT_FUNCTION);
+
+    edgeRowMask.Initialize(nPoint, nPointDomain, nVar, 1.0);
+
+    if (!std::is_same<Scalar,su2double>::value) {
+      edgeProdIn.Initialize(nPoint, nPointDomain, nVar, nullptr);
+      edgeProdOut.Initialize(nPoint, nPointDomain, nVar, nullptr);
+    }
+  }
+
   /*--- Check if the solver is able to provide a linear preconditioner. ---*/
   if (config->GetKind_TimeIntScheme() != EULER_IMPLICIT) return;
 
@@ -118,23 +134,29 @@ void CNewtonIntegration::PerturbSolution(const CSysVector<Scalar>& dir, Scalar m
 
 void CNewtonIntegration::ComputeResiduals(ResEvalType type) {
 
-  /*--- Save the default integration scheme, and force to explicit if required. ---*/
+  /*--- Save the default integration scheme, and force to explicit if required. For products
+   * the limiters and dissipation coefficients of the current solution can also be kept. ---*/
   auto TimeIntScheme = config->GetKind_TimeIntScheme();
   if (type == EXPLICIT) {
-    SU2_OMP_MASTER
-    config->SetKind_TimeIntScheme(EULER_EXPLICIT);
+    SU2_OMP_MASTER {
+      config->SetKind_TimeIntScheme(EULER_EXPLICIT);
+      config->SetFrozenCoeff(frozenCoeff);
+    }
     END_SU2_OMP_MASTER
     SU2_OMP_BARRIER
   }
 
+  solvers[FLOW_SOL]->SetDeferHaloComms();
   solvers[FLOW_SOL]->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
 
   Space_Integration(geometry, solvers, numerics[FLOW_SOL], config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS);
 
   /*--- Restore default. ---*/
   if (type == EXPLICIT) {
-    SU2_OMP_MASTER
-    config->SetKind_TimeIntScheme(TimeIntScheme);
+    SU2_OMP_MASTER {
+      config->SetKind_TimeIntScheme(TimeIntScheme);
+      config->SetFrozenCoeff(false);
+    }
     END_SU2_OMP_MASTER
     SU2_OMP_BARRIER
   }
@@ -169,6 +191,28 @@ void CNewtonIntegration::ComputeFinDiffStep() {
 
 }
 
+void CNewtonIntegration::SetEdgeRowMask() {
+
+  /*--- Strong boundary conditions delete the rows of the Jacobian (and residual), the edge
+   * products must not add the flux Jacobians to those rows. No other row can have all its
+   * off-diagonal entries equal to 0 unless the flux Jacobians are 0, so nothing is lost. ---*/
+  const auto& jacobian = solvers[FLOW_SOL]->Jacobian;
+  const auto nVar = edgeRowMask.GetNVar();
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      bool coupled = false;
+      for (auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+        const auto* block = jacobian.GetBlock(iPoint, jPoint);
+        for (auto jVar = 0ul; jVar < nVar; ++jVar) coupled |= (block[iVar*nVar+jVar] != 0.0);
+      }
+      edgeRowMask(iPoint,iVar) = coupled;
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
 void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver *****solvers_, CNumerics ******numerics_,
                                              CConfig **config_, unsigned short EqSystem, unsigned short iZone,
                                              unsigned short iInst) {
@@ -244,7 +288,8 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
     iter = Preconditioner_impl(LinSysRes, linSysSol, iter, eps);
   }
   else {
-    ComputeFinDiffStep();
+    if (edgeProducts) SetEdgeRowMask();
+    else ComputeFinDiffStep();
 
     eps *= toleranceFactor;
     iter = LinSolver.FGMRES_LinSolver(LinSysRes, linSysSol, CMatrixFreeProductWrapper(this),
@@ -274,9 +319,11 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
   solvers[FLOW_SOL]->Postprocessing(geometry, solvers, config, MESH_0);
 
   SU2_OMP_MASTER {
+    CMonitorReduction::GetInstance().Begin();
     solvers[FLOW_SOL]->Pressure_Forces(geometry, config);
     solvers[FLOW_SOL]->Momentum_Forces(geometry, config);
     solvers[FLOW_SOL]->Friction_Forces(geometry, config);
+    CMonitorReduction::GetInstance().End();
   }
   END_SU2_OMP_MASTER
 
@@ -300,6 +347,11 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
 
 void CNewtonIntegration::MatrixFreeProduct(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) {
 
+  if (edgeProducts) {
+    EdgeProduct(u, v);
+    return;
+  }
+
   Scalar factor = finDiffStep / u.norm();
 
   PerturbSolution(u, factor);
@@ -330,6 +382,35 @@ void CNewtonIntegration::MatrixFreeProduct(const CSysVector<Scalar>& u, CSysVect
   CSysMatrixComms::Complete(v, geometry, config);
 }
 
+void CNewtonIntegration::EdgeProduct(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) {
+
+  /*--- Off-diagonal blocks, from the flux Jacobians of the edge numerics. ---*/
+  if (!EdgeFluxProduct_impl(u, v)) {
+    SU2_MPI::Error("NEWTON_KRYLOV_EDGE_PRODUCTS requires vectorized numerics (USE_VECTORIZATION= YES).",
+                   CURRENT_FUNCTION);
+  }
+
+  /*--- Diagonal blocks, they include the flux Jacobians, the boundary conditions, sources,
+   * and the pseudotime term, which therefore do not need to be evaluated for each product. ---*/
+  const auto& jacobian = solvers[FLOW_SOL]->Jacobian;
+  const auto nVar = v.GetNVar();
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+    const auto* diag = jacobian.GetBlock(iPoint, iPoint);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      Scalar prod = edgeRowMask(iPoint,iVar) * v(iPoint,iVar);
+      for (auto jVar = 0ul; jVar < nVar; ++jVar)
+        prod += diag[iVar*nVar+jVar] * u(iPoint,jVar);
+      v(iPoint,iVar) = prod;
+    }
+  }
+  END_SU2_OMP_FOR
+
+  CSysMatrixComms::Initiate(v, geometry, config);
+  CSysMatrixComms::Complete(v, geometry, config);
+}
+
 void CNewtonIntegration::Preconditioner(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) const {
 
   if (preconditioner) {
@@ -27,6 +27,7 @@
 
 #include "../../include/iteration/CDiscAdjFluidIteration.hpp"
 #include "../../include/output/COutput.hpp"
+#include "../../include/solvers/CCheckpointStore.hpp"
 
 void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integration, CGeometry**** geometry,
                                         CSolver***** solver, CNumerics****** numerics, CConfig** config,
@@ -49,6 +50,12 @@ void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integr
   if (config[iZone]->GetTime_Marching() != TIME_MARCHING::STEADY) {
     const int Direct_Iter = static_cast<int>(config[iZone]->GetUnst_AdjointIter()) - static_cast<int>(TimeIter) - 2 + dual_time;
 
+    auto& checkpoints = CCheckpointStore::GetInstance();
+    if (TimeIter == 0) {
+      checkpoints.SetOptions(config[iZone]->GetUnst_AdjointCheckpoints(),
+                             config[iZone]->GetUnst_AdjointCheckpointCompression());
+    }
+
     /*--- For dual-time stepping we want to load the already converged solution at timestep n ---*/
 
     if (TimeIter == 0) {
@@ -270,6 +277,15 @@ void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integr
 
     }  // else if TimeIter > 0
 
+    /*--- Start reading the solution needed by the next time iteration, it completes when loaded. ---*/
+
+    const int Next_Iter = Direct_Iter - 1 - (dual_time_1st ? 1 : 2);
+    if (dual_time && (Next_Iter >= 0) && (TimeIter+1 < config[iZone]->GetnTime_Iter()) &&
+        config[iZone]->GetRead_Binary_Restart()) {
+      checkpoints.Prefetch(geometries[MESH_0],
+                           config[iZone]->GetFilename(config[iZone]->GetSolution_FileName(), "", Next_Iter) + ".dat");
+    }
+
     /*--- Compute & set Grid Velocity via finite differences of the Coordinates. ---*/
     if (grid_IsMoving)
       for (auto iMesh = 0u; iMesh <= config[iZone]->GetnMGLevels(); iMesh++)
@@ -85,15 +85,15 @@ void CBaselineOutput::SetVolumeOutputFields(CConfig *config){
   }
 
   // Grid coordinates
-  AddVolumeOutput(fields[0], fields[0], "COORDINATES", "x-component of the coordinate vector");
-  AddVolumeOutput(fields[1], fields[1], "COORDINATES", "y-component of the coordinate vector");
+  AddVolumeOutput(fields[0], fields[0], "COORDINATES", "x-component of the coordinate vector", VolumeFieldType::RESTART);
+  AddVolumeOutput(fields[1], fields[1], "COORDINATES", "y-component of the coordinate vector", VolumeFieldType::RESTART);
   if (nDim == 3)
-    AddVolumeOutput(fields[2], fields[2], "COORDINATES", "z-component of the coordinate vector");
+    AddVolumeOutput(fields[2], fields[2], "COORDINATES", "z-component of the coordinate vector", VolumeFieldType::RESTART);
 
   // Add all the remaining fields
 
   for (iField = nDim; iField < fields.size(); iField++){
-    AddVolumeOutput(fields[iField], fields[iField], "SOLUTION","");
+    AddVolumeOutput(fields[iField], fields[iField], "SOLUTION","", VolumeFieldType::RESTART);
   }
 
 }
@@ -128,18 +128,18 @@ void CFlowCompFEMOutput::SetHistoryOutputFields(CConfig *config){
 void CFlowCompFEMOutput::SetVolumeOutputFields(CConfig *config){
 
   // Grid coordinates
-  AddVolumeOutput("COORD-X", "x", "COORDINATES", "x-component of the coordinate vector");
-  AddVolumeOutput("COORD-Y", "y", "COORDINATES", "y-component of the coordinate vector");
+  AddVolumeOutput("COORD-X", "x", "COORDINATES", "x-component of the coordinate vector", VolumeFieldType::RESTART);
+  AddVolumeOutput("COORD-Y", "y", "COORDINATES", "y-component of the coordinate vector", VolumeFieldType::RESTART);
   if (nDim == 3)
-    AddVolumeOutput("COORD-Z", "z", "COORDINATES", "z-component of the coordinate vector");
+    AddVolumeOutput("COORD-Z", "z", "COORDINATES", "z-component of the coordinate vector", VolumeFieldType::RESTART);
 
   // Solution variables
-  AddVolumeOutput("DENSITY",    "Density",    "SOLUTION", "Density");
-  AddVolumeOutput("MOMENTUM-X", "Momentum_x", "SOLUTION", "x-component of the momentum vector");
-  AddVolumeOutput("MOMENTUM-Y", "Momentum_y", "SOLUTION", "y-component of the momentum vector");
+  AddVolumeOutput("DENSITY",    "Density",    "SOLUTION", "Density", VolumeFieldType::RESTART);
+  AddVolumeOutput("MOMENTUM-X", "Momentum_x", "SOLUTION", "x-component of the momentum vector", VolumeFieldType::RESTART);
+  AddVolumeOutput("MOMENTUM-Y", "Momentum_y", "SOLUTION", "y-component of the momentum vector", VolumeFieldType::RESTART);
   if (nDim == 3)
-    AddVolumeOutput("MOMENTUM-Z", "Momentum_z", "SOLUTION", "z-component of the momentum vector");
-  AddVolumeOutput("ENERGY",     "Energy",     "SOLUTION", "Energy");
+    AddVolumeOutput("MOMENTUM-Z", "Momentum_z", "SOLUTION", "z-component of the momentum vector", VolumeFieldType::RESTART);
+  AddVolumeOutput("ENERGY",     "Energy",     "SOLUTION", "Energy", VolumeFieldType::RESTART);
 
   // Primitive variables
   AddVolumeOutput("PRESSURE",    "Pressure",                "PRIMITIVE", "Pressure");
@@ -262,7 +262,9 @@ void CFlowCompFEMOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, C
 
   /*--- Set the analyse surface history values --- */
 
-  SetAnalyzeSurface(flow_solver, geometry, config, false);
+  LoadHistoryGroups({"FLOW_COEFF", "FLOW_COEFF_SURF"}, [&]() {
+    SetAnalyzeSurface(flow_solver, geometry, config, false);
+  });
 
   /*--- Set aeroydnamic coefficients --- */
 
@@ -289,22 +289,22 @@ void CFlowCompOutput::SetVolumeOutputFields(CConfig *config){
   AddCoordinates();
 
   // Solution variables
-  AddVolumeOutput("DENSITY",    "Density",    "SOLUTION", "Density");
-  AddVolumeOutput("MOMENTUM-X", "Momentum_x", "SOLUTION", "x-component of the momentum vector");
-  AddVolumeOutput("MOMENTUM-Y", "Momentum_y", "SOLUTION", "y-component of the momentum vector");
+  AddVolumeOutput("DENSITY",    "Density",    "SOLUTION", "Density", VolumeFieldType::RESTART);
+  AddVolumeOutput("MOMENTUM-X", "Momentum_x", "SOLUTION", "x-component of the momentum vector", VolumeFieldType::RESTART);
+  AddVolumeOutput("MOMENTUM-Y", "Momentum_y", "SOLUTION", "y-component of the momentum vector", VolumeFieldType::RESTART);
   if (nDim == 3)
-    AddVolumeOutput("MOMENTUM-Z", "Momentum_z", "SOLUTION", "z-component of the momentum vector");
-  AddVolumeOutput("ENERGY",     "Energy",     "SOLUTION", "Energy");
+    AddVolumeOutput("MOMENTUM-Z", "Momentum_z", "SOLUTION", "z-component of the momentum vector", VolumeFieldType::RESTART);
+  AddVolumeOutput("ENERGY",     "Energy",     "SOLUTION", "Energy", VolumeFieldType::RESTART);
 
   // Turbulent Residuals
   switch(config->GetKind_Turb_Model()){
   case SST: case SST_SUST:
-    AddVolumeOutput("TKE", "Turb_Kin_Energy", "SOLUTION", "Turbulent kinetic energy");
-    AddVolumeOutput("DISSIPATION", "Omega", "SOLUTION", "Rate of dissipation");
+    AddVolumeOutput("TKE", "Turb_Kin_Energy", "SOLUTION", "Turbulent kinetic energy", VolumeFieldType::RESTART);
+    AddVolumeOutput("DISSIPATION", "Omega", "SOLUTION", "Rate of dissipation", VolumeFieldType::RESTART);
     break;
   case SA: case SA_COMP: case SA_E:
   case SA_E_COMP: case SA_NEG:
-    AddVolumeOutput("NU_TILDE", "Nu_Tilde", "SOLUTION", "Spalart-Allmaras variable");
+    AddVolumeOutput("NU_TILDE", "Nu_Tilde", "SOLUTION", "Spalart-Allmaras variable", VolumeFieldType::RESTART);
     break;
   case NONE:
     break;
@@ -312,10 +312,10 @@ void CFlowCompOutput::SetVolumeOutputFields(CConfig *config){
 
   // Grid velocity
   if (gridMovement){
-    AddVolumeOutput("GRID_VELOCITY-X", "Grid_Velocity_x", "GRID_VELOCITY", "x-component of the grid velocity vector");
-    AddVolumeOutput("GRID_VELOCITY-Y", "Grid_Velocity_y", "GRID_VELOCITY", "y-component of the grid velocity vector");
+    AddVolumeOutput("GRID_VELOCITY-X", "Grid_Velocity_x", "GRID_VELOCITY", "x-component of the grid velocity vector", VolumeFieldType::RESTART);
+    AddVolumeOutput("GRID_VELOCITY-Y", "Grid_Velocity_y", "GRID_VELOCITY", "y-component of the grid velocity vector", VolumeFieldType::RESTART);
     if (nDim == 3 )
-      AddVolumeOutput("GRID_VELOCITY-Z", "Grid_Velocity_z", "GRID_VELOCITY", "z-component of the grid velocity vector");
+      AddVolumeOutput("GRID_VELOCITY-Z", "Grid_Velocity_z", "GRID_VELOCITY", "z-component of the grid velocity vector", VolumeFieldType::RESTART);
   }
 
   // Primitive variables
@@ -678,7 +678,9 @@ void CFlowCompOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSol
 
   /*--- Set the analyse surface history values --- */
 
-  SetAnalyzeSurface(flow_solver, geometry, config, false);
+  LoadHistoryGroups({"FLOW_COEFF", "FLOW_COEFF_SURF"}, [&]() {
+    SetAnalyzeSurface(flow_solver, geometry, config, false);
+  });
 
   /*--- Set aeroydnamic coefficients --- */
 
@@ -692,12 +694,18 @@ void CFlowCompOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSol
 
   SetRotatingFrameCoefficients(config, flow_solver);
 
-  /*--- Set Cp diff fields ---*/
+  /*--- Set Cp diff fields, the target is read on the first inner iteration. ---*/
 
-  Set_CpInverseDesign(flow_solver, geometry, config);
+  LoadHistoryGroups({"CP_DIFF"}, [&]() {
+    Set_CpInverseDesign(flow_solver, geometry, config);
+  }, config->GetInnerIter() == 0);
 
   /*--- Set nearfield diff fields ---*/
-  if (config->GetEquivArea()) Set_NearfieldInverseDesign(flow_solver, geometry, config);
+  if (config->GetEquivArea()) {
+    LoadHistoryGroups({"EQUIVALENT_AREA"}, [&]() {
+      Set_NearfieldInverseDesign(flow_solver, geometry, config);
+    });
+  }
 
 }
 
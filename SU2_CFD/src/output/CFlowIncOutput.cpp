@@ -356,7 +356,9 @@ void CFlowIncOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSolv
 
   /*--- Set the analyse surface history values --- */
 
-  SetAnalyzeSurface(flow_solver, geometry, config, false);
+  LoadHistoryGroups({"FLOW_COEFF", "FLOW_COEFF_SURF"}, [&]() {
+    SetAnalyzeSurface(flow_solver, geometry, config, false);
+  });
 
   /*--- Set aeroydnamic coefficients --- */
 
@@ -375,22 +377,22 @@ void CFlowIncOutput::SetVolumeOutputFields(CConfig *config){
   AddCoordinates();
 
   // SOLUTION variables
-  AddVolumeOutput("PRESSURE",   "Pressure",   "SOLUTION", "Pressure");
-  AddVolumeOutput("VELOCITY-X", "Velocity_x", "SOLUTION", "x-component of the velocity vector");
-  AddVolumeOutput("VELOCITY-Y", "Velocity_y", "SOLUTION", "y-component of the velocity vector");
+  AddVolumeOutput("PRESSURE",   "Pressure",   "SOLUTION", "Pressure", VolumeFieldType::RESTART);
+  AddVolumeOutput("VELOCITY-X", "Velocity_x", "SOLUTION", "x-component of the velocity vector", VolumeFieldType::RESTART);
+  AddVolumeOutput("VELOCITY-Y", "Velocity_y", "SOLUTION", "y-component of the velocity vector", VolumeFieldType::RESTART);
   if (nDim == 3)
-    AddVolumeOutput("VELOCITY-Z", "Velocity_z", "SOLUTION", "z-component of the velocity vector");
+    AddVolumeOutput("VELOCITY-Z", "Velocity_z", "SOLUTION", "z-component of the velocity vector", VolumeFieldType::RESTART);
   if (heat || weakly_coupled_heat)
-    AddVolumeOutput("TEMPERATURE",  "Temperature","SOLUTION", "Temperature");
+    AddVolumeOutput("TEMPERATURE",  "Temperature","SOLUTION", "Temperature", VolumeFieldType::RESTART);
 
   switch(config->GetKind_Turb_Model()){
   case SST: case SST_SUST:
-    AddVolumeOutput("TKE", "Turb_Kin_Energy", "SOLUTION", "Turbulent kinetic energy");
-    AddVolumeOutput("DISSIPATION", "Omega", "SOLUTION", "Rate of dissipation");
+    AddVolumeOutput("TKE", "Turb_Kin_Energy", "SOLUTION", "Turbulent kinetic energy", VolumeFieldType::RESTART);
+    AddVolumeOutput("DISSIPATION", "Omega", "SOLUTION", "Rate of dissipation", VolumeFieldType::RESTART);
     break;
   case SA: case SA_COMP: case SA_E:
   case SA_E_COMP: case SA_NEG:
-    AddVolumeOutput("NU_TILDE", "Nu_Tilde", "SOLUTION", "Spalart–Allmaras variable");
+    AddVolumeOutput("NU_TILDE", "Nu_Tilde", "SOLUTION", "Spalart–Allmaras variable", VolumeFieldType::RESTART);
     break;
   case NONE:
     break;
@@ -398,14 +400,14 @@ void CFlowIncOutput::SetVolumeOutputFields(CConfig *config){
 
   // Radiation variables
   if (config->AddRadiation())
-    AddVolumeOutput("P1-RAD", "Radiative_Energy(P1)", "SOLUTION", "Radiative Energy");
+    AddVolumeOutput("P1-RAD", "Radiative_Energy(P1)", "SOLUTION", "Radiative Energy", VolumeFieldType::RESTART);
 
   // Grid velocity
   if (gridMovement){
-    AddVolumeOutput("GRID_VELOCITY-X", "Grid_Velocity_x", "GRID_VELOCITY", "x-component of the grid velocity vector");
-    AddVolumeOutput("GRID_VELOCITY-Y", "Grid_Velocity_y", "GRID_VELOCITY", "y-component of the grid velocity vector");
+    AddVolumeOutput("GRID_VELOCITY-X", "Grid_Velocity_x", "GRID_VELOCITY", "x-component of the grid velocity vector", VolumeFieldType::RESTART);
+    AddVolumeOutput("GRID_VELOCITY-Y", "Grid_Velocity_y", "GRID_VELOCITY", "y-component of the grid velocity vector", VolumeFieldType::RESTART);
     if (nDim == 3 )
-      AddVolumeOutput("GRID_VELOCITY-Z", "Grid_Velocity_z", "GRID_VELOCITY", "z-component of the grid velocity vector");
+      AddVolumeOutput("GRID_VELOCITY-Z", "Grid_Velocity_z", "GRID_VELOCITY", "z-component of the grid velocity vector", VolumeFieldType::RESTART);
   }
 
   // Primitive variables
@@ -504,9 +506,9 @@ void CFlowIncOutput::SetVolumeOutputFields(CConfig *config){
 
   // Streamwise Periodicity
   if(streamwisePeriodic) {
-    AddVolumeOutput("RECOVERED_PRESSURE", "Recovered_Pressure", "SOLUTION", "Recovered physical pressure");
+    AddVolumeOutput("RECOVERED_PRESSURE", "Recovered_Pressure", "SOLUTION", "Recovered physical pressure", VolumeFieldType::RESTART);
     if (heat && streamwisePeriodic_temperature)
-      AddVolumeOutput("RECOVERED_TEMPERATURE", "Recovered_Temperature", "SOLUTION", "Recovered physical temperature");
+      AddVolumeOutput("RECOVERED_TEMPERATURE", "Recovered_Temperature", "SOLUTION", "Recovered physical temperature", VolumeFieldType::RESTART);
   }
 
   AddCommonFVMOutputs(config);
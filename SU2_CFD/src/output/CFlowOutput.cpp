@@ -28,6 +28,7 @@
 #include "../../include/output/CFlowOutput.hpp"
 #include "../../../Common/include/geometry/CGeometry.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CMonitorReduction.hpp"
 #include "../../include/solvers/CSolver.hpp"
 
 CFlowOutput::CFlowOutput(const CConfig *config, unsigned short nDim, bool fem_output) :
@@ -35,6 +36,31 @@ CFlowOutput::CFlowOutput(const CConfig *config, unsigned short nDim, bool fem_ou
   lastInnerIter(curInnerIter) {
 }
 
+void CFlowOutput::SetHistoryGroupDemand(const CConfig *config) {
+
+  COutput::SetHistoryGroupDemand(config);
+
+  /*--- These groups also set the surface values, and the Cp and near-field differences, of the objective. ---*/
+
+  for (auto iObj = 0u; iObj < config->GetnObj(); iObj++) {
+    switch (config->GetKind_ObjFunc(iObj)) {
+      case SURFACE_TOTAL_PRESSURE: case SURFACE_STATIC_PRESSURE: case SURFACE_STATIC_TEMPERATURE:
+      case SURFACE_MASSFLOW: case SURFACE_MACH: case SURFACE_UNIFORMITY: case SURFACE_SECONDARY:
+      case SURFACE_MOM_DISTORTION: case SURFACE_SECOND_OVER_UNIFORM: case SURFACE_PRESSURE_DROP:
+        historyGroupDemand["FLOW_COEFF"] |= DEMAND_ALWAYS;
+        break;
+      case INVERSE_DESIGN_PRESSURE:
+        historyGroupDemand["CP_DIFF"] |= DEMAND_ALWAYS;
+        break;
+      case EQUIVALENT_AREA: case NEARFIELD_PRESSURE:
+        historyGroupDemand["EQUIVALENT_AREA"] |= DEMAND_ALWAYS;
+        break;
+      default:
+        break;
+    }
+  }
+}
+
 void CFlowOutput::AddAnalyzeSurfaceOutput(const CConfig *config){
 
   /// DESCRIPTION: Average mass flow
@@ -330,8 +356,13 @@ void CFlowOutput::SetAnalyzeSurface(const CSolver *solver, const CGeometry *geom
 
   }
 
-  auto Allreduce = [](const vector<su2double>& src, vector<su2double>& dst) {
-    SU2_MPI::Allreduce(src.data(), dst.data(), src.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  /*--- All the quantities are reduced with a single collective. ---*/
+
+  auto& reduction = CMonitorReduction::GetInstance();
+
+  auto Allreduce = [&reduction](const vector<su2double>& src, vector<su2double>& dst) {
+    dst = src;
+    reduction.Sum(dst.data(), dst.size());
   };
 
   Allreduce(Surface_MassFlow_Local, Surface_MassFlow_Total);
@@ -348,6 +379,8 @@ void CFlowOutput::SetAnalyzeSurface(const CSolver *solver, const CGeometry *geom
   Allreduce(Surface_Area_Local, Surface_Area_Total);
   Allreduce(Surface_MassFlow_Abs_Local, Surface_MassFlow_Abs_Total);
 
+  reduction.ReduceNow();
+
   /*--- Compute the value of Surface_Area_Total, and Surface_Pressure_Total, and
    set the value in the config structure for future use ---*/
 
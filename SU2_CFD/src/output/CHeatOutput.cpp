@@ -118,7 +118,7 @@ void CHeatOutput::SetVolumeOutputFields(CConfig *config){
   AddCoordinates();
 
   // SOLUTION
-  AddVolumeOutput("TEMPERATURE", "Temperature", "SOLUTION", "Temperature");
+  AddVolumeOutput("TEMPERATURE", "Temperature", "SOLUTION", "Temperature", VolumeFieldType::RESTART);
 
   // Primitives
   AddVolumeOutput("HEAT_FLUX", "Heat_Flux", "PRIMITIVE", "Heatflux");
@@ -294,14 +294,14 @@ void CNEMOCompOutput::SetVolumeOutputFields(CConfig *config){
 
   // Solution variables
   for(iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-    AddVolumeOutput("DENSITY_" + std::to_string(iSpecies),  "Density_" + std::to_string(iSpecies),  "SOLUTION", "Density_"  + std::to_string(iSpecies));
+    AddVolumeOutput("DENSITY_" + std::to_string(iSpecies),  "Density_" + std::to_string(iSpecies),  "SOLUTION", "Density_"  + std::to_string(iSpecies), VolumeFieldType::RESTART);
 
-  AddVolumeOutput("MOMENTUM-X", "Momentum_x", "SOLUTION", "x-component of the momentum vector");
-  AddVolumeOutput("MOMENTUM-Y", "Momentum_y", "SOLUTION", "y-component of the momentum vector");
+  AddVolumeOutput("MOMENTUM-X", "Momentum_x", "SOLUTION", "x-component of the momentum vector", VolumeFieldType::RESTART);
+  AddVolumeOutput("MOMENTUM-Y", "Momentum_y", "SOLUTION", "y-component of the momentum vector", VolumeFieldType::RESTART);
   if (nDim == 3)
-    AddVolumeOutput("MOMENTUM-Z", "Momentum_z", "SOLUTION", "z-component of the momentum vector");
-  AddVolumeOutput("ENERGY",       "Energy",     "SOLUTION", "Energy");
-  AddVolumeOutput("ENERGY_VE",    "Energy_ve",  "SOLUTION", "Energy_ve");
+    AddVolumeOutput("MOMENTUM-Z", "Momentum_z", "SOLUTION", "z-component of the momentum vector", VolumeFieldType::RESTART);
+  AddVolumeOutput("ENERGY",       "Energy",     "SOLUTION", "Energy", VolumeFieldType::RESTART);
+  AddVolumeOutput("ENERGY_VE",    "Energy_ve",  "SOLUTION", "Energy_ve", VolumeFieldType::RESTART);
 
   //Auxiliary variables for post-processment
   for(iSpecies = 0; iSpecies < nSpecies; iSpecies++)
@@ -310,12 +310,12 @@ void CNEMOCompOutput::SetVolumeOutputFields(CConfig *config){
   // Turbulent Residuals
   switch(config->GetKind_Turb_Model()){
   case SST: case SST_SUST:
-    AddVolumeOutput("TKE", "Turb_Kin_Energy", "SOLUTION", "Turbulent kinetic energy");
-    AddVolumeOutput("DISSIPATION", "Omega", "SOLUTION", "Rate of dissipation");
+    AddVolumeOutput("TKE", "Turb_Kin_Energy", "SOLUTION", "Turbulent kinetic energy", VolumeFieldType::RESTART);
+    AddVolumeOutput("DISSIPATION", "Omega", "SOLUTION", "Rate of dissipation", VolumeFieldType::RESTART);
     break;
   case SA: case SA_COMP: case SA_E:
   case SA_E_COMP: case SA_NEG:
-    AddVolumeOutput("NU_TILDE", "Nu_Tilde", "SOLUTION", "Spalart-Allmaras variable");
+    AddVolumeOutput("NU_TILDE", "Nu_Tilde", "SOLUTION", "Spalart-Allmaras variable", VolumeFieldType::RESTART);
     break;
   case NONE:
     break;
@@ -323,10 +323,10 @@ void CNEMOCompOutput::SetVolumeOutputFields(CConfig *config){
 
   // Grid velocity
   if (gridMovement){
-    AddVolumeOutput("GRID_VELOCITY-X", "Grid_Velocity_x", "GRID_VELOCITY", "x-component of the grid velocity vector");
-    AddVolumeOutput("GRID_VELOCITY-Y", "Grid_Velocity_y", "GRID_VELOCITY", "y-component of the grid velocity vector");
+    AddVolumeOutput("GRID_VELOCITY-X", "Grid_Velocity_x", "GRID_VELOCITY", "x-component of the grid velocity vector", VolumeFieldType::RESTART);
+    AddVolumeOutput("GRID_VELOCITY-Y", "Grid_Velocity_y", "GRID_VELOCITY", "y-component of the grid velocity vector", VolumeFieldType::RESTART);
     if (nDim == 3 )
-      AddVolumeOutput("GRID_VELOCITY-Z", "Grid_Velocity_z", "GRID_VELOCITY", "z-component of the grid velocity vector");
+      AddVolumeOutput("GRID_VELOCITY-Z", "Grid_Velocity_z", "GRID_VELOCITY", "z-component of the grid velocity vector", VolumeFieldType::RESTART);
   }
 
   // Primitive variables
@@ -434,7 +434,7 @@ void CNEMOCompOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolv
 
   LoadCoordinates(Node_Geo->GetCoord(iPoint), iPoint);
 
-  for(iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+  for(unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
     SetVolumeOutputValue("DENSITY_" + std::to_string(iSpecies),   iPoint, Node_Flow->GetSolution(iPoint, iSpecies));
 
   SetVolumeOutputValue("MOMENTUM-X", iPoint, Node_Flow->GetSolution(iPoint, nSpecies));
@@ -448,7 +448,7 @@ void CNEMOCompOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolv
     SetVolumeOutputValue("ENERGY_VE",  iPoint, Node_Flow->GetSolution(iPoint, nSpecies+3));
   }
 
-  for(iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+  for(unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
     SetVolumeOutputValue("MASSFRAC_" + std::to_string(iSpecies),   iPoint, Node_Flow->GetSolution(iPoint, iSpecies)/Node_Flow->GetDensity(iPoint));
 
   // Turbulent Residuals
@@ -492,7 +492,7 @@ void CNEMOCompOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolv
     SetVolumeOutputValue("INTERMITTENCY", iPoint, Node_Turb->GetGammaBC(iPoint));
   }
 
-  for(iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+  for(unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
     SetVolumeOutputValue("RES_DENSITY_" + std::to_string(iSpecies), iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, iSpecies));
 
   SetVolumeOutputValue("RES_MOMENTUM-X", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, nSpecies));
@@ -672,15 +672,19 @@ void CNEMOCompOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSol
 
   /*--- Set the analyse surface history values --- */
 
-  SetAnalyzeSurface(NEMO_solver, geometry, config, false);
+  LoadHistoryGroups({"FLOW_COEFF", "FLOW_COEFF_SURF"}, [&]() {
+    SetAnalyzeSurface(NEMO_solver, geometry, config, false);
+  });
 
   /*--- Set aeroydnamic coefficients --- */
 
   SetAerodynamicCoefficients(config, NEMO_solver);
 
-  /*--- Set Cp diff fields ---*/
+  /*--- Set Cp diff fields, the target is read on the first inner iteration. ---*/
 
-  Set_CpInverseDesign(NEMO_solver, geometry, config);
+  LoadHistoryGroups({"CP_DIFF"}, [&]() {
+    Set_CpInverseDesign(NEMO_solver, geometry, config);
+  }, config->GetInnerIter() == 0);
 
 }
 
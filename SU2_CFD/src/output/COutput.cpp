@@ -41,6 +41,7 @@
 #include "../../include/output/filewriter/CSU2FileWriter.hpp"
 #include "../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2MeshFileWriter.hpp"
+#include "../../include/output/filewriter/CSU2BinaryMeshFileWriter.hpp"
 
 
 #include "../../../Common/include/geometry/CGeometry.hpp"
@@ -160,6 +161,7 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
   convergence        = false;
 
   buildFieldIndexCache = false;
+  cacheCursor.resize(omp_get_max_threads());
 
   curInnerIter = 0;
   curOuterIter = 0;
@@ -173,6 +175,13 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
 }
 
 COutput::~COutput(void) {
+
+  /*--- Writes that were not completed by the driver (collective). ---*/
+
+  for (auto writer : asyncWriters) {
+    writer->Write_Data_Wait();
+    delete writer;
+  }
   delete convergenceTable;
   delete multiZoneHeaderTable;
   delete fileWritingTable;
@@ -194,6 +203,13 @@ void COutput::SetHistory_Output(CGeometry *geometry,
   curOuterIter = OuterIter;
   curInnerIter = InnerIter;
 
+  /*--- Expensive history groups are only evaluated if they are needed at this iteration. ---*/
+
+  historyAllGroups = false;
+  historyScreenIter = historyFileIter = false;
+  historyGroupsDone.clear();
+  SetHistoryIterationDemand(config);
+
   /*--- Retrieve residual and extra data -----------------------------------------------------------------*/
 
   LoadCommonHistoryData(config);
@@ -202,6 +218,10 @@ void COutput::SetHistory_Output(CGeometry *geometry,
 
   Convergence_Monitoring(config, curInnerIter);
 
+  /*--- Convergence triggers the output of this iteration, evaluate the groups that were skipped. ---*/
+
+  if (SetHistoryIterationDemand(config)) LoadHistoryData(config, geometry, solver_container);
+
   Postprocess_HistoryData(config);
 
   MonitorTimeConvergence(config, curTimeIter);
@@ -214,6 +234,11 @@ void COutput::SetHistory_Output(CGeometry *geometry,
                                 CSolver **solver_container,
                                 CConfig *config) {
 
+  /*--- All the fields may be used by the multizone output. ---*/
+
+  historyAllGroups = true;
+  historyGroupsDone.clear();
+
   /*--- Retrieve residual and extra data -----------------------------------------------------------------*/
 
   LoadCommonHistoryData(config);
@@ -226,6 +251,28 @@ void COutput::SetHistory_Output(CGeometry *geometry,
 
 }
 
+void COutput::BroadcastHistoryFields(int root, SU2_Comm comm) {
+
+  /*--- The fields only depend on the config, hence they are the same (and in the same order) on all ranks. ---*/
+
+  vector<su2double> values;
+  values.reserve(historyOutput_List.size());
+
+  for (const auto& name : historyOutput_List)
+    values.push_back(historyOutput_Map.at(name).value);
+  for (const auto& name : historyOutputPerSurface_List)
+    for (const auto& field : historyOutputPerSurface_Map.at(name)) values.push_back(field.value);
+
+  SU2_MPI::Bcast(values.data(), values.size(), MPI_DOUBLE, root, comm);
+
+  auto value = values.begin();
+
+  for (const auto& name : historyOutput_List)
+    historyOutput_Map.at(name).value = *(value++);
+  for (const auto& name : historyOutputPerSurface_List)
+    for (auto& field : historyOutputPerSurface_Map.at(name)) field.value = *(value++);
+}
+
 void COutput::SetMultizoneHistory_Output(COutput **output, CConfig **config, CConfig *driver_config, unsigned long TimeIter, unsigned long OuterIter){
 
   curTimeIter  = TimeIter;
@@ -353,7 +400,21 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
           (*fileWritingTable) << "SU2 restart" << fileName + CSU2BinaryFileWriter::fileExt;
       }
 
+      if (config->GetAsync_Restart_Buffers() > 0) {
+        auto asyncWriter = new CSU2BinaryFileWriter(fileName, volumeDataSorter);
+        SetRestartCompression(config, asyncWriter);
+        StartAsyncWrite(config, asyncWriter);
+
+        if (config->GetWrt_Performance() && (rank == MASTER_NODE)) {
+          fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+          (*fileWritingTable) << " " << "(asynchronous)";
+          fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+        }
+        return;
+      }
+
       fileWriter = new CSU2BinaryFileWriter(fileName, volumeDataSorter);
+      SetRestartCompression(config, static_cast<CSU2BinaryFileWriter*>(fileWriter));
 
       break;
 
@@ -377,6 +438,25 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
       break;
 
+    case MESH_BINARY:
+
+      if (fileName.empty())
+        fileName = volumeFilename;
+
+      /*--- Load and sort the output data and connectivity. ---*/
+
+      volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      /*--- Set the mesh binary format ---*/
+      if (rank == MASTER_NODE) {
+          (*fileWritingTable) << "SU2 binary mesh" << fileName + CSU2BinaryMeshFileWriter::fileExt;
+      }
+
+      fileWriter = new CSU2BinaryMeshFileWriter(fileName, volumeDataSorter,
+                                                config->GetiZone(), config->GetnZone());
+
+      break;
+
     case TECPLOT_BINARY:
 
       if (fileName.empty())
@@ -709,6 +789,66 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
   }
 }
 
+void COutput::StartAsyncWrite(CConfig *config, CSU2BinaryFileWriter* writer) {
+
+  /*--- The same file (e.g. steady restarts) cannot be written by two requests. ---*/
+
+  const auto sameFile = find_if(asyncWriters.begin(), asyncWriters.end(),
+    [writer](const CSU2BinaryFileWriter* other) { return other->Get_FileName() == writer->Get_FileName(); });
+
+  if (sameFile != asyncWriters.end()) {
+    const auto count = distance(asyncWriters.begin(), sameFile) + 1;
+    for (auto i = 0l; i < count; ++i) CompleteAsyncWrite(config);
+  }
+
+  /*--- Back-pressure, wait for the oldest writes if all the staging buffers are in use. ---*/
+
+  while (asyncWriters.size() >= config->GetAsync_Restart_Buffers())
+    CompleteAsyncWrite(config);
+
+  writer->Write_Data_Start();
+  asyncWriters.push_back(writer);
+}
+
+void COutput::CompleteAsyncWrite(CConfig *config) {
+
+  auto writer = asyncWriters.front();
+  asyncWriters.pop_front();
+
+  writer->Write_Data_Wait();
+
+  config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg() + writer->Get_Bandwidth());
+  asyncWriteTime += writer->Get_UsedTime();
+  asyncWaitTime += writer->Get_WaitTime();
+
+  delete writer;
+}
+
+void COutput::SetRestartCompression(const CConfig *config, CSU2BinaryFileWriter* writer) const {
+
+  const auto kind = config->GetRestart_Compression();
+  if (kind == RESTART_COMPRESSION::NONE) return;
+
+  vector<passivedouble> tolerance;
+
+  if (kind == RESTART_COMPRESSION::LOSSY) {
+    const auto tol = SU2_TYPE::GetValue(config->GetRestart_Compression_Tol());
+    tolerance.resize(volumeFieldNames.size(), 0.0);
+
+    for (const auto& field : volumeOutput_Map) {
+      const auto& output = field.second;
+      if (output.offset >= 0 && output.offset < short(tolerance.size()) && output.fieldType != VolumeFieldType::RESTART)
+        tolerance[output.offset] = tol;
+    }
+  }
+  writer->Set_Compression(kind, tolerance);
+}
+
+void COutput::CompleteAsyncOutput(CConfig *config) {
+
+  while (!asyncWriters.empty()) CompleteAsyncWrite(config);
+}
+
 bool COutput::GetCauchyCorrectedTimeConvergence(const CConfig *config){
    if(!cauchyTimeConverged && TimeConvergence && config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND){
        // Change flags for 2nd order Time stepping: In case of convergence, this iter and next iter gets written out. then solver stops
@@ -726,6 +866,10 @@ bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** so
 
   bool writeFiles = WriteVolume_Output(config, iter, force_writing || cauchyTimeConverged);
 
+  /*--- Progress the asynchronous writes (local, completion is collective and happens on demand). ---*/
+
+  for (auto writer : asyncWriters) writer->Write_Data_Test();
+
   /*--- Check if the data sorters are allocated, if not, allocate them. --- */
 
   AllocateDataSorters(config, geometry);
@@ -1134,6 +1278,8 @@ void COutput::PreprocessHistoryOutput(CConfig *config, bool wrt){
 
   CheckHistoryOutput();
 
+  SetHistoryGroupDemand(config);
+
   if (rank == MASTER_NODE && !noWriting){
 
     /*--- Open history file and print the header ---*/
@@ -1409,6 +1555,109 @@ void COutput::CheckHistoryOutput() {
   }
 }
 
+string COutput::GetHistoryFieldGroup(const string& name) const {
+
+  const auto it1 = historyOutput_Map.find(name);
+  if (it1 != historyOutput_Map.end()) return it1->second.outputGroup;
+
+  const auto it2 = historyOutputPerSurface_Map.find(name);
+  if (it2 != historyOutputPerSurface_Map.end() && !it2->second.empty()) return it2->second[0].outputGroup;
+
+  return name;
+}
+
+void COutput::AddHistoryGroupDemand(const string& name, unsigned short demand) {
+
+  if (name != "ALL") {
+    historyGroupDemand[GetHistoryFieldGroup(name)] |= demand;
+    return;
+  }
+  for (const auto& field : historyOutput_Map)
+    historyGroupDemand[field.second.outputGroup] |= demand;
+  for (const auto& fields : historyOutputPerSurface_Map)
+    for (const auto& field : fields.second) historyGroupDemand[field.outputGroup] |= demand;
+}
+
+void COutput::SetHistoryGroupDemand(const CConfig *config) {
+
+  historyGroupDemand.clear();
+
+  for (const auto& name : requestedScreenFields) AddHistoryGroupDemand(name, DEMAND_SCREEN);
+
+  for (const auto& name : requestedHistoryFields) AddHistoryGroupDemand(name, DEMAND_FILE);
+
+  /*--- The Cauchy series are updated at every iteration. ---*/
+
+  for (const auto& name : convFields) AddHistoryGroupDemand(name, DEMAND_ALWAYS);
+
+  for (const auto& name : wndConvFields) AddHistoryGroupDemand(name, DEMAND_ALWAYS);
+
+  /*--- The time averages and the derivatives of the coefficients need every sample. ---*/
+
+  if (config->GetTime_Domain() || (config->GetDirectDiff() != NO_DERIVATIVE)) {
+    for (const auto& name : historyOutput_List) {
+      const auto& field = historyOutput_Map.at(name);
+      if (field.fieldType == HistoryFieldType::COEFFICIENT)
+        historyGroupDemand[field.outputGroup] |= DEMAND_ALWAYS;
+    }
+  }
+
+  for (const auto& name : historyExternalRequests) AddHistoryGroupDemand(name, DEMAND_ALWAYS);
+}
+
+void COutput::RequestHistoryFields(const vector<string>& fields) {
+
+  for (const auto& name : fields) {
+    historyExternalRequests.push_back(name);
+    AddHistoryGroupDemand(name, DEMAND_ALWAYS);
+  }
+}
+
+bool COutput::SetHistoryIterationDemand(const CConfig *config) {
+
+  /*--- Only depends on the iteration, the config, and the convergence status (same on all ranks). ---*/
+
+  const bool screen = WriteScreen_Output(config);
+  const bool file = WriteHistoryFile_Output(config);
+  const bool increased = (screen && !historyScreenIter) || (file && !historyFileIter);
+
+  historyScreenIter = historyScreenIter || screen;
+  historyFileIter = historyFileIter || file;
+
+  return increased;
+}
+
+bool COutput::HistoryGroupRequired(const string& group) const {
+
+  if (historyAllGroups) return true;
+
+  const auto it = historyGroupDemand.find(group);
+  if (it == historyGroupDemand.end()) return false;
+
+  return (it->second & DEMAND_ALWAYS) ||
+         (historyScreenIter && (it->second & DEMAND_SCREEN)) ||
+         (historyFileIter && (it->second & DEMAND_FILE));
+}
+
+void COutput::LoadHistoryGroups(const vector<string>& groups, const std::function<void()>& load, bool force) {
+
+  if (historyGroupsDone.count(groups.front())) return;
+
+  bool required = force;
+  for (const auto& group : groups) required = required || HistoryGroupRequired(group);
+  if (!required) return;
+
+  const auto startTime = SU2_MPI::Wtime();
+
+  load();
+
+  auto& cost = historyGroupCost[groups.front()];
+  cost.first += SU2_MPI::Wtime() - startTime;
+  cost.second++;
+
+  historyGroupsDone.insert(groups.front());
+}
+
 void COutput::PreprocessVolumeOutput(CConfig *config){
 
   /*--- Set the volume output fields using a virtual function call to the child implementation ---*/
@@ -1511,10 +1760,12 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
   unsigned long iVertex = 0;
 
   /*--- Reset the offset cache and index --- */
-  cachePosition = 0;
-  fieldIndexCache.clear();
-  curGetFieldIndex = 0;
-  fieldGetIndexCache.clear();
+  auto resetFieldIndexCache = [this]() {
+    fieldIndexCache.clear();
+    fieldGetIndexCache.clear();
+    cacheCursor.assign(omp_get_max_threads(), FieldCacheCursor());
+  };
+  resetFieldIndexCache();
 
   if (femOutput){
 
@@ -1544,47 +1795,77 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
 
   } else {
 
-    for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    /*--- The first point builds the offset caches serially, then all points are loaded
+     * in parallel (the first is loaded again), each thread uses its own cache position.
+     * AD types are not recorded in parallel, thus only one thread is used when taping. ---*/
+
+    const unsigned long nPointDomain = geometry->GetnPointDomain();
+
+    if (nPointDomain > 0) {
+      buildFieldIndexCache = true;
+      LoadVolumeData(config, geometry, solver, 0);
+      buildFieldIndexCache = false;
+    }
 
-      /*--- Load the volume data into the data sorter. --- */
+    SU2_OMP_PARALLEL_(if(!AD::TapeActive()))
+    {
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-      buildFieldIndexCache = fieldIndexCache.empty();
+        /*--- Load the volume data into the data sorter. --- */
 
-      LoadVolumeData(config, geometry, solver, iPoint);
+        LoadVolumeData(config, geometry, solver, iPoint);
 
+      }
+      END_SU2_OMP_FOR
     }
+    END_SU2_OMP_PARALLEL
 
     /*--- Reset the offset cache and index --- */
-    cachePosition = 0;
-    fieldIndexCache.clear();
-    curGetFieldIndex = 0;
-    fieldGetIndexCache.clear();
+    resetFieldIndexCache();
 
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
 
       /*--- We only want to have surface values on solid walls ---*/
 
-      if (config->GetSolid_Wall(iMarker)){
-        for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++){
+      if (!config->GetSolid_Wall(iMarker)) continue;
 
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      const unsigned long nVertex = geometry->GetnVertex(iMarker);
 
-          /*--- Load the surface data into the data sorter. --- */
+      for (iVertex = 0; (iVertex < nVertex) && fieldIndexCache.empty(); iVertex++) {
 
-          if(geometry->nodes->GetDomain(iPoint)){
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
 
-            buildFieldIndexCache = fieldIndexCache.empty();
+        if (geometry->nodes->GetDomain(iPoint)) {
+          buildFieldIndexCache = true;
+          LoadSurfaceData(config, geometry, solver, iPoint, iMarker, iVertex);
+          buildFieldIndexCache = false;
+        }
+      }
 
-            LoadSurfaceData(config, geometry, solver, iPoint, iMarker, iVertex);
+      /*--- Points shared by two markers take the values of the last, as in serial. ---*/
+
+      SU2_OMP_PARALLEL_(if(!AD::TapeActive()))
+      {
+        SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+        for (unsigned long jVertex = 0; jVertex < nVertex; jVertex++) {
+
+          const auto jPoint = geometry->vertex[iMarker][jVertex]->GetNode();
+
+          /*--- Load the surface data into the data sorter. --- */
 
+          if (geometry->nodes->GetDomain(jPoint)) {
+            LoadSurfaceData(config, geometry, solver, jPoint, iMarker, jVertex);
           }
         }
+        END_SU2_OMP_FOR
       }
+      END_SU2_OMP_PARALLEL
     }
   }
 }
 
-void COutput::SetVolumeOutputValue(string name, unsigned long iPoint, su2double value){
+void COutput::SetVolumeOutputValue(const string& name, unsigned long iPoint, su2double value){
 
   if (buildFieldIndexCache){
 
@@ -1605,6 +1886,7 @@ void COutput::SetVolumeOutputValue(string name, unsigned long iPoint, su2double
 
     /*--- Use the offset cache for the access ---*/
 
+    auto& cachePosition = cacheCursor[omp_get_thread_num()].set;
     const short Offset = fieldIndexCache[cachePosition++];
     if (Offset != -1){
       volumeDataSorter->SetUnsorted_Data(iPoint, Offset, value);
@@ -1616,7 +1898,7 @@ void COutput::SetVolumeOutputValue(string name, unsigned long iPoint, su2double
 
 }
 
-su2double COutput::GetVolumeOutputValue(string name, unsigned long iPoint){
+su2double COutput::GetVolumeOutputValue(const string& name, unsigned long iPoint){
 
   if (buildFieldIndexCache){
 
@@ -1637,6 +1919,7 @@ su2double COutput::GetVolumeOutputValue(string name, unsigned long iPoint){
 
     /*--- Use the offset cache for the access ---*/
 
+    auto& curGetFieldIndex = cacheCursor[omp_get_thread_num()].get;
     const short Offset = fieldGetIndexCache[curGetFieldIndex++];
 
     if (curGetFieldIndex == fieldGetIndexCache.size()){
@@ -1650,7 +1933,7 @@ su2double COutput::GetVolumeOutputValue(string name, unsigned long iPoint){
   return 0.0;
 }
 
-void COutput::SetAvgVolumeOutputValue(string name, unsigned long iPoint, su2double value){
+void COutput::SetAvgVolumeOutputValue(const string& name, unsigned long iPoint, su2double value){
 
   const su2double scaling = 1.0 / su2double(curAbsTimeIter + 1);
 
@@ -1677,6 +1960,7 @@ void COutput::SetAvgVolumeOutputValue(string name, unsigned long iPoint, su2doub
 
     /*--- Use the offset cache for the access ---*/
 
+    auto& cachePosition = cacheCursor[omp_get_thread_num()].set;
     const short Offset = fieldIndexCache[cachePosition++];
     if (Offset != -1){
 
@@ -208,18 +208,33 @@ void CParallelDataSorter::SortOutputData() {
   delete [] recv_req;
 #endif
 
-  /*--- Reorder the data in the buffer. ---*/
+  /*--- Reorder the data in the buffer. The received IDs are a permutation of the local
+   points, its inverse is used to gather entire points at once, which is done in parallel. ---*/
 
-  vector<passivedouble> tmpBuffer(nPoint_Recv[size]);
+  const unsigned long nPointRecv = nPoint_Recv[size];
 
-  for (int jj = 0; jj < VARS_PER_POINT; jj++){
-    for (int ii = 0; ii < nPoint_Recv[size]; ii++){
-      tmpBuffer[idRecv[ii]] = dataBuffer[ii*VARS_PER_POINT+jj];
+  vector<unsigned long> sourceIdx(nPointRecv);
+  auto sortedBuffer = new passivedouble[VARS_PER_POINT*nPointRecv];
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(computeStaticChunkSize(nPointRecv, omp_get_num_threads(), 1024))
+    for (unsigned long ii = 0; ii < nPointRecv; ii++){
+      sourceIdx[idRecv[ii]] = ii;
     }
-    for (int ii = 0; ii < nPoint_Recv[size]; ii++){
-      dataBuffer[ii*VARS_PER_POINT+jj] = tmpBuffer[ii];
+    END_SU2_OMP_FOR
+
+    SU2_OMP_FOR_STAT(computeStaticChunkSize(nPointRecv, omp_get_num_threads(), 1024))
+    for (unsigned long ii = 0; ii < nPointRecv; ii++){
+      const auto source = &dataBuffer[sourceIdx[ii]*VARS_PER_POINT];
+      std::copy(source, source+VARS_PER_POINT, &sortedBuffer[ii*VARS_PER_POINT]);
     }
+    END_SU2_OMP_FOR
   }
+  END_SU2_OMP_PARALLEL
+
+  delete [] dataBuffer;
+  dataBuffer = sortedBuffer;
 
   /*--- Store the total number of local points my rank has for
    the current section after completing the communications. ---*/
@@ -26,6 +26,7 @@
  */
 
 #include "../../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
+#include "../../../../Common/include/toolboxes/compression_toolbox.hpp"
 
 const string CSU2BinaryFileWriter::fileExt = ".dat";
 
@@ -37,7 +38,14 @@ CSU2BinaryFileWriter::~CSU2BinaryFileWriter(){
 
 }
 
-void CSU2BinaryFileWriter::Write_Data(){
+void CSU2BinaryFileWriter::Set_Compression(RESTART_COMPRESSION kind, vector<passivedouble> fieldTolerance){
+
+  compression = kind;
+  tolerance = std::move(fieldTolerance);
+}
+
+const void* CSU2BinaryFileWriter::Write_Header(bool snapshot, unsigned long& sizeInBytesLocal,
+                                               unsigned long& sizeInBytesGlobal, unsigned long& offsetInBytes){
 
   /*--- Local variables ---*/
 
@@ -47,17 +55,86 @@ void CSU2BinaryFileWriter::Write_Data(){
   unsigned short nVar = fieldNames.size();
   unsigned long nParallel_Poin = dataSorter->GetnPoints();
   unsigned long nPoint_Global = dataSorter->GetnPointsGlobal();
+  const passivedouble* data = dataSorter->GetData();
 
   char str_buf[CGNS_STRING_SIZE];
 
+  CompressionToolbox::CRestartBlockTable table(nVar);
+  unsigned long nBlock_Global = 0, blockOffset = 0;
+  su2double compressTime = 0.0;
+
+  if (compression == RESTART_COMPRESSION::NONE) {
+
+    unsigned long sizeInBytesPerPoint = sizeof(passivedouble)*nVar;
+
+    sizeInBytesLocal  = sizeInBytesPerPoint*nParallel_Poin;
+    sizeInBytesGlobal = sizeInBytesPerPoint*nPoint_Global;
+    offsetInBytes     = sizeInBytesPerPoint*dataSorter->GetnPointCumulative(rank);
+
+    if (snapshot) {
+      const auto bytes = reinterpret_cast<const uint8_t*>(data);
+      stagingBuffer.assign(bytes, bytes + sizeInBytesLocal);
+    }
+  }
+  else {
+
+    /*--- Compress the local points in blocks, each field separately. ---*/
+
+    const su2double compressStart = SU2_MPI::Wtime();
+
+    if (tolerance.empty()) tolerance.resize(nVar, 0.0);
+
+    const unsigned long firstPoint = dataSorter->GetnPointCumulative(rank);
+    const unsigned long blockSize = CompressionToolbox::RESTART_BLOCK_SIZE;
+    vector<uint64_t> sizes(nVar);
+
+    stagingBuffer.clear();
+    for (unsigned long iPoint = 0; iPoint < nParallel_Poin; iPoint += blockSize) {
+      const auto nPointBlock = min(blockSize, nParallel_Poin - iPoint);
+      const auto offset = stagingBuffer.size();
+
+      CompressionToolbox::CompressBlock(&data[iPoint*nVar], nPointBlock, nVar, tolerance.data(),
+                                        stagingBuffer, sizes.data());
+      table.AddBlock(firstPoint + iPoint, nPointBlock, offset, sizes.data());
+    }
+
+    /*--- Position of the blocks and of the data of this rank in the file. ---*/
+
+    unsigned long myCounts[2] = {table.GetnBlock(), stagingBuffer.size()};
+    vector<unsigned long> allCounts(2*size);
+    SU2_MPI::Allgather(myCounts, 2, MPI_UNSIGNED_LONG, allCounts.data(), 2, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+    sizeInBytesLocal = stagingBuffer.size();
+    sizeInBytesGlobal = 0;
+    offsetInBytes = 0;
+    for (int iRank = 0; iRank < size; iRank++) {
+      if (iRank == rank) {
+        blockOffset = nBlock_Global;
+        offsetInBytes = sizeInBytesGlobal;
+      }
+      nBlock_Global += allCounts[2*iRank];
+      sizeInBytesGlobal += allCounts[2*iRank+1];
+    }
+    table.ShiftOffsets(offsetInBytes);
+
+    compressTime = SU2_MPI::Wtime() - compressStart;
+  }
+
   /*--- Prepare the first ints containing the counts. The first is a
    magic number that we can use to check for binary files (it is the hex
    representation for "SU2"). The second two values are number of variables
-   and number of points (DoFs). ---*/
+   and number of points (DoFs). Compressed files also have the number of
+   blocks and the type of compression. ---*/
 
   int var_buf_size = 5;
   int var_buf[5] = {535532, nVar, (int)nPoint_Global, 0, 0};
 
+  if (compression != RESTART_COMPRESSION::NONE) {
+    var_buf[0] = CompressionToolbox::COMPRESSED_RESTART_MAGIC;
+    var_buf[3] = (int)nBlock_Global;
+    var_buf[4] = static_cast<int>(compression);
+  }
+
   /*--- Open the file using MPI I/O ---*/
 
   OpenMPIFile();
@@ -77,19 +154,126 @@ void CSU2BinaryFileWriter::Write_Data(){
     WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
   }
 
-  /*--- Compute various data sizes --- */
+  /*--- Collectively write the block table, the compression time counts as writing time. ---*/
+
+  if (compression != RESTART_COMPRESSION::NONE) {
+    const unsigned long sizeInBytesPerBlock = sizeof(uint64_t)*table.GetEntrySize();
 
-  unsigned long sizeInBytesPerPoint = sizeof(passivedouble)*nVar;
-  unsigned long sizeInBytesLocal    = sizeInBytesPerPoint*nParallel_Poin;
-  unsigned long sizeInBytesGlobal   = sizeInBytesPerPoint*nPoint_Global;
-  unsigned long offsetInBytes       = sizeInBytesPerPoint*dataSorter->GetnPointCumulative(rank);
+    WriteMPIBinaryDataAll(table.GetData(), sizeInBytesPerBlock*table.GetnBlock(),
+                          sizeInBytesPerBlock*nBlock_Global, sizeInBytesPerBlock*blockOffset);
+    usedTime += compressTime;
+  }
+
+  if (compression != RESTART_COMPRESSION::NONE || snapshot) return stagingBuffer.data();
+  return data;
+}
+
+void CSU2BinaryFileWriter::Write_Data(){
+
+  unsigned long sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes;
+
+  const void* data = Write_Header(false, sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
 
   /*--- Collectively write the actual data to file ---*/
 
-  WriteMPIBinaryDataAll(dataSorter->GetData(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+  WriteMPIBinaryDataAll(data, sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
 
   /*--- Close the file ---*/
 
   CloseMPIFile();
 
+  vector<uint8_t>().swap(stagingBuffer);
+
+}
+
+void CSU2BinaryFileWriter::Write_Data_Start(){
+
+  /*--- Snapshot (or compressed copy) of the sorted data, the header is small, it is written synchronously. ---*/
+
+  unsigned long sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes;
+
+  Write_Header(true, sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+
+  startTime = SU2_MPI::Wtime();
+
+#ifdef HAVE_MPI
+
+  /*--- Same view as WriteMPIBinaryDataAll, but with a non-blocking collective. ---*/
+
+  MPI_Type_contiguous(int(sizeInBytesLocal), MPI_BYTE, &filetype);
+  MPI_Type_commit(&filetype);
+
+  MPI_File_set_view(fhw, disp + offsetInBytes, MPI_BYTE, filetype, (char*)"native", MPI_INFO_NULL);
+
+  int ierr = MPI_File_iwrite_all(fhw, stagingBuffer.data(), int(sizeInBytesLocal), MPI_BYTE, &request);
+
+  if (ierr != MPI_SUCCESS)
+    SU2_MPI::Error(string("Unable to write file ") + fileName, CURRENT_FUNCTION);
+
+  disp += sizeInBytesGlobal;
+
+#else
+
+  /*--- Serial, the data is written by a separate thread. ---*/
+
+  FILE* file = fhw;
+  const uint8_t* data = stagingBuffer.data();
+
+  success = std::async(std::launch::async, [file, data, sizeInBytesLocal]() {
+    return fwrite(data, sizeof(char), sizeInBytesLocal, file) == sizeInBytesLocal;
+  });
+
+#endif
+
+  fileSize += sizeInBytesLocal;
+  writing = true;
+  finished = false;
+}
+
+bool CSU2BinaryFileWriter::Write_Data_Test(){
+
+  if (writing && !finished) {
+#ifdef HAVE_MPI
+    int flag = 0;
+    MPI_Test(&request, &flag, MPI_STATUS_IGNORE);
+    finished = (flag != 0);
+#else
+    finished = (success.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+#endif
+    if (finished) finishTime = SU2_MPI::Wtime();
+  }
+  return finished;
+}
+
+void CSU2BinaryFileWriter::Write_Data_Wait(){
+
+  if (!writing) return;
+
+  const su2double waitStart = SU2_MPI::Wtime();
+
+#ifdef HAVE_MPI
+  MPI_Wait(&request, MPI_STATUS_IGNORE);
+  MPI_Type_free(&filetype);
+  const bool ok = true;
+#else
+  const bool ok = success.get();
+#endif
+
+  /*--- Record the completion here if no test observed it. ---*/
+
+  stopTime = SU2_MPI::Wtime();
+  waitTime = stopTime - waitStart;
+  if (!finished) {
+    finished = true;
+    finishTime = stopTime;
+  }
+
+  usedTime += finishTime - startTime;
+
+  writing = false;
+  vector<uint8_t>().swap(stagingBuffer);
+
+  CloseMPIFile();
+
+  if (!ok) SU2_MPI::Error(string("Unable to write file ") + fileName, CURRENT_FUNCTION);
 }
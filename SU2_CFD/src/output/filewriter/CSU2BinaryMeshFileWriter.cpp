@@ -0,0 +1,208 @@
+/*!
+ * \file CSU2BinaryMeshFileWriter.cpp
+ * \brief Filewriter class SU2 native binary mesh format.
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CSU2BinaryMeshFileWriter.hpp"
+#include "../../../../Common/include/toolboxes/printing_toolbox.hpp"
+
+const string CSU2BinaryMeshFileWriter::fileExt = ".su2b";
+
+CSU2BinaryMeshFileWriter::CSU2BinaryMeshFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                                   unsigned short valiZone, unsigned short valnZone) :
+  CFileWriter((valnZone > 1)? valFileName + "_" + PrintingToolbox::to_string(valiZone) : valFileName,
+              valDataSorter, fileExt), iZone(valiZone), nZone(valnZone) {}
+
+void CSU2BinaryMeshFileWriter::Write_Data() {
+
+  static_assert(sizeof(unsigned long) == 8 && sizeof(passivedouble) == 8,
+                "The SU2 binary mesh format assumes 8 byte integers and floating point numbers.");
+
+  if (!dataSorter->GetConnectivitySorted()) {
+    SU2_MPI::Error("Connectivity must be sorted.", CURRENT_FUNCTION);
+  }
+
+  const unsigned long nDim = dataSorter->GetnDim();
+  const unsigned long nPoint = dataSorter->GetnPoints();
+  const unsigned long nPointGlobal = dataSorter->GetnPointsGlobal();
+
+  /*--- The master reads the markers to know their size in the file. ---*/
+
+  unsigned long nMarker = 0;
+  vector<char> markerBuffer;
+  if (rank == MASTER_NODE) ReadBoundaryFile(nMarker, markerBuffer);
+
+  /*--- Header, all offsets are known from the global sizes. ---*/
+
+  unsigned long header[BINARY_MESH_HEADER_SIZE] = {0};
+  header[BINARY_MESH_MAGIC] = SU2_BINARY_MESH_MAGIC;
+  header[BINARY_MESH_VERSION] = SU2_BINARY_MESH_VERSION;
+  header[BINARY_MESH_NDIM] = nDim;
+  header[BINARY_MESH_NPOINT] = nPointGlobal;
+  header[BINARY_MESH_NMARKER] = nMarker;
+  header[BINARY_MESH_POINT_OFFSET] = sizeof(header);
+
+  unsigned long offset = sizeof(header) + nPointGlobal*nDim*sizeof(passivedouble);
+
+  for (unsigned short iType = 0; iType < BINARY_MESH_N_ELEM_TYPES; iType++) {
+    const auto nElemGlobal = dataSorter->GetnElemGlobal(BINARY_MESH_ELEM_TYPES[iType]);
+    header[BINARY_MESH_NELEM] += nElemGlobal;
+    header[BINARY_MESH_ELEM_COUNT+iType] = nElemGlobal;
+    header[BINARY_MESH_ELEM_OFFSET+iType] = offset;
+    offset += nElemGlobal*BINARY_MESH_ELEM_NODES[iType]*sizeof(unsigned long);
+  }
+  header[BINARY_MESH_MARKER_OFFSET] = offset;
+
+  OpenMPIFile();
+
+  bool success = WriteMPIBinaryData(header, sizeof(header), MASTER_NODE);
+
+  /*--- Point coordinates, each rank writes its contiguous range of points. ---*/
+
+  vector<passivedouble> coords(nPoint*nDim);
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    for (auto iDim = 0ul; iDim < nDim; iDim++)
+      coords[iPoint*nDim + iDim] = SU2_TYPE::GetValue(dataSorter->GetData(iDim, iPoint));
+
+  const auto bytesPerPoint = nDim*sizeof(passivedouble);
+  success &= WriteMPIBinaryDataAll(coords.data(), nPoint*bytesPerPoint, nPointGlobal*bytesPerPoint,
+                                   dataSorter->GetnPointCumulative(rank)*bytesPerPoint);
+  vector<passivedouble>().swap(coords);
+
+  /*--- Volume elements, one block per type with 0-based point indices. ---*/
+
+  vector<unsigned long> nElemRank(size);
+
+  for (unsigned short iType = 0; iType < BINARY_MESH_N_ELEM_TYPES; iType++) {
+    const auto type = BINARY_MESH_ELEM_TYPES[iType];
+    const unsigned long nNodes = BINARY_MESH_ELEM_NODES[iType];
+    unsigned long nElem = dataSorter->GetnElem(type);
+
+    SU2_MPI::Allgather(&nElem, 1, MPI_UNSIGNED_LONG, nElemRank.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+    unsigned long nElemBefore = 0;
+    for (int iRank = 0; iRank < rank; iRank++) nElemBefore += nElemRank[iRank];
+
+    vector<unsigned long> conn(nElem*nNodes);
+    for (auto iElem = 0ul; iElem < nElem; iElem++)
+      for (auto iNode = 0ul; iNode < nNodes; iNode++)
+        conn[iElem*nNodes + iNode] = dataSorter->GetElem_Connectivity(type, iElem, iNode) - 1;
+
+    const auto bytesPerElem = nNodes*sizeof(unsigned long);
+    success &= WriteMPIBinaryDataAll(conn.data(), nElem*bytesPerElem, header[BINARY_MESH_ELEM_COUNT+iType]*bytesPerElem,
+                                     nElemBefore*bytesPerElem);
+  }
+
+  /*--- Markers, written by the master at the end of the file. ---*/
+
+  success &= WriteMPIBinaryData(markerBuffer.data(), markerBuffer.size(), MASTER_NODE);
+
+  CloseMPIFile();
+
+  if (!success) {
+    SU2_MPI::Error(string("Error writing SU2 binary mesh ") + fileName, CURRENT_FUNCTION);
+  }
+}
+
+void CSU2BinaryMeshFileWriter::ReadBoundaryFile(unsigned long& nMarker, vector<char>& buffer) const {
+
+  string str = "boundary";
+  if (nZone > 1) str += "_" + PrintingToolbox::to_string(iZone);
+  str += ".dat";
+
+  ifstream input_file;
+  input_file.open(str);
+
+  if (!input_file.is_open()) {
+    SU2_MPI::Error(string("Cannot find ") + str, CURRENT_FUNCTION);
+  }
+
+  auto append = [&buffer](const void* data, size_t nBytes) {
+    const auto ptr = static_cast<const char*>(data);
+    buffer.insert(buffer.end(), ptr, ptr+nBytes);
+  };
+
+  nMarker = 0;
+
+  string text_line;
+  while (getline(input_file, text_line)) {
+
+    if (text_line.find("NMARK=",0) == string::npos) continue;
+
+    text_line.erase(0,6);
+    const auto nMarker_ = atoi(text_line.c_str());
+
+    for (auto iMarker = 0; iMarker < nMarker_; iMarker++) {
+
+      getline(input_file, text_line);
+      text_line.erase(0,11);
+      string Marker_Tag;
+      for (auto c : text_line) if ((c != ' ') && (c != '\r') && (c != '\n')) Marker_Tag += c;
+
+      getline(input_file, text_line);
+      text_line.erase(0,13);
+      const unsigned long nElem_Bound_ = atoi(text_line.c_str());
+
+      /*--- SEND_TO line. ---*/
+      getline(input_file, text_line);
+
+      /*--- Skip the parallel communication markers, the format has no SEND_TO. ---*/
+      const bool skip = (Marker_Tag == "SEND_RECEIVE");
+
+      if (!skip) {
+        const unsigned long nameLength = Marker_Tag.size();
+        append(&nameLength, sizeof(unsigned long));
+        append(Marker_Tag.data(), nameLength);
+        append(&nElem_Bound_, sizeof(unsigned long));
+        ++nMarker;
+      }
+
+      for (auto iElem_Bound = 0ul; iElem_Bound < nElem_Bound_; iElem_Bound++) {
+
+        getline(input_file, text_line);
+        if (skip) continue;
+
+        istringstream bound_line(text_line);
+
+        unsigned long conn[BINARY_MESH_MARKER_CONN_SIZE] = {0};
+        bound_line >> conn[0];
+
+        switch (conn[0]) {
+        case LINE:
+        case VERTEX:
+          bound_line >> conn[1]; bound_line >> conn[2];
+          break;
+        case TRIANGLE:
+          bound_line >> conn[1]; bound_line >> conn[2]; bound_line >> conn[3];
+          break;
+        case QUADRILATERAL:
+          bound_line >> conn[1]; bound_line >> conn[2]; bound_line >> conn[3]; bound_line >> conn[4];
+          break;
+        }
+        append(conn, sizeof(conn));
+      }
+    }
+  }
+
+}
@@ -393,13 +393,16 @@ void CSurfaceFVMDataSorter::SortOutputData() {
 
   nPoints = 0;
   Renumber2Global.clear();
+  vector<unsigned long> volumeIdx;
 
   for (iPoint = 0; iPoint < volumeSorter->GetnPoints(); iPoint++) {
     if (surfPoint[iPoint] != -1) {
 
-      /*--- Save the global index values for CSV output. ---*/
+      /*--- Save the global index values for CSV output, and
+       * the local index in the volume data to extract it. ---*/
 
       Renumber2Global[nPoints] = surfPoint[iPoint];
+      volumeIdx.push_back(iPoint);
 
       /*--- Increment total number of surface points found locally. ---*/
 
@@ -434,15 +437,18 @@ void CSurfaceFVMDataSorter::SortOutputData() {
   delete [] dataBuffer;
   dataBuffer = new passivedouble[nPoints*VARS_PER_POINT];
 
-  for (int jj = 0; jj < VARS_PER_POINT; jj++) {
-    count = 0;
-    for (int ii = 0; ii < (int)volumeSorter->GetnPoints(); ii++) {
-      if (surfPoint[ii] !=-1) {
-        dataBuffer[count*VARS_PER_POINT + jj] = volumeSorter->GetData(jj,ii);
-        count++;
-      }
+  const auto volumeData = volumeSorter->GetData();
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(computeStaticChunkSize(nPoints, omp_get_num_threads(), 1024))
+    for (unsigned long ii = 0; ii < nPoints; ii++) {
+      const auto source = &volumeData[volumeIdx[ii]*VARS_PER_POINT];
+      std::copy(source, source+VARS_PER_POINT, &dataBuffer[ii*VARS_PER_POINT]);
     }
+    END_SU2_OMP_FOR
   }
+  END_SU2_OMP_PARALLEL
   /*--- Reduce the total number of surf points we have. This will be
    needed for writing the surface solution files later. ---*/
 
@@ -28,6 +28,7 @@
 
 #include "../include/drivers/CDriver.hpp"
 #include "../include/drivers/CSinglezoneDriver.hpp"
+#include "../include/output/COutput.hpp"
 #include "../../Common/include/toolboxes/geometry_toolbox.hpp"
 
 void CDriver::PythonInterface_Preprocessing(CConfig **config, CGeometry ****geometry, CSolver *****solver){
@@ -166,6 +167,16 @@ passivedouble CDriver::Get_LiftCoeff() const {
   return SU2_TYPE::GetValue(CLift);
 }
 
+void CDriver::RequestHistoryOutput(const vector<string>& fields) {
+
+  output_container[ZONE_0]->RequestHistoryFields(fields);
+}
+
+passivedouble CDriver::GetHistoryOutputValue(const string& field) const {
+
+  return SU2_TYPE::GetValue(output_container[ZONE_0]->GetHistoryFieldValue(field));
+}
+
 /////////////////////////////////////////////////////////////////////////////
 /* Functions to obtain information from the geometry/mesh                  */
 /////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,267 @@
+/*!
+ * \file CCheckpointStore.cpp
+ * \brief In-memory store of primal states (restart data) for the unsteady discrete adjoint.
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/solvers/CCheckpointStore.hpp"
+#include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../Common/include/toolboxes/compression_toolbox.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+
+CCheckpointStore& CCheckpointStore::GetInstance() {
+  static CCheckpointStore store;
+  return store;
+}
+
+void CCheckpointStore::SetOptions(unsigned long maxStates, bool compressStates) {
+  if (maxStates == 0 && pending.active) CompletePrefetch();
+  capacity = maxStates;
+  compress = compressStates;
+  while (states.size() > capacity) states.pop_back();
+}
+
+void CCheckpointStore::Clear() {
+  if (pending.active) CompletePrefetch();
+  states.clear();
+}
+
+void CCheckpointStore::Store(CState&& state) {
+
+  if (compress) {
+    CompressionToolbox::CompressLossless(state.data.data(), state.nValues, state.stride, state.compressed);
+    std::vector<passivedouble>().swap(state.data);
+  }
+  states.push_front(std::move(state));
+
+  while (states.size() > capacity) states.pop_back();
+}
+
+bool CCheckpointStore::Load(const std::string& filename, int* header,
+                            std::vector<std::string>& fields, passivedouble*& data) {
+
+  if (!IsEnabled()) return false;
+
+  if (pending.active && pending.state.filename == filename) CompletePrefetch();
+
+  auto it = std::find_if(states.begin(), states.end(),
+                         [&filename](const CState& s) { return s.filename == filename; });
+  if (it == states.end()) return false;
+
+  /*--- Move to the front (most recently used). ---*/
+
+  states.splice(states.begin(), states, it);
+  const auto& state = states.front();
+
+  std::copy(state.header, state.header+NHEADER, header);
+  fields = state.fields;
+  data = new passivedouble[state.nValues];
+
+  if (state.compressed.empty()) {
+    std::copy(state.data.begin(), state.data.end(), data);
+  }
+  else if (!CompressionToolbox::DecompressLossless(state.compressed.data(), state.compressed.size(),
+                                                    state.nValues, state.stride, data)) {
+    SU2_MPI::Error(std::string("Corrupted checkpoint of ") + filename, CURRENT_FUNCTION);
+  }
+  return true;
+}
+
+void CCheckpointStore::Save(const std::string& filename, const int* header, const std::vector<std::string>& fields,
+                            const passivedouble* data, unsigned long nValues) {
+
+  if (!IsEnabled()) return;
+
+  for (const auto& s : states) if (s.filename == filename) return;
+
+  CState state;
+  state.filename = filename;
+  std::copy(header, header+NHEADER, state.header);
+  state.fields = fields;
+  state.nValues = nValues;
+  state.stride = std::max(header[1], 1);
+  state.data.assign(data, data+nValues);
+
+  Store(std::move(state));
+}
+
+void CCheckpointStore::Prefetch(const CGeometry* geometry, const std::string& filename) {
+
+  if (!IsEnabled()) return;
+
+  if (pending.active) {
+    if (pending.state.filename == filename) return;
+    CompletePrefetch();
+  }
+  for (const auto& s : states) if (s.filename == filename) return;
+
+  auto& state = pending.state;
+  state = CState();
+  state.filename = filename;
+
+  const unsigned long nPointGlobal = geometry->GetGlobal_nPointDomain();
+  const unsigned long nPointDomain = geometry->GetnPointDomain();
+
+#ifndef HAVE_MPI
+
+  /*--- Serial, the whole read happens in a separate thread. ---*/
+
+  pending.success = std::async(std::launch::async, [&state, nPointGlobal, nPointDomain]() {
+
+    FILE* fhw = fopen(state.filename.c_str(), "rb");
+    if (!fhw) return false;
+
+    bool ok = (fread(state.header, sizeof(int), NHEADER, fhw) == size_t(NHEADER));
+    const bool compressed = ok && (state.header[0] == CompressionToolbox::COMPRESSED_RESTART_MAGIC);
+    ok = ok && (state.header[0] == 535532 || compressed) && (state.header[2] == long(nPointGlobal));
+
+    const unsigned long nFields = ok? state.header[1] : 0;
+    char str_buf[CGNS_STRING_SIZE];
+
+    state.fields.push_back("Point_ID");
+    for (auto iVar = 0ul; ok && iVar < nFields; iVar++) {
+      ok = (fread(str_buf, sizeof(char), CGNS_STRING_SIZE, fhw) == size_t(CGNS_STRING_SIZE));
+      state.fields.push_back(str_buf);
+    }
+
+    if (ok) {
+      state.nValues = nFields*nPointDomain;
+      state.stride = std::max<unsigned long>(nFields, 1);
+      state.data.resize(state.nValues);
+    }
+    if (ok && !compressed) {
+      ok = (fread(state.data.data(), sizeof(passivedouble), state.nValues, fhw) == state.nValues);
+    }
+    fclose(fhw);
+
+    if (ok && compressed) {
+      std::vector<unsigned long> points(nPointDomain);
+      std::iota(points.begin(), points.end(), 0ul);
+      CompressionToolbox::ReadRestartBlocks(state.filename, state.header, points.data(), nPointDomain,
+                                            state.data.data());
+    }
+    return ok;
+  });
+
+#else
+
+  /*--- Parallel, the header is read now and the data with a non-blocking collective. ---*/
+
+  int ierr = MPI_File_open(SU2_MPI::GetComm(), const_cast<char*>(filename.c_str()), MPI_MODE_RDONLY,
+                           MPI_INFO_NULL, &pending.fileHandle);
+  if (ierr) return;
+
+  const int rank = SU2_MPI::GetRank();
+
+  if (rank == MASTER_NODE)
+    MPI_File_read(pending.fileHandle, state.header, NHEADER, MPI_INT, MPI_STATUS_IGNORE);
+  SU2_MPI::Bcast(state.header, NHEADER, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+
+  const bool compressed = (state.header[0] == CompressionToolbox::COMPRESSED_RESTART_MAGIC);
+
+  if ((state.header[0] != 535532 && !compressed) || state.header[2] != long(nPointGlobal) || state.header[1] <= 0) {
+    MPI_File_close(&pending.fileHandle);
+    return;
+  }
+
+  const unsigned long nFields = state.header[1];
+
+  std::vector<char> str_buf(nFields*CGNS_STRING_SIZE);
+  if (rank == MASTER_NODE) {
+    MPI_File_read_at(pending.fileHandle, NHEADER*sizeof(int), str_buf.data(), str_buf.size(),
+                     MPI_CHAR, MPI_STATUS_IGNORE);
+  }
+  SU2_MPI::Bcast(str_buf.data(), str_buf.size(), MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+
+  /*--- Same format as CSolver::Read_SU2_Restart_Binary. ---*/
+
+  state.fields.push_back("Point_ID");
+  for (auto iVar = 0ul; iVar < nFields; iVar++) {
+    const char* name = &str_buf[iVar*CGNS_STRING_SIZE];
+    state.fields.push_back("\"" + std::string(name, strnlen(name, CGNS_STRING_SIZE)) + "\"");
+  }
+
+  state.nValues = nFields*nPointDomain;
+  state.stride = nFields;
+  state.data.resize(state.nValues);
+
+  /*--- Local points (sorted by global index). ---*/
+
+  std::vector<unsigned long> points;
+  points.reserve(nPointDomain);
+  for (auto iPoint_Global = 0ul; iPoint_Global < nPointGlobal; ++iPoint_Global) {
+    if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) points.push_back(iPoint_Global);
+  }
+
+  /*--- Compressed files are read (collectively) and decompressed block by block, since the
+   * block table is needed to find the blocks of each rank there is no non-blocking version. ---*/
+
+  if (compressed) {
+    MPI_File_close(&pending.fileHandle);
+    CompressionToolbox::ReadRestartBlocks(filename, state.header, points.data(), nPointDomain, state.data.data());
+    Store(std::move(state));
+    state = CState();
+    return;
+  }
+
+  /*--- View of the local points. ---*/
+
+  std::vector<int> blocklen(nPointDomain, nFields);
+  std::vector<MPI_Aint> displace;
+  displace.reserve(nPointDomain);
+  for (auto iPoint_Global : points) displace.push_back(iPoint_Global*nFields*sizeof(passivedouble));
+
+  MPI_Type_create_hindexed(nPointDomain, blocklen.data(), displace.data(), MPI_DOUBLE, &pending.fileType);
+  MPI_Type_commit(&pending.fileType);
+
+  const MPI_Offset disp = NHEADER*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
+  MPI_File_set_view(pending.fileHandle, disp, MPI_DOUBLE, pending.fileType, (char*)"native", MPI_INFO_NULL);
+
+  MPI_File_iread_all(pending.fileHandle, state.data.data(), state.nValues, MPI_DOUBLE, &pending.request);
+
+#endif
+
+  pending.active = true;
+}
+
+void CCheckpointStore::CompletePrefetch() {
+
+  pending.active = false;
+
+#ifndef HAVE_MPI
+  const bool success = pending.success.get();
+#else
+  MPI_Wait(&pending.request, MPI_STATUS_IGNORE);
+  MPI_File_close(&pending.fileHandle);
+  MPI_Type_free(&pending.fileType);
+  const bool success = true;
+#endif
+
+  if (success && IsEnabled()) Store(std::move(pending.state));
+  pending.state = CState();
+}
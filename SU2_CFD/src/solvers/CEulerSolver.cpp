@@ -1520,19 +1520,21 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
   END_SU2_OMP_MASTER
   SU2_OMP_BARRIER
 
-  /*--- Artificial dissipation ---*/
+  /*--- Artificial dissipation, the coefficients may be frozen (e.g. for matrix-free products). ---*/
+
+  const bool frozen = config->GetFrozenCoeff();
 
   if (center && !Output) {
-    if (!center_jst_mat) SetMax_Eigenvalue(geometry, config);
+    if (!center_jst_mat && !frozen) SetMax_Eigenvalue(geometry, config);
     if (center_jst || center_jst_ke || center_jst_mat) {
-      SetCentered_Dissipation_Sensor(geometry, config);
+      if (!frozen) SetCentered_Dissipation_Sensor(geometry, config);
       if (!center_jst_ke) SetUndivided_Laplacian(geometry, config);
     }
   }
 
   /*--- Roe Low Dissipation Sensor ---*/
 
-  if (roe_low_dissipation) {
+  if (roe_low_dissipation && !frozen) {
     SetRoe_Dissipation(geometry, config);
     if (kind_row_dissipation == FD_DUCROS || kind_row_dissipation == NTS_DUCROS){
       SetUpwind_Ducros_Sensor(geometry, config);
@@ -1556,7 +1558,8 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   const auto InnerIter = config->GetInnerIter();
   const bool muscl = config->GetMUSCL_Flow() && (iMesh == MESH_0);
   const bool center = (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED);
-  const bool limiter = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (InnerIter <= config->GetLimiterIter());
+  const bool limiter = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (InnerIter <= config->GetLimiterIter()) &&
+                       !config->GetFrozenCoeff();
   const bool van_albada = (config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE);
 
   /*--- Common preprocessing steps. ---*/
@@ -1707,8 +1710,12 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   else AD::StartNoSharedReading();
 
   /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring)
+  for (auto iColor = 0ul; iColor < EdgeColoring.size(); ++iColor)
   {
+  /*--- Partition boundary edges need the halo data of gradients and limiters. ---*/
+  if (iColor == nEdgeColorInterior) CompleteDeferredComms();
+  const auto& color = EdgeColoring[iColor];
+
   /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
   SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
   for(auto k = 0ul; k < color.size; ++k) {
@@ -1890,6 +1897,9 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   END_SU2_OMP_FOR
   } // end color loop
 
+  /*--- In case there are no partition boundary colors (or no colors at all). ---*/
+  CompleteDeferredComms();
+
   /*--- Restore preaccumulation and adjoint evaluation state. ---*/
   AD::ResumePreaccumulation(pausePreacc);
   if (!ReducerStrategy) AD::EndNoSharedReading();
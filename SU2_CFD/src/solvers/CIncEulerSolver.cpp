@@ -32,6 +32,7 @@
 #include "../../include/fluid/CIncIdealGasPolynomial.hpp"
 #include "../../include/variables/CIncNSVariable.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 
 CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh,
@@ -867,12 +868,14 @@ void CIncEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_
     SU2_OMP_BARRIER
   }
 
-  /*--- Artificial dissipation ---*/
+  /*--- Artificial dissipation, the coefficients may be frozen (e.g. for matrix-free products). ---*/
+
+  const bool frozen = config->GetFrozenCoeff();
 
   if (center && !Output) {
-    SetMax_Eigenvalue(geometry, config);
+    if (!frozen) SetMax_Eigenvalue(geometry, config);
     if (center_jst) {
-      SetCentered_Dissipation_Sensor(geometry, config);
+      if (!frozen) SetCentered_Dissipation_Sensor(geometry, config);
       SetUndivided_Laplacian(geometry, config);
     }
   }
@@ -906,7 +909,8 @@ void CIncEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
   const auto InnerIter = config->GetInnerIter();
   const bool muscl = config->GetMUSCL_Flow() && (iMesh == MESH_0);
   const bool center = (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED);
-  const bool limiter = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (InnerIter <= config->GetLimiterIter());
+  const bool limiter = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (InnerIter <= config->GetLimiterIter()) &&
+                       !config->GetFrozenCoeff();
   const bool van_albada = (config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE);
 
   /*--- Common preprocessing steps. ---*/
@@ -1012,9 +1016,32 @@ void CIncEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contain
 
 }
 
+void CIncEulerSolver::InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+
+  if (solver_container[TURB_SOL])
+    edgeNumerics = CNumericsSIMD::CreateNumerics(*config, nDim, MGLevel, solver_container[TURB_SOL]->GetNodes());
+  else
+    edgeNumerics = CNumericsSIMD::CreateNumerics(*config, nDim, MGLevel);
+
+  if (!edgeNumerics)
+    SU2_MPI::Error("The numerical scheme in use does not support vectorization.", CURRENT_FUNCTION);
+
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
 void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                      CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
+  if (UseEdgeNumericsSIMD(config)) {
+    EdgeFluxResidual(geometry, solver_container, config);
+    return;
+  }
+
   CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
   unsigned long iPoint, jPoint;
@@ -1029,8 +1056,12 @@ void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
   else AD::StartNoSharedReading();
 
   /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring)
+  for (auto iColor = 0ul; iColor < EdgeColoring.size(); ++iColor)
   {
+  /*--- Partition boundary edges need the halo data of gradients and limiters. ---*/
+  if (iColor == nEdgeColorInterior) CompleteDeferredComms();
+  const auto& color = EdgeColoring[iColor];
+
   /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
   SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
   for(auto k = 0ul; k < color.size; ++k) {
@@ -1092,6 +1123,9 @@ void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
   END_SU2_OMP_FOR
   } // end color loop
 
+  /*--- In case there are no partition boundary colors (or no colors at all). ---*/
+  CompleteDeferredComms();
+
   /*--- Restore preaccumulation and adjoint evaluation state. ---*/
   AD::ResumePreaccumulation(pausePreacc);
   if (!ReducerStrategy) AD::EndNoSharedReading();
@@ -1107,6 +1141,11 @@ void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
 void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                       CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
+  if (UseEdgeNumericsSIMD(config)) {
+    EdgeFluxResidual(geometry, solver_container, config);
+    return;
+  }
+
   CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
   /*--- Static arrays of MUSCL-reconstructed primitives and secondaries (thread safety). ---*/
@@ -1131,8 +1170,12 @@ void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
   else AD::StartNoSharedReading();
 
   /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring)
+  for (auto iColor = 0ul; iColor < EdgeColoring.size(); ++iColor)
   {
+  /*--- Partition boundary edges need the halo data of gradients and limiters. ---*/
+  if (iColor == nEdgeColorInterior) CompleteDeferredComms();
+  const auto& color = EdgeColoring[iColor];
+
   /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
   SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
   for(auto k = 0ul; k < color.size; ++k) {
@@ -1270,6 +1313,9 @@ void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
   END_SU2_OMP_FOR
   } // end color loop
 
+  /*--- In case there are no partition boundary colors (or no colors at all). ---*/
+  CompleteDeferredComms();
+
   /*--- Restore preaccumulation and adjoint evaluation state. ---*/
   AD::ResumePreaccumulation(pausePreacc);
   if (!ReducerStrategy) AD::EndNoSharedReading();
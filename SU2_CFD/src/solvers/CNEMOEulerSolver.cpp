@@ -125,12 +125,16 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 
   Allocate(*config);
 
+  /*--- MPI + OpenMP initialization. ---*/
+
+  HybridParallelInitialization(*config, *geometry);
+
   /*--- Allocate Jacobians for implicit time-stepping ---*/
   if (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) {
 
     /*--- Jacobians and vector  structures for implicit computations ---*/
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
 
     if (config->GetKind_Linear_Solver_Prec() == LINELET) {
       nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
@@ -194,24 +198,24 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
     nodes      = new CNEMONSVariable    (Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                          Temperature_Inf, Temperature_ve_Inf,
                                          nPoint, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                         config, FluidModel);
+                                         config, GetFluidModel());
     node_infty = new CNEMONSVariable    (Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                         Temperature_Inf, Temperature_ve_Inf,
                                         1, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                        config, FluidModel);
+                                        config, GetFluidModel());
   } else {
     nodes      = new CNEMOEulerVariable(Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                         Temperature_Inf, Temperature_ve_Inf,
                                         nPoint, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                        config, FluidModel);
+                                        config, GetFluidModel());
     node_infty = new CNEMOEulerVariable(Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                         Temperature_Inf, Temperature_ve_Inf,
                                         1, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                        config, FluidModel);
+                                        config, GetFluidModel());
   }
   SetBaseClassPointerToNodes();
 
-  node_infty->SetPrimVar(0, FluidModel);
+  node_infty->SetPrimVar(0, GetFluidModel());
 
   /*--- Initial comms. ---*/
 
@@ -233,7 +237,7 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 CNEMOEulerSolver::~CNEMOEulerSolver(void) {
 
   delete node_infty;
-  delete FluidModel;
+  for(auto& model : FluidModel) delete model;
 
 }
 
@@ -246,25 +250,34 @@ void CNEMOEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver
   bool center_jst_ke    = (config->GetKind_Centered_Flow() == JST_KE) && (iMesh == MESH_0);
 
   /*--- Set the primitive variables ---*/
-  ErrorCounter  = 0;
+
+  ompMasterAssignBarrier(ErrorCounter, 0);
+
+  SU2_OMP_ATOMIC
   ErrorCounter += SetPrimitive_Variables(solver_container, config, Output);
+  SU2_OMP_BARRIER
 
   if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
-
+    SU2_OMP_MASTER {
       unsigned long tmp = ErrorCounter;
       SU2_MPI::Allreduce(&tmp, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
       config->SetNonphysical_Points(ErrorCounter);
-      
+
       if ((rank == MASTER_NODE) && (ErrorCounter != 0))
         cout << "Warning. The initial solution contains "<< ErrorCounter << " points that are not physical." << endl;
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
   }
 
-  /*--- Artificial dissipation ---*/
+  /*--- Artificial dissipation, the coefficients may be frozen (e.g. for matrix-free products). ---*/
+
+  const bool frozen = config->GetFrozenCoeff();
 
   if (center && !Output) {
-    SetMax_Eigenvalue(geometry, config);
+    if (!frozen) SetMax_Eigenvalue(geometry, config);
     if (center_jst) SetUndivided_Laplacian(geometry, config);
-    if (center_jst || center_jst_ke) SetCentered_Dissipation_Sensor(geometry, config);
+    if ((center_jst || center_jst_ke) && !frozen) SetCentered_Dissipation_Sensor(geometry, config);
   }
 
   /*--- Initialize the Jacobian matrix and residual, not needed for the reducer strategy
@@ -273,6 +286,7 @@ void CNEMOEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver
   if(!ReducerStrategy && !Output) {
     LinSysRes.SetValZero();
     if (implicit) Jacobian.SetValZero();
+    else {SU2_OMP_BARRIER} // because of "nowait" in LinSysRes
   }
 }
 
@@ -283,7 +297,8 @@ void CNEMOEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_conta
 
   const unsigned long InnerIter = config->GetInnerIter();
   const bool muscl       = config->GetMUSCL_Flow() && (iMesh == MESH_0);
-  const bool limiter     = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (InnerIter <= config->GetLimiterIter());
+  const bool limiter     = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (InnerIter <= config->GetLimiterIter()) &&
+                           !config->GetFrozenCoeff();
   const bool center      = config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED;
   const bool van_albada  = config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE;
 
@@ -310,24 +325,26 @@ void CNEMOEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_conta
 
 unsigned long CNEMOEulerSolver::SetPrimitive_Variables(CSolver **solver_container, CConfig *config, bool Output) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
-  bool nonphysical = true;
+  /*--- Number of non-physical points, local to the thread, needs
+   *    further reduction if function is called in parallel ---*/
+  unsigned long nonPhysicalPoints = 0;
+
+  AD::StartNoSharedReading();
 
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
 
-    /*--- Incompressible flow, primitive variables ---*/
+    /*--- Compressible flow, primitive variables ---*/
 
-    nonphysical = nodes->SetPrimVar(iPoint,FluidModel);
+    bool nonphysical = nodes->SetPrimVar(iPoint, GetFluidModel());
 
     /* Check for non-realizable states for reporting. */
 
     if (nonphysical) nonPhysicalPoints++;
-
-    /*--- Initialize the convective, source and viscous residual vector ---*/
-
-    if (!Output) LinSysRes.SetBlock_Zero(iPoint);
-
   }
+  END_SU2_OMP_FOR
+
+  AD::EndNoSharedReading();
 
   return nonPhysicalPoints;
 }
@@ -405,20 +422,35 @@ void CNEMOEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
 
 void CNEMOEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                          CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
-  unsigned long iEdge, iPoint, jPoint;
-  unsigned short iVar;
-  bool err;
-
-  CNumerics* numerics = numerics_container[CONV_TERM];
 
   /*--- Set booleans based on config settings ---*/
-  //bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  /*--- For hybrid parallel AD, pause preaccumulation if there is shared reading of
+  * variables, otherwise switch to the faster adjoint evaluation mode. ---*/
+  bool pausePreacc = false;
+  if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
+  else AD::StartNoSharedReading();
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- Loop over edge colors. ---*/
+  for (auto iColor = 0ul; iColor < EdgeColoring.size(); ++iColor)
+  {
+  /*--- Partition boundary edges need the halo data of gradients and limiters. ---*/
+  if (iColor == nEdgeColorInterior) CompleteDeferredComms();
+  const auto& color = EdgeColoring[iColor];
+
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
+
+    auto iEdge = color.indices[k];
 
     /*--- Points in edge, set normal vectors, and number of neighbors ---*/
-    iPoint = geometry->edges->GetNode(iEdge, 0);
-    jPoint = geometry->edges->GetNode(iEdge, 1);
+    auto iPoint = geometry->edges->GetNode(iEdge, 0);
+    auto jPoint = geometry->edges->GetNode(iEdge, 1);
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
     numerics->SetNeighbor(geometry->nodes->GetnNeighbor(iPoint),
                           geometry->nodes->GetnNeighbor(jPoint));
@@ -442,8 +474,8 @@ void CNEMOEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_c
     auto residual = numerics->ComputeResidual(config);
 
     /*--- Check for NaNs before applying the residual to the linear system ---*/
-    err = false;
-    for (iVar = 0; iVar < nVar; iVar++)
+    bool err = false;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
       if (residual[iVar] != residual[iVar])
         err = true;
     //if (implicit)
@@ -454,16 +486,41 @@ void CNEMOEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_c
     //        err = true;
 
     /*--- Update the residual and Jacobian ---*/
-    if (!err) {
+    if (ReducerStrategy) {
+      if (err) EdgeFluxes.SetBlock_Zero(iEdge);
+      else EdgeFluxes.SetBlock(iEdge, residual);
+    }
+    else if (!err) {
       LinSysRes.AddBlock(iPoint, residual);
       LinSysRes.SubtractBlock(jPoint, residual);
+    }
     //  if (implicit) {
     //    Jacobian.AddBlock(iPoint,iPoint,Jacobian_i);
     //    Jacobian.AddBlock(iPoint,jPoint,Jacobian_j);
     //    Jacobian.SubtractBlock(jPoint,iPoint,Jacobian_i);
     //    Jacobian.SubtractBlock(jPoint,jPoint,Jacobian_j);
     //  }
-    }
+
+    /*--- Viscous contribution. ---*/
+
+    Viscous_Residual(iEdge, geometry, solver_container,
+                     numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
+  }
+  END_SU2_OMP_FOR
+  } // end color loop
+
+  /*--- In case there are no partition boundary colors (or no colors at all). ---*/
+  CompleteDeferredComms();
+
+  /*--- Restore preaccumulation and adjoint evaluation state. ---*/
+  AD::ResumePreaccumulation(pausePreacc);
+  if (!ReducerStrategy) AD::EndNoSharedReading();
+
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    /*--- The edge loops do not set off-diagonal blocks, this only resets the diagonal. ---*/
+    if (implicit)
+      Jacobian.SetDiagonalAsColumnSum();
   }
 }
 
@@ -471,7 +528,7 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
                                        CConfig *config, unsigned short iMesh) {
 
   /*--- Set booleans based on config settings ---*/
-  //const bool implicit         = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool implicit         = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
   const bool muscl            = (config->GetMUSCL_Flow() && (iMesh == MESH_0));
   const bool limiter          = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER);
   const bool van_albada       = (config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE);
@@ -483,9 +540,9 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
   END_SU2_OMP_MASTER
 
   /*--- Pick one numerics object per thread. ---*/
-  CNumerics* numerics = numerics_container[CONV_TERM];
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  /*--- Static arrays for MUSCL reconstructed variables ---*/
+  /*--- Static arrays for MUSCL reconstructed variables (thread safety). ---*/
   su2double Primitive_i[MAXNVAR] = {0.0}, Primitive_j[MAXNVAR] = {0.0};
   su2double Conserved_i[MAXNVAR] = {0.0}, Conserved_j[MAXNVAR] = {0.0};
   su2double      dPdU_i[MAXNVAR] = {0.0},      dPdU_j[MAXNVAR] = {0.0};
@@ -495,8 +552,24 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
   su2double      Cvve_i[MAXNVAR] = {0.0},      Cvve_j[MAXNVAR] = {0.0};
   su2double Gamma_i = 0.0, Gamma_j = 0.0;
 
-  /*--- Loop over edges and calculate convective fluxes ---*/
-  for(unsigned long iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- For hybrid parallel AD, pause preaccumulation if there is shared reading of
+  * variables, otherwise switch to the faster adjoint evaluation mode. ---*/
+  bool pausePreacc = false;
+  if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
+  else AD::StartNoSharedReading();
+
+  /*--- Loop over edge colors and calculate convective fluxes ---*/
+  for (auto iColor = 0ul; iColor < EdgeColoring.size(); ++iColor)
+  {
+  /*--- Partition boundary edges need the halo data of gradients and limiters. ---*/
+  if (iColor == nEdgeColorInterior) CompleteDeferredComms();
+  const auto& color = EdgeColoring[iColor];
+
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
+
+    auto iEdge = color.indices[k];
 
     unsigned short iDim, iVar;
 
@@ -558,13 +631,18 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
         }
 
         if (limiter) {
+          /*--- Edge-based limiters are not stored in the nodes (thread safety). ---*/
+          su2double edgeLim_i, edgeLim_j;
           if (van_albada) {
             su2double V_ij = V_j[iVar] - V_i[iVar];
-            Limiter_i[iVar] = V_ij*( 2.0*Project_Grad_i + V_ij) / (4*pow(Project_Grad_i, 2) + pow(V_ij, 2) + EPS);
-            Limiter_j[iVar] = V_ij*(-2.0*Project_Grad_j + V_ij) / (4*pow(Project_Grad_j, 2) + pow(V_ij, 2) + EPS);
+            edgeLim_i = V_ij*( 2.0*Project_Grad_i + V_ij) / (4*pow(Project_Grad_i, 2) + pow(V_ij, 2) + EPS);
+            edgeLim_j = V_ij*(-2.0*Project_Grad_j + V_ij) / (4*pow(Project_Grad_j, 2) + pow(V_ij, 2) + EPS);
+          } else {
+            edgeLim_i = Limiter_i[iVar];
+            edgeLim_j = Limiter_j[iVar];
           }
-          if (lim_i > Limiter_i[iVar] && Limiter_i[iVar] != 0) lim_i = Limiter_i[iVar];
-          if (lim_j > Limiter_j[iVar] && Limiter_j[iVar] != 0) lim_j = Limiter_j[iVar];
+          if (lim_i > edgeLim_i && edgeLim_i != 0) lim_i = edgeLim_i;
+          if (lim_j > edgeLim_j && edgeLim_j != 0) lim_j = edgeLim_j;
           su2double lim_ij = min(lim_i, lim_j);
 
           Primitive_i[iVar] = V_i[iVar] + lim_ij*Project_Grad_i;
@@ -627,16 +705,41 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
     //        err = true;
 
     /*--- Update the residual and Jacobian ---*/
-    if (!err) {
+    if (ReducerStrategy) {
+      if (err) EdgeFluxes.SetBlock_Zero(iEdge);
+      else EdgeFluxes.SetBlock(iEdge, residual);
+    }
+    else if (!err) {
       LinSysRes.AddBlock(iPoint, residual);
       LinSysRes.SubtractBlock(jPoint, residual);
-      //if (implicit) {
-      //  Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-      //  Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-      //  Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-      //  Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
-      //}
     }
+    //if (implicit) {
+    //  Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+    //  Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
+    //  Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
+    //  Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
+    //}
+
+    /*--- Viscous contribution. ---*/
+
+    Viscous_Residual(iEdge, geometry, solver_container,
+                     numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
+  }
+  END_SU2_OMP_FOR
+  } // end color loop
+
+  /*--- In case there are no partition boundary colors (or no colors at all). ---*/
+  CompleteDeferredComms();
+
+  /*--- Restore preaccumulation and adjoint evaluation state. ---*/
+  AD::ResumePreaccumulation(pausePreacc);
+  if (!ReducerStrategy) AD::EndNoSharedReading();
+
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    /*--- The edge loops do not set off-diagonal blocks, this only resets the diagonal. ---*/
+    if (implicit)
+      Jacobian.SetDiagonalAsColumnSum();
   }
 
   /*--- Warning message about non-physical reconstructions. ---*/
@@ -720,8 +823,9 @@ void CNEMOEulerSolver::RecomputeConservativeVector(su2double *U, const su2double
   }
 
   /*--- Set the fluidmodel and recompute energies ---*/
-  FluidModel->SetTDStateRhosTTv( rhos, V[T_INDEX], V[TVE_INDEX]);
-  const auto& Energies = FluidModel->ComputeMixtureEnergies();
+  auto fluidModel = GetFluidModel();
+  fluidModel->SetTDStateRhosTTv( rhos, V[T_INDEX], V[TVE_INDEX]);
+  const auto& Energies = fluidModel->ComputeMixtureEnergies();
 
   /*--- Set conservative energies ---*/
   U[nSpecies+nDim]   = V[RHO_INDEX]*(Energies[0]+0.5*sqvel);
@@ -766,11 +870,7 @@ bool CNEMOEulerSolver::CheckNonPhys(const su2double *V) const {
 
 void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  unsigned short iVar, jVar;
-  unsigned long iPoint;
-
   /*--- Assign booleans ---*/
-  bool err        = false;
   bool implicit   = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   bool frozen     = config->GetFrozen();
   bool monoatomic = config->GetMonoatomic();
@@ -778,16 +878,14 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
   bool viscous    = config->GetViscous();
   bool rans       = (config->GetKind_Turb_Model() != NONE);
 
-  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  /*--- Initialize the error counter ---*/
+  /*--- Initialize the error counters (thread local). ---*/
   unsigned long eAxi_local = 0;
   unsigned long eChm_local = 0;
   unsigned long eVib_local = 0;
 
-  /*--- Initialize the source residual to zero ---*/
-  for (iVar = 0; iVar < nVar; iVar++) Residual[iVar] = 0.0;
-
   /*--- Preprocess viscous axisymm variables (if necessary) ---*/
   if (axisymm && viscous) {
     ComputeAxisymmetricAuxGradients(geometry,config);
@@ -797,7 +895,10 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
 
   /*--- loop over interior points ---*/
   SU2_OMP_FOR_DYN(omp_chunk_size)
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+
+    unsigned short iVar, jVar;
+    bool err = false;
 
     /*--- Set conserved & primitive variables  ---*/
     numerics->SetConservative(nodes->GetSolution(iPoint),  nullptr);
@@ -922,12 +1023,20 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
 
   AD::EndNoSharedReading();
 
-  /*--- Checking for NaN ---*/
-  unsigned long eAxi_global = eAxi_local;
-  unsigned long eChm_global = eChm_local;
-  unsigned long eVib_global = eVib_local;
+  /*--- Checking for NaN, reduce the counters over threads. ---*/
+  static unsigned long eAxi_global, eChm_global, eVib_global;
+  ompMasterAssignBarrier(eAxi_global,0, eChm_global,0, eVib_global,0);
+
+  SU2_OMP_ATOMIC
+  eAxi_global += eAxi_local;
+  SU2_OMP_ATOMIC
+  eChm_global += eChm_local;
+  SU2_OMP_ATOMIC
+  eVib_global += eVib_local;
+  SU2_OMP_BARRIER
 
   //THIS IS NO FUN
+  SU2_OMP_MASTER
   if ((eAxi_global != 0) ||
       (eChm_global != 0) ||
       (eVib_global != 0)) {
@@ -936,6 +1045,7 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
     cout << "Chemical:    " << eChm_global << endl;
     cout << "Vib. Relax:  " << eVib_global << endl;
   }
+  END_SU2_OMP_MASTER
 }
 
 void CNEMOEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solver_container,
@@ -1006,19 +1116,26 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   bool tkeNeeded          = ((turbulent) && (config->GetKind_Turb_Model() == SST));
   bool reynolds_init      = (config->GetKind_InitOption() == REYNOLDS);
 
-  /*--- Instatiate the fluid model ---*/
-  switch (config->GetKind_FluidModel()) {
-  case MUTATIONPP:
-   #if defined(HAVE_MPP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
-     FluidModel = new CMutationTCLib(config, nDim);
-   #else
-     SU2_MPI::Error(string("Either 1) Mutation++ has not been configured/compiled (add '-Denable-mpp=true' to your meson string) or 2) CODI must be deactivated since it is not compatible with Mutation++."),
-     CURRENT_FUNCTION);
-   #endif
-   break;
-  case SU2_NONEQ:
-   FluidModel = new CSU2TCLib(config, nDim, viscous);
-   break;
+  /*--- Instatiate the fluid models, one per thread since they store the thermodynamic state.
+   * They are created serially as the libraries read their data files on construction.
+   * GetFluidModel() returns the object of the calling thread. ---*/
+  assert(FluidModel.empty() && "Potential memory leak!");
+  FluidModel.resize(omp_get_max_threads());
+
+  for (auto& fluidModel : FluidModel) {
+    switch (config->GetKind_FluidModel()) {
+    case MUTATIONPP:
+     #if defined(HAVE_MPP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+       fluidModel = new CMutationTCLib(config, nDim);
+     #else
+       SU2_MPI::Error(string("Either 1) Mutation++ has not been configured/compiled (add '-Denable-mpp=true' to your meson string) or 2) CODI must be deactivated since it is not compatible with Mutation++."),
+       CURRENT_FUNCTION);
+     #endif
+     break;
+    case SU2_NONEQ:
+     fluidModel = new CSU2TCLib(config, nDim, viscous);
+     break;
+    }
   }
 
   /*--- Compute the Free Stream Pressure, Temperatrue, and Density ---*/
@@ -1031,17 +1148,17 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   /*---                                     ---*/
 
   /*--- Set mixture state based on pressure, mass fractions and temperatures ---*/
-  FluidModel->SetTDStatePTTv(Pressure_FreeStream, MassFrac_Inf,
+  GetFluidModel()->SetTDStatePTTv(Pressure_FreeStream, MassFrac_Inf,
                              Temperature_FreeStream, Temperature_ve_FreeStream);
 
   /*--- Compute Gas Constant ---*/
-  GasConstant_Inf = FluidModel->ComputeGasConstant();
+  GasConstant_Inf = GetFluidModel()->ComputeGasConstant();
   config->SetGas_Constant(GasConstant_Inf);
 
   /*--- Compute the freestream density, soundspeed ---*/
-  Density_FreeStream = FluidModel->GetDensity();
-  soundspeed         = FluidModel->ComputeSoundSpeed();
-  Gamma              = FluidModel->ComputeGamma();
+  Density_FreeStream = GetFluidModel()->GetDensity();
+  soundspeed         = GetFluidModel()->ComputeSoundSpeed();
+  Gamma              = GetFluidModel()->ComputeGamma();
 
   /*--- Compute the Free Stream velocity, using the Mach number ---*/
   if (nDim == 2) {
@@ -1063,7 +1180,7 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   ModVel_FreeStream = sqrt(ModVel_FreeStream); config->SetModVel_FreeStream(ModVel_FreeStream);
 
   /*--- Calculate energies ---*/
-  const auto& energies = FluidModel->ComputeMixtureEnergies();
+  const auto& energies = GetFluidModel()->ComputeMixtureEnergies();
 
   /*--- Viscous initialization ---*/
   if (viscous) {
@@ -1085,7 +1202,7 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
     if (!reynolds_init) {
 
       /*--- Thermodynamics quantities based initialization ---*/
-      Viscosity_FreeStream = FluidModel->GetViscosity();
+      Viscosity_FreeStream = GetFluidModel()->GetViscosity();
       Energy_FreeStream    = energies[0] + 0.5*sqvel;
 
     } else {
@@ -1402,7 +1519,7 @@ void CNEMOEulerSolver::BC_Sym_Plane(CGeometry *geometry, CSolver **solver_contai
   unsigned long iPoint, iVertex;
 
   su2double *Normal = nullptr, Area, UnitNormal[3], *NormalArea,
-  **Jacobian_b, **DubDu,
+  **Jacobian_b, **DubDu, Residual[MAXNVAR] = {0.0},
   rho, cs, P, rhoE, rhoEve, conc, *u, *dPdU;
 
   bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -1420,9 +1537,10 @@ void CNEMOEulerSolver::BC_Sym_Plane(CGeometry *geometry, CSolver **solver_contai
   }
 
   /*--- Get species molar mass ---*/
-  auto& Ms = FluidModel->GetSpeciesMolarMass();
+  auto& Ms = GetFluidModel()->GetSpeciesMolarMass();
 
   /*--- Loop over all the vertices on this boundary (val_marker) ---*/
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
@@ -1461,7 +1579,7 @@ void CNEMOEulerSolver::BC_Sym_Plane(CGeometry *geometry, CSolver **solver_contai
         /*--- Initialize Jacobian ---*/
         for (iVar = 0; iVar < nVar; iVar++)
           for (jVar = 0; jVar < nVar; jVar++)
-            Jacobian_i[iVar][jVar] = 0.0;
+            Jacobian_b[iVar][jVar] = 0.0;
 
         /*--- Calculate state i ---*/
         rho     = nodes->GetDensity(iPoint);
@@ -1478,34 +1596,36 @@ void CNEMOEulerSolver::BC_Sym_Plane(CGeometry *geometry, CSolver **solver_contai
 
           /////// NEW //////
           for (iDim = 0; iDim < nDim; iDim++) {
-            Jacobian_i[nSpecies+iDim][iSpecies] = dPdU[iSpecies] * UnitNormal[iDim];
-            Jacobian_i[iSpecies][nSpecies+iDim] = cs * UnitNormal[iDim];
+            Jacobian_b[nSpecies+iDim][iSpecies] = dPdU[iSpecies] * UnitNormal[iDim];
+            Jacobian_b[iSpecies][nSpecies+iDim] = cs * UnitNormal[iDim];
           }
         }
 
         for (iDim = 0; iDim < nDim; iDim++) {
           for (jDim = 0; jDim < nDim; jDim++) {
-            Jacobian_i[nSpecies+iDim][nSpecies+jDim] = u[iDim]*UnitNormal[jDim]
+            Jacobian_b[nSpecies+iDim][nSpecies+jDim] = u[iDim]*UnitNormal[jDim]
                 + dPdU[nSpecies+jDim]*UnitNormal[iDim];
           }
-          Jacobian_i[nSpecies+iDim][nSpecies+nDim]   = dPdU[nSpecies+nDim]  *UnitNormal[iDim];
-          Jacobian_i[nSpecies+iDim][nSpecies+nDim+1] = dPdU[nSpecies+nDim+1]*UnitNormal[iDim];
+          Jacobian_b[nSpecies+iDim][nSpecies+nDim]   = dPdU[nSpecies+nDim]  *UnitNormal[iDim];
+          Jacobian_b[nSpecies+iDim][nSpecies+nDim+1] = dPdU[nSpecies+nDim+1]*UnitNormal[iDim];
 
-          Jacobian_i[nSpecies+nDim][nSpecies+iDim]   = (rhoE+P)/rho * UnitNormal[iDim];
-          Jacobian_i[nSpecies+nDim+1][nSpecies+iDim] = rhoEve/rho   * UnitNormal[iDim];
+          Jacobian_b[nSpecies+nDim][nSpecies+iDim]   = (rhoE+P)/rho * UnitNormal[iDim];
+          Jacobian_b[nSpecies+nDim+1][nSpecies+iDim] = rhoEve/rho   * UnitNormal[iDim];
         }
 
         /*--- Integrate over the dual-grid area ---*/
         for (iVar = 0; iVar < nVar; iVar++)
           for (jVar = 0; jVar < nVar; jVar++)
-            Jacobian_i[iVar][jVar] = Jacobian_i[iVar][jVar] * Area;
+            Jacobian_b[iVar][jVar] = Jacobian_b[iVar][jVar] * Area;
 
         /*--- Apply the contribution to the system ---*/
-        Jacobian.AddBlock(iPoint,iPoint,Jacobian_i);
+        Jacobian.AddBlock(iPoint,iPoint,Jacobian_b);
 
       }
     }
   }
+  END_SU2_OMP_FOR
+
   delete [] Normal;
   delete [] NormalArea;
   delete [] u;
@@ -1536,6 +1656,7 @@ void CNEMOEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_contai
   su2double *Normal = new su2double[nDim];
 
   /*--- Loop over all the vertices on this boundary (val_marker) ---*/
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
@@ -1633,6 +1754,7 @@ void CNEMOEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_contai
       }
     }
   }
+  END_SU2_OMP_FOR
 
   /*--- Free locally allocated memory ---*/
   delete [] Normal;
@@ -1947,7 +2069,10 @@ void CNEMOEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container
   unsigned short RHOCVTR_INDEX = nodes->GetRhoCvtrIndex();
   unsigned short RHOCVVE_INDEX = nodes->GetRhoCvveIndex();
 
+  auto fluidModel = GetFluidModel();
+
   /*--- Loop over all the vertices on this boundary marker ---*/
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
@@ -1975,8 +2100,8 @@ void CNEMOEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container
       /*--- Build the fictitious intlet state based on characteristics ---*/
 
       /*--- Compute Gamma using domain state ---*/
-      Gamma = nodes->GetGamma(iPoint);
-      Gamma_Minus_One = Gamma - 1.0;
+      const su2double Gamma = nodes->GetGamma(iPoint);
+      const su2double Gamma_Minus_One = Gamma - 1.0;
 
       /*--- Retrieve the specified back pressure for this outlet. ---*/
       if (gravity) P_Exit = config->GetOutlet_Pressure(Marker_Tag) - geometry->nodes->GetCoord(iPoint, nDim-1)*STANDARD_GRAVITY;
@@ -2058,11 +2183,11 @@ void CNEMOEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container
         V_outlet[A_INDEX]     = SoundSpeed;
 
         /*--- Set mixture state and compute quantities ---*/
-        FluidModel->SetTDStateRhosTTv(rhos, Temperature, Tve);
-        V_outlet[RHOCVTR_INDEX] = FluidModel->ComputerhoCvtr();
-        V_outlet[RHOCVVE_INDEX] = FluidModel->ComputerhoCvve();
+        fluidModel->SetTDStateRhosTTv(rhos, Temperature, Tve);
+        V_outlet[RHOCVTR_INDEX] = fluidModel->ComputerhoCvtr();
+        V_outlet[RHOCVVE_INDEX] = fluidModel->ComputerhoCvve();
 
-        const auto& energies = FluidModel->ComputeMixtureEnergies();
+        const auto& energies = fluidModel->ComputeMixtureEnergies();
 
         /*--- Conservative variables, using the derived quantities ---*/
         for (iSpecies = 0; iSpecies < nSpecies; iSpecies ++){
@@ -2156,6 +2281,7 @@ void CNEMOEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container
 //      }
     }
   }
+  END_SU2_OMP_FOR
 
   /*--- Free locally allocated memory ---*/
   delete [] U_domain;
@@ -2394,6 +2520,7 @@ void CNEMOEulerSolver::BC_Supersonic_Outlet(CGeometry *geometry, CSolver **solve
    so all flow variables can should be interpolated from the domain. ---*/
 
   /*--- Loop over all the vertices on this boundary marker ---*/
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
@@ -2439,6 +2566,7 @@ void CNEMOEulerSolver::BC_Supersonic_Outlet(CGeometry *geometry, CSolver **solve
       //  Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
     }
   }
+  END_SU2_OMP_FOR
 
   /*--- Free locally allocated memory ---*/
   delete [] Normal;
@@ -58,7 +58,8 @@ void CNEMONSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_containe
                               unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
   const unsigned long InnerIter = config->GetInnerIter();
-  const bool limiter    = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (InnerIter <= config->GetLimiterIter());
+  const bool limiter    = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (InnerIter <= config->GetLimiterIter()) &&
+                          !config->GetFrozenCoeff();
   const bool van_albada = config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE;
   const bool muscl      = config->GetMUSCL_Flow() && (iMesh == MESH_0);
   const bool center     = config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED;
@@ -97,13 +98,13 @@ void CNEMONSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_containe
 
   /*--- Evaluate the vorticity and strain rate magnitude ---*/
   //TODO: THIS NEEDS TO BE UPDATED ASAP!
-  StrainMag_Max = 0.0;
-  Omega_Max = 0.0;
+  ompMasterAssignBarrier(StrainMag_Max,0.0, Omega_Max,0.0);
   //nodes->SetVorticity_StrainMag();
 
   //su2double strainMax = 0.0;
   su2double omegaMax = 0.0;
 
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
 
     //su2double StrainMag = nodes->GetStrainMag(iPoint);
@@ -114,17 +115,24 @@ void CNEMONSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_containe
     omegaMax = max(omegaMax, Omega);
 
   }
+  END_SU2_OMP_FOR
 
-  //StrainMag_Max = max(StrainMag_Max, strainMax);
-  Omega_Max = max(Omega_Max, omegaMax);
+  SU2_OMP_CRITICAL {
+    //StrainMag_Max = max(StrainMag_Max, strainMax);
+    Omega_Max = max(Omega_Max, omegaMax);
+  }
+  END_SU2_OMP_CRITICAL
 
   if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
-
-    su2double MyOmega_Max = Omega_Max;
-    //su2double MyStrainMag_Max = StrainMag_Max;
-    //SU2_MPI::Allreduce(&MyStrainMag_Max, &StrainMag_Max, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
-    SU2_MPI::Allreduce(&MyOmega_Max, &Omega_Max, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
-
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      su2double MyOmega_Max = Omega_Max;
+      //su2double MyStrainMag_Max = StrainMag_Max;
+      //SU2_MPI::Allreduce(&MyStrainMag_Max, &StrainMag_Max, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+      SU2_MPI::Allreduce(&MyOmega_Max, &Omega_Max, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
   }
 }
 
@@ -141,6 +149,7 @@ void CNEMONSSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, const CConfig
   RHO_INDEX  = nodes->GetRhoIndex();
 
   /*--- Modify species density to mass concentration ---*/
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for ( iPoint = 0; iPoint < nPoint; iPoint++){
     su2double primitives_aux[MAXNVAR] = {0.0};
     for( iVar = 0; iVar < nPrimVar; iVar++)
@@ -150,6 +159,7 @@ void CNEMONSSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, const CConfig
     for( iVar = 0; iVar < nPrimVar; iVar++)
       nodes->SetPrimitive_Aux(iPoint, iVar, primitives_aux[iVar] );
   }
+  END_SU2_OMP_FOR
 
   const auto& primitives = nodes->GetPrimitive_Aux();
 
@@ -164,6 +174,9 @@ unsigned long CNEMONSSolver::SetPrimitive_Variables(CSolver **solver_container,C
 
   bool nonphysical = true;
 
+  AD::StartNoSharedReading();
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (iPoint = 0; iPoint < nPoint; iPoint ++) {
 
     /*--- Retrieve the value of the kinetic energy (if needed). ---*/
@@ -180,101 +193,100 @@ unsigned long CNEMONSSolver::SetPrimitive_Variables(CSolver **solver_container,C
 
     /*--- Incompressible flow, primitive variables ---*/
 
-    nonphysical = nodes->SetPrimVar(iPoint,FluidModel);
+    nonphysical = nodes->SetPrimVar(iPoint, GetFluidModel());
 
     /* Check for non-realizable states for reporting. */
 
     if (nonphysical) nonPhysicalPoints++;
 
   }
+  END_SU2_OMP_FOR
+
+  AD::EndNoSharedReading();
 
   return nonPhysicalPoints;
 }
 
-void CNEMONSSolver::Viscous_Residual(CGeometry *geometry,
-                                     CSolver **solution_container,
-                                     CNumerics **numerics_container,
-                                     CConfig *config, unsigned short iMesh,
-                                     unsigned short iRKStep) {
+void CNEMONSSolver::Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
+                                     CNumerics *numerics, CConfig *config) {
 
   bool err;
   unsigned short iVar;
-  unsigned long iPoint, jPoint, iEdge;
-
-  CNumerics* numerics = numerics_container[VISC_TERM];
-
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-
-    /*--- Points, coordinates and normal vector in edge ---*/
-    iPoint = geometry->edges->GetNode(iEdge, 0);
-    jPoint = geometry->edges->GetNode(iEdge, 1);
-    numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
-                       geometry->nodes->GetCoord(jPoint) );
-    numerics->SetNormal(geometry->edges->GetNormal(iEdge));
-
-    /*--- Primitive variables, and gradient ---*/
-    numerics->SetConservative   (nodes->GetSolution(iPoint),
-                                 nodes->GetSolution(jPoint) );
-    numerics->SetConsVarGradient(nodes->GetGradient(iPoint),
-                                 nodes->GetGradient(jPoint) );
-    numerics->SetPrimitive      (nodes->GetPrimitive(iPoint),
-                                 nodes->GetPrimitive(jPoint) );
-    numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint),
-                                 nodes->GetGradient_Primitive(jPoint) );
-
-    /*--- Pass supplementary information to CNumerics ---*/
-    numerics->SetdPdU  (nodes->GetdPdU(iPoint),   nodes->GetdPdU(jPoint));
-    numerics->SetdTdU  (nodes->GetdTdU(iPoint),   nodes->GetdTdU(jPoint));
-    numerics->SetdTvedU(nodes->GetdTvedU(iPoint), nodes->GetdTvedU(jPoint));
-    numerics->SetEve   (nodes->GetEve(iPoint),    nodes->GetEve(jPoint));
-    numerics->SetCvve  (nodes->GetCvve(iPoint),   nodes->GetCvve(jPoint));
-
-    /*--- Species diffusion coefficients ---*/
-    numerics->SetDiffusionCoeff(nodes->GetDiffusionCoeff(iPoint),
-                                nodes->GetDiffusionCoeff(jPoint) );
-
-    /*--- Laminar viscosity ---*/
-    numerics->SetLaminarViscosity(nodes->GetLaminarViscosity(iPoint),
-                                  nodes->GetLaminarViscosity(jPoint) );
-
-    /*--- Eddy viscosity ---*/
-    numerics->SetEddyViscosity(nodes->GetEddyViscosity(iPoint),
-                               nodes->GetEddyViscosity(jPoint) );
-
-    /*--- Thermal conductivity ---*/
-    numerics->SetThermalConductivity(nodes->GetThermalConductivity(iPoint),
-                                     nodes->GetThermalConductivity(jPoint));
-
-    /*--- Vib-el. thermal conductivity ---*/
-    numerics->SetThermalConductivity_ve(nodes->GetThermalConductivity_ve(iPoint),
-                                        nodes->GetThermalConductivity_ve(jPoint) );
-
-    /*--- Compute and update residual ---*/
-    auto residual = numerics->ComputeResidual(config);
-
-    /*--- Check for NaNs before applying the residual to the linear system ---*/
-    err = false;
-    for (iVar = 0; iVar < nVar; iVar++)
-      if (residual[iVar] != residual[iVar]) err = true;
-    //if (implicit)
-    //  for (iVar = 0; iVar < nVar; iVar++)
-    //    for (jVar = 0; jVar < nVar; jVar++)
-    //      if ((Jacobian_i[iVar][jVar] != Jacobian_i[iVar][jVar]) ||
-    //          (Jacobian_j[iVar][jVar] != Jacobian_j[iVar][jVar])   )
-    //        err = true;
-
-    /*--- Update the residual and Jacobian ---*/
-    if (!err) {
-      LinSysRes.SubtractBlock(iPoint, residual);
-      LinSysRes.AddBlock(jPoint, residual);
-      //if (implicit) {
-      //  Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-      //  Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
-      //  Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
-      //  Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
-      //}
-    }
-  } //iEdge
+
+  /*--- Points, coordinates and normal vector in edge ---*/
+  const auto iPoint = geometry->edges->GetNode(iEdge, 0);
+  const auto jPoint = geometry->edges->GetNode(iEdge, 1);
+  numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
+                     geometry->nodes->GetCoord(jPoint) );
+  numerics->SetNormal(geometry->edges->GetNormal(iEdge));
+
+  /*--- Primitive variables, and gradient ---*/
+  numerics->SetConservative   (nodes->GetSolution(iPoint),
+                               nodes->GetSolution(jPoint) );
+  numerics->SetConsVarGradient(nodes->GetGradient(iPoint),
+                               nodes->GetGradient(jPoint) );
+  numerics->SetPrimitive      (nodes->GetPrimitive(iPoint),
+                               nodes->GetPrimitive(jPoint) );
+  numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint),
+                               nodes->GetGradient_Primitive(jPoint) );
+
+  /*--- Pass supplementary information to CNumerics ---*/
+  numerics->SetdPdU  (nodes->GetdPdU(iPoint),   nodes->GetdPdU(jPoint));
+  numerics->SetdTdU  (nodes->GetdTdU(iPoint),   nodes->GetdTdU(jPoint));
+  numerics->SetdTvedU(nodes->GetdTvedU(iPoint), nodes->GetdTvedU(jPoint));
+  numerics->SetEve   (nodes->GetEve(iPoint),    nodes->GetEve(jPoint));
+  numerics->SetCvve  (nodes->GetCvve(iPoint),   nodes->GetCvve(jPoint));
+
+  /*--- Species diffusion coefficients ---*/
+  numerics->SetDiffusionCoeff(nodes->GetDiffusionCoeff(iPoint),
+                              nodes->GetDiffusionCoeff(jPoint) );
+
+  /*--- Laminar viscosity ---*/
+  numerics->SetLaminarViscosity(nodes->GetLaminarViscosity(iPoint),
+                                nodes->GetLaminarViscosity(jPoint) );
+
+  /*--- Eddy viscosity ---*/
+  numerics->SetEddyViscosity(nodes->GetEddyViscosity(iPoint),
+                             nodes->GetEddyViscosity(jPoint) );
+
+  /*--- Thermal conductivity ---*/
+  numerics->SetThermalConductivity(nodes->GetThermalConductivity(iPoint),
+                                   nodes->GetThermalConductivity(jPoint));
+
+  /*--- Vib-el. thermal conductivity ---*/
+  numerics->SetThermalConductivity_ve(nodes->GetThermalConductivity_ve(iPoint),
+                                      nodes->GetThermalConductivity_ve(jPoint) );
+
+  /*--- Compute and update residual ---*/
+  auto residual = numerics->ComputeResidual(config);
+
+  /*--- Check for NaNs before applying the residual to the linear system ---*/
+  err = false;
+  for (iVar = 0; iVar < nVar; iVar++)
+    if (residual[iVar] != residual[iVar]) err = true;
+  //if (implicit)
+  //  for (iVar = 0; iVar < nVar; iVar++)
+  //    for (jVar = 0; jVar < nVar; jVar++)
+  //      if ((Jacobian_i[iVar][jVar] != Jacobian_i[iVar][jVar]) ||
+  //          (Jacobian_j[iVar][jVar] != Jacobian_j[iVar][jVar])   )
+  //        err = true;
+
+  /*--- Update the residual and Jacobian ---*/
+  if (err) return;
+
+  if (ReducerStrategy) {
+    EdgeFluxes.SubtractBlock(iEdge, residual);
+  }
+  else {
+    LinSysRes.SubtractBlock(iPoint, residual);
+    LinSysRes.AddBlock(jPoint, residual);
+  }
+  //if (implicit) {
+  //  Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+  //  Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
+  //  Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
+  //  Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+  //}
 }
 
 void CNEMONSSolver::BC_HeatFluxNonCatalytic_Wall(CGeometry *geometry,
@@ -291,6 +303,7 @@ void CNEMONSSolver::BC_HeatFluxNonCatalytic_Wall(CGeometry *geometry,
   unsigned long iVertex, iPoint, total_index;
   su2double dTdn, dTvedn, ktr, kve, pcontrol, Wall_HeatFlux;
   su2double *Normal, Area, *V;
+  su2double Res_Visc[MAXNVAR] = {0.0}, Vector[MAXNDIM] = {0.0};
 
   /*--- Assign booleans ---*/
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -310,6 +323,7 @@ void CNEMONSSolver::BC_HeatFluxNonCatalytic_Wall(CGeometry *geometry,
   RHOCVTR_INDEX = nodes->GetRhoCvtrIndex();
 
   /*--- Loop over all of the vertices on this boundary marker ---*/
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for(iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
@@ -343,7 +357,7 @@ void CNEMONSSolver::BC_HeatFluxNonCatalytic_Wall(CGeometry *geometry,
       // TODO: Need to determine proper way to incorporate eddy viscosity
       // This is only scaling Kve by same factor as ktr
       su2double Mass = 0.0;
-      auto&     Ms   = FluidModel->GetSpeciesMolarMass();
+      auto&     Ms   = GetFluidModel()->GetSpeciesMolarMass();
       su2double tmp1, scl, Cptr;
       su2double Ru=1000.0*UNIVERSAL_GAS_CONSTANT;
       su2double eddy_viscosity = nodes->GetEddyViscosity(iPoint);
@@ -381,6 +395,7 @@ void CNEMONSSolver::BC_HeatFluxNonCatalytic_Wall(CGeometry *geometry,
       }
     }
   }
+  END_SU2_OMP_FOR
 }
 
 void CNEMONSSolver::BC_HeatFlux_Wall(CGeometry *geometry,
@@ -639,6 +654,7 @@ void CNEMONSSolver::BC_IsothermalNonCatalytic_Wall(CGeometry *geometry,
   su2double ktr, kve, Ti, Tvei, Tj, Tvej, Twall, dij, theta,
   Area, *Normal, UnitNormal[3], *Coord_i, *Coord_j, C;
   su2double *V;
+  su2double Res_Visc[MAXNVAR] = {0.0}, Vector[MAXNDIM] = {0.0};
   bool ionization = config->GetIonization();
 
   if (ionization) {
@@ -658,6 +674,7 @@ void CNEMONSSolver::BC_IsothermalNonCatalytic_Wall(CGeometry *geometry,
   Twall = config->GetIsothermal_Temperature(Marker_Tag);
 
   /*--- Loop over boundary points to calculate energy flux ---*/
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for(iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
@@ -716,7 +733,7 @@ void CNEMONSSolver::BC_IsothermalNonCatalytic_Wall(CGeometry *geometry,
       // This is only scaling Kve by same factor as ktr
       V = nodes->GetPrimitive(iPoint);
       su2double Mass = 0.0;
-      auto&     Ms   = FluidModel->GetSpeciesMolarMass();
+      auto&     Ms   = GetFluidModel()->GetSpeciesMolarMass();
       su2double tmp1, scl, Cptr;
       su2double Ru=1000.0*UNIVERSAL_GAS_CONSTANT;
       su2double eddy_viscosity=nodes->GetEddyViscosity(iPoint);
@@ -753,6 +770,7 @@ void CNEMONSSolver::BC_IsothermalNonCatalytic_Wall(CGeometry *geometry,
       //} // implicit
     }
   }
+  END_SU2_OMP_FOR
 }
 
 void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
@@ -791,7 +809,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
   /*--- Get universal information ---*/
   RuSI     = UNIVERSAL_GAS_CONSTANT;
   Ru       = 1000.0*RuSI;
-  auto& Ms = FluidModel->GetSpeciesMolarMass();
+  auto& Ms = GetFluidModel()->GetSpeciesMolarMass();
 
   /*--- Get the locations of the primitive variables ---*/
   RHOS_INDEX  = nodes->GetRhosIndex();
@@ -843,7 +861,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
       Vj   = nodes->GetPrimitive(jPoint);
       Di   = nodes->GetDiffusionCoeff(iPoint);
       eves = nodes->GetEve(iPoint);
-      hs   = FluidModel->ComputeSpeciesEnthalpy(Vi[T_INDEX], Vi[TVE_INDEX], eves);
+      hs   = GetFluidModel()->ComputeSpeciesEnthalpy(Vi[T_INDEX], Vi[TVE_INDEX], eves);
       for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
         Yj[iSpecies] = Vj[RHOS_INDEX+iSpecies]/Vj[RHO_INDEX];
       rho    = Vi[RHO_INDEX];
@@ -892,7 +910,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
         }
 
         /*--- Calculate supplementary quantities ---*/
-        Cvtrs = FluidModel->GetSpeciesCvTraRot();
+        Cvtrs = GetFluidModel()->GetSpeciesCvTraRot();
         Cvve = nodes->GetCvve(iPoint);
 
         /*--- Take the primitive var. Jacobian & store in Jac. jj ---*/
@@ -952,7 +970,7 @@ void CNEMONSSolver::BC_Smoluchowski_Maxwell(CGeometry *geometry,
   unsigned short iDim, iVar, iSpecies;
   unsigned short T_INDEX, TVE_INDEX, VEL_INDEX;
   unsigned long iVertex, iPoint, jPoint;
-  su2double ktr, kve, Mass = 0.0;
+  su2double ktr, kve;
   su2double Ti, Tvei, Tj, Tvej;
   su2double Twall, Tslip, Tslip_ve, dij;
   su2double Pi;
@@ -969,6 +987,7 @@ void CNEMONSSolver::BC_Smoluchowski_Maxwell(CGeometry *geometry,
 
   su2double TauTangent[MAXNDIM] = {0.0};
   su2double Tau[MAXNDIM][MAXNDIM] = {{0.0}};
+  su2double Res_Visc[MAXNVAR] = {0.0}, Vector[MAXNDIM] = {0.0};
 
   bool ionization = config->GetIonization();
 
@@ -997,6 +1016,7 @@ void CNEMONSSolver::BC_Smoluchowski_Maxwell(CGeometry *geometry,
   TVE_INDEX     = nodes->GetTveIndex();
 
   /*--- Loop over boundary points to calculate energy flux ---*/
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for(iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
@@ -1039,10 +1059,11 @@ void CNEMONSSolver::BC_Smoluchowski_Maxwell(CGeometry *geometry,
       Viscosity = nodes->GetLaminarViscosity(iPoint);
       Eddy_Visc = nodes->GetEddyViscosity(iPoint);
       Density   = nodes->GetDensity(iPoint);
-      Gamma     = nodes->GetGamma(iPoint);
+      const su2double Gamma = nodes->GetGamma(iPoint);
 
       /*--- Incorporate turbulence effects ---*/
-      const auto& Ms = FluidModel->GetSpeciesMolarMass();
+      const auto& Ms = GetFluidModel()->GetSpeciesMolarMass();
+      su2double  Mass = 0.0;
       su2double  Ru = 1000.0*UNIVERSAL_GAS_CONSTANT;
       su2double  tmp1, scl, Cptr;
       su2double *Vi = nodes->GetPrimitive(iPoint);
@@ -1122,4 +1143,5 @@ void CNEMONSSolver::BC_Smoluchowski_Maxwell(CGeometry *geometry,
       LinSysRes.SubtractBlock(iPoint, Res_Visc);
     }
   }
+  END_SU2_OMP_FOR
 }
@@ -29,6 +29,7 @@
 #include "../../include/variables/CNSVariable.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CMonitorReduction.hpp"
 #include "../../include/solvers/CFVMFlowSolverBase.inl"
 
 /*--- Explicit instantiation of the parent class of CEulerSolver,
@@ -74,7 +75,8 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   const auto InnerIter = config->GetInnerIter();
   const bool muscl = config->GetMUSCL_Flow() && (iMesh == MESH_0);
   const bool center = (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED);
-  const bool limiter = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (InnerIter <= config->GetLimiterIter());
+  const bool limiter = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (InnerIter <= config->GetLimiterIter()) &&
+                       !config->GetFrozenCoeff();
   const bool van_albada = (config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE);
   const bool wall_functions = config->GetWall_Functions();
 
@@ -253,15 +255,13 @@ void CNSSolver::Buffet_Monitoring(const CGeometry *geometry, const CConfig *conf
 
   }
 
-  /*--- Add buffet metric information using all the nodes ---*/
+  /*--- Add buffet metric information and the buffet metric on the surfaces using all the nodes
+   * (batched with the forces when called from Friction_Forces). ---*/
 
-  su2double MyTotal_Buffet_Metric = Total_Buffet_Metric;
-  SU2_MPI::Allreduce(&MyTotal_Buffet_Metric, &Total_Buffet_Metric, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-
-  /*--- Add the buffet metric on the surfaces using all the nodes ---*/
-
-  auto local_copy = Surface_Buffet_Metric;
-  SU2_MPI::Allreduce(local_copy.data(), Surface_Buffet_Metric.data(), local_copy.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  auto& reduction = CMonitorReduction::GetInstance();
+  reduction.Sum(&Total_Buffet_Metric, 1);
+  reduction.Sum(Surface_Buffet_Metric.data(), Surface_Buffet_Metric.size());
+  reduction.Reduce();
 
 }
 
@@ -27,6 +27,7 @@
 
 
 #include "../../include/solvers/CSolver.hpp"
+#include "../../include/solvers/CCheckpointStore.hpp"
 #include "../../include/gradients/computeGradientsGreenGauss.hpp"
 #include "../../include/gradients/computeGradientsLeastSquares.hpp"
 #include "../../include/limiters/computeLimiters.hpp"
@@ -46,6 +47,8 @@
 #include "../../../Common/include/toolboxes/C1DInterpolation.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../../Common/include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../Common/include/toolboxes/CMonitorReduction.hpp"
+#include "../../../Common/include/toolboxes/compression_toolbox.hpp"
 #include "../../../Common/include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/CMarkerProfileReaderFVM.hpp"
 
@@ -1408,6 +1411,10 @@ void CSolver::InitiateComms(CGeometry *geometry,
 
   int iMessage, iSend, nSend;
 
+  /*--- The comm buffers of the geometry may still be in use by deferred comms. ---*/
+
+  CompleteDeferredComms(false);
+
   /*--- Set the size of the data packet and type depending on quantity. ---*/
 
   GetCommCountAndType(config, commType, COUNT_PER_POINT, MPI_TYPE);
@@ -1693,6 +1700,51 @@ void CSolver::CompleteComms(CGeometry *geometry,
 
 }
 
+void CSolver::CompleteOrDeferComms(CGeometry *geometry,
+                                   const CConfig *config,
+                                   unsigned short commType) {
+
+  /*--- Only the convective residual reads reconstruction gradients and limiters of halo points. ---*/
+
+  const bool deferrable = (commType == SOLUTION_GRAD_REC) || (commType == SOLUTION_LIMITER) ||
+                          (commType == PRIMITIVE_GRAD_REC) || (commType == PRIMITIVE_LIMITER);
+
+  if (!deferHaloComms || !deferrable) {
+    CompleteComms(geometry, config, commType);
+    return;
+  }
+
+  SU2_OMP_MASTER {
+    deferredComm.geometry = geometry;
+    deferredComm.config = config;
+    deferredComm.commType = commType;
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+void CSolver::CompleteDeferredComms(bool stopDeferring) {
+
+  /*--- All threads check the state before the master thread resets it. ---*/
+
+  if (deferredComm.geometry != nullptr) {
+    CompleteComms(deferredComm.geometry, deferredComm.config, deferredComm.commType);
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER
+    deferredComm.geometry = nullptr;
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
+  if (stopDeferring && deferHaloComms) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER
+    deferHaloComms = false;
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+}
+
 void CSolver::ResetCFLAdapt() {
   NonLinRes_Series.clear();
   Old_Func = 0;
@@ -1931,55 +1983,49 @@ void CSolver::SetResidual_RMS(const CGeometry *geometry, const CConfig *config)
 
   SU2_OMP_MASTER {
 
-  /*--- Set the L2 Norm residual in all the processors. ---*/
+  /*--- Set the L2 Norm and the Maximum residual in all the processors. Both are reduced
+   * with one collective, the max residual location is obtained with a MAXLOC reduction
+   * whose payload is the point index and its coordinates. ---*/
 
-  vector<su2double> rbuf_res(nVar);
-  unsigned long Global_nPointDomain = 0;
+  const bool commFull = (config->GetComm_Level() == COMM_FULL);
+  const unsigned long Global_nPointDomain = commFull? geometry->GetGlobal_nPointDomain() : geometry->GetnPointDomain();
+  const unsigned long nPayload = 1 + nDim;
 
-  if (config->GetComm_Level() == COMM_FULL) {
+  vector<passivedouble> rbuf_res(nVar), rbuf_max(nVar), rbuf_loc(nVar*nPayload);
 
-    SU2_MPI::Allreduce(Residual_RMS.data(), rbuf_res.data(), nVar, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-    Global_nPointDomain = geometry->GetGlobal_nPointDomain();
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    rbuf_res[iVar] = SU2_TYPE::GetValue(Residual_RMS[iVar]);
+    rbuf_max[iVar] = SU2_TYPE::GetValue(Residual_Max[iVar]);
+    rbuf_loc[iVar*nPayload] = Point_Max[iVar];
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      rbuf_loc[iVar*nPayload+1+iDim] = SU2_TYPE::GetValue(Point_Max_Coord(iVar,iDim));
   }
-  else {
-    /*--- Reduced MPI comms have been requested. Use a local residual only. ---*/
 
-    for (unsigned short iVar = 0; iVar < nVar; iVar++) rbuf_res[iVar] = Residual_RMS[iVar];
-    Global_nPointDomain = geometry->GetnPointDomain();
+  /*--- If reduced MPI comms have been requested, use local residuals only. ---*/
+
+  if (commFull) {
+    auto& reduction = CMonitorReduction::GetInstance();
+    reduction.Sum(rbuf_res.data(), nVar);
+    reduction.MaxLoc(rbuf_max.data(), rbuf_loc.data(), nVar, nPayload);
+    reduction.ReduceNow();
   }
 
   for (unsigned short iVar = 0; iVar < nVar; iVar++) {
 
-    if (std::isnan(SU2_TYPE::GetValue(rbuf_res[iVar]))) {
+    if (std::isnan(rbuf_res[iVar])) {
       SU2_MPI::Error("SU2 has diverged (NaN detected).", CURRENT_FUNCTION);
     }
 
-    Residual_RMS[iVar] = max(EPS*EPS, sqrt(rbuf_res[iVar]/Global_nPointDomain));
+    Residual_RMS[iVar] = max(EPS*EPS, su2double(sqrt(rbuf_res[iVar]/Global_nPointDomain)));
 
     if (log10(GetRes_RMS(iVar)) > 20.0) {
       SU2_MPI::Error("SU2 has diverged (Residual > 10^20 detected).", CURRENT_FUNCTION);
     }
-  }
-
-  /*--- Set the Maximum residual in all the processors. ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
 
-    const unsigned long nProcessor = size;
-
-    su2activematrix rbuf_residual(nProcessor,nVar);
-    su2matrix<unsigned long> rbuf_point(nProcessor,nVar);
-    su2activematrix rbuf_coord(nProcessor*nVar, nDim);
-
-    SU2_MPI::Allgather(Residual_Max.data(), nVar, MPI_DOUBLE, rbuf_residual.data(), nVar, MPI_DOUBLE, SU2_MPI::GetComm());
-    SU2_MPI::Allgather(Point_Max.data(), nVar, MPI_UNSIGNED_LONG, rbuf_point.data(), nVar, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
-    SU2_MPI::Allgather(Point_Max_Coord.data(), nVar*nDim, MPI_DOUBLE, rbuf_coord.data(), nVar*nDim, MPI_DOUBLE, SU2_MPI::GetComm());
-
-    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-      for (auto iProcessor = 0ul; iProcessor < nProcessor; iProcessor++) {
-        AddRes_Max(iVar, rbuf_residual(iProcessor,iVar), rbuf_point(iProcessor,iVar), rbuf_coord[iProcessor*nVar+iVar]);
-      }
-    }
+    Residual_Max[iVar] = rbuf_max[iVar];
+    Point_Max[iVar] = static_cast<unsigned long>(rbuf_loc[iVar*nPayload]);
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      Point_Max_Coord(iVar,iDim) = rbuf_loc[iVar*nPayload+1+iDim];
   }
 
   }
@@ -1993,36 +2039,34 @@ void CSolver::SetResidual_BGS(const CGeometry *geometry, const CConfig *config)
 
   SU2_OMP_MASTER {
 
-  /*--- Set the L2 Norm residual in all the processors. ---*/
+  /*--- Set the L2 Norm and the Maximum residual in all the processors (see SetResidual_RMS). ---*/
 
-  vector<su2double> rbuf_res(nVar);
-
-  SU2_MPI::Allreduce(Residual_BGS.data(), rbuf_res.data(), nVar, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  const bool commFull = (config->GetComm_Level() == COMM_FULL);
   const auto Global_nPointDomain = geometry->GetGlobal_nPointDomain();
+  const unsigned long nPayload = 1 + nDim;
+
+  vector<passivedouble> rbuf_res(nVar), rbuf_max(nVar), rbuf_loc(nVar*nPayload);
 
   for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-    Residual_BGS[iVar] = max(EPS*EPS, sqrt(rbuf_res[iVar]/Global_nPointDomain));
+    rbuf_res[iVar] = SU2_TYPE::GetValue(Residual_BGS[iVar]);
+    rbuf_max[iVar] = SU2_TYPE::GetValue(Residual_Max_BGS[iVar]);
+    rbuf_loc[iVar*nPayload] = Point_Max_BGS[iVar];
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      rbuf_loc[iVar*nPayload+1+iDim] = SU2_TYPE::GetValue(Point_Max_Coord_BGS(iVar,iDim));
   }
 
-  if (config->GetComm_Level() == COMM_FULL) {
-
-    /*--- Set the Maximum residual in all the processors. ---*/
-
-    const unsigned long nProcessor = size;
-
-    su2activematrix rbuf_residual(nProcessor,nVar);
-    su2matrix<unsigned long> rbuf_point(nProcessor,nVar);
-    su2activematrix rbuf_coord(nProcessor*nVar, nDim);
+  auto& reduction = CMonitorReduction::GetInstance();
+  reduction.Sum(rbuf_res.data(), nVar);
+  if (commFull) reduction.MaxLoc(rbuf_max.data(), rbuf_loc.data(), nVar, nPayload);
+  reduction.ReduceNow();
 
-    SU2_MPI::Allgather(Residual_Max_BGS.data(), nVar, MPI_DOUBLE, rbuf_residual.data(), nVar, MPI_DOUBLE, SU2_MPI::GetComm());
-    SU2_MPI::Allgather(Point_Max_BGS.data(), nVar, MPI_UNSIGNED_LONG, rbuf_point.data(), nVar, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
-    SU2_MPI::Allgather(Point_Max_Coord_BGS.data(), nVar*nDim, MPI_DOUBLE, rbuf_coord.data(), nVar*nDim, MPI_DOUBLE, SU2_MPI::GetComm());
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    Residual_BGS[iVar] = max(EPS*EPS, su2double(sqrt(rbuf_res[iVar]/Global_nPointDomain)));
 
-    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-      for (auto iProcessor = 0ul; iProcessor < nProcessor; iProcessor++) {
-        AddRes_Max_BGS(iVar, rbuf_residual(iProcessor,iVar), rbuf_point(iProcessor,iVar), rbuf_coord[iProcessor*nVar+iVar]);
-      }
-    }
+    Residual_Max_BGS[iVar] = rbuf_max[iVar];
+    Point_Max_BGS[iVar] = static_cast<unsigned long>(rbuf_loc[iVar*nPayload]);
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      Point_Max_Coord_BGS(iVar,iDim) = rbuf_loc[iVar*nPayload+1+iDim];
   }
 
   }
@@ -2748,6 +2792,11 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, const CConfig *config,
   strcpy(fname, val_filename.c_str());
   int magic_number;
 
+  /*--- The data may already be in memory (unsteady adjoint). ---*/
+
+  auto& checkpoints = CCheckpointStore::GetInstance();
+  if (checkpoints.Load(val_filename, Restart_Vars, fields, Restart_Data)) return;
+
 #ifndef HAVE_MPI
 
   /*--- Serial binary input. ---*/
@@ -2772,7 +2821,7 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, const CConfig *config,
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
 
-  if (magic_number == 535532) {
+  if (magic_number == 535532 || magic_number == CompressionToolbox::COMPRESSED_RESTART_MAGIC) {
     SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                    string("SU2 reads/writes binary restart files by default.\n") +
                    string("Note that backward compatibility for ASCII restart files is\n") +
@@ -2811,7 +2860,7 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, const CConfig *config,
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
 
-  if (magic_number == 535532) {
+  if (magic_number == 535532 || magic_number == CompressionToolbox::COMPRESSED_RESTART_MAGIC) {
     SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                    string("SU2 reads/writes binary restart files by default.\n") +
                    string("Note that backward compatibility for ASCII restart files is\n") +
@@ -2888,6 +2937,8 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, const CConfig *config,
     SU2_MPI::Error("The solution file does not match the mesh, currently only binary files can be interpolated.",
                    CURRENT_FUNCTION);
 
+  checkpoints.Save(val_filename, Restart_Vars, fields, Restart_Data, Restart_Vars[1]*geometry->GetnPointDomain());
+
 }
 
 void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config, string val_filename) {
@@ -2899,6 +2950,22 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
   Restart_Vars = new int[nRestart_Vars];
   fields.clear();
 
+  /*--- The data may already be in memory (unsteady adjoint). ---*/
+
+  auto& checkpoints = CCheckpointStore::GetInstance();
+  if (checkpoints.Load(val_filename, Restart_Vars, fields, Restart_Data)) return;
+
+  /*--- After reading, the data is stored for reuse, or interpolated if the mesh is different. ---*/
+
+  auto finalize = [&]() {
+    if (Restart_Vars[2] == long(geometry->GetGlobal_nPointDomain())) {
+      checkpoints.Save(val_filename, Restart_Vars, fields, Restart_Data, Restart_Vars[1]*geometry->GetnPointDomain());
+    }
+    else if (config->GetKind_SU2() != SU2_COMPONENT::SU2_SOL) {
+      InterpolateRestartData(geometry, config);
+    }
+  };
+
 #ifndef HAVE_MPI
 
   /*--- Serial binary input. ---*/
@@ -2921,9 +2988,12 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
   }
 
   /*--- Check that this is an SU2 binary file. SU2 binary files
-   have the hex representation of "SU2" as the first int in the file. ---*/
+   have the hex representation of "SU2" as the first int in the file
+   (plus one if the file is compressed). ---*/
+
+  const bool compressed = (Restart_Vars[0] == CompressionToolbox::COMPRESSED_RESTART_MAGIC);
 
-  if (Restart_Vars[0] != 535532) {
+  if (Restart_Vars[0] != 535532 && !compressed) {
     SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                    string("SU2 reads/writes binary restart files by default.\n") +
                    string("Note that backward compatibility for ASCII restart files is\n") +
@@ -2949,6 +3019,15 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
     fields.push_back(str_buf);
   }
 
+  /*--- Compressed files are read block by block. ---*/
+
+  if (compressed) {
+    fclose(fhw);
+    Read_SU2_Restart_Compressed(geometry, config, val_filename);
+    finalize();
+    return;
+  }
+
   /*--- For now, create a temp 1D buffer to read the data from file. ---*/
 
   Restart_Data = new passivedouble[nFields*nPointFile];
@@ -2991,9 +3070,12 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
   SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
 
   /*--- Check that this is an SU2 binary file. SU2 binary files
-   have the hex representation of "SU2" as the first int in the file. ---*/
+   have the hex representation of "SU2" as the first int in the file
+   (plus one if the file is compressed). ---*/
 
-  if (Restart_Vars[0] != 535532) {
+  const bool compressed = (Restart_Vars[0] == CompressionToolbox::COMPRESSED_RESTART_MAGIC);
+
+  if (Restart_Vars[0] != 535532 && !compressed) {
     SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                    string("SU2 reads/writes binary restart files by default.\n") +
                    string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3040,6 +3122,15 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
 
   delete [] mpi_str_buf;
 
+  /*--- Compressed files are read block by block. ---*/
+
+  if (compressed) {
+    MPI_File_close(&fhw);
+    Read_SU2_Restart_Compressed(geometry, config, val_filename);
+    finalize();
+    return;
+  }
+
   /*--- We're writing only su2doubles in the data portion of the file. ---*/
 
   etype = MPI_DOUBLE;
@@ -3116,10 +3207,40 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
 
 #endif
 
-  if (nPointFile != geometry->GetGlobal_nPointDomain() &&
-      config->GetKind_SU2() != SU2_COMPONENT::SU2_SOL) {
-    InterpolateRestartData(geometry, config);
+  finalize();
+}
+
+void CSolver::Read_SU2_Restart_Compressed(const CGeometry *geometry, const CConfig *config, const string& filename) {
+
+  const unsigned long nFields = Restart_Vars[1];
+  const unsigned long nPointFile = Restart_Vars[2];
+
+  /*--- Global indices of the points read by this rank (sorted), all points in serial, the local
+   points if no interpolation is needed, otherwise a linear partition of the points of the file. ---*/
+
+  vector<unsigned long> points;
+
+#ifdef HAVE_MPI
+  if (nPointFile == geometry->GetGlobal_nPointDomain() ||
+      config->GetKind_SU2() == SU2_COMPONENT::SU2_SOL) {
+    points.reserve(geometry->GetnPointDomain());
+    for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); ++iPoint_Global) {
+      if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) points.push_back(iPoint_Global);
+    }
   }
+  else {
+    const auto partitioner = CLinearPartitioner(nPointFile,0);
+    points.resize(partitioner.GetSizeOnRank(rank));
+    iota(points.begin(), points.end(), partitioner.GetFirstIndexOnRank(rank));
+  }
+#else
+  points.resize(nPointFile);
+  iota(points.begin(), points.end(), 0ul);
+#endif
+
+  Restart_Data = new passivedouble[nFields*points.size()];
+
+  CompressionToolbox::ReadRestartBlocks(filename, Restart_Vars, points.data(), points.size(), Restart_Data);
 }
 
 void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *config) {
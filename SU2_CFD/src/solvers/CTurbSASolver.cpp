@@ -60,9 +60,11 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
 
   nDim = geometry->GetnDim();
 
-  /*--- Single grid simulation ---*/
+  /*--- Single grid simulation, or multigrid also for the turbulence equations. ---*/
 
-  if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE) {
+  MGLevel = iMesh;
+
+  if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE || config->GetMG_Turb()) {
 
     /*--- Define some auxiliar vector related with the residual ---*/
 
@@ -192,7 +194,7 @@ void CTurbSASolver::Preprocessing(CGeometry *geometry, CSolver **solver_containe
         unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  const bool muscl = config->GetMUSCL_Turb();
+  const bool muscl = config->GetMUSCL_Turb() && (iMesh == MESH_0);
   const bool limiter = (config->GetKind_SlopeLimit_Turb() != NO_LIMITER) &&
                        (config->GetInnerIter() <= config->GetLimiterIter());
   const auto kind_hybridRANSLES = config->GetKind_HybridRANSLES();
@@ -298,6 +300,11 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
   const bool transition    = (config->GetKind_Trans_Model() == LM);
   const bool transition_BC = (config->GetKind_Trans_Model() == BC);
 
+  /*--- The vectorized sources only implement the standard model. ---*/
+  const bool vectorSources = config->GetUseVectorization() && (config->GetKind_Turb_Model() == SA) &&
+                             !transition && !transition_BC &&
+                             (config->GetKind_HybridRANSLES() == NO_HYBRIDRANSLES);
+
   CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
   /*--- Pick one numerics object per thread. ---*/
@@ -305,6 +312,11 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
 
   AD::StartNoSharedReading();
 
+  if (vectorSources) {
+    PointSourceResidual(geometry, solver_container, config);
+  }
+  else {
+
   /*--- Loop over all points. ---*/
 
   SU2_OMP_FOR_DYN(omp_chunk_size)
@@ -387,6 +399,8 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
   }
   END_SU2_OMP_FOR
 
+  } // end scalar sources
+
   if (harmonic_balance) {
 
     SU2_OMP_FOR_STAT(omp_chunk_size)
@@ -62,9 +62,11 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
 
   nDim = geometry->GetnDim();
 
-  /*--- Single grid simulation ---*/
+  /*--- Single grid simulation, or multigrid also for the turbulence equations. ---*/
 
-  if (iMesh == MESH_0) {
+  MGLevel = iMesh;
+
+  if (iMesh == MESH_0 || config->GetMG_Turb()) {
 
     /*--- Define some auxiliary vector related with the residual ---*/
 
@@ -197,7 +199,7 @@ void CTurbSSTSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contain
          unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  const bool muscl = config->GetMUSCL_Turb();
+  const bool muscl = config->GetMUSCL_Turb() && (iMesh == MESH_0);
   const bool limiter = (config->GetKind_SlopeLimit_Turb() != NO_LIMITER) &&
                        (config->GetInnerIter() <= config->GetLimiterIter());
 
@@ -287,15 +289,23 @@ void CTurbSSTSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
 
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
+  /*--- The vectorized sources do not implement the axisymmetric and UQ modifications. ---*/
+  const bool vectorSources = config->GetUseVectorization() && !axisymmetric && !config->GetUsing_UQ();
+
   CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
   /*--- Pick one numerics object per thread. ---*/
   CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  /*--- Loop over all points. ---*/
-
   AD::StartNoSharedReading();
 
+  if (vectorSources) {
+    PointSourceResidual(geometry, solver_container, config);
+  }
+  else {
+
+  /*--- Loop over all points. ---*/
+
   SU2_OMP_FOR_DYN(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
@@ -355,6 +365,8 @@ void CTurbSSTSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
   }
   END_SU2_OMP_FOR
 
+  } // end scalar sources
+
   AD::EndNoSharedReading();
 
 }
@@ -28,6 +28,7 @@
 #include "../../include/solvers/CTurbSolver.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 
 CTurbSolver::CTurbSolver(void) : CSolver() { }
@@ -57,20 +58,29 @@ CTurbSolver::CTurbSolver(CGeometry* geometry, CConfig *config) : CSolver() {
   if (ReducerStrategy && (coloring.getOuterSize()>1))
     geometry->SetNaturalEdgeColoring();
 
-  if (!coloring.empty()) {
-    auto groupSize = ReducerStrategy? 1ul : geometry->GetEdgeColorGroupSize();
-    auto nColor = coloring.getOuterSize();
+  nPoint = geometry->GetnPoint();
+  omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
+#endif
+
+  /*--- Interior and partition boundary edges are in different colors if the halo comms
+   *    are overlapped with the interior edges, see CFVMFlowSolverBase. ---*/
+  overlapHaloComms = config->GetOverlapHaloComms() && !config->GetContinuous_Adjoint();
+
+  const auto groupSize = ReducerStrategy? 1ul : geometry->GetEdgeColorGroupSize();
+  const auto& colors = overlapHaloComms?
+    geometry->GetEdgeColoringSplit(omp_get_max_threads() > 1 ? groupSize : 1ul, nEdgeColorInterior) :
+    geometry->GetEdgeColoring();
+
+  if (!colors.empty()) {
+    auto nColor = colors.getOuterSize();
     EdgeColoring.reserve(nColor);
 
     for(auto iColor = 0ul; iColor < nColor; ++iColor)
-      EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+      EdgeColoring.emplace_back(colors.innerIdx(iColor), colors.getNumNonZeros(iColor), groupSize);
   }
 
-  nPoint = geometry->GetnPoint();
-  omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
-#else
-  EdgeColoring[0] = DummyGridColor<>(geometry->GetnEdge());
-#endif
+  /*--- Without partition boundary edges there is nothing to overlap. ---*/
+  if (nEdgeColorInterior == EdgeColoring.size()) nEdgeColorInterior = 0;
 }
 
 CTurbSolver::~CTurbSolver(void) {
@@ -80,14 +90,21 @@ CTurbSolver::~CTurbSolver(void) {
   }
 
   delete nodes;
+  delete edgeNumerics;
 
 }
 
 void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                   CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
+  /*--- The vectorized numerics compute convection and diffusion together. ---*/
+  if (config->GetUseVectorization()) {
+    EdgeFluxResidual(geometry, solver_container, config);
+    return;
+  }
+
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  const bool muscl = config->GetMUSCL_Turb();
+  const bool muscl = config->GetMUSCL_Turb() && (iMesh == MESH_0);
   const bool limiter = (config->GetKind_SlopeLimit_Turb() != NO_LIMITER);
 
   /*--- Only reconstruct flow variables if MUSCL is on for flow (requires upwind) and turbulence. ---*/
@@ -113,8 +130,12 @@ void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
   else AD::StartNoSharedReading();
 
   /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring)
+  for (auto iColor = 0ul; iColor < EdgeColoring.size(); ++iColor)
   {
+  /*--- Partition boundary edges need the halo data of gradients and limiters. ---*/
+  if (iColor == nEdgeColorInterior) CompleteDeferredComms();
+  const auto& color = EdgeColoring[iColor];
+
   /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
   SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
   for(auto k = 0ul; k < color.size; ++k) {
@@ -238,6 +259,9 @@ void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
   END_SU2_OMP_FOR
   } // end color loop
 
+  /*--- In case there are no partition boundary colors (or no colors at all). ---*/
+  CompleteDeferredComms();
+
   /*--- Restore preaccumulation and adjoint evaluation state. ---*/
   AD::ResumePreaccumulation(pausePreacc);
   if (!ReducerStrategy) AD::EndNoSharedReading();
@@ -248,6 +272,95 @@ void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
   }
 }
 
+void CTurbSolver::InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) {
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+
+  edgeNumerics = CNumericsSIMD::CreateTurbNumerics(*config, nDim, MGLevel, solvers[FLOW_SOL]->GetNodes(),
+                                                   GetConstants(), Solution_Inf);
+  if (!edgeNumerics)
+    SU2_MPI::Error("The turbulence model in use does not support vectorization.", CURRENT_FUNCTION);
+
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+void CTurbSolver::EdgeFluxResidual(CGeometry *geometry, const CSolver* const* solvers, const CConfig *config) {
+
+  if (!edgeNumerics) {
+    InstantiateEdgeNumerics(solvers, config);
+  }
+
+  /*--- For hybrid parallel AD, pause preaccumulation if there is shared reading of
+  * variables, otherwise switch to the faster adjoint evaluation mode. ---*/
+  bool pausePreacc = false;
+  if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
+  else AD::StartNoSharedReading();
+
+  /*--- Loop over edge colors. ---*/
+  for (auto iColor = 0ul; iColor < EdgeColoring.size(); ++iColor) {
+    /*--- Partition boundary edges need the halo data of gradients and limiters. ---*/
+    if (iColor == nEdgeColorInterior) CompleteDeferredComms();
+    const auto& color = EdgeColoring[iColor];
+
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for(auto k = 0ul; k < color.size; k += Double::Size) {
+      Int iEdge;
+      Double mask;
+      for (auto j = 0ul; j < Double::Size; ++j) {
+        bool in = (k+j < color.size);
+        mask[j] = in;
+        iEdge[j] = color.indices[k+j*in];
+      }
+
+      if (ReducerStrategy) {
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
+      } else {
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- In case there are no partition boundary colors (or no colors at all). ---*/
+  CompleteDeferredComms();
+
+  /*--- Restore preaccumulation and adjoint evaluation state. ---*/
+  AD::ResumePreaccumulation(pausePreacc);
+  if (!ReducerStrategy) AD::EndNoSharedReading();
+
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    if (config->GetKind_TimeIntScheme() == EULER_IMPLICIT) {
+      Jacobian.SetDiagonalAsColumnSum();
+    }
+  }
+}
+
+void CTurbSolver::PointSourceResidual(const CGeometry *geometry, const CSolver* const* solvers, const CConfig *config) {
+
+  if (!edgeNumerics) {
+    InstantiateEdgeNumerics(solvers, config);
+  }
+
+  /*--- Each point is only updated once, there is no shared writing. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(omp_chunk_size, Double::Size))
+  for (auto k = 0ul; k < nPointDomain; k += Double::Size) {
+    Int iPoint;
+    Double mask;
+    for (auto j = 0ul; j < Double::Size; ++j) {
+      bool in = (k+j < nPointDomain);
+      mask[j] = in;
+      iPoint[j] = k + j*in;
+    }
+    edgeNumerics->ComputeSource(iPoint, *config, *geometry, *nodes, mask, LinSysRes, Jacobian);
+  }
+  END_SU2_OMP_FOR
+}
+
 void CTurbSolver::Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
                                    CNumerics *numerics, CConfig *config) {
 
@@ -562,6 +675,10 @@ void CTurbSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver** solver
 
   const auto flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
+  /*--- On coarse multigrid levels the residual includes the forcing term (truncation error). ---*/
+
+  const bool coarseLevel = (MGLevel != MESH_0);
+
   /*--- Set shared residual variables to 0 and declare
    *    local ones for current thread to work on. ---*/
 
@@ -589,8 +706,11 @@ void CTurbSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver** solver
     else {
       Jacobian.SetVal2Diag(iPoint, 1.0);
       LinSysRes.SetBlock_Zero(iPoint);
+      if (coarseLevel) nodes->SetRes_TruncErrorZero(iPoint);
     }
 
+    if (coarseLevel) LinSysRes.AddBlock(iPoint, nodes->GetResTruncError(iPoint));
+
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
 
     for (unsigned short iVar = 0; iVar < nVar; iVar++) {
@@ -653,7 +773,8 @@ void CTurbSolver::CompleteImplicitIteration(CGeometry *geometry, CSolver **solve
           su2double density = flowNodes->GetDensity(iPoint);
           su2double density_old = density;
 
-          if (compressible)
+          /*--- On coarse multigrid levels the old flow solution stores the correction. ---*/
+          if (compressible && (MGLevel == MESH_0))
             density_old = flowNodes->GetSolution_Old(iPoint,0);
 
           for (unsigned short iVar = 0; iVar < nVar; iVar++) {
@@ -396,7 +396,8 @@ int main(int argc, char *argv[]) {
 
     output[iZone]->Load_Data(geometry_container[iZone], config_container[iZone], nullptr);
 
-    output[iZone]->WriteToFile(config_container[iZone], geometry_container[iZone], MESH, config->GetMesh_Out_FileName());
+    const auto meshFormat = (config->GetMesh_Out_FileFormat() == SU2_BINARY)? MESH_BINARY : MESH;
+    output[iZone]->WriteToFile(config_container[iZone], geometry_container[iZone], meshFormat, config->GetMesh_Out_FileName());
 
     /*--- Set the file names for the visualization files ---*/
 
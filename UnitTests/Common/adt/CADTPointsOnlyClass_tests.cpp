@@ -0,0 +1,106 @@
+/*!
+ * \file CADTPointsOnlyClass_tests.cpp
+ * \brief Unit tests for the nearest neighbor searches of the points ADT.
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <algorithm>
+#include <vector>
+#include "../../../Common/include/adt/CADTPointsOnlyClass.hpp"
+
+TEST_CASE("ADT k nearest nodes", "[ADT]") {
+
+  /*--- Points on a coarse lattice (many ties) with scrambled IDs. ---*/
+  const unsigned short nDim = 3;
+  const unsigned long n = 5;
+  std::vector<su2double> coord;
+  std::vector<unsigned long> ids;
+  for (unsigned long i = 0; i < n*n*n; ++i) {
+    coord.push_back(i%n);
+    coord.push_back((i/n)%n);
+    coord.push_back(i/(n*n));
+    ids.push_back((i*37)%(n*n*n));
+  }
+  CADTPointsOnlyClass adt(nDim, ids.size(), coord.data(), ids.data(), false);
+
+  const su2double targets[][3] = {{0.0, 0.0, 0.0}, {1.5, 2.5, 2.0}, {-1.0, 7.0, 2.2}, {2.0, 2.0, 2.0}};
+
+  std::vector<su2double> dist2;
+  std::vector<unsigned long> pointID;
+  std::vector<int> rankID;
+
+  for (const auto& x : targets) {
+    /*--- Brute force reference, sorted by distance and ID. ---*/
+    std::vector<std::pair<su2double, unsigned long> > ref;
+    for (unsigned long i = 0; i < ids.size(); ++i) {
+      su2double d2 = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) d2 += pow(x[iDim]-coord[i*nDim+iDim], 2);
+      ref.emplace_back(d2, ids[i]);
+    }
+    std::sort(ref.begin(), ref.end());
+
+    for (unsigned long k : {1ul, 4ul, 9ul}) {
+      adt.DetermineNearestNodes(x, k, dist2, pointID, rankID);
+      REQUIRE(pointID.size() == k);
+      for (unsigned long i = 0; i < k; ++i) {
+        CHECK(pointID[i] == ref[i].second);
+        CHECK(dist2[i] == Approx(ref[i].first));
+      }
+    }
+  }
+}
+
+TEST_CASE("ADT nodes in radius", "[ADT]") {
+
+  const unsigned short nDim = 2;
+  const unsigned long n = 6;
+  std::vector<su2double> coord;
+  std::vector<unsigned long> ids;
+  for (unsigned long i = 0; i < n*n; ++i) {
+    coord.push_back(0.5*(i%n));
+    coord.push_back(0.5*(i/n));
+    ids.push_back((i*7)%(n*n));
+  }
+  CADTPointsOnlyClass adt(nDim, ids.size(), coord.data(), ids.data(), false);
+
+  const su2double targets[][2] = {{0.0, 0.0}, {1.2, 1.3}, {-2.0, 1.0}};
+
+  std::vector<unsigned long> pointID;
+
+  for (const auto& x : targets) {
+    for (su2double radius : {0.1, 0.5, 1.1, 10.0}) {
+      std::vector<unsigned long> ref;
+      for (unsigned long i = 0; i < ids.size(); ++i) {
+        su2double d2 = 0.0;
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim) d2 += pow(x[iDim]-coord[i*nDim+iDim], 2);
+        if (d2 <= radius*radius) ref.push_back(ids[i]);
+      }
+      std::sort(ref.begin(), ref.end());
+
+      adt.DetermineNodesInRadius(x, radius, pointID);
+      CHECK(pointID == ref);
+    }
+  }
+}
@@ -0,0 +1,261 @@
+/*!
+ * \file CMultiGridGeometry_tests.cpp
+ * \brief Unit tests for the agglomeration of coarse multigrid levels across partitions.
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/geometry/CMultiGridGeometry.hpp"
+
+namespace {
+
+constexpr unsigned short nLevels = 2, nDim = 2;
+
+/*--- Rectangular mesh with all the multigrid levels, built on the current communicator. ---*/
+struct CMultiGridTestCase {
+  std::unique_ptr<CConfig> config;
+  CGeometry* geometry[nLevels+1] = {nullptr};
+
+  explicit CMultiGridTestCase(bool partitionAgglomeration) {
+
+    auto orig_buf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+
+    stringstream ss;
+    ss << "SOLVER= EULER\n"
+          "MESH_FORMAT= RECTANGLE\n"
+          "MESH_BOX_SIZE= 33, 33, 0\n"
+          "MESH_BOX_LENGTH= 1, 1, 1\n"
+          "MESH_BOX_OFFSET= 0, 0, 0\n"
+          "MARKER_EULER= (y_minus, y_plus)\n"
+          "MARKER_FAR= (x_minus, x_plus)\n"
+          "MGLEVEL= " << nLevels << "\n"
+          "MG_PARTITION_AGGLOMERATION= " << (partitionAgglomeration? "YES" : "NO") << "\n";
+    config = std::unique_ptr<CConfig>(new CConfig(ss, SU2_COMPONENT::SU2_CFD, false));
+
+    {
+      CPhysicalGeometry aux_geometry(config.get(), 0, 1);
+      aux_geometry.SetColorGrid_Parallel(config.get());
+      geometry[MESH_0] = new CPhysicalGeometry(&aux_geometry, config.get());
+    }
+    auto fine = geometry[MESH_0];
+    fine->SetSendReceive(config.get());
+    fine->SetBoundaries(config.get());
+    fine->SetPoint_Connectivity();
+    fine->SetElement_Connectivity();
+    fine->SetBoundVolume();
+    fine->SetEdges();
+    fine->SetVertex(config.get());
+    fine->SetControlVolume(config.get(), ALLOCATE);
+    fine->SetBoundControlVolume(config.get(), ALLOCATE);
+    fine->FindNormal_Neighbor(config.get());
+    fine->SetGlobal_to_Local_Point();
+    fine->SetMGLevel(MESH_0);
+
+    /*--- Same sequence as the driver. ---*/
+
+    for (auto iMesh = 1u; iMesh <= nLevels; iMesh++) {
+      auto coarse = new CMultiGridGeometry(geometry, config.get(), iMesh);
+      geometry[iMesh] = coarse;
+      coarse->SetPoint_Connectivity(geometry[iMesh-1]);
+      coarse->SetEdges();
+      coarse->SetVertex(geometry[iMesh-1], config.get());
+      coarse->SetControlVolume(config.get(), geometry[iMesh-1], ALLOCATE);
+      coarse->SetBoundControlVolume(config.get(), geometry[iMesh-1], ALLOCATE);
+      coarse->SetCoord(geometry[iMesh-1]);
+      coarse->FindNormal_Neighbor(config.get());
+      coarse->SetMGLevel(iMesh);
+    }
+    for (auto iMesh = 0u; iMesh <= nLevels; iMesh++)
+      geometry[iMesh]->PreprocessP2PComms(geometry[iMesh], config.get());
+
+    cout.rdbuf(orig_buf);
+  }
+
+  ~CMultiGridTestCase() {
+    for (auto iMesh = 0u; iMesh <= nLevels; iMesh++) delete geometry[iMesh];
+  }
+
+  /*--- Global number of (domain) points of a level. ---*/
+  unsigned long GetnPointGlobal(unsigned short iMesh) const {
+    unsigned long nLocal = geometry[iMesh]->GetnPointDomain(), nGlobal = 0;
+    SU2_MPI::Allreduce(&nLocal, &nGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+    return nGlobal;
+  }
+
+  /*--- Global sum of the domain values of a level. ---*/
+  static su2double SumGlobal(const CGeometry* geo, const vector<su2double>& values) {
+    su2double local = 0.0, global = 0.0;
+    for (auto iPoint = 0ul; iPoint < geo->GetnPointDomain(); iPoint++) local += values[iPoint];
+    SU2_MPI::Allreduce(&local, &global, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+    return global;
+  }
+
+  /*!
+   * \brief Largest sum of the edge and boundary normals of a domain control volume, which is zero if
+   *        the control volume is closed, i.e. if this rank has all its edges (boundary normals point inwards).
+   */
+  su2double MaxClosureError(unsigned short iMesh) const {
+    const auto geo = geometry[iMesh];
+    vector<su2double> closure(geo->GetnPoint()*nDim, 0.0);
+
+    for (auto iEdge = 0ul; iEdge < geo->GetnEdge(); iEdge++) {
+      const auto iPoint = geo->edges->GetNode(iEdge, 0);
+      const auto jPoint = geo->edges->GetNode(iEdge, 1);
+      const auto normal = geo->edges->GetNormal(iEdge);
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        closure[iPoint*nDim+iDim] += normal[iDim];
+        closure[jPoint*nDim+iDim] -= normal[iDim];
+      }
+    }
+    for (auto iMarker = 0u; iMarker < geo->GetnMarker(); iMarker++) {
+      if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) continue;
+      for (auto iVertex = 0ul; iVertex < geo->GetnVertex(iMarker); iVertex++) {
+        const auto iPoint = geo->vertex[iMarker][iVertex]->GetNode();
+        const auto normal = geo->vertex[iMarker][iVertex]->GetNormal();
+        for (auto iDim = 0u; iDim < nDim; iDim++) closure[iPoint*nDim+iDim] -= normal[iDim];
+      }
+    }
+
+    su2double local = 0.0, global = 0.0;
+    for (auto iPoint = 0ul; iPoint < geo->GetnPointDomain(); iPoint++)
+      for (auto iDim = 0u; iDim < nDim; iDim++) local = max(local, fabs(closure[iPoint*nDim+iDim]));
+    SU2_MPI::Allreduce(&local, &global, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+    return global;
+  }
+
+  /*!
+   * \brief Prolong the coarse x coordinate to the fine level, in the way of CMultiGridIntegration
+   *        (all coarse points, fine domain points), and integrate the result over the fine level.
+   * \note The coarse coordinates are volume averages, the exact integral of x is recovered if every
+   *       fine point gets the value of its parent, which may be a coarse halo.
+   */
+  su2double ProlongedIntegral(unsigned short iMesh, unsigned long& nMissing) {
+    auto fine = geometry[iMesh-1];
+    auto coarse = geometry[iMesh];
+
+    coarse->InitiateComms(coarse, config.get(), COORDINATES);
+    coarse->CompleteComms(coarse, config.get(), COORDINATES);
+
+    vector<su2double> prolonged(fine->GetnPoint(), 0.0);
+    vector<bool> visited(fine->GetnPoint(), false);
+
+    for (auto Point_Coarse = 0ul; Point_Coarse < coarse->GetnPoint(); Point_Coarse++) {
+      for (auto iChildren = 0u; iChildren < coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
+        const auto Point_Fine = coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
+        if (!fine->nodes->GetDomain(Point_Fine)) continue;
+        prolonged[Point_Fine] = coarse->nodes->GetCoord(Point_Coarse, 0) * fine->nodes->GetVolume(Point_Fine);
+        nMissing += visited[Point_Fine];
+        visited[Point_Fine] = true;
+      }
+    }
+    for (auto iPoint = 0ul; iPoint < fine->GetnPointDomain(); iPoint++) nMissing += !visited[iPoint];
+
+    return SumGlobal(fine, prolonged);
+  }
+};
+
+/*--- Number of points and volume of each level, agglomerated on a single rank. ---*/
+void SerialReference(vector<unsigned long>& nPoint, vector<su2double>& volume) {
+#ifdef HAVE_MPI
+  const auto comm = SU2_MPI::GetComm();
+  SU2_MPI::SetComm(MPI_COMM_SELF);
+#endif
+  {
+    CMultiGridTestCase serial(true);
+    for (auto iMesh = 0u; iMesh <= nLevels; iMesh++) {
+      auto geo = serial.geometry[iMesh];
+      nPoint[iMesh] = geo->GetnPointDomain();
+      vector<su2double> vol(geo->GetnPoint());
+      for (auto iPoint = 0ul; iPoint < geo->GetnPoint(); iPoint++) vol[iPoint] = geo->nodes->GetVolume(iPoint);
+      volume[iMesh] = CMultiGridTestCase::SumGlobal(geo, vol);
+    }
+  }
+#ifdef HAVE_MPI
+  SU2_MPI::SetComm(comm);
+#endif
+}
+
+}
+
+TEST_CASE("Multigrid agglomeration across partitions", "[Geometry]") {
+
+  /*--- The test can run on any number of ranks, with more than one the coarse levels
+   * contain control volumes with points of two partitions. ---*/
+
+  const int size = SU2_MPI::GetSize();
+
+  vector<unsigned long> nPointSerial(nLevels+1), nPointNoCross(nLevels+1);
+  vector<su2double> volumeSerial(nLevels+1);
+  SerialReference(nPointSerial, volumeSerial);
+
+  {
+    CMultiGridTestCase noCross(false);
+    for (auto iMesh = 0u; iMesh <= nLevels; iMesh++) nPointNoCross[iMesh] = noCross.GetnPointGlobal(iMesh);
+  }
+
+  CMultiGridTestCase testCase(true);
+
+  for (auto iMesh = 0u; iMesh <= nLevels; iMesh++) {
+    auto geo = testCase.geometry[iMesh];
+    const auto nPoint = testCase.GetnPointGlobal(iMesh);
+
+    /*--- The finest level is not agglomerated, and in serial nothing changes. The coarse levels are
+     * coarser than without crossing the partitions, and close to the serial agglomeration. ---*/
+
+    if (iMesh == MESH_0 || size == 1) {
+      CHECK(nPoint == nPointSerial[iMesh]);
+    }
+    else {
+      CHECK(nPoint < nPointNoCross[iMesh]);
+      CHECK(nPoint <= 1.1 * nPointSerial[iMesh]);
+    }
+
+    /*--- The control volumes with points of two partitions have all their edges. ---*/
+
+    CHECK(testCase.MaxClosureError(iMesh) < 1e-12);
+
+    /*--- The volume is preserved, i.e. each fine point belongs to one coarse control volume. ---*/
+
+    vector<su2double> volume(geo->GetnPoint());
+    for (auto iPoint = 0ul; iPoint < geo->GetnPoint(); iPoint++) volume[iPoint] = geo->nodes->GetVolume(iPoint);
+    CHECK(CMultiGridTestCase::SumGlobal(geo, volume) == Approx(volumeSerial[iMesh]).epsilon(1e-12));
+
+    if (iMesh == MESH_0) continue;
+
+    /*--- Every fine domain point is prolonged once, from a coarse domain or halo point. ---*/
+
+    unsigned long nMissing = 0;
+    const su2double integral = testCase.ProlongedIntegral(iMesh, nMissing);
+    CHECK(nMissing == 0);
+
+    auto fine = testCase.geometry[iMesh-1];
+    vector<su2double> exact(fine->GetnPoint());
+    for (auto iPoint = 0ul; iPoint < fine->GetnPoint(); iPoint++)
+      exact[iPoint] = fine->nodes->GetCoord(iPoint, 0) * fine->nodes->GetVolume(iPoint);
+    CHECK(integral == Approx(CMultiGridTestCase::SumGlobal(fine, exact)).epsilon(1e-12));
+  }
+}
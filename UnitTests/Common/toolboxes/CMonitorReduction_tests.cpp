@@ -0,0 +1,79 @@
+/*!
+ * \file CMonitorReduction_tests.cpp
+ * \brief Unit tests for the aggregation of monitoring reductions.
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../Common/include/toolboxes/CMonitorReduction.hpp"
+
+TEST_CASE("Combination of monitoring records", "[Toolboxes]") {
+
+  /*--- Size, then records [op, n, payload size, values]: a sum, a max, and a maxloc with a tie. ---*/
+
+  const passivedouble a[] = {17, 0, 2, 0, 1.0, 2.0, 2, 1, 0, 5.0, 3, 2, 1, 4.0, 7, 9.0, 3};
+  passivedouble b[] = {17, 0, 2, 0, 0.5, 0.5, 2, 1, 0, 6.0, 3, 2, 1, 4.0, 9, 1.0, 2};
+
+  CMonitorReduction::CombineRecords(a, b);
+
+  CHECK(b[4] == 1.5);
+  CHECK(b[5] == 2.5);
+  CHECK(b[9] == 6.0);
+
+  /*--- Equal values, the smaller first payload entry wins. ---*/
+  CHECK(b[13] == 4.0);
+  CHECK(b[14] == 7);
+
+  /*--- Larger value, the payload comes with it. ---*/
+  CHECK(b[15] == 9.0);
+  CHECK(b[16] == 3);
+}
+
+TEST_CASE("Batched monitoring reductions", "[Toolboxes]") {
+
+  /*--- The tests run on one rank, values are unchanged but the finalization is deferred. ---*/
+
+  auto& reduction = CMonitorReduction::GetInstance();
+
+  passivedouble sum[] = {1.0, 2.0}, value = 3.0, payload[] = {10, 0.5};
+  bool finalized = false;
+
+  reduction.Begin();
+  reduction.Sum(sum, 2);
+  reduction.Reduce([&]() { finalized = true; });
+  reduction.MaxLoc(&value, payload, 1, 2);
+  reduction.Reduce();
+  CHECK_FALSE(finalized);
+
+  reduction.End(false);
+  reduction.Complete();
+
+  CHECK(finalized);
+  CHECK(sum[0] == 1.0);
+  CHECK(sum[1] == 2.0);
+  CHECK(value == 3.0);
+  CHECK(payload[0] == 10);
+
+  reduction.Clear();
+}
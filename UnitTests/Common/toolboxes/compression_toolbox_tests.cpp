@@ -0,0 +1,195 @@
+/*!
+ * \file compression_toolbox_tests.cpp
+ * \brief Unit tests for the compression toolbox.
+ * \author P. Gomes
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include "../../Common/include/toolboxes/compression_toolbox.hpp"
+#include "../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../Common/include/option_structure.hpp"
+
+TEST_CASE("Lossless compression round trip", "[Toolboxes]") {
+
+  /*--- Point-major data with 3 smooth fields, one constant field and a few special values. ---*/
+
+  const size_t nPoint = 1000, nField = 4;
+  std::vector<passivedouble> data(nPoint*nField);
+
+  for (size_t i = 0; i < nPoint; ++i) {
+    data[i*nField+0] = 101325.0 + 10*std::sin(0.01*i);
+    data[i*nField+1] = 1.0 / (1.0 + i);
+    data[i*nField+2] = -0.5 * i;
+    data[i*nField+3] = 288.15;
+  }
+  data[7] = 0.0;
+  data[11] = -0.0;
+  data[13] = std::numeric_limits<passivedouble>::max();
+  data[17] = std::numeric_limits<passivedouble>::denorm_min();
+
+  std::vector<uint8_t> buffer;
+  CompressionToolbox::CompressLossless(data.data(), data.size(), nField, buffer);
+
+  CHECK(buffer.size() < data.size()*sizeof(passivedouble));
+
+  std::vector<passivedouble> result(data.size());
+  REQUIRE(CompressionToolbox::DecompressLossless(buffer.data(), buffer.size(), data.size(), nField, result.data()));
+
+  for (size_t k = 0; k < data.size(); ++k) {
+    CHECK(result[k] == data[k]);
+    CHECK(std::signbit(result[k]) == std::signbit(data[k]));
+  }
+
+  /*--- Truncated buffers are detected. ---*/
+
+  CHECK_FALSE(CompressionToolbox::DecompressLossless(buffer.data(), buffer.size()/2, data.size(), nField, result.data()));
+}
+
+TEST_CASE("Lossy compression error bound", "[Toolboxes]") {
+
+  const size_t n = 1000;
+  const passivedouble tol = 1e-4;
+  std::vector<passivedouble> data(n);
+
+  for (size_t i = 0; i < n; ++i) data[i] = std::exp(std::sin(0.01*i)) * (i%2? 1 : -1e-3);
+  data[3] = 0.0;
+  data[5] = std::numeric_limits<passivedouble>::infinity();
+
+  std::vector<uint8_t> lossless, lossy;
+  CompressionToolbox::CompressLossless(data.data(), n, 2, lossless);
+  CompressionToolbox::CompressLossy(data.data(), n, 2, tol, lossy);
+
+  CHECK(lossy.size() < lossless.size());
+
+  std::vector<passivedouble> result(n);
+  REQUIRE(CompressionToolbox::DecompressLossless(lossy.data(), lossy.size(), n, 2, result.data()));
+
+  for (size_t k = 0; k < n; ++k) {
+    if (std::isinf(data[k])) CHECK(result[k] == data[k]);
+    else CHECK(std::abs(result[k] - data[k]) <= tol * std::abs(data[k]));
+  }
+}
+
+TEST_CASE("Compressed restart blocks", "[Toolboxes]") {
+
+  /*--- Two blocks of point-major data, the second field is lossy. ---*/
+
+  const size_t nField = 3, nPoint[] = {100, 50};
+  const passivedouble tolerance[] = {0.0, 1e-3, 0.0};
+
+  std::vector<passivedouble> data((nPoint[0] + nPoint[1]) * nField);
+  for (size_t k = 0; k < data.size(); ++k) data[k] = 1.0 + std::cos(0.1*k);
+
+  CompressionToolbox::CRestartBlockTable table(nField);
+  std::vector<uint8_t> buffer;
+  std::vector<uint64_t> sizes(nField);
+
+  for (size_t iBlock = 0, first = 0; iBlock < 2; first += nPoint[iBlock++]) {
+    const auto offset = buffer.size();
+    CompressionToolbox::CompressBlock(&data[first*nField], nPoint[iBlock], nField, tolerance, buffer, sizes.data());
+    table.AddBlock(first, nPoint[iBlock], offset, sizes.data());
+  }
+
+  REQUIRE(table.GetnBlock() == 2);
+  CHECK(table.Check(150));
+  CHECK_FALSE(table.Check(151));
+  CHECK(table.GetOffset(1) + table.GetSize(1) == buffer.size());
+
+  std::vector<size_t> blocks;
+  const unsigned long points[] = {120, 140};
+  REQUIRE(table.FindBlocks(points, 2, blocks));
+  CHECK(blocks == std::vector<size_t>{1});
+
+  const unsigned long outside[] = {10, 150};
+  CHECK_FALSE(table.FindBlocks(outside, 2, blocks));
+
+  std::vector<passivedouble> result(nPoint[1] * nField);
+  REQUIRE(CompressionToolbox::DecompressBlock(&buffer[table.GetOffset(1)], table.GetFieldSizes(1), nPoint[1],
+                                              nField, result.data()));
+
+  for (size_t iPoint = 0; iPoint < nPoint[1]; ++iPoint) {
+    for (size_t iField = 0; iField < nField; ++iField) {
+      const auto ref = data[(nPoint[0] + iPoint)*nField + iField];
+      CHECK(std::abs(result[iPoint*nField + iField] - ref) <= tolerance[iField] * std::abs(ref));
+    }
+  }
+}
+
+TEST_CASE("Compressed restart file", "[Toolboxes]") {
+
+  /*--- Write a file with three blocks, then read every third point starting at the rank. ---*/
+
+  const int nField = 2, nPoint = 20000, nBlock = 3;
+  const passivedouble tolerance[] = {0.0, 0.0};
+  const std::string filename = "compressed_restart_test.dat";
+
+  std::vector<passivedouble> data(nPoint * nField);
+  for (size_t k = 0; k < data.size(); ++k) data[k] = std::exp(std::sin(1e-3*k));
+
+  CompressionToolbox::CRestartBlockTable table(nField);
+  std::vector<uint8_t> buffer;
+  std::vector<uint64_t> sizes(nField);
+
+  for (int first = 0; first < nPoint; first += CompressionToolbox::RESTART_BLOCK_SIZE) {
+    const int n = std::min<int>(CompressionToolbox::RESTART_BLOCK_SIZE, nPoint - first);
+    const auto offset = buffer.size();
+    CompressionToolbox::CompressBlock(&data[first*nField], n, nField, tolerance, buffer, sizes.data());
+    table.AddBlock(first, n, offset, sizes.data());
+  }
+  REQUIRE(table.GetnBlock() == nBlock);
+
+  const int header[] = {CompressionToolbox::COMPRESSED_RESTART_MAGIC, nField, nPoint, nBlock, 1};
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    FILE* file = fopen(filename.c_str(), "wb");
+    REQUIRE(file);
+    char names[nField][CGNS_STRING_SIZE] = {};
+    strcpy(names[0], "x");
+    strcpy(names[1], "y");
+    fwrite(header, sizeof(int), 5, file);
+    fwrite(names, sizeof(char), nField*CGNS_STRING_SIZE, file);
+    fwrite(table.GetData(), sizeof(uint64_t), table.GetnBlock()*table.GetEntrySize(), file);
+    fwrite(buffer.data(), sizeof(uint8_t), buffer.size(), file);
+    fclose(file);
+  }
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+
+  std::vector<unsigned long> points;
+  for (unsigned long iPoint = SU2_MPI::GetRank(); iPoint < nPoint; iPoint += 3) points.push_back(iPoint);
+
+  std::vector<passivedouble> result(points.size() * nField);
+  CompressionToolbox::ReadRestartBlocks(filename, header, points.data(), points.size(), result.data());
+
+  for (size_t k = 0; k < points.size(); ++k) {
+    for (int iField = 0; iField < nField; ++iField)
+      CHECK(result[k*nField + iField] == data[points[k]*nField + iField]);
+  }
+
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  if (SU2_MPI::GetRank() == MASTER_NODE) remove(filename.c_str());
+}